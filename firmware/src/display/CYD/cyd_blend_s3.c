@@ -0,0 +1,367 @@
+#include "cyd_blend_s3.h"
+
+#if defined(CYD_BLEND_S3) && CYD_BLEND_S3
+
+#include <string.h>
+#if !defined(__XTENSA__)
+#include <assert.h>
+#endif
+
+#define CHUNK_PX 8       // RGB565 pixels per 128-bit PIE register
+#define MIN_VECTOR_PX 16  // narrower rows (glyph spans, borders) stay on LVGL's loops
+
+static volatile bool s_enabled = true;
+static const uint16_t MASK_5BIT = 0x001F;
+static const uint16_t MASK_6BIT = 0x003F;
+
+static inline bool is_aligned16(const void *p) {
+    return ((uintptr_t)p & 0xF) == 0;
+}
+
+static inline bool same_phase16(const void *a, const void *b) {
+    return (((uintptr_t)a ^ (uintptr_t)b) & 0xF) == 0;
+}
+
+// LVGL's lv_color_16_16_mix() works on a 5-bit weight; the vector path uses the same one.
+static inline uint16_t mix_weight(lv_opa_t opa) {
+    return (uint16_t)((opa + 4) >> 3);
+}
+
+// The kernels below expect 16-byte aligned pointers and chunks > 0.
+
+#if defined(__XTENSA__)
+
+// Per channel: bg + ((fg - bg) * weight >> 5), with q1 = fg, q0 = bg, q5/q6 = 5/6-bit masks
+// and q7 = weight. This matches lv_color_16_16_mix() bit for bit. The 32-bit lane shifts
+// move bits across the two 16-bit halves, but the masks drop them again. Result in q4.
+#define PIE_MIX565                                                   \
+    "ee.andq      q2, q1, q5\n"                                      \
+    "ee.andq      q3, q0, q5\n"                                      \
+    "ee.vsubs.s16 q2, q2, q3\n"                                      \
+    "ssai         5\n"                                               \
+    "ee.vmul.s16  q2, q2, q7\n"                                      \
+    "ee.vadds.s16 q4, q2, q3\n" /* blue */                           \
+    "ee.vsr.32    q2, q1\n"                                          \
+    "ee.andq      q2, q2, q6\n"                                      \
+    "ee.vsr.32    q3, q0\n"                                          \
+    "ee.andq      q3, q3, q6\n"                                      \
+    "ee.vsubs.s16 q2, q2, q3\n"                                      \
+    "ee.vmul.s16  q2, q2, q7\n"                                      \
+    "ee.vadds.s16 q2, q2, q3\n"                                      \
+    "ee.vsl.32    q2, q2\n"                                          \
+    "ee.orq       q4, q4, q2\n" /* green */                          \
+    "ssai         11\n"                                              \
+    "ee.vsr.32    q2, q1\n"                                          \
+    "ee.andq      q2, q2, q5\n"                                      \
+    "ee.vsr.32    q3, q0\n"                                          \
+    "ee.andq      q3, q3, q5\n"                                      \
+    "ee.vsubs.s16 q2, q2, q3\n"                                      \
+    "ssai         5\n"                                               \
+    "ee.vmul.s16  q2, q2, q7\n"                                      \
+    "ee.vadds.s16 q2, q2, q3\n"                                      \
+    "ssai         11\n"                                              \
+    "ee.vsl.32    q2, q2\n"                                          \
+    "ee.orq       q4, q4, q2\n" /* red */
+
+static void pie_fill(uint16_t *dst, int32_t chunks, const uint16_t *color) {
+    __asm__ volatile(
+        "ee.vldbc.16     q0, %[c]\n"
+        "1:\n"
+        "ee.vst.128.ip   q0, %[d], 16\n"
+        "addi            %[n], %[n], -1\n"
+        "bnez            %[n], 1b\n"
+        : [d] "+r"(dst), [n] "+r"(chunks)
+        : [c] "r"(color)
+        : "memory");
+}
+
+static void pie_copy(uint16_t *dst, const uint16_t *src, int32_t chunks) {
+    __asm__ volatile(
+        "1:\n"
+        "ee.vld.128.ip   q0, %[s], 16\n"
+        "ee.vst.128.ip   q0, %[d], 16\n"
+        "addi            %[n], %[n], -1\n"
+        "bnez            %[n], 1b\n"
+        : [d] "+r"(dst), [s] "+r"(src), [n] "+r"(chunks)
+        :
+        : "memory");
+}
+
+static void pie_mix_color(uint16_t *dst, int32_t chunks, const uint16_t *color, const uint16_t *weight) {
+    uint16_t *out = dst;
+    __asm__ volatile(
+        "ee.vldbc.16     q1, %[c]\n"
+        "ee.vldbc.16     q5, %[m5]\n"
+        "ee.vldbc.16     q6, %[m6]\n"
+        "ee.vldbc.16     q7, %[w]\n"
+        "1:\n"
+        "ee.vld.128.ip   q0, %[d], 16\n"
+        PIE_MIX565
+        "ee.vst.128.ip   q4, %[o], 16\n"
+        "addi            %[n], %[n], -1\n"
+        "bnez            %[n], 1b\n"
+        : [d] "+r"(dst), [o] "+r"(out), [n] "+r"(chunks)
+        : [c] "r"(color), [w] "r"(weight), [m5] "r"(&MASK_5BIT), [m6] "r"(&MASK_6BIT)
+        : "memory");
+}
+
+static void pie_mix_image(uint16_t *dst, const uint16_t *src, int32_t chunks, const uint16_t *weight) {
+    uint16_t *out = dst;
+    __asm__ volatile(
+        "ee.vldbc.16     q5, %[m5]\n"
+        "ee.vldbc.16     q6, %[m6]\n"
+        "ee.vldbc.16     q7, %[w]\n"
+        "1:\n"
+        "ee.vld.128.ip   q0, %[d], 16\n"
+        "ee.vld.128.ip   q1, %[s], 16\n"
+        PIE_MIX565
+        "ee.vst.128.ip   q4, %[o], 16\n"
+        "addi            %[n], %[n], -1\n"
+        "bnez            %[n], 1b\n"
+        : [d] "+r"(dst), [s] "+r"(src), [o] "+r"(out), [n] "+r"(chunks)
+        : [w] "r"(weight), [m5] "r"(&MASK_5BIT), [m6] "r"(&MASK_6BIT)
+        : "memory");
+}
+
+#else  // host builds (test/test_blend_s3)
+
+// The kernels' lane arithmetic in C, so the row splitting around them and the mix formula can be
+// checked against LVGL's loops off the device; the asserts catch a split that leaves a kernel
+// misaligned. Per 16-bit lane and channel: the signed difference times the weight, shifted right
+// by 5 (ee.vmul.s16 with SAR 5), plus the background.
+static uint16_t lane_mix565(uint16_t fg, uint16_t bg, uint16_t weight) {
+    static const uint8_t shift[3] = {0, 5, 11};
+    const uint16_t mask[3] = {MASK_5BIT, MASK_6BIT, MASK_5BIT};
+    uint16_t out = 0;
+    for (int c = 0; c < 3; c++) {
+        const int16_t f = (int16_t)((fg >> shift[c]) & mask[c]);
+        const int16_t b = (int16_t)((bg >> shift[c]) & mask[c]);
+        const int16_t mixed = (int16_t)((((int32_t)(int16_t)(f - b) * (int16_t)weight) >> 5) + b);
+        out |= (uint16_t)((uint16_t)mixed << shift[c]);
+    }
+    return out;
+}
+
+static void pie_fill(uint16_t *dst, int32_t chunks, const uint16_t *color) {
+    assert(is_aligned16(dst) && chunks > 0);
+    for (int32_t i = 0; i < chunks * CHUNK_PX; i++) dst[i] = *color;
+}
+
+static void pie_copy(uint16_t *dst, const uint16_t *src, int32_t chunks) {
+    assert(is_aligned16(dst) && is_aligned16(src) && chunks > 0);
+    memcpy(dst, src, (size_t)chunks * CHUNK_PX * sizeof(uint16_t));
+}
+
+static void pie_mix_color(uint16_t *dst, int32_t chunks, const uint16_t *color, const uint16_t *weight) {
+    assert(is_aligned16(dst) && chunks > 0);
+    for (int32_t i = 0; i < chunks * CHUNK_PX; i++) dst[i] = lane_mix565(*color, dst[i], *weight);
+}
+
+static void pie_mix_image(uint16_t *dst, const uint16_t *src, int32_t chunks, const uint16_t *weight) {
+    assert(is_aligned16(dst) && is_aligned16(src) && chunks > 0);
+    for (int32_t i = 0; i < chunks * CHUNK_PX; i++) dst[i] = lane_mix565(src[i], dst[i], *weight);
+}
+
+#endif  // __XTENSA__
+
+lv_result_t cyd_blend_s3_color_to_rgb565(_lv_draw_sw_blend_fill_dsc_t *dsc) {
+    if (!s_enabled || dsc->dest_w < MIN_VECTOR_PX) return LV_RESULT_INVALID;
+    const uint16_t color = lv_color_to_u16(dsc->color);
+    uint8_t *row = (uint8_t *)dsc->dest_buf;
+    for (int32_t y = 0; y < dsc->dest_h; y++) {
+        uint16_t *d = (uint16_t *)row;
+        int32_t n = dsc->dest_w;
+        while (n > 0 && !is_aligned16(d)) {
+            *d++ = color;
+            n--;
+        }
+        const int32_t chunks = n / CHUNK_PX;
+        if (chunks > 0) {
+            pie_fill(d, chunks, &color);
+            d += chunks * CHUNK_PX;
+            n -= chunks * CHUNK_PX;
+        }
+        while (n-- > 0) *d++ = color;
+        row += dsc->dest_stride;
+    }
+    return LV_RESULT_OK;
+}
+
+lv_result_t cyd_blend_s3_color_to_rgb565_with_opa(_lv_draw_sw_blend_fill_dsc_t *dsc) {
+    if (!s_enabled || dsc->dest_w < MIN_VECTOR_PX) return LV_RESULT_INVALID;
+    const uint16_t color = lv_color_to_u16(dsc->color);
+    const uint16_t weight = mix_weight(dsc->opa);
+    const lv_opa_t opa = dsc->opa;
+    uint8_t *row = (uint8_t *)dsc->dest_buf;
+    for (int32_t y = 0; y < dsc->dest_h; y++) {
+        uint16_t *d = (uint16_t *)row;
+        int32_t n = dsc->dest_w;
+        while (n > 0 && !is_aligned16(d)) {
+            *d = lv_color_16_16_mix(color, *d, opa);
+            d++;
+            n--;
+        }
+        const int32_t chunks = n / CHUNK_PX;
+        if (chunks > 0) {
+            pie_mix_color(d, chunks, &color, &weight);
+            d += chunks * CHUNK_PX;
+            n -= chunks * CHUNK_PX;
+        }
+        for (; n > 0; n--, d++) *d = lv_color_16_16_mix(color, *d, opa);
+        row += dsc->dest_stride;
+    }
+    return LV_RESULT_OK;
+}
+
+lv_result_t cyd_blend_s3_rgb565_to_rgb565(_lv_draw_sw_blend_image_dsc_t *dsc) {
+    if (!s_enabled || dsc->dest_w < MIN_VECTOR_PX) return LV_RESULT_INVALID;
+    uint8_t *dest_row = (uint8_t *)dsc->dest_buf;
+    const uint8_t *src_row = (const uint8_t *)dsc->src_buf;
+    for (int32_t y = 0; y < dsc->dest_h; y++) {
+        uint16_t *d = (uint16_t *)dest_row;
+        const uint16_t *s = (const uint16_t *)src_row;
+        int32_t n = dsc->dest_w;
+        if (same_phase16(d, s)) {
+            while (n > 0 && !is_aligned16(d)) {
+                *d++ = *s++;
+                n--;
+            }
+            const int32_t chunks = n / CHUNK_PX;
+            if (chunks > 0) {
+                pie_copy(d, s, chunks);
+                d += chunks * CHUNK_PX;
+                s += chunks * CHUNK_PX;
+                n -= chunks * CHUNK_PX;
+            }
+        }
+        memcpy(d, s, (size_t)n * sizeof(uint16_t));
+        dest_row += dsc->dest_stride;
+        src_row += dsc->src_stride;
+    }
+    return LV_RESULT_OK;
+}
+
+lv_result_t cyd_blend_s3_rgb565_to_rgb565_with_opa(_lv_draw_sw_blend_image_dsc_t *dsc) {
+    if (!s_enabled || dsc->dest_w < MIN_VECTOR_PX) return LV_RESULT_INVALID;
+    const uint16_t weight = mix_weight(dsc->opa);
+    const lv_opa_t opa = dsc->opa;
+    uint8_t *dest_row = (uint8_t *)dsc->dest_buf;
+    const uint8_t *src_row = (const uint8_t *)dsc->src_buf;
+    for (int32_t y = 0; y < dsc->dest_h; y++) {
+        uint16_t *d = (uint16_t *)dest_row;
+        const uint16_t *s = (const uint16_t *)src_row;
+        int32_t n = dsc->dest_w;
+        if (same_phase16(d, s)) {
+            while (n > 0 && !is_aligned16(d)) {
+                *d = lv_color_16_16_mix(*s++, *d, opa);
+                d++;
+                n--;
+            }
+            const int32_t chunks = n / CHUNK_PX;
+            if (chunks > 0) {
+                pie_mix_image(d, s, chunks, &weight);
+                d += chunks * CHUNK_PX;
+                s += chunks * CHUNK_PX;
+                n -= chunks * CHUNK_PX;
+            }
+        }
+        for (; n > 0; n--, d++, s++) *d = lv_color_16_16_mix(*s, *d, opa);
+        dest_row += dsc->dest_stride;
+        src_row += dsc->src_stride;
+    }
+    return LV_RESULT_OK;
+}
+
+void cyd_blend_s3_set_enabled(bool enabled) {
+    s_enabled = enabled;
+}
+
+bool cyd_blend_s3_enabled(void) {
+    return s_enabled;
+}
+
+// Self-test geometry: a few rows of a width that leaves both an unaligned head and a tail.
+#define TEST_STRIDE_PX 56
+#define TEST_ROWS 3
+#define TEST_W 43
+#define TEST_BUF_PX (TEST_STRIDE_PX * TEST_ROWS + CHUNK_PX)
+
+static uint32_t s_rng = 0x1234567u;
+
+static uint16_t next_pixel(void) {
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return (uint16_t)s_rng;
+}
+
+static uint32_t count_mismatches(const uint16_t *a, const uint16_t *b) {
+    uint32_t bad = 0;
+    for (uint32_t i = 0; i < TEST_BUF_PX; i++) {
+        if (a[i] != b[i]) bad++;
+    }
+    return bad;
+}
+
+uint32_t cyd_blend_s3_selftest(void) {
+    static uint16_t ref[TEST_BUF_PX] __attribute__((aligned(16)));
+    static uint16_t out[TEST_BUF_PX] __attribute__((aligned(16)));
+    static uint16_t src[TEST_BUF_PX] __attribute__((aligned(16)));
+    static uint16_t bg[TEST_BUF_PX] __attribute__((aligned(16)));
+    static const lv_opa_t opas[] = {LV_OPA_COVER, LV_OPA_0, LV_OPA_10, LV_OPA_50, 200};
+    const bool was_enabled = s_enabled;
+    uint32_t bad = 0;
+
+    for (uint32_t i = 0; i < TEST_BUF_PX; i++) {
+        src[i] = next_pixel();
+        bg[i] = next_pixel();
+    }
+
+    // Destination offsets cover every 16-byte phase; source offsets both match and miss it.
+    for (int32_t dest_off = 0; dest_off < CHUNK_PX; dest_off++) {
+        for (int32_t src_off = 0; src_off < 2; src_off++) {
+            for (uint32_t o = 0; o < sizeof(opas) / sizeof(opas[0]); o++) {
+                for (int pass = 0; pass < 4; pass++) {
+                    const lv_opa_t opa = (pass & 1) ? opas[o] : LV_OPA_COVER;
+                    const lv_color_t color = lv_color_hex(s_rng & 0xFFFFFF);
+                    for (int variant = 0; variant < 2; variant++) {
+                        uint16_t *dest = variant == 0 ? ref : out;
+                        memcpy(dest, bg, sizeof(bg));
+                        s_enabled = variant == 1;
+                        if (pass < 2) {
+                            _lv_draw_sw_blend_fill_dsc_t fill;
+                            memset(&fill, 0, sizeof(fill));
+                            fill.dest_buf = dest + dest_off;
+                            fill.dest_w = TEST_W;
+                            fill.dest_h = TEST_ROWS;
+                            fill.dest_stride = TEST_STRIDE_PX * sizeof(uint16_t);
+                            fill.color = color;
+                            fill.opa = opa;
+                            lv_draw_sw_blend_color_to_rgb565(&fill);
+                        } else {
+                            _lv_draw_sw_blend_image_dsc_t img;
+                            memset(&img, 0, sizeof(img));
+                            img.dest_buf = dest + dest_off;
+                            img.dest_w = TEST_W;
+                            img.dest_h = TEST_ROWS;
+                            img.dest_stride = TEST_STRIDE_PX * sizeof(uint16_t);
+                            img.src_buf = src + dest_off + src_off;
+                            img.src_stride = TEST_STRIDE_PX * sizeof(uint16_t);
+                            img.src_color_format = LV_COLOR_FORMAT_RGB565;
+                            img.blend_mode = LV_BLEND_MODE_NORMAL;
+                            img.opa = opa;
+                            lv_draw_sw_blend_image_to_rgb565(&img);
+                        }
+                    }
+                    next_pixel();
+                    bad += count_mismatches(ref, out);
+                }
+            }
+        }
+    }
+
+    s_enabled = was_enabled && bad == 0;
+    return bad;
+}
+
+#endif  // CYD_BLEND_S3
@@ -0,0 +1,44 @@
+#ifndef CYD_BLEND_S3_H
+#define CYD_BLEND_S3_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <lvgl.h>
+#include <src/draw/sw/blend/lv_draw_sw_blend_to_rgb565.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// RGB565 blend loops for LVGL's software renderer using the ESP32-S3 PIE vector unit (eight
+// pixels per 128-bit register). lv_conf.h includes this header as LVGL's custom draw_sw asm
+// backend when tools/strip_lvgl.py sets CYD_BLEND_S3, which it only does for S3 boards.
+// Each hook returns LV_RESULT_INVALID for cases it does not cover, and LVGL then runs its own
+// scalar loop.
+
+#if defined(CYD_BLEND_S3) && CYD_BLEND_S3
+
+lv_result_t cyd_blend_s3_color_to_rgb565(_lv_draw_sw_blend_fill_dsc_t *dsc);
+lv_result_t cyd_blend_s3_color_to_rgb565_with_opa(_lv_draw_sw_blend_fill_dsc_t *dsc);
+lv_result_t cyd_blend_s3_rgb565_to_rgb565(_lv_draw_sw_blend_image_dsc_t *dsc);
+lv_result_t cyd_blend_s3_rgb565_to_rgb565_with_opa(_lv_draw_sw_blend_image_dsc_t *dsc);
+
+// Route blends to LVGL's scalar loops when false (benchmarks, failed self-test).
+void cyd_blend_s3_set_enabled(bool enabled);
+bool cyd_blend_s3_enabled(void);
+// Compare every hook against LVGL's scalar loops on odd sizes and offsets. Returns the number
+// of mismatching pixels; the backend disables itself when it is not zero.
+uint32_t cyd_blend_s3_selftest(void);
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565(dsc)                   cyd_blend_s3_color_to_rgb565(dsc)
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc)          cyd_blend_s3_color_to_rgb565_with_opa(dsc)
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565(dsc)           cyd_blend_s3_rgb565_to_rgb565(dsc)
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  cyd_blend_s3_rgb565_to_rgb565_with_opa(dsc)
+
+#endif  // CYD_BLEND_S3
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // CYD_BLEND_S3_H
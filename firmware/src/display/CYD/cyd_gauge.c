@@ -0,0 +1,675 @@
+#include "cyd_gauge.h"
+
+#include <math.h>
+#include <string.h>
+#include <esp_heap_caps.h>
+
+#define GEOMETRY_MAX 4
+#define THR_NONE 0xFF                        // pixel outside the track
+#define INTERNAL_RESERVE_BYTES (48 * 1024)   // sprites only use internal RAM above this
+
+// Everything the sprites depend on; two gauges with equal keys share one geometry.
+typedef struct {
+    cyd_gauge_shape_t shape;
+    int32_t w;
+    int32_t h;
+    int32_t pad_left;
+    int32_t pad_right;
+    int32_t pad_top;
+    int32_t pad_bottom;
+    int32_t arc_width;
+    int32_t angle_start;
+    int32_t angle_end;
+    int32_t radius;
+    lv_dir_t dir;
+    bool rounded;
+} geom_key_t;
+
+typedef struct {
+    geom_key_t key;
+    uint8_t refs;               // 0: slot free
+    lv_area_t area;             // sprite area relative to the object
+    uint8_t *cov;               // track sprite (coverage)
+    uint8_t *thr;               // step from which each pixel belongs to the fill, THR_NONE outside
+    lv_area_t *step_area;       // pixels of each step, relative to the sprite
+    lv_image_dsc_t track;
+} geometry_t;
+
+typedef struct {
+    lv_obj_t obj;
+    cyd_gauge_shape_t shape;
+    int32_t min;
+    int32_t max;
+    int32_t value;
+    int32_t angle_start;
+    int32_t angle_end;
+    lv_dir_t dir;
+    uint8_t step;               // step shown by the indicator sprite
+    bool geom_dirty;            // size or styles changed; check the key before the next draw
+    geometry_t *geom;
+    uint8_t *ind;
+    lv_image_dsc_t indicator;
+} cyd_gauge_t;
+
+// Shape parameters in object pixel coordinates, derived from a key.
+typedef struct {
+    float cx;
+    float cy;
+    float mid_r;     // arc: centre line radius
+    float half;      // arc: half line width
+    float start;     // arc: degrees
+    float sweep;
+    float cap[2][2]; // arc: centres of the rounded ends
+    float ext_x;     // bar: half extents minus the corner radius
+    float ext_y;
+    float corner;
+} shape_t;
+
+static void cyd_gauge_constructor(const lv_obj_class_t *class_p, lv_obj_t *obj);
+static void cyd_gauge_destructor(const lv_obj_class_t *class_p, lv_obj_t *obj);
+static void cyd_gauge_event(const lv_obj_class_t *class_p, lv_event_t *e);
+
+static const lv_obj_class_t cyd_gauge_class = {
+    .base_class = &lv_obj_class,
+    .constructor_cb = cyd_gauge_constructor,
+    .destructor_cb = cyd_gauge_destructor,
+    .event_cb = cyd_gauge_event,
+    .instance_size = sizeof(cyd_gauge_t),
+    .name = "cyd_gauge",
+};
+
+static geometry_t s_geoms[GEOMETRY_MAX];
+
+static void *alloc_sprite(size_t size) {
+    void *p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (p) return p;
+    if (heap_caps_get_free_size(MALLOC_CAP_INTERNAL) < size + INTERNAL_RESERVE_BYTES) return NULL;
+    return heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+}
+
+static void image_init(lv_image_dsc_t *img, const lv_area_t *area, const uint8_t *data) {
+    memset(img, 0, sizeof(*img));
+    img->header.magic = LV_IMAGE_HEADER_MAGIC;
+    img->header.cf = LV_COLOR_FORMAT_A8;
+    img->header.w = lv_area_get_width(area);
+    img->header.h = lv_area_get_height(area);
+    img->header.stride = img->header.w;
+    img->data_size = (uint32_t)img->header.w * img->header.h;
+    img->data = data;
+}
+
+static void shape_init(const geom_key_t *key, shape_t *s) {
+    memset(s, 0, sizeof(*s));
+    if (key->shape == CYD_GAUGE_ARC) {
+        // Same centre and radius as lv_arc: the largest circle in the padded box, top-left aligned.
+        const int32_t r = LV_MIN(key->w - key->pad_left - key->pad_right, key->h - key->pad_top - key->pad_bottom) / 2;
+        const int32_t width = LV_MIN(key->arc_width, r);
+        int32_t sweep = key->angle_end - key->angle_start;
+        while (sweep <= 0) sweep += 360;
+        if (sweep > 360) sweep = 360;
+        s->cx = (float)(key->pad_left + r);
+        s->cy = (float)(key->pad_top + r);
+        s->half = width / 2.0f;
+        s->mid_r = r - s->half;
+        s->start = (float)key->angle_start;
+        s->sweep = (float)sweep;
+        for (int i = 0; i < 2; i++) {
+            const float a = (s->start + i * s->sweep) * ((float)M_PI / 180.0f);
+            s->cap[i][0] = s->cx + s->mid_r * cosf(a);
+            s->cap[i][1] = s->cy + s->mid_r * sinf(a);
+        }
+    } else {
+        const float corner = (float)LV_MIN(key->radius, LV_MIN(key->w, key->h) / 2);
+        s->cx = (key->w - 1) / 2.0f;
+        s->cy = (key->h - 1) / 2.0f;
+        s->corner = corner;
+        s->ext_x = key->w / 2.0f - corner;
+        s->ext_y = key->h / 2.0f - corner;
+    }
+}
+
+// Coverage of pixel (x, y) of the object, and the step from which it belongs to the fill.
+static uint8_t sample(const geom_key_t *key, const shape_t *s, int32_t x, int32_t y, uint8_t *thr) {
+    float dist;  // signed distance to the track outline, negative inside
+    float pos;   // position along the fill, 0..1
+    if (key->shape == CYD_GAUGE_ARC) {
+        const float dx = x - s->cx;
+        const float dy = y - s->cy;
+        float rel = atan2f(dy, dx) * (180.0f / (float)M_PI) - s->start;
+        while (rel < 0.0f) rel += 360.0f;
+        while (rel >= 360.0f) rel -= 360.0f;
+        if (rel <= s->sweep) {
+            dist = fabsf(sqrtf(dx * dx + dy * dy) - s->mid_r) - s->half;
+            pos = rel / s->sweep;
+        } else {
+            if (!key->rounded) return 0;
+            const float d0 = hypotf(x - s->cap[0][0], y - s->cap[0][1]);
+            const float d1 = hypotf(x - s->cap[1][0], y - s->cap[1][1]);
+            dist = fminf(d0, d1) - s->half;
+            pos = d1 < d0 ? 1.0f : 0.0f;
+        }
+    } else {
+        const float qx = fabsf(x - s->cx) - s->ext_x;
+        const float qy = fabsf(y - s->cy) - s->ext_y;
+        dist = hypotf(fmaxf(qx, 0.0f), fmaxf(qy, 0.0f)) + fminf(fmaxf(qx, qy), 0.0f) - s->corner;
+        switch (key->dir) {
+            case LV_DIR_TOP: pos = (key->h - y - 0.5f) / key->h; break;
+            case LV_DIR_BOTTOM: pos = (y + 0.5f) / key->h; break;
+            case LV_DIR_LEFT: pos = (key->w - x - 0.5f) / key->w; break;
+            default: pos = (x + 0.5f) / key->w; break;
+        }
+    }
+    const float cov = 0.5f - dist;
+    if (cov <= 0.0f) return 0;
+    int32_t step = (int32_t)(pos * CYD_GAUGE_STEPS);
+    *thr = (uint8_t)LV_CLAMP(0, step, CYD_GAUGE_STEPS - 1);
+    return cov >= 1.0f ? LV_OPA_COVER : (uint8_t)(cov * 255.0f + 0.5f);
+}
+
+static void area_add_point(lv_area_t *area, int32_t x, int32_t y) {
+    if (area->x1 > area->x2) {
+        area->x1 = area->x2 = x;
+        area->y1 = area->y2 = y;
+        return;
+    }
+    area->x1 = LV_MIN(area->x1, x);
+    area->y1 = LV_MIN(area->y1, y);
+    area->x2 = LV_MAX(area->x2, x);
+    area->y2 = LV_MAX(area->y2, y);
+}
+
+static void area_set_empty(lv_area_t *area) {
+    area->x1 = area->y1 = 0;
+    area->x2 = area->y2 = -1;
+}
+
+static geometry_t *build_geometry(const geom_key_t *key) {
+    geometry_t *geom = NULL;
+    for (uint8_t i = 0; i < GEOMETRY_MAX && !geom; i++) {
+        if (s_geoms[i].refs == 0) geom = &s_geoms[i];
+    }
+    if (!geom || key->w <= 0 || key->h <= 0) return NULL;
+
+    shape_t shape;
+    shape_init(key, &shape);
+    uint8_t thr;
+    lv_area_t box;
+    area_set_empty(&box);
+    for (int32_t y = 0; y < key->h; y++) {
+        for (int32_t x = 0; x < key->w; x++) {
+            if (sample(key, &shape, x, y, &thr)) area_add_point(&box, x, y);
+        }
+    }
+    if (box.x1 > box.x2) return NULL;
+
+    const size_t px = (size_t)lv_area_get_size(&box);
+    const size_t planes = (2 * px + 3) & ~(size_t)3;
+    uint8_t *mem = (uint8_t *)alloc_sprite(planes + CYD_GAUGE_STEPS * sizeof(lv_area_t));
+    if (!mem) return NULL;
+
+    memset(geom, 0, sizeof(*geom));
+    geom->key = *key;
+    geom->area = box;
+    geom->cov = mem;
+    geom->thr = mem + px;
+    geom->step_area = (lv_area_t *)(mem + planes);
+    for (uint32_t i = 0; i < CYD_GAUGE_STEPS; i++) area_set_empty(&geom->step_area[i]);
+
+    const int32_t w = lv_area_get_width(&box);
+    for (int32_t y = box.y1; y <= box.y2; y++) {
+        for (int32_t x = box.x1; x <= box.x2; x++) {
+            const size_t i = (size_t)(y - box.y1) * w + (x - box.x1);
+            geom->cov[i] = sample(key, &shape, x, y, &thr);
+            geom->thr[i] = geom->cov[i] ? thr : THR_NONE;
+            if (geom->cov[i]) area_add_point(&geom->step_area[thr], x - box.x1, y - box.y1);
+        }
+    }
+    image_init(&geom->track, &box, geom->cov);
+    return geom;
+}
+
+static geometry_t *acquire_geometry(const geom_key_t *key) {
+    for (uint8_t i = 0; i < GEOMETRY_MAX; i++) {
+        if (s_geoms[i].refs && memcmp(&s_geoms[i].key, key, sizeof(*key)) == 0) {
+            s_geoms[i].refs++;
+            return &s_geoms[i];
+        }
+    }
+    geometry_t *geom = build_geometry(key);
+    if (geom) geom->refs = 1;
+    return geom;
+}
+
+static void release_geometry(geometry_t *geom) {
+    if (!geom || --geom->refs) return;
+    heap_caps_free(geom->cov);
+    memset(geom, 0, sizeof(*geom));
+}
+
+static void read_key(const cyd_gauge_t *g, geom_key_t *key) {
+    const lv_obj_t *obj = &g->obj;
+    memset(key, 0, sizeof(*key));  // keys are compared with memcmp
+    key->shape = g->shape;
+    key->w = lv_obj_get_width(obj);
+    key->h = lv_obj_get_height(obj);
+    if (g->shape == CYD_GAUGE_ARC) {
+        key->pad_left = lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
+        key->pad_right = lv_obj_get_style_pad_right(obj, LV_PART_MAIN);
+        key->pad_top = lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
+        key->pad_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_MAIN);
+        key->arc_width = lv_obj_get_style_arc_width(obj, LV_PART_MAIN);
+        key->rounded = lv_obj_get_style_arc_rounded(obj, LV_PART_MAIN);
+        key->angle_start = g->angle_start;
+        key->angle_end = g->angle_end;
+    } else {
+        key->radius = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+        key->dir = g->dir;
+    }
+}
+
+static uint8_t value_to_step(const cyd_gauge_t *g, int32_t value) {
+    const int32_t range = g->max - g->min;
+    if (range <= 0) return 0;
+    return (uint8_t)(((int64_t)(value - g->min) * CYD_GAUGE_STEPS * 2 + range) / (2 * range));
+}
+
+// Bring the indicator sprite to step `to` in the pixels of the steps between `from` and `to`.
+// Returns false when none of them is on the track.
+static bool update_indicator(cyd_gauge_t *g, uint8_t from, uint8_t to, lv_area_t *changed) {
+    const geometry_t *geom = g->geom;
+    area_set_empty(changed);
+    for (uint8_t s = LV_MIN(from, to); s < LV_MAX(from, to); s++) {
+        const lv_area_t *a = &geom->step_area[s];
+        if (a->x1 > a->x2) continue;
+        area_add_point(changed, a->x1, a->y1);
+        area_add_point(changed, a->x2, a->y2);
+    }
+    if (changed->x1 > changed->x2) return false;
+
+    const int32_t stride = lv_area_get_width(&geom->area);
+    for (int32_t y = changed->y1; y <= changed->y2; y++) {
+        const size_t row = (size_t)y * stride;
+        for (int32_t x = changed->x1; x <= changed->x2; x++) {
+            g->ind[row + x] = geom->thr[row + x] < to ? geom->cov[row + x] : 0;
+        }
+    }
+    return true;
+}
+
+static void refill_indicator(cyd_gauge_t *g) {
+    const size_t px = (size_t)lv_area_get_size(&g->geom->area);
+    for (size_t i = 0; i < px; i++) g->ind[i] = g->geom->thr[i] < g->step ? g->geom->cov[i] : 0;
+}
+
+// Make sure the sprites match the current size and styles. Returns false when they could not
+// be allocated; the gauge then draws with LVGL's own primitives.
+static bool ensure_geometry(cyd_gauge_t *g) {
+    if (g->geom && !g->geom_dirty) return true;
+    g->geom_dirty = false;
+    geom_key_t key;
+    read_key(g, &key);
+    if (g->geom && memcmp(&g->geom->key, &key, sizeof(key)) == 0) return true;
+
+    const size_t old_px = g->geom ? (size_t)lv_area_get_size(&g->geom->area) : 0;
+    release_geometry(g->geom);
+    g->geom = acquire_geometry(&key);
+    if (!g->geom) {
+        heap_caps_free(g->ind);
+        g->ind = NULL;
+        return false;
+    }
+    const size_t px = (size_t)lv_area_get_size(&g->geom->area);
+    if (!g->ind || px != old_px) {
+        heap_caps_free(g->ind);
+        g->ind = (uint8_t *)alloc_sprite(px);
+        if (!g->ind) {
+            release_geometry(g->geom);
+            g->geom = NULL;
+            return false;
+        }
+    }
+    refill_indicator(g);
+    image_init(&g->indicator, &g->geom->area, g->ind);
+    return true;
+}
+
+static void part_color(const lv_obj_t *obj, cyd_gauge_shape_t shape, lv_part_t part, lv_color_t *color,
+                       lv_opa_t *opa) {
+    if (shape == CYD_GAUGE_ARC) {
+        *color = lv_obj_get_style_arc_color(obj, part);
+        *opa = lv_obj_get_style_arc_opa(obj, part);
+    } else {
+        *color = lv_obj_get_style_bg_color(obj, part);
+        *opa = lv_obj_get_style_bg_opa(obj, part);
+    }
+    *opa = LV_OPA_MIX2(*opa, lv_obj_get_style_opa_recursive(obj, part));
+}
+
+// Without sprites: the stock arc, or a track and a fill rectangle.
+static void draw_fallback(cyd_gauge_t *g, lv_layer_t *layer) {
+    lv_obj_t *obj = &g->obj;
+    const uint8_t step = g->step;
+    if (g->shape == CYD_GAUGE_ARC) {
+        geom_key_t key;
+        shape_t s;
+        read_key(g, &key);
+        shape_init(&key, &s);
+        lv_draw_arc_dsc_t dsc;
+        lv_draw_arc_dsc_init(&dsc);
+        lv_obj_init_draw_arc_dsc(obj, LV_PART_MAIN, &dsc);
+        dsc.center.x = obj->coords.x1 + (int32_t)s.cx;
+        dsc.center.y = obj->coords.y1 + (int32_t)s.cy;
+        dsc.radius = (uint16_t)(s.mid_r + s.half);
+        dsc.start_angle = s.start;
+        dsc.end_angle = s.start + s.sweep;
+        lv_draw_arc(layer, &dsc);
+        if (step == 0) return;
+        lv_obj_init_draw_arc_dsc(obj, LV_PART_INDICATOR, &dsc);
+        dsc.end_angle = s.start + s.sweep * step / CYD_GAUGE_STEPS;
+        lv_draw_arc(layer, &dsc);
+        return;
+    }
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    lv_obj_init_draw_rect_dsc(obj, LV_PART_MAIN, &dsc);
+    lv_draw_rect(layer, &dsc, &obj->coords);
+    if (step == 0) return;
+    lv_area_t fill = obj->coords;
+    const int32_t w = lv_area_get_width(&fill) * step / CYD_GAUGE_STEPS;
+    const int32_t h = lv_area_get_height(&fill) * step / CYD_GAUGE_STEPS;
+    switch (g->dir) {
+        case LV_DIR_TOP: fill.y1 = fill.y2 - h + 1; break;
+        case LV_DIR_BOTTOM: fill.y2 = fill.y1 + h - 1; break;
+        case LV_DIR_LEFT: fill.x1 = fill.x2 - w + 1; break;
+        default: fill.x2 = fill.x1 + w - 1; break;
+    }
+    lv_draw_rect_dsc_init(&dsc);
+    lv_obj_init_draw_rect_dsc(obj, LV_PART_INDICATOR, &dsc);
+    lv_draw_rect(layer, &dsc, &fill);
+}
+
+static void draw_gauge(lv_event_t *e) {
+    cyd_gauge_t *g = (cyd_gauge_t *)lv_event_get_current_target(e);
+    lv_obj_t *obj = &g->obj;
+    lv_layer_t *layer = lv_event_get_layer(e);
+    if (!ensure_geometry(g)) {
+        draw_fallback(g, layer);
+        return;
+    }
+
+    lv_area_t area = g->geom->area;
+    lv_area_move(&area, obj->coords.x1, obj->coords.y1);
+    lv_color_t track_color, fill_color;
+    lv_opa_t track_opa, fill_opa;
+    part_color(obj, g->shape, LV_PART_MAIN, &track_color, &track_opa);
+    part_color(obj, g->shape, LV_PART_INDICATOR, &fill_color, &fill_opa);
+
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    // A8 images are blended in the recolour. The track is drawn under the fill even where it is
+    // covered, so partial redraws of the anti-aliased edges match full ones.
+    if (track_opa > LV_OPA_MIN) {
+        dsc.src = &g->geom->track;
+        dsc.recolor = track_color;
+        dsc.opa = track_opa;
+        lv_draw_image(layer, &dsc, &area);
+    }
+    if (fill_opa > LV_OPA_MIN && g->step > 0) {
+        dsc.src = &g->indicator;
+        dsc.recolor = fill_color;
+        dsc.opa = fill_opa;
+        lv_draw_image(layer, &dsc, &area);
+    }
+}
+
+static void cyd_gauge_constructor(const lv_obj_class_t *class_p, lv_obj_t *obj) {
+    LV_UNUSED(class_p);
+    cyd_gauge_t *g = (cyd_gauge_t *)obj;
+    g->shape = CYD_GAUGE_ARC;
+    g->min = 0;
+    g->max = 100;
+    g->value = 0;
+    g->angle_start = 135;
+    g->angle_end = 45;
+    g->dir = LV_DIR_RIGHT;
+    g->step = 0;
+    g->geom_dirty = true;
+    g->geom = NULL;
+    g->ind = NULL;
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_SCROLL_ON_FOCUS);
+}
+
+static void cyd_gauge_destructor(const lv_obj_class_t *class_p, lv_obj_t *obj) {
+    LV_UNUSED(class_p);
+    cyd_gauge_t *g = (cyd_gauge_t *)obj;
+    release_geometry(g->geom);
+    g->geom = NULL;
+    heap_caps_free(g->ind);
+    g->ind = NULL;
+}
+
+static void cyd_gauge_event(const lv_obj_class_t *class_p, lv_event_t *e) {
+    LV_UNUSED(class_p);
+    const lv_event_code_t code = lv_event_get_code(e);
+    // The sprites stand in for the base object's background, border and shadow.
+    if (code == LV_EVENT_DRAW_MAIN) {
+        draw_gauge(e);
+        return;
+    }
+    if (code == LV_EVENT_COVER_CHECK) {
+        lv_event_set_cover_res(e, LV_COVER_RES_NOT_COVER);
+        return;
+    }
+    if (lv_obj_event_base(&cyd_gauge_class, e) != LV_RESULT_OK) return;
+    if (code == LV_EVENT_SIZE_CHANGED || code == LV_EVENT_STYLE_CHANGED) {
+        cyd_gauge_t *g = (cyd_gauge_t *)lv_event_get_current_target(e);
+        g->geom_dirty = true;
+    }
+}
+
+static cyd_gauge_t *as_gauge(const lv_obj_t *obj) {
+    return obj && lv_obj_check_type(obj, &cyd_gauge_class) ? (cyd_gauge_t *)obj : NULL;
+}
+
+static void reshape(cyd_gauge_t *g) {
+    g->geom_dirty = true;
+    lv_obj_invalidate(&g->obj);
+}
+
+lv_obj_t *cyd_gauge_create(lv_obj_t *parent, cyd_gauge_shape_t shape) {
+    lv_obj_t *obj = lv_obj_class_create_obj(&cyd_gauge_class, parent);
+    lv_obj_class_init_obj(obj);
+    ((cyd_gauge_t *)obj)->shape = shape;
+    return obj;
+}
+
+void cyd_gauge_set_angles(lv_obj_t *obj, int32_t start, int32_t end) {
+    cyd_gauge_t *g = as_gauge(obj);
+    if (!g || (g->angle_start == start && g->angle_end == end)) return;
+    g->angle_start = start;
+    g->angle_end = end;
+    reshape(g);
+}
+
+void cyd_gauge_set_fill_dir(lv_obj_t *obj, lv_dir_t dir) {
+    cyd_gauge_t *g = as_gauge(obj);
+    if (!g || g->dir == dir) return;
+    g->dir = dir;
+    reshape(g);
+}
+
+void cyd_gauge_set_range(lv_obj_t *obj, int32_t min, int32_t max) {
+    cyd_gauge_t *g = as_gauge(obj);
+    if (!g || max <= min || (g->min == min && g->max == max)) return;
+    g->min = min;
+    g->max = max;
+    g->value = LV_CLAMP(min, g->value, max);
+    g->step = value_to_step(g, g->value);
+    if (g->geom) refill_indicator(g);
+    lv_obj_invalidate(obj);
+}
+
+void cyd_gauge_set_value(lv_obj_t *obj, int32_t value) {
+    if (!obj) return;
+#if LV_USE_ARC
+    if (lv_obj_check_type(obj, &lv_arc_class)) {
+        lv_arc_set_value(obj, value);
+        return;
+    }
+#endif
+#if LV_USE_BAR
+    if (lv_obj_check_type(obj, &lv_bar_class)) {
+        lv_bar_set_value(obj, value, LV_ANIM_OFF);
+        return;
+    }
+#endif
+    cyd_gauge_t *g = as_gauge(obj);
+    if (!g) return;
+    value = LV_CLAMP(g->min, value, g->max);
+    if (value == g->value) return;
+    g->value = value;
+    const uint8_t step = value_to_step(g, value);
+    if (step == g->step) return;
+
+    lv_area_t changed;
+    if (!g->geom) {
+        g->step = step;  // the sprite is filled when the geometry is built
+        lv_obj_invalidate(obj);
+        return;
+    }
+    if (update_indicator(g, g->step, step, &changed)) {
+        lv_area_move(&changed, obj->coords.x1 + g->geom->area.x1, obj->coords.y1 + g->geom->area.y1);
+        lv_obj_invalidate_area(obj, &changed);
+    }
+    g->step = step;
+}
+
+int32_t cyd_gauge_get_value(const lv_obj_t *obj) {
+    if (!obj) return 0;
+#if LV_USE_ARC
+    if (lv_obj_check_type(obj, &lv_arc_class)) return lv_arc_get_value(obj);
+#endif
+#if LV_USE_BAR
+    if (lv_obj_check_type(obj, &lv_bar_class)) return lv_bar_get_value(obj);
+#endif
+    const cyd_gauge_t *g = as_gauge(obj);
+    return g ? g->value : 0;
+}
+
+// Transform properties are dropped: a rotated bar is rebuilt upright instead.
+static bool skip_prop(lv_style_prop_t prop) {
+    return prop >= LV_STYLE_TRANSFORM_SCALE_X && prop <= LV_STYLE_TRANSFORM_SKEW_Y;
+}
+
+static void copy_styles(lv_obj_t *dst, const lv_obj_t *src) {
+    // Lowest precedence first, so lv_obj_add_style() ends up with the same order. Shared (theme)
+    // styles are referenced, so theme changes reach the gauge; local ones are copied.
+    for (int32_t i = (int32_t)src->style_cnt - 1; i >= 0; i--) {
+        const _lv_obj_style_t *entry = &src->styles[i];
+        if (entry->is_trans) continue;
+        if (!entry->is_local) {
+            lv_obj_add_style(dst, (lv_style_t *)entry->style, entry->selector);
+            if (!lv_style_is_const(entry->style)) continue;
+            // Table-built screens (cyd_uitable) keep the widget's own properties in const shared
+            // styles: cancel their transforms locally instead.
+            for (lv_style_prop_t prop = LV_STYLE_TRANSFORM_SCALE_X; prop <= LV_STYLE_TRANSFORM_SKEW_Y; prop++) {
+                lv_style_value_t value;
+                if (lv_style_get_prop(entry->style, prop, &value) == LV_STYLE_RES_FOUND) {
+                    lv_obj_set_local_style_prop(dst, prop, lv_style_prop_get_default(prop), entry->selector);
+                }
+            }
+            continue;
+        }
+        const lv_style_t *style = entry->style;
+        const uint8_t *raw = (const uint8_t *)style->values_and_props;
+        const lv_style_value_t *values = (const lv_style_value_t *)raw;
+        const lv_style_prop_t *props = (const lv_style_prop_t *)(raw + style->prop_cnt * sizeof(lv_style_value_t));
+        for (uint32_t p = 0; p < style->prop_cnt; p++) {
+            if (!skip_prop(props[p])) lv_obj_set_local_style_prop(dst, props[p], values[p], entry->selector);
+        }
+    }
+}
+
+// On-screen box of a possibly rotated widget, and the direction its bar fills in.
+static void bar_placement(lv_obj_t *bar, lv_area_t *box, lv_dir_t *dir) {
+    const lv_area_t *c = &bar->coords;
+    lv_point_t corners[4] = {{c->x1, c->y1}, {c->x2, c->y1}, {c->x1, c->y2}, {c->x2, c->y2}};
+    area_set_empty(box);
+    for (int i = 0; i < 4; i++) {
+        lv_obj_transform_point(bar, &corners[i], LV_OBJ_POINT_TRANSFORM_FLAG_NONE);
+        area_add_point(box, corners[i].x, corners[i].y);
+    }
+    // lv_bar fills along the longer side, left to right or bottom to top.
+    const int32_t cx = (c->x1 + c->x2) / 2;
+    const int32_t cy = (c->y1 + c->y2) / 2;
+    lv_point_t from = {c->x1, cy};
+    lv_point_t to = {c->x2, cy};
+    if (lv_area_get_width(c) < lv_area_get_height(c)) {
+        from = (lv_point_t){cx, c->y2};
+        to = (lv_point_t){cx, c->y1};
+    }
+    lv_obj_transform_point(bar, &from, LV_OBJ_POINT_TRANSFORM_FLAG_NONE);
+    lv_obj_transform_point(bar, &to, LV_OBJ_POINT_TRANSFORM_FLAG_NONE);
+    const int32_t dx = to.x - from.x;
+    const int32_t dy = to.y - from.y;
+    if (LV_ABS(dx) >= LV_ABS(dy)) *dir = dx >= 0 ? LV_DIR_RIGHT : LV_DIR_LEFT;
+    else *dir = dy < 0 ? LV_DIR_TOP : LV_DIR_BOTTOM;
+}
+
+lv_obj_t *cyd_gauge_replace(lv_obj_t *widget) {
+    if (!widget) return NULL;
+#if LV_USE_ARC
+    const bool arc = lv_obj_check_type(widget, &lv_arc_class);
+#else
+    const bool arc = false;
+#endif
+#if LV_USE_BAR
+    const bool bar = lv_obj_check_type(widget, &lv_bar_class);
+#else
+    const bool bar = false;
+#endif
+    if (!arc && !bar) return widget;
+
+    lv_obj_update_layout(widget);
+    lv_obj_t *obj = cyd_gauge_create(lv_obj_get_parent(widget), arc ? CYD_GAUGE_ARC : CYD_GAUGE_BAR);
+    cyd_gauge_t *g = (cyd_gauge_t *)obj;
+    copy_styles(obj, widget);
+    if (arc) {
+#if LV_USE_ARC
+        const int32_t rotation = lv_arc_get_rotation(widget);
+        g->angle_start = (int32_t)lv_arc_get_bg_angle_start(widget) + rotation;
+        g->angle_end = (int32_t)lv_arc_get_bg_angle_end(widget) + rotation;
+        g->min = lv_arc_get_min_value(widget);
+        g->max = lv_arc_get_max_value(widget);
+        g->value = lv_arc_get_value(widget);
+#endif
+    } else {
+#if LV_USE_BAR
+        lv_area_t box;
+        bar_placement(widget, &box, &g->dir);
+        lv_obj_set_size(obj, lv_area_get_width(&box), lv_area_get_height(&box));
+        lv_obj_update_layout(obj);
+        lv_obj_set_pos(obj, lv_obj_get_style_x(widget, LV_PART_MAIN) + box.x1 - obj->coords.x1,
+                       lv_obj_get_style_y(widget, LV_PART_MAIN) + box.y1 - obj->coords.y1);
+        g->min = lv_bar_get_min_value(widget);
+        g->max = lv_bar_get_max_value(widget);
+        g->value = lv_bar_get_value(widget);
+#endif
+    }
+    if (g->max <= g->min) g->max = g->min + 1;
+    g->value = LV_CLAMP(g->min, g->value, g->max);
+    g->step = value_to_step(g, g->value);
+
+    lv_obj_update_layout(obj);
+    if (!ensure_geometry(g)) {
+        lv_obj_delete(obj);
+        return widget;
+    }
+
+    if (lv_obj_has_flag(widget, LV_OBJ_FLAG_HIDDEN)) lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_set_user_data(obj, lv_obj_get_user_data(widget));
+    while (lv_obj_get_child_count(widget) > 0) lv_obj_set_parent(lv_obj_get_child(widget, 0), obj);
+    lv_obj_move_to_index(obj, lv_obj_get_index(widget));
+    lv_obj_delete(widget);
+    return obj;
+}
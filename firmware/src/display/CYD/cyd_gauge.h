@@ -0,0 +1,49 @@
+#ifndef CYD_GAUGE_H
+#define CYD_GAUGE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Tank level gauge: a 0–100% fill drawn as an arc or a bar. For each geometry (size, line width,
+// radius, angles) an A8 track sprite is rendered once, with a lookup table holding the level step
+// at which each of its pixels fills; gauges of the same geometry share both. Every gauge keeps
+// its own A8 indicator sprite. A level change rewrites and invalidates only the pixels of the
+// steps in between, and drawing is two solid-colour A8 blits instead of LVGL's anti-aliased
+// arc and rounded-rectangle masks.
+//
+// Colours follow the same style properties as the stock widgets: arc_color/arc_opa for arcs and
+// bg_color/bg_opa for bars, on LV_PART_MAIN (track) and LV_PART_INDICATOR (fill). Arc ends follow
+// arc_rounded; the level edge itself is a straight cut.
+
+#define CYD_GAUGE_STEPS 100  // level resolution of the lookup table
+
+typedef enum {
+    CYD_GAUGE_ARC = 0,
+    CYD_GAUGE_BAR,
+} cyd_gauge_shape_t;
+
+lv_obj_t *cyd_gauge_create(lv_obj_t *parent, cyd_gauge_shape_t shape);
+// Arc: background angles as for lv_arc (0° at 3 o'clock, clockwise). Default 135°..45°.
+void cyd_gauge_set_angles(lv_obj_t *obj, int32_t start, int32_t end);
+// Bar: the side the fill grows towards (LV_DIR_TOP fills from the bottom up). Default LV_DIR_RIGHT.
+void cyd_gauge_set_fill_dir(lv_obj_t *obj, lv_dir_t dir);
+void cyd_gauge_set_range(lv_obj_t *obj, int32_t min, int32_t max);
+// Also accepts lv_arc and lv_bar objects, so callers work whether or not a widget was replaced.
+void cyd_gauge_set_value(lv_obj_t *obj, int32_t value);
+int32_t cyd_gauge_get_value(const lv_obj_t *obj);
+
+// Swap a generated lv_arc or lv_bar for a gauge with the same placement, on-screen geometry (a
+// rotated bar becomes an upright one), styles, range, value and children, and delete it. Returns
+// the gauge, or the widget unchanged when it is neither or the sprites do not fit in memory.
+lv_obj_t *cyd_gauge_replace(lv_obj_t *widget);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // CYD_GAUGE_H
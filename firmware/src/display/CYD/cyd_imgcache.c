@@ -0,0 +1,237 @@
+#include "cyd_imgcache.h"
+
+#include <string.h>
+#include <esp_heap_caps.h>
+
+#define INTERNAL_RESERVE_BYTES (48 * 1024)  // decodes only use internal RAM above this
+#define COMPRESSED_HEADER_BYTES 12          // method, compressed size, decompressed size
+
+typedef struct {
+    const lv_image_dsc_t *src;  // NULL: slot free
+    lv_draw_buf_t buf;
+    void *data;
+    uint32_t bytes;
+    uint32_t last_use;
+    uint16_t refs;   // draws holding the buffer
+    bool cached;     // false: one-off decode, freed on close
+} entry_t;
+
+static entry_t s_entries[CYD_IMGCACHE_MAX_ENTRIES];
+static lv_mutex_t s_lock;  // the decoder also runs in the draw unit tasks
+static size_t s_budget;
+static size_t s_bytes;
+static uint32_t s_clock;
+static uint32_t s_hits;
+static uint32_t s_misses;
+static uint32_t s_evictions;
+
+static bool handled(const lv_image_dsc_t *img) {
+    return (img->header.flags & LV_IMAGE_FLAGS_COMPRESSED) || LV_COLOR_FORMAT_IS_INDEXED(img->header.cf);
+}
+
+static lv_color_format_t decoded_cf(const lv_image_header_t *header) {
+    if (!LV_COLOR_FORMAT_IS_INDEXED(header->cf)) return (lv_color_format_t)header->cf;
+    return (header->flags & CYD_IMAGE_FLAGS_OPAQUE) ? LV_COLOR_FORMAT_RGB565 : LV_COLOR_FORMAT_ARGB8888;
+}
+
+static void *alloc_buf(size_t size) {
+    if (heap_caps_get_free_size(MALLOC_CAP_INTERNAL) >= size + INTERNAL_RESERVE_BYTES) {
+        void *p = heap_caps_aligned_alloc(LV_DRAW_BUF_ALIGN, size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (p) return p;
+    }
+    return heap_caps_aligned_alloc(LV_DRAW_BUF_ALIGN, size, MALLOC_CAP_SPIRAM);
+}
+
+// Expand palette indices (MSB first) row by row into RGB565 or ARGB8888.
+static void expand_indexed(const lv_image_header_t *header, const uint8_t *src, lv_draw_buf_t *out) {
+    const lv_color_format_t cf = (lv_color_format_t)header->cf;
+    const uint32_t bpp = lv_color_format_get_bpp(cf);
+    const uint32_t palette_size = LV_COLOR_INDEXED_PALETTE_SIZE(cf);
+    const lv_color32_t *palette = (const lv_color32_t *)src;
+    const uint8_t *indices = src + palette_size * sizeof(lv_color32_t);
+    const uint32_t mask = (1U << bpp) - 1;
+    const bool rgb565 = out->header.cf == LV_COLOR_FORMAT_RGB565;
+    uint16_t palette565[256];
+    if (rgb565) {
+        for (uint32_t i = 0; i < palette_size; i++) {
+            palette565[i] = (uint16_t)(((palette[i].red & 0xF8) << 8) | ((palette[i].green & 0xFC) << 3) |
+                                       (palette[i].blue >> 3));
+        }
+    }
+    for (uint32_t y = 0; y < header->h; y++) {
+        const uint8_t *row = indices + y * header->stride;
+        uint8_t *dst = out->data + y * out->header.stride;
+        for (uint32_t x = 0; x < header->w; x++) {
+            const uint32_t bit = x * bpp;
+            const uint32_t idx = (row[bit >> 3] >> (8 - bpp - (bit & 7))) & mask;
+            if (rgb565) ((uint16_t *)dst)[x] = palette565[idx];
+            else ((lv_color32_t *)dst)[x] = palette[idx];
+        }
+    }
+}
+
+static bool decode(const lv_image_dsc_t *img, lv_draw_buf_t *out) {
+    const lv_image_header_t *header = &img->header;
+    const uint8_t *src = img->data;
+    uint8_t *expanded = NULL;
+    if (header->flags & LV_IMAGE_FLAGS_COMPRESSED) {
+        uint32_t words[3];
+        if (img->data_size < COMPRESSED_HEADER_BYTES) return false;
+        memcpy(words, img->data, sizeof(words));
+        const uint32_t in_len = words[1];
+        const uint32_t out_len = words[2];
+        if ((words[0] & 0xF) != LV_IMAGE_COMPRESS_RLE || in_len != img->data_size - COMPRESSED_HEADER_BYTES) {
+            return false;
+        }
+        const uint8_t blk = LV_COLOR_FORMAT_IS_INDEXED(header->cf) ? 1 : (lv_color_format_get_bpp(header->cf) + 7) >> 3;
+        const bool direct = !LV_COLOR_FORMAT_IS_INDEXED(header->cf) && header->stride == out->header.stride &&
+                            out_len == out->header.stride * header->h;
+        uint8_t *dst = direct ? out->data : (expanded = heap_caps_malloc(out_len, MALLOC_CAP_8BIT));
+        if (!dst) return false;
+        if (lv_rle_decompress(img->data + COMPRESSED_HEADER_BYTES, in_len, dst, out_len, blk) != out_len) {
+            heap_caps_free(expanded);
+            return false;
+        }
+        if (direct) return true;
+        src = expanded;
+    }
+    if (LV_COLOR_FORMAT_IS_INDEXED(header->cf)) {
+        expand_indexed(header, src, out);
+    } else {
+        // Compressed true-colour data with a stride of its own.
+        const uint32_t row_bytes = out->header.stride < header->stride ? out->header.stride : header->stride;
+        for (uint32_t y = 0; y < header->h; y++) {
+            memcpy(out->data + y * out->header.stride, src + y * header->stride, row_bytes);
+        }
+    }
+    heap_caps_free(expanded);
+    return true;
+}
+
+static entry_t *find_entry(const lv_image_dsc_t *img) {
+    for (int i = 0; i < CYD_IMGCACHE_MAX_ENTRIES; i++) {
+        if (s_entries[i].src == img) return &s_entries[i];
+    }
+    return NULL;
+}
+
+static void free_entry(entry_t *e) {
+    heap_caps_free(e->data);
+    s_bytes -= e->bytes;
+    memset(e, 0, sizeof(*e));
+}
+
+// A free slot with room for size more bytes, evicting least recently drawn images as needed.
+static entry_t *make_room(size_t size) {
+    if (size > s_budget) return NULL;
+    for (;;) {
+        entry_t *slot = NULL;
+        entry_t *lru = NULL;
+        for (int i = 0; i < CYD_IMGCACHE_MAX_ENTRIES; i++) {
+            entry_t *e = &s_entries[i];
+            if (!e->src) {
+                if (!slot) slot = e;
+            } else if (e->refs == 0 && (!lru || e->last_use < lru->last_use)) {
+                lru = e;
+            }
+        }
+        if (slot && s_bytes + size <= s_budget) return slot;
+        if (!lru) return NULL;
+        free_entry(lru);
+        s_evictions++;
+    }
+}
+
+static lv_result_t imgcache_info(lv_image_decoder_t *decoder, const void *src, lv_image_header_t *header) {
+    LV_UNUSED(decoder);
+    if (lv_image_src_get_type(src) != LV_IMAGE_SRC_VARIABLE) return LV_RESULT_INVALID;
+    const lv_image_dsc_t *img = (const lv_image_dsc_t *)src;
+    if (img->header.magic != LV_IMAGE_HEADER_MAGIC || !handled(img)) return LV_RESULT_INVALID;
+    const lv_color_format_t cf = decoded_cf(&img->header);
+    memset(header, 0, sizeof(*header));
+    header->magic = LV_IMAGE_HEADER_MAGIC;
+    header->cf = cf;
+    header->w = img->header.w;
+    header->h = img->header.h;
+    header->stride = lv_draw_buf_width_to_stride(img->header.w, cf);
+    return LV_RESULT_OK;
+}
+
+static lv_result_t imgcache_open(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc) {
+    LV_UNUSED(decoder);
+    const lv_image_dsc_t *img = (const lv_image_dsc_t *)dsc->src;
+    lv_mutex_lock(&s_lock);
+    entry_t *e = find_entry(img);
+    if (e) {
+        e->refs++;
+        e->last_use = ++s_clock;
+        s_hits++;
+    } else {
+        s_misses++;
+        const lv_color_format_t cf = decoded_cf(&img->header);
+        const uint32_t stride = lv_draw_buf_width_to_stride(img->header.w, cf);
+        const uint32_t size = stride * img->header.h;
+        e = make_room(size);
+        if (!e) e = (entry_t *)heap_caps_calloc(1, sizeof(entry_t), MALLOC_CAP_8BIT);
+        else e->cached = true;
+        void *data = e ? alloc_buf(size) : NULL;
+        if (!data || lv_draw_buf_init(&e->buf, img->header.w, img->header.h, cf, stride, data, size) != LV_RESULT_OK ||
+            !decode(img, &e->buf)) {
+            heap_caps_free(data);
+            if (e && e->cached) memset(e, 0, sizeof(*e));
+            else heap_caps_free(e);
+            lv_mutex_unlock(&s_lock);
+            return LV_RESULT_INVALID;
+        }
+        e->data = data;
+        e->bytes = size;
+        e->refs = 1;
+        if (e->cached) {
+            e->src = img;
+            e->last_use = ++s_clock;
+            s_bytes += size;
+        }
+    }
+    dsc->decoded = &e->buf;
+    dsc->user_data = e;
+    lv_mutex_unlock(&s_lock);
+    return LV_RESULT_OK;
+}
+
+static void imgcache_close(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc) {
+    LV_UNUSED(decoder);
+    entry_t *e = (entry_t *)dsc->user_data;
+    if (!e) return;
+    lv_mutex_lock(&s_lock);
+    if (e->cached) {
+        e->refs--;
+    } else {
+        heap_caps_free(e->data);
+        heap_caps_free(e);
+    }
+    lv_mutex_unlock(&s_lock);
+}
+
+void cyd_imgcache_init(size_t budget_bytes) {
+    s_budget = budget_bytes;
+    lv_mutex_init(&s_lock);
+    lv_image_decoder_t *decoder = lv_image_decoder_create();  // inserted ahead of LVGL's decoders
+    if (!decoder) return;
+    lv_image_decoder_set_info_cb(decoder, imgcache_info);
+    lv_image_decoder_set_open_cb(decoder, imgcache_open);
+    lv_image_decoder_set_close_cb(decoder, imgcache_close);
+}
+
+void cyd_imgcache_get_stats(cyd_imgcache_stats_t *out) {
+    lv_mutex_lock(&s_lock);
+    out->hits = s_hits;
+    out->misses = s_misses;
+    out->evictions = s_evictions;
+    out->entries = 0;
+    for (int i = 0; i < CYD_IMGCACHE_MAX_ENTRIES; i++) {
+        if (s_entries[i].src) out->entries++;
+    }
+    out->bytes = (uint32_t)s_bytes;
+    out->budget = (uint32_t)s_budget;
+    lv_mutex_unlock(&s_lock);
+}
@@ -0,0 +1,43 @@
+#ifndef CYD_IMGCACHE_H
+#define CYD_IMGCACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Decode cache for packed images (images/, written by tools/pack_images.py). Those are stored
+// RLE-compressed and/or indexed, which LVGL's own decoder would expand again on every draw. This
+// decoder expands each one once into a plain RGB565 (ARGB8888 when the palette has transparency)
+// buffer and keeps it for later draws; uncompressed true-colour images are left to LVGL.
+//
+// Decoded images stay until the byte budget is full, then the least recently drawn one that is
+// not being drawn is evicted. An image that does not fit at all is decoded for that draw only.
+// Buffers go to internal RAM while enough of it stays free, otherwise to PSRAM.
+
+#define CYD_IMGCACHE_MAX_ENTRIES 16
+
+// Set by the packer on indexed images whose palette is fully opaque: decode them to RGB565.
+#define CYD_IMAGE_FLAGS_OPAQUE LV_IMAGE_FLAGS_USER1
+
+typedef struct {
+    uint32_t hits;       // draws served from a cached decode
+    uint32_t misses;     // draws that had to decode
+    uint32_t evictions;  // decodes dropped to make room
+    uint32_t entries;    // images currently held
+    uint32_t bytes;      // memory used by them
+    uint32_t budget;
+} cyd_imgcache_stats_t;
+
+// Register the decoder (after lv_init) with a budget for the decoded images.
+void cyd_imgcache_init(size_t budget_bytes);
+void cyd_imgcache_get_stats(cyd_imgcache_stats_t *out);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // CYD_IMGCACHE_H
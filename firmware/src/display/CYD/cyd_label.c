@@ -0,0 +1,154 @@
+#include "cyd_label.h"
+
+#include <string.h>
+
+typedef struct {
+    lv_obj_t *label;  // NULL: slot free
+    char text[CYD_LABEL_TEXT_MAX];
+} slot_t;
+
+typedef struct {
+    char text[CYD_LABEL_TEXT_MAX];
+    size_t len;
+} writer_t;
+
+static slot_t s_slots[CYD_LABEL_SLOTS];
+static uint32_t s_bound;
+static uint32_t s_updates;
+static uint32_t s_unchanged;
+static uint32_t s_fallbacks;
+
+static void label_delete_cb(lv_event_t *e) {
+    slot_t *slot = (slot_t *)lv_event_get_user_data(e);
+    slot->label = NULL;
+    s_bound--;
+}
+
+static slot_t *slot_for(lv_obj_t *label) {
+    slot_t *free_slot = NULL;
+    for (int i = 0; i < CYD_LABEL_SLOTS; i++) {
+        if (s_slots[i].label == label) return &s_slots[i];
+        if (free_slot == NULL && s_slots[i].label == NULL) free_slot = &s_slots[i];
+    }
+    if (free_slot == NULL) return NULL;
+    free_slot->label = label;
+    free_slot->text[0] = '\0';
+    lv_obj_add_event_cb(label, label_delete_cb, LV_EVENT_DELETE, free_slot);
+    s_bound++;
+    return free_slot;
+}
+
+static void commit(lv_obj_t *label, const char *text, size_t len) {
+    slot_t *slot = len < CYD_LABEL_TEXT_MAX ? slot_for(label) : NULL;
+    if (slot == NULL) {
+        s_fallbacks++;
+        lv_label_set_text(label, text);
+        return;
+    }
+    if (lv_label_get_text(label) == slot->text && memcmp(slot->text, text, len + 1) == 0) {
+        s_unchanged++;
+        return;
+    }
+    memcpy(slot->text, text, len + 1);
+    s_updates++;
+    lv_label_set_text_static(label, slot->text);
+}
+
+static void put_str(writer_t *w, const char *s) {
+    if (s == NULL) return;
+    while (*s && w->len < CYD_LABEL_TEXT_MAX - 1) w->text[w->len++] = *s++;
+    w->text[w->len] = '\0';
+}
+
+// Decimal digits of value, zero-padded to at least min_digits.
+static void put_uint(writer_t *w, uint32_t value, int min_digits) {
+    char digits[10];
+    int n = 0;
+    do {
+        digits[n++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    while (n < min_digits && n < (int)sizeof(digits)) digits[n++] = '0';
+    while (n > 0 && w->len < CYD_LABEL_TEXT_MAX - 1) w->text[w->len++] = digits[--n];
+    w->text[w->len] = '\0';
+}
+
+static void put_int(writer_t *w, int32_t value) {
+    if (value < 0) put_str(w, "-");
+    put_uint(w, value < 0 ? 0u - (uint32_t)value : (uint32_t)value, 1);
+}
+
+void cyd_label_set_static(lv_obj_t *label, const char *text) {
+    if (label == NULL) return;
+    if (lv_label_get_text(label) == text) {
+        s_unchanged++;
+        return;
+    }
+    s_updates++;
+    lv_label_set_text_static(label, text);
+}
+
+void cyd_label_set_text(lv_obj_t *label, const char *text) {
+    if (label == NULL) return;
+    if (text == NULL) text = "";
+    commit(label, text, strlen(text));
+}
+
+void cyd_label_set_int(lv_obj_t *label, const char *prefix, int32_t value, const char *suffix) {
+    if (label == NULL) return;
+    writer_t w = {.len = 0};
+    put_str(&w, prefix);
+    put_int(&w, value);
+    put_str(&w, suffix);
+    commit(label, w.text, w.len);
+}
+
+void cyd_label_set_percent(lv_obj_t *label, uint32_t percent) {
+    if (label == NULL) return;
+    writer_t w = {.len = 0};
+    put_uint(&w, percent, 1);
+    put_str(&w, "%");
+    commit(label, w.text, w.len);
+}
+
+void cyd_label_set_temp(lv_obj_t *label, int32_t deci_c, bool fahrenheit) {
+    if (label == NULL) return;
+    // Tenths of a degree Fahrenheit, rounded half away from zero.
+    const int32_t deci = fahrenheit ? (deci_c * 9 + (deci_c < 0 ? -2 : 2)) / 5 + 320 : deci_c;
+    const uint32_t mag = deci < 0 ? 0u - (uint32_t)deci : (uint32_t)deci;
+    writer_t w = {.len = 0};
+    if (deci < 0) put_str(&w, "-");
+    put_uint(&w, mag / 10, 1);
+    put_str(&w, ".");
+    put_uint(&w, mag % 10, 1);
+    put_str(&w, fahrenheit ? "\xC2\xB0" "F" : "\xC2\xB0" "C");
+    commit(label, w.text, w.len);
+}
+
+void cyd_label_set_millivolts(lv_obj_t *label, uint32_t mv) {
+    if (label == NULL) return;
+    const uint32_t centi = (mv + 5) / 10;
+    writer_t w = {.len = 0};
+    put_uint(&w, centi / 100, 1);
+    put_str(&w, ".");
+    put_uint(&w, centi % 100, 2);
+    put_str(&w, "V");
+    commit(label, w.text, w.len);
+}
+
+void cyd_label_set_uptime(lv_obj_t *label, uint32_t seconds) {
+    if (label == NULL) return;
+    writer_t w = {.len = 0};
+    put_uint(&w, seconds / 60, 1);
+    put_str(&w, "m ");
+    put_uint(&w, seconds % 60, 2);
+    put_str(&w, "s");
+    commit(label, w.text, w.len);
+}
+
+void cyd_label_get_stats(cyd_label_stats_t *out) {
+    out->bound = s_bound;
+    out->updates = s_updates;
+    out->unchanged = s_unchanged;
+    out->fallbacks = s_fallbacks;
+}
@@ -0,0 +1,49 @@
+#ifndef CYD_LABEL_H
+#define CYD_LABEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Label text without LVGL heap traffic. lv_label_set_text() copies every string into the LVGL
+// pool and frees the previous copy, so labels refreshed from live telemetry keep cutting the pool
+// into small holes. A label set through these functions is bound to a fixed buffer from a static
+// pool and shown with lv_label_set_text_static(); the buffer is released when the label is
+// deleted. Setting the text a label already shows does not redraw it.
+//
+// The formatters use integer arithmetic only. Constant strings need no buffer and go through
+// cyd_label_set_static().
+
+#define CYD_LABEL_SLOTS 48
+#define CYD_LABEL_TEXT_MAX 64  // including the terminator; longer text falls back to lv_label_set_text()
+
+typedef struct {
+    uint32_t bound;      // labels holding a buffer
+    uint32_t updates;    // texts that changed a label
+    uint32_t unchanged;  // sets skipped because the label already showed the text
+    uint32_t fallbacks;  // sets that went to the LVGL heap (pool full or text too long)
+} cyd_label_stats_t;
+
+// text must outlive the label (a literal); the label is only refreshed if it showed something else.
+void cyd_label_set_static(lv_obj_t *label, const char *text);
+void cyd_label_set_text(lv_obj_t *label, const char *text);
+// prefix, value and suffix, e.g. ("Fault ", 12, "") or ("", -67, " dBm"); either string may be NULL.
+void cyd_label_set_int(lv_obj_t *label, const char *prefix, int32_t value, const char *suffix);
+void cyd_label_set_percent(lv_obj_t *label, uint32_t percent);
+// Temperature in tenths of a degree Celsius, shown as "21.5°C" or, converted, "70.7°F".
+void cyd_label_set_temp(lv_obj_t *label, int32_t deci_c, bool fahrenheit);
+// "12.35V", rounded to 10 mV.
+void cyd_label_set_millivolts(lv_obj_t *label, uint32_t mv);
+// "83m 07s"
+void cyd_label_set_uptime(lv_obj_t *label, uint32_t seconds);
+void cyd_label_get_stats(cyd_label_stats_t *out);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // CYD_LABEL_H
@@ -0,0 +1,390 @@
+#include "cyd_layercache.h"
+
+#include <string.h>
+#include <esp_heap_caps.h>
+
+#define LIVE_AREAS_MAX 48
+#define MUTED_MAX 64
+
+// Local style overrides that stop a cached container from drawing itself; none affects layout.
+static const lv_style_prop_t CONTAINER_PROPS[] = {
+    LV_STYLE_BG_OPA, LV_STYLE_BG_IMAGE_OPA, LV_STYLE_BORDER_OPA, LV_STYLE_SHADOW_OPA, LV_STYLE_OUTLINE_OPA,
+};
+#define CONTAINER_PROP_COUNT (sizeof(CONTAINER_PROPS) / sizeof(CONTAINER_PROPS[0]))
+#define CONTAINER_BORDER 2  // index of LV_STYLE_BORDER_OPA
+
+// The screen keeps a solid fill (its gradient is in the snapshot) and draws the snapshot on top.
+enum {
+    SCREEN_GRAD_DIR,
+    SCREEN_IMAGE_SRC,
+    SCREEN_IMAGE_OPA,
+    SCREEN_IMAGE_RECOLOR_OPA,
+    SCREEN_IMAGE_TILED,
+    SCREEN_BORDER_OPA,
+    SCREEN_SHADOW_OPA,
+    SCREEN_OUTLINE_OPA,
+    SCREEN_PROP_COUNT,
+};
+
+typedef struct {
+    lv_style_value_t value;
+    bool local;  // the object had its own value before the override
+} saved_prop_t;
+
+typedef struct {
+    lv_obj_t *obj;
+    lv_area_t coords;
+    lv_state_t state;
+    bool hidden;
+    bool live_border;  // border_post: drawn over the children, so it stays live
+    bool had_task_events;
+    saved_prop_t saved[CONTAINER_PROP_COUNT];
+} cached_obj_t;
+
+typedef struct {
+    lv_obj_t *screen;  // NULL: slot free
+    lv_area_t coords;
+    void *data;
+    uint32_t data_size;
+    lv_draw_buf_t buf;
+    saved_prop_t screen_saved[SCREEN_PROP_COUNT];
+    cached_obj_t *objs;  // CYD_LAYERCACHE_MAX_OBJS entries in PSRAM
+    uint16_t obj_count;
+} layer_t;
+
+// Scratch state of one capture: areas of live widgets seen so far in drawing order, and the
+// visible live subtrees muted while the snapshot renders.
+typedef struct {
+    layer_t *layer;
+    lv_area_t live[LIVE_AREAS_MAX];
+    uint8_t live_count;
+    bool live_overflow;
+    lv_obj_t *muted[MUTED_MAX];
+    saved_prop_t muted_opa[MUTED_MAX];
+    uint8_t muted_count;
+    bool ok;
+} capture_t;
+
+// Full-screen redraw times, so a layer is only kept where it is faster than drawing.
+typedef struct {
+    const lv_obj_t *screen;
+    uint32_t plain_us;  // last full redraw without a layer
+    bool no_gain;       // the layer was not faster; not captured again under this theme
+} screen_timing_t;
+
+static layer_t s_layers[CYD_LAYERCACHE_MAX_SCREENS];
+static screen_timing_t s_timings[CYD_LAYERCACHE_MAX_SCREENS];
+static capture_t s_capture;
+static bool s_enabled = false;
+static size_t s_psram_reserve = 0;
+static lv_obj_t *s_last_screen = NULL;
+static bool s_gave_up = false;  // active screen's layer was dropped; wait for the next screen load
+static bool s_capture_pending = false;
+static bool s_refr_cached = false;  // the refresh in progress draws from a layer
+static uint32_t s_captures = 0;
+static uint32_t s_drops = 0;
+static uint32_t s_no_gain = 0;
+
+static void layer_obj_delete_cb(lv_event_t *e);
+
+static void override_prop(lv_obj_t *obj, lv_style_prop_t prop, lv_style_value_t value, saved_prop_t *saved) {
+    saved->local = lv_obj_get_local_style_prop(obj, prop, &saved->value, LV_PART_MAIN) == LV_STYLE_RES_FOUND;
+    lv_obj_set_local_style_prop(obj, prop, value, LV_PART_MAIN);
+}
+
+static void restore_prop(lv_obj_t *obj, lv_style_prop_t prop, const saved_prop_t *saved) {
+    if (saved->local) {
+        lv_obj_set_local_style_prop(obj, prop, saved->value, LV_PART_MAIN);
+    } else {
+        lv_obj_remove_local_style_prop(obj, prop, LV_PART_MAIN);
+    }
+}
+
+static lv_style_prop_t screen_prop(int index) {
+    static const lv_style_prop_t props[SCREEN_PROP_COUNT] = {
+        LV_STYLE_BG_GRAD_DIR, LV_STYLE_BG_IMAGE_SRC, LV_STYLE_BG_IMAGE_OPA, LV_STYLE_BG_IMAGE_RECOLOR_OPA,
+        LV_STYLE_BG_IMAGE_TILED, LV_STYLE_BORDER_OPA, LV_STYLE_SHADOW_OPA, LV_STYLE_OUTLINE_OPA,
+    };
+    return props[index];
+}
+
+static layer_t *find_layer(const lv_obj_t *screen) {
+    for (uint8_t i = 0; i < CYD_LAYERCACHE_MAX_SCREENS; i++) {
+        if (s_layers[i].screen == screen) return &s_layers[i];
+    }
+    return NULL;
+}
+
+static screen_timing_t *timing_for(const lv_obj_t *screen) {
+    screen_timing_t *free_slot = NULL;
+    for (uint8_t i = 0; i < CYD_LAYERCACHE_MAX_SCREENS; i++) {
+        if (s_timings[i].screen == screen) return &s_timings[i];
+        if (!free_slot && !s_timings[i].screen) free_slot = &s_timings[i];
+    }
+    if (free_slot) free_slot->screen = screen;
+    return free_slot;
+}
+
+static void free_layer_memory(layer_t *layer) {
+    if (layer->data) heap_caps_free(layer->data);
+    if (layer->objs) heap_caps_free(layer->objs);
+    memset(layer, 0, sizeof(*layer));
+}
+
+// Give the objects their own styles back and free the layer. deleting is an object being deleted
+// (it is skipped); when it is the screen, nothing is restored.
+static void release_layer(layer_t *layer, const lv_obj_t *deleting) {
+    const bool restore = deleting != layer->screen;
+    for (uint16_t i = 0; i < layer->obj_count; i++) {
+        cached_obj_t *c = &layer->objs[i];
+        if (c->obj == deleting) continue;
+        lv_obj_remove_event_cb(c->obj, layer_obj_delete_cb);
+        if (!restore) continue;
+        for (uint8_t p = 0; p < CONTAINER_PROP_COUNT; p++) {
+            if (p == CONTAINER_BORDER && c->live_border) continue;
+            restore_prop(c->obj, CONTAINER_PROPS[p], &c->saved[p]);
+        }
+    }
+    if (restore) {
+        lv_obj_remove_event_cb(layer->screen, layer_obj_delete_cb);
+        for (int p = 0; p < SCREEN_PROP_COUNT; p++) restore_prop(layer->screen, screen_prop(p), &layer->screen_saved[p]);
+    }
+    lv_image_cache_drop(&layer->buf);
+    free_layer_memory(layer);
+}
+
+static void layer_obj_delete_cb(lv_event_t *e) {
+    layer_t *layer = (layer_t *)lv_event_get_user_data(e);
+    const lv_obj_t *target = (const lv_obj_t *)lv_event_get_target(e);
+    if (!layer->screen) return;
+    if (target == layer->screen) {
+        screen_timing_t *timing = timing_for(target);
+        if (timing) memset(timing, 0, sizeof(*timing));
+        if (s_last_screen == target) s_last_screen = NULL;
+    }
+    release_layer(layer, target);
+}
+
+static bool overlaps_live(const capture_t *cap, const lv_area_t *area) {
+    if (cap->live_overflow) return true;
+    for (uint8_t i = 0; i < cap->live_count; i++) {
+        if (_lv_area_is_on(&cap->live[i], area)) return true;
+    }
+    return false;
+}
+
+// Depth-first in drawing order. A plain container is cached unless it overlaps a live widget
+// drawn before it; everything else (and all of its children) stays live.
+static void collect(capture_t *cap, lv_obj_t *parent) {
+    layer_t *layer = cap->layer;
+    const uint32_t child_count = lv_obj_get_child_count(parent);
+    for (uint32_t i = 0; i < child_count && cap->ok; i++) {
+        lv_obj_t *child = lv_obj_get_child(parent, (int32_t)i);
+        lv_area_t ext;
+        lv_obj_get_coords(child, &ext);
+        const int32_t ext_size = _lv_obj_get_ext_draw_size(child);
+        lv_area_increase(&ext, ext_size, ext_size);
+        const bool hidden = lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN);
+
+        if (lv_obj_check_type(child, &lv_obj_class) && !overlaps_live(cap, &ext) &&
+            layer->obj_count < CYD_LAYERCACHE_MAX_OBJS) {
+            cached_obj_t *c = &layer->objs[layer->obj_count++];
+            c->obj = child;
+            lv_obj_get_coords(child, &c->coords);
+            c->state = lv_obj_get_state(child);
+            c->hidden = hidden;
+            c->live_border = lv_obj_get_style_border_post(child, LV_PART_MAIN);
+            if (!hidden) collect(cap, child);
+            continue;
+        }
+        // Hidden widgets count too: they may appear later without a layout change.
+        if (cap->live_count < LIVE_AREAS_MAX) cap->live[cap->live_count++] = ext;
+        else cap->live_overflow = true;
+        if (hidden) continue;
+        if (cap->muted_count == MUTED_MAX) {
+            cap->ok = false;
+            return;
+        }
+        cap->muted[cap->muted_count++] = child;
+    }
+}
+
+static void mute_border_task_cb(lv_event_t *e) {
+    lv_draw_task_t *task = lv_event_get_draw_task(e);
+    if (task->type == LV_DRAW_TASK_TYPE_BORDER) ((lv_draw_border_dsc_t *)task->draw_dsc)->opa = LV_OPA_TRANSP;
+}
+
+// Post borders are left out of the snapshot by dropping their draw tasks. Changing border_opa
+// instead would also change the background (LVGL shrinks it under an opaque border).
+static void set_post_borders_muted(layer_t *layer, bool muted) {
+    for (uint16_t i = 0; i < layer->obj_count; i++) {
+        cached_obj_t *c = &layer->objs[i];
+        if (!c->live_border) continue;
+        if (muted) {
+            c->had_task_events = lv_obj_has_flag(c->obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+            lv_obj_add_flag(c->obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+            lv_obj_add_event_cb(c->obj, mute_border_task_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+        } else {
+            lv_obj_remove_event_cb(c->obj, mute_border_task_cb);
+            if (!c->had_task_events) lv_obj_remove_flag(c->obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+        }
+    }
+}
+
+static void capture(lv_obj_t *screen) {
+    if (find_layer(screen)) return;
+    layer_t *layer = find_layer(NULL);
+    if (!layer) return;
+
+    lv_obj_update_layout(screen);
+    const uint32_t w = (uint32_t)lv_obj_get_width(screen);
+    const uint32_t h = (uint32_t)lv_obj_get_height(screen);
+    const uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    const uint32_t data_size = stride * h;
+    const size_t objs_bytes = CYD_LAYERCACHE_MAX_OBJS * sizeof(cached_obj_t);
+    if (heap_caps_get_free_size(MALLOC_CAP_SPIRAM) < data_size + objs_bytes + s_psram_reserve) return;
+    layer->data = heap_caps_aligned_alloc(LV_DRAW_BUF_ALIGN, data_size, MALLOC_CAP_SPIRAM);
+    layer->objs = (cached_obj_t *)heap_caps_malloc(objs_bytes, MALLOC_CAP_SPIRAM);
+    if (!layer->data || !layer->objs) {
+        free_layer_memory(layer);
+        return;
+    }
+    layer->data_size = data_size;
+    lv_obj_get_coords(screen, &layer->coords);
+
+    capture_t *cap = &s_capture;
+    memset(cap, 0, sizeof(*cap));
+    cap->layer = layer;
+    cap->ok = true;
+    collect(cap, screen);
+    if (!cap->ok || lv_draw_buf_init(&layer->buf, w, h, LV_COLOR_FORMAT_RGB565, stride, layer->data, data_size) !=
+                        LV_RESULT_OK) {
+        free_layer_memory(layer);
+        return;
+    }
+
+    // Render only the static part: live subtrees are made fully transparent (no layout change)
+    // and live borders are left out.
+    const lv_style_value_t transp = {.num = LV_OPA_TRANSP};
+    for (uint8_t i = 0; i < cap->muted_count; i++) override_prop(cap->muted[i], LV_STYLE_OPA, transp, &cap->muted_opa[i]);
+    set_post_borders_muted(layer, true);
+    const lv_result_t res = lv_snapshot_take_to_draw_buf(screen, LV_COLOR_FORMAT_RGB565, &layer->buf);
+    set_post_borders_muted(layer, false);
+    for (uint8_t i = 0; i < cap->muted_count; i++) restore_prop(cap->muted[i], LV_STYLE_OPA, &cap->muted_opa[i]);
+    if (res != LV_RESULT_OK) {
+        free_layer_memory(layer);
+        return;
+    }
+
+    layer->screen = screen;
+    saved_prop_t *ss = layer->screen_saved;
+    override_prop(screen, LV_STYLE_BG_GRAD_DIR, (lv_style_value_t){.num = LV_GRAD_DIR_NONE}, &ss[SCREEN_GRAD_DIR]);
+    override_prop(screen, LV_STYLE_BG_IMAGE_SRC, (lv_style_value_t){.ptr = &layer->buf}, &ss[SCREEN_IMAGE_SRC]);
+    override_prop(screen, LV_STYLE_BG_IMAGE_OPA, (lv_style_value_t){.num = LV_OPA_COVER}, &ss[SCREEN_IMAGE_OPA]);
+    override_prop(screen, LV_STYLE_BG_IMAGE_RECOLOR_OPA, transp, &ss[SCREEN_IMAGE_RECOLOR_OPA]);
+    override_prop(screen, LV_STYLE_BG_IMAGE_TILED, (lv_style_value_t){.num = 0}, &ss[SCREEN_IMAGE_TILED]);
+    override_prop(screen, LV_STYLE_BORDER_OPA, transp, &ss[SCREEN_BORDER_OPA]);
+    override_prop(screen, LV_STYLE_SHADOW_OPA, transp, &ss[SCREEN_SHADOW_OPA]);
+    override_prop(screen, LV_STYLE_OUTLINE_OPA, transp, &ss[SCREEN_OUTLINE_OPA]);
+    lv_obj_add_event_cb(screen, layer_obj_delete_cb, LV_EVENT_DELETE, layer);
+    for (uint16_t i = 0; i < layer->obj_count; i++) {
+        cached_obj_t *c = &layer->objs[i];
+        for (uint8_t p = 0; p < CONTAINER_PROP_COUNT; p++) {
+            if (p == CONTAINER_BORDER && c->live_border) continue;
+            override_prop(c->obj, CONTAINER_PROPS[p], transp, &c->saved[p]);
+        }
+        lv_obj_add_event_cb(c->obj, layer_obj_delete_cb, LV_EVENT_DELETE, layer);
+    }
+    s_captures++;
+}
+
+static void capture_async_cb(void * /*unused*/) {
+    s_capture_pending = false;
+    lv_obj_t *screen = lv_screen_active();
+    if (screen == s_last_screen && !s_gave_up) capture(screen);
+}
+
+static void schedule_capture(void) {
+    if (s_capture_pending) return;
+    if (lv_async_call(capture_async_cb, NULL) == LV_RESULT_OK) s_capture_pending = true;
+}
+
+static bool layer_matches(const layer_t *layer) {
+    lv_area_t coords;
+    lv_obj_get_coords(layer->screen, &coords);
+    if (!_lv_area_is_equal(&coords, &layer->coords)) return false;
+    for (uint16_t i = 0; i < layer->obj_count; i++) {
+        const cached_obj_t *c = &layer->objs[i];
+        if (lv_obj_has_flag(c->obj, LV_OBJ_FLAG_HIDDEN) != c->hidden) return false;
+        if (lv_obj_get_state(c->obj) != c->state) return false;
+        lv_obj_get_coords(c->obj, &coords);
+        if (!_lv_area_is_equal(&coords, &c->coords)) return false;
+    }
+    return true;
+}
+
+void cyd_layercache_init(size_t psram_reserve) {
+    s_psram_reserve = psram_reserve;
+    s_enabled = heap_caps_get_total_size(MALLOC_CAP_SPIRAM) > 0;
+}
+
+void cyd_layercache_refr_start(lv_obj_t *screen) {
+    if (!s_enabled || !screen) return;
+    if (screen != s_last_screen) {
+        s_last_screen = screen;
+        s_gave_up = false;
+    }
+    layer_t *layer = find_layer(screen);
+    s_refr_cached = false;
+    if (!layer) return;
+    // Layout normally runs right after REFR_START; do it first so moved containers are seen
+    // before they would be drawn against a stale snapshot.
+    lv_obj_update_layout(screen);
+    if (!layer_matches(layer)) {
+        release_layer(layer, NULL);
+        s_gave_up = true;
+        s_drops++;
+        return;
+    }
+    s_refr_cached = true;
+}
+
+void cyd_layercache_refr_ready(uint32_t refr_us, bool full_screen) {
+    if (!s_enabled || !s_last_screen || !full_screen) return;
+    screen_timing_t *timing = timing_for(s_last_screen);
+    if (!timing) return;
+    if (!s_refr_cached) {
+        timing->plain_us = refr_us;
+        // Capture outside the refresh, from LVGL's timer loop.
+        if (!timing->no_gain && !s_gave_up) schedule_capture();
+        return;
+    }
+    layer_t *layer = find_layer(s_last_screen);
+    if (layer && timing->plain_us && refr_us >= timing->plain_us) {
+        release_layer(layer, NULL);
+        timing->no_gain = true;
+        s_no_gain++;
+    }
+}
+
+void cyd_layercache_drop_all(void) {
+    for (uint8_t i = 0; i < CYD_LAYERCACHE_MAX_SCREENS; i++) {
+        if (!s_layers[i].screen) continue;
+        release_layer(&s_layers[i], NULL);
+        s_drops++;
+    }
+    memset(s_timings, 0, sizeof(s_timings));
+    s_gave_up = false;
+}
+
+void cyd_layercache_get_stats(cyd_layercache_stats_t *out) {
+    memset(out, 0, sizeof(*out));
+    for (uint8_t i = 0; i < CYD_LAYERCACHE_MAX_SCREENS; i++) {
+        if (!s_layers[i].screen) continue;
+        out->screens++;
+        out->bytes += s_layers[i].data_size;
+    }
+    out->captures = s_captures;
+    out->drops = s_drops;
+    out->no_gain = s_no_gain;
+}
@@ -0,0 +1,53 @@
+#ifndef CYD_LAYERCACHE_H
+#define CYD_LAYERCACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Cached static layers. The first time a screen is shown under the current theme, its plain
+// containers (screen background, headers, card frames; anything of base class lv_obj) are
+// rendered once into an RGB565 snapshot in PSRAM. While the layout matches the snapshot, the
+// screen draws that image as its background and the containers stop drawing their own
+// backgrounds, borders and shadows; labels, arcs, buttons and other widgets stay live on top.
+//
+// Containers that overlap an earlier live widget stay live as well, so the stacking order is
+// unchanged. If a cached container moves, resizes, changes state or is shown/hidden, that screen's
+// layer is dropped and it renders normally until it is loaded again.
+//
+// A screen is captured after its first full redraw and the layer is kept only if the next full
+// redraw from it is faster; flat screens can blit slower from PSRAM than they draw.
+
+#define CYD_LAYERCACHE_MAX_SCREENS 12
+#define CYD_LAYERCACHE_MAX_OBJS 64  // cached containers per screen
+
+typedef struct {
+    uint32_t screens;   // layers currently held
+    uint32_t bytes;     // PSRAM used by them
+    uint32_t captures;  // since boot
+    uint32_t drops;     // layout mismatches and theme changes since boot
+    uint32_t no_gain;   // layers released because they did not speed up the redraw
+} cyd_layercache_stats_t;
+
+// Enable the cache. Layers are only allocated while at least psram_reserve bytes of PSRAM stay
+// free; boards without PSRAM keep rendering normally.
+void cyd_layercache_init(size_t psram_reserve);
+// Call from the display's LV_EVENT_REFR_START: validates the active screen's layer.
+void cyd_layercache_refr_start(lv_obj_t *screen);
+// Call from LV_EVENT_REFR_READY with the refresh time: full-screen redraws schedule captures and
+// decide whether a layer is kept.
+void cyd_layercache_refr_ready(uint32_t refr_us, bool full_screen);
+// Restore every screen's own styles and free the layers. Call before the theme changes (or
+// anything else restyles the containers); screens are captured again when next drawn.
+void cyd_layercache_drop_all(void);
+void cyd_layercache_get_stats(cyd_layercache_stats_t *out);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // CYD_LAYERCACHE_H
@@ -0,0 +1,156 @@
+#include "cyd_metrics.h"
+
+#include <esp_timer.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+typedef enum {
+    KIND_COUNTER = 0,
+    KIND_GAUGE,
+    KIND_HISTOGRAM,
+} kind_t;
+
+typedef struct {
+    const char *name;
+    kind_t kind;
+    uint8_t n_bounds;
+    const uint32_t *bounds;
+    uint32_t count;  // counter: total; histogram: values observed
+    int32_t value;   // gauge
+    uint32_t buckets[CYD_METRICS_MAX_BOUNDS + 1];
+} metric_t;
+
+// What a reader had seen at the start of its window.
+typedef struct {
+    uint32_t count;
+    uint32_t buckets[CYD_METRICS_MAX_BOUNDS + 1];
+    uint32_t max;  // histogram: largest value in the window so far
+} seen_t;
+
+static metric_t s_metrics[CYD_METRICS_MAX];
+static uint8_t s_count = 0;
+static seen_t s_seen[CYD_METRICS_READERS][CYD_METRICS_MAX];
+static int64_t s_window_start_us[CYD_METRICS_READERS];
+static uint8_t s_readers = 0;
+
+static cyd_metric_t add_metric(const char *name, kind_t kind, const uint32_t *bounds, uint8_t n) {
+    if (s_count >= CYD_METRICS_MAX) return CYD_METRIC_NONE;
+    metric_t *m = &s_metrics[s_count];
+    memset(m, 0, sizeof(*m));
+    m->name = name;
+    m->kind = kind;
+    m->bounds = bounds;
+    m->n_bounds = n;
+    return s_count++;
+}
+
+cyd_metric_t cyd_metrics_counter(const char *name) {
+    return add_metric(name, KIND_COUNTER, NULL, 0);
+}
+
+cyd_metric_t cyd_metrics_gauge(const char *name) {
+    return add_metric(name, KIND_GAUGE, NULL, 0);
+}
+
+cyd_metric_t cyd_metrics_histogram(const char *name, const uint32_t *bounds, uint8_t n) {
+    if (n > CYD_METRICS_MAX_BOUNDS) n = CYD_METRICS_MAX_BOUNDS;
+    return add_metric(name, KIND_HISTOGRAM, bounds, n);
+}
+
+void cyd_metrics_add(cyd_metric_t m, uint32_t n) {
+    if (m >= s_count) return;
+    s_metrics[m].count += n;
+}
+
+void cyd_metrics_set(cyd_metric_t m, int32_t value) {
+    if (m >= s_count) return;
+    s_metrics[m].value = value;
+}
+
+void cyd_metrics_observe(cyd_metric_t m, uint32_t value) {
+    if (m >= s_count) return;
+    metric_t *metric = &s_metrics[m];
+    uint8_t i = 0;
+    while (i < metric->n_bounds && value > metric->bounds[i]) i++;
+    metric->buckets[i]++;
+    metric->count++;
+    for (uint8_t r = 0; r < s_readers; r++) {
+        if (value > s_seen[r][m].max) s_seen[r][m].max = value;
+    }
+}
+
+static void start_window(uint8_t reader, int64_t now_us) {
+    for (uint8_t i = 0; i < s_count; i++) {
+        seen_t *seen = &s_seen[reader][i];
+        seen->count = s_metrics[i].count;
+        memcpy(seen->buckets, s_metrics[i].buckets, sizeof(seen->buckets));
+        seen->max = 0;
+    }
+    s_window_start_us[reader] = now_us;
+}
+
+uint8_t cyd_metrics_reader(void) {
+    if (s_readers >= CYD_METRICS_READERS) return CYD_METRIC_NONE;
+    start_window(s_readers, esp_timer_get_time());
+    return s_readers++;
+}
+
+// Upper bound of the bucket holding the pct-th percentile of the window, capped at its maximum.
+static uint32_t percentile(const metric_t *m, const seen_t *seen, uint32_t total, uint32_t pct) {
+    const uint32_t rank = (uint32_t)(((uint64_t)total * pct + 99) / 100);
+    uint32_t below = 0;
+    for (uint8_t i = 0; i < m->n_bounds; i++) {
+        below += m->buckets[i] - seen->buckets[i];
+        if (below >= rank) return m->bounds[i] < seen->max ? m->bounds[i] : seen->max;
+    }
+    return seen->max;
+}
+
+static size_t append(char *buf, size_t len, size_t pos, const char *fmt, ...) {
+    if (pos >= len) return pos;
+    va_list args;
+    va_start(args, fmt);
+    const int n = vsnprintf(buf + pos, len - pos, fmt, args);
+    va_end(args);
+    if (n < 0) return pos;
+    return pos + (size_t)n < len ? pos + (size_t)n : len - 1;
+}
+
+size_t cyd_metrics_format(uint8_t reader, char sep, char *buf, size_t len) {
+    if (len == 0) return 0;
+    buf[0] = '\0';
+    if (reader >= s_readers) return 0;
+    const int64_t now_us = esp_timer_get_time();
+    const uint64_t elapsed_us = (uint64_t)(now_us - s_window_start_us[reader]);
+    size_t pos = 0;
+    for (uint8_t i = 0; i < s_count; i++) {
+        const metric_t *m = &s_metrics[i];
+        const seen_t *seen = &s_seen[reader][i];
+        if (i > 0) pos = append(buf, len, pos, "%c", sep);
+        const uint32_t delta = m->count - seen->count;
+        switch (m->kind) {
+        case KIND_COUNTER: {
+            const uint64_t tenths = elapsed_us ? (uint64_t)delta * 10000000ULL / elapsed_us : 0;
+            pos = append(buf, len, pos, "%s=%lu.%lu/s", m->name, (unsigned long)(tenths / 10),
+                         (unsigned long)(tenths % 10));
+            break;
+        }
+        case KIND_GAUGE:
+            pos = append(buf, len, pos, "%s=%ld", m->name, (long)m->value);
+            break;
+        case KIND_HISTOGRAM:
+            if (delta == 0) {
+                pos = append(buf, len, pos, "%s=-", m->name);
+            } else {
+                pos = append(buf, len, pos, "%s=%lu/%lu/%lu(%lu)", m->name,
+                             (unsigned long)percentile(m, seen, delta, 50),
+                             (unsigned long)percentile(m, seen, delta, 95), (unsigned long)seen->max,
+                             (unsigned long)delta);
+            }
+            break;
+        }
+    }
+    start_window(reader, now_us);
+    return pos;
+}
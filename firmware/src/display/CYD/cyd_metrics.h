@@ -0,0 +1,49 @@
+#ifndef CYD_METRICS_H
+#define CYD_METRICS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Named runtime metrics in a fixed table: counters (events or bytes, shown as a rate), gauges (a
+// current value) and histograms over fixed bucket bounds (shown as p50/p95/max). Recording is a
+// few adds, with no allocation or formatting.
+//
+// Each reader (the serial line, the on-screen HUD) sees counters and histograms over its own
+// window: from its previous cyd_metrics_format() to this one. Percentiles are the upper bound of
+// the bucket they fall in, capped at the window's exact maximum.
+//
+// Not locked: register, record and format on one task (the LVGL task).
+
+#define CYD_METRICS_MAX 16
+#define CYD_METRICS_MAX_BOUNDS 8  // per histogram; one more bucket takes values above the last bound
+#define CYD_METRICS_READERS 2
+#define CYD_METRIC_NONE 0xFF      // registry or readers full; recording to it does nothing
+
+typedef uint8_t cyd_metric_t;
+
+// name is kept, not copied; it goes into the formatted output as is (e.g. "flush_us").
+cyd_metric_t cyd_metrics_counter(const char *name);
+cyd_metric_t cyd_metrics_gauge(const char *name);
+// bounds: n ascending upper bounds (inclusive), kept, not copied.
+cyd_metric_t cyd_metrics_histogram(const char *name, const uint32_t *bounds, uint8_t n);
+
+void cyd_metrics_add(cyd_metric_t m, uint32_t n);
+void cyd_metrics_set(cyd_metric_t m, int32_t value);
+void cyd_metrics_observe(cyd_metric_t m, uint32_t value);
+
+// A new reader whose first window starts now.
+uint8_t cyd_metrics_reader(void);
+// Every metric as "name=value", separated by sep, e.g. "frames=29.8/s flush_us=16000/33000/31250(149)
+// lv_used=24576"; histograms with no values in the window show "-". Starts the reader's next
+// window. Returns the length written (the text is cut to fit len).
+size_t cyd_metrics_format(uint8_t reader, char sep, char *buf, size_t len);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // CYD_METRICS_H
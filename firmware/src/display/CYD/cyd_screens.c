@@ -0,0 +1,179 @@
+#include "cyd_screens.h"
+
+#include <esp_timer.h>
+#include "ui.h"
+
+typedef struct {
+    const char *name;
+    lv_obj_t **screen;
+    void (*init)(void);
+    void (*destroy)(void);
+} screen_def_t;
+
+typedef struct {
+    uint32_t bytes;     // LVGL heap held by the built screen; 0 once it is on its way out
+    uint32_t size;      // LVGL heap the last build took, kept to make room before rebuilding
+    uint32_t build_us;
+    uint32_t last_use;  // 0: never shown since built
+    bool prefetched;    // built ahead of its navigation and not shown yet
+} slot_t;
+
+static const screen_def_t SCREENS[CYD_SCREEN_COUNT] = {
+    [CYD_SCREEN_BOOT] = {"boot", &ui_boot, ui_boot_screen_init, ui_boot_screen_destroy},
+    [CYD_SCREEN_HOME] = {"home", &ui_home, ui_home_screen_init, ui_home_screen_destroy},
+    [CYD_SCREEN_FRESH] = {"fresh", &ui_fresh, ui_fresh_screen_init, ui_fresh_screen_destroy},
+    [CYD_SCREEN_FRESHFAULTS] = {"freshfaults", &ui_freshfaults, ui_freshfaults_screen_init,
+                                ui_freshfaults_screen_destroy},
+    [CYD_SCREEN_FRESHSETTINGS] = {"freshsettings", &ui_freshsettings, ui_freshsettings_screen_init,
+                                  ui_freshsettings_screen_destroy},
+    [CYD_SCREEN_WASTE] = {"waste", &ui_waste, ui_waste_screen_init, ui_waste_screen_destroy},
+    [CYD_SCREEN_WASTEFAULTS] = {"wastefaults", &ui_wastefaults, ui_wastefaults_screen_init,
+                                ui_wastefaults_screen_destroy},
+    [CYD_SCREEN_WASTESETTINGS] = {"wastesettings", &ui_wastesettings, ui_wastesettings_screen_init,
+                                  ui_wastesettings_screen_destroy},
+    [CYD_SCREEN_CYDSETTINGS] = {"cydsettings", &ui_cydsettings, ui_cydsettings_screen_init,
+                                ui_cydsettings_screen_destroy},
+};
+
+static slot_t s_slots[CYD_SCREEN_COUNT];
+static cyd_screens_built_cb_t s_built_cb;
+static size_t s_budget;
+static size_t s_bytes;
+static uint32_t s_clock;
+static uint32_t s_builds;
+static uint32_t s_evictions;
+static uint32_t s_prefetch_hits;
+static cyd_screens_nav_t s_nav;
+static bool s_nav_pending;
+
+cyd_screen_t cyd_screens_find(const lv_obj_t *obj) {
+    if (obj == NULL) return CYD_SCREEN_COUNT;
+    for (int i = 0; i < CYD_SCREEN_COUNT; i++) {
+        if (*SCREENS[i].screen == obj) return (cyd_screen_t)i;
+    }
+    return CYD_SCREEN_COUNT;
+}
+
+static void screen_delete_cb(lv_event_t *e) {
+    slot_t *slot = &s_slots[(uintptr_t)lv_event_get_user_data(e)];
+    s_bytes -= slot->bytes;
+    slot->bytes = 0;
+    slot->prefetched = false;
+}
+
+static void build(cyd_screen_t id) {
+    lv_mem_monitor_t before;
+    lv_mem_monitor_t after;
+    lv_mem_monitor(&before);
+    const int64_t start = esp_timer_get_time();
+    SCREENS[id].init();
+    lv_obj_add_event_cb(*SCREENS[id].screen, screen_delete_cb, LV_EVENT_DELETE, (void *)(uintptr_t)id);
+    if (s_built_cb) s_built_cb(id);
+    lv_mem_monitor(&after);
+
+    slot_t *slot = &s_slots[id];
+    slot->build_us = (uint32_t)(esp_timer_get_time() - start);
+    slot->bytes = before.free_size > after.free_size ? (uint32_t)(before.free_size - after.free_size) : 0;
+    slot->size = slot->bytes;
+    slot->last_use = 0;
+    s_bytes += slot->bytes;
+    s_builds++;
+}
+
+// Destroy least recently shown screens until the cache fits its budget with reserve bytes to
+// spare, sparing keep. The active screen is only evicted when leaving, and then through
+// scr_unloaded_delete_cb so it is deleted once the next screen has replaced it.
+static void trim(cyd_screen_t keep, bool leaving, size_t reserve) {
+    const cyd_screen_t active = cyd_screens_active();
+    while (s_bytes + reserve > s_budget) {
+        cyd_screen_t victim = CYD_SCREEN_COUNT;
+        for (int i = 0; i < CYD_SCREEN_COUNT; i++) {
+            if (i == keep || *SCREENS[i].screen == NULL || s_slots[i].bytes == 0) continue;
+            if (i == active && !leaving) continue;
+            if (victim == CYD_SCREEN_COUNT || s_slots[i].last_use < s_slots[victim].last_use) victim = (cyd_screen_t)i;
+        }
+        if (victim == CYD_SCREEN_COUNT) return;
+        s_evictions++;
+        if (victim == active) {
+            s_bytes -= s_slots[victim].bytes;
+            s_slots[victim].bytes = 0;
+            lv_obj_add_event_cb(*SCREENS[victim].screen, scr_unloaded_delete_cb, LV_EVENT_SCREEN_UNLOADED,
+                                (void *)SCREENS[victim].destroy);
+        } else {
+            SCREENS[victim].destroy();
+        }
+    }
+}
+
+void cyd_screens_init(size_t budget_bytes, cyd_screens_built_cb_t built_cb) {
+    s_budget = budget_bytes;
+    s_built_cb = built_cb;
+}
+
+lv_obj_t *cyd_screens_prefetch(cyd_screen_t screen) {
+    if (screen >= CYD_SCREEN_COUNT) return NULL;
+    if (*SCREENS[screen].screen == NULL) {
+        trim(screen, false, s_slots[screen].size);
+        build(screen);
+        s_slots[screen].prefetched = true;
+        trim(screen, false, 0);
+    }
+    return *SCREENS[screen].screen;
+}
+
+void cyd_screens_show(cyd_screen_t screen) {
+    if (screen >= CYD_SCREEN_COUNT) return;
+    slot_t *slot = &s_slots[screen];
+    s_nav.from = cyd_screens_active();
+    s_nav.to = screen;
+    s_nav.start_us = esp_timer_get_time();
+    s_nav.prefetched = slot->prefetched;
+    s_nav.build_us = 0;
+    if (*SCREENS[screen].screen == NULL) {
+        trim(screen, true, slot->size);
+        build(screen);
+        s_nav.build_us = slot->build_us;
+    } else if (slot->prefetched) {
+        s_nav.build_us = slot->build_us;
+        s_prefetch_hits++;
+    }
+    slot->prefetched = false;
+    slot->last_use = ++s_clock;
+    s_nav_pending = s_nav.from != screen;
+    trim(screen, true, 0);
+    _ui_screen_change(SCREENS[screen].screen, LV_SCR_LOAD_ANIM_NONE, 0, 0, NULL);
+}
+
+cyd_screen_t cyd_screens_active(void) {
+    return cyd_screens_find(lv_screen_active());
+}
+
+lv_obj_t *cyd_screens_get(cyd_screen_t screen) {
+    return screen < CYD_SCREEN_COUNT ? *SCREENS[screen].screen : NULL;
+}
+
+const char *cyd_screens_name(cyd_screen_t screen) {
+    return screen < CYD_SCREEN_COUNT ? SCREENS[screen].name : "?";
+}
+
+bool cyd_screens_take_nav(cyd_screens_nav_t *out) {
+    if (!s_nav_pending) return false;
+    s_nav_pending = false;
+    *out = s_nav;
+    return true;
+}
+
+void cyd_screens_get_stats(cyd_screens_stats_t *out) {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    out->screens = 0;
+    for (int i = 0; i < CYD_SCREEN_COUNT; i++) {
+        if (*SCREENS[i].screen) out->screens++;
+    }
+    out->bytes = (uint32_t)s_bytes;
+    out->budget = (uint32_t)s_budget;
+    out->builds = s_builds;
+    out->evictions = s_evictions;
+    out->prefetch_hits = s_prefetch_hits;
+    out->lv_peak = (uint32_t)mon.max_used;
+}
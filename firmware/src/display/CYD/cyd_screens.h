@@ -0,0 +1,78 @@
+#ifndef CYD_SCREENS_H
+#define CYD_SCREENS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Lazily built SquareLine screens. A screen is created the first time it is prefetched or shown
+// and then kept in an LRU cache whose budget is measured in LVGL heap (the LV_MEM_SIZE pool).
+// When a build pushes the cache over budget, the least recently shown screens are destroyed with
+// their SquareLine destroy functions; the active screen is never deleted while it is shown, it is
+// handed to scr_unloaded_delete_cb and goes when the next screen replaces it.
+//
+// Everything that wires up a screen after SquareLine built it (custom actions, gauge swaps, state)
+// belongs in the built callback, since a screen may be built and destroyed many times. Widget
+// pointers of screens that are not built are NULL.
+
+typedef enum {
+    CYD_SCREEN_BOOT = 0,
+    CYD_SCREEN_HOME,
+    CYD_SCREEN_FRESH,
+    CYD_SCREEN_FRESHFAULTS,
+    CYD_SCREEN_FRESHSETTINGS,
+    CYD_SCREEN_WASTE,
+    CYD_SCREEN_WASTEFAULTS,
+    CYD_SCREEN_WASTESETTINGS,
+    CYD_SCREEN_CYDSETTINGS,
+    CYD_SCREEN_COUNT,  // also "none of these"
+} cyd_screen_t;
+
+typedef void (*cyd_screens_built_cb_t)(cyd_screen_t screen);
+
+typedef struct {
+    uint32_t screens;        // screens currently built
+    uint32_t bytes;          // LVGL heap they use
+    uint32_t budget;
+    uint32_t builds;         // since boot
+    uint32_t evictions;      // since boot
+    uint32_t prefetch_hits;  // navigations whose target was built at press time
+    uint32_t lv_peak;        // LVGL heap high-water mark
+} cyd_screens_stats_t;
+
+// One navigation, for latency logging.
+typedef struct {
+    cyd_screen_t from;
+    cyd_screen_t to;
+    uint32_t build_us;  // time to build the target; 0 if it was cached
+    bool prefetched;    // built by cyd_screens_prefetch() before the navigation
+    int64_t start_us;   // esp_timer time of cyd_screens_show()
+} cyd_screens_nav_t;
+
+// Call after lv_init() and once the display and theme are set up; builds nothing yet.
+void cyd_screens_init(size_t budget_bytes, cyd_screens_built_cb_t built_cb);
+// Build the screen if it is not built. Call on LV_EVENT_PRESSED of a navigation button so the
+// screen is ready by LV_EVENT_CLICKED.
+lv_obj_t *cyd_screens_prefetch(cyd_screen_t screen);
+// Build (if needed) and load the screen.
+void cyd_screens_show(cyd_screen_t screen);
+cyd_screen_t cyd_screens_active(void);
+// The screen object, or NULL while it is not built.
+lv_obj_t *cyd_screens_get(cyd_screen_t screen);
+// Which screen obj is; CYD_SCREEN_COUNT for anything else (including NULL).
+cyd_screen_t cyd_screens_find(const lv_obj_t *obj);
+const char *cyd_screens_name(cyd_screen_t screen);
+// The latest navigation not yet taken; call when its first frame is drawn.
+bool cyd_screens_take_nav(cyd_screens_nav_t *out);
+void cyd_screens_get_stats(cyd_screens_stats_t *out);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // CYD_SCREENS_H
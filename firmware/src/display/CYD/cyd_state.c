@@ -5,6 +5,9 @@
 #include <math.h>
 #include <lvgl.h>
 #include "ui.h"
+#include "cyd_gauge.h"
+#include "cyd_label.h"
+#include "cyd_ui_task.h"
 
 cyd_state_t cyd_state;
 
@@ -13,6 +16,13 @@ static const uint8_t SETTING_INVALID = 0xFF;
 static const uint16_t VOLT_INVALID = 0xFFFF;
 static const uint16_t FAULT_INVALID = 0xFFFF;
 
+#define FIELD(name) CYD_FIELD_BIT(CYD_FIELD_##name)
+#define ALL_FIELDS (CYD_FIELD_BIT(CYD_FIELD_COUNT) - 1u)
+
+static uint32_t s_version = 1;
+static uint32_t s_field_version[2][CYD_FIELD_COUNT];  // fresh, waste
+static uint32_t s_synced[CYD_SCREEN_COUNT];           // version each screen shows; 0: nothing yet
+
 void cyd_state_init_defaults(void) {
     memset(&cyd_state, 0, sizeof(cyd_state));
 
@@ -84,194 +94,209 @@ static const char *cyd_tank_status_to_string(tank_status_t status) {
 
 static bool s_units_metric = true;
 
+// Change tracking
+
+void cyd_state_mark_changed(tank_state_t *tank, uint32_t fields) {
+    uint32_t *versions = s_field_version[tank == &cyd_state.waste];
+    s_version++;
+    for (int f = 0; f < CYD_FIELD_COUNT; f++) {
+        if (fields & CYD_FIELD_BIT(f)) versions[f] = s_version;
+    }
+    // The binder runs before LVGL's next pass; do not leave it to the next timer.
+    cyd_ui_wake();
+}
+
+// Fields of tank changed after version since.
+static uint32_t changed_since(const tank_state_t *tank, uint32_t since) {
+    if (since == 0) return ALL_FIELDS;
+    const uint32_t *versions = s_field_version[tank == &cyd_state.waste];
+    uint32_t fields = 0;
+    for (int f = 0; f < CYD_FIELD_COUNT; f++) {
+        if (versions[f] > since) fields |= CYD_FIELD_BIT(f);
+    }
+    return fields;
+}
+
+#define SET_FIELD(tank, member, value, field)           \
+    do {                                                \
+        if ((tank)->member == (value)) return;          \
+        (tank)->member = (value);                       \
+        cyd_state_mark_changed((tank), FIELD(field));   \
+    } while (0)
+
+void cyd_state_set_paired(tank_state_t *tank, bool paired) {
+    SET_FIELD(tank, paired, paired, PAIRED);
+}
+
+void cyd_state_set_level(tank_state_t *tank, uint8_t percent) {
+    SET_FIELD(tank, level_percent, percent, LEVEL);
+}
+
+void cyd_state_set_temp(tank_state_t *tank, float temp_c) {
+    if (isnan(tank->temp_c) && isnan(temp_c)) return;
+    SET_FIELD(tank, temp_c, temp_c, TEMP);
+}
+
+void cyd_state_set_status(tank_state_t *tank, tank_status_t status) {
+    SET_FIELD(tank, status, status, STATUS);
+}
+
+void cyd_state_set_leak(tank_state_t *tank, bool leak) {
+    SET_FIELD(tank, leak, leak, LEAK);
+}
+
+void cyd_state_set_freeze(tank_state_t *tank, uint8_t setting) {
+    if (tank->freeze_setting == setting) return;
+    tank->freeze_setting = setting;
+    tank->freeze_enabled = setting != SETTING_INVALID && setting > 0;
+    cyd_state_mark_changed(tank, FIELD(FREEZE));
+}
+
+void cyd_state_set_fault(tank_state_t *tank, uint16_t code, const char *description) {
+    if (description == NULL) description = "";
+    if (tank->fault_code == code && strncmp(tank->fault_description, description, sizeof(tank->fault_description) - 1) == 0) {
+        return;
+    }
+    tank->fault_code = code;
+    strncpy(tank->fault_description, description, sizeof(tank->fault_description) - 1);
+    tank->fault_description[sizeof(tank->fault_description) - 1] = '\0';
+    cyd_state_mark_changed(tank, FIELD(FAULT));
+}
+
+void cyd_state_set_stop_level(tank_state_t *tank, uint8_t percent) {
+    SET_FIELD(tank, stop_level_percent, percent, STOP_LEVEL);
+}
+
+void cyd_state_set_full_voltage(tank_state_t *tank, uint16_t mv) {
+    SET_FIELD(tank, full_voltage_mv, mv, FULL_MV);
+}
+
+void cyd_state_set_empty_voltage(tank_state_t *tank, uint16_t mv) {
+    SET_FIELD(tank, empty_voltage_mv, mv, EMPTY_MV);
+}
+
+void cyd_state_set_safety_override(tank_state_t *tank, bool enabled) {
+    SET_FIELD(tank, safety_override_enabled, enabled, SAFETY);
+}
+
+void cyd_state_set_valve_override(tank_state_t *tank, bool enabled) {
+    SET_FIELD(tank, valve_override_enabled, enabled, VALVE);
+}
+
 void cyd_state_set_units_metric(bool metric) {
+    if (s_units_metric == metric) return;
     s_units_metric = metric;
+    cyd_state_mark_changed(&cyd_state.fresh, FIELD(UNITS));
+    cyd_state_mark_changed(&cyd_state.waste, FIELD(UNITS));
 }
 
 bool cyd_state_units_metric(void) {
     return s_units_metric;
 }
 
-void cyd_state_apply_to_home_screen(void) {
-    const bool fresh_valid = cyd_state.fresh.paired && cyd_state.fresh.level_percent != LEVEL_INVALID;
-    const bool waste_valid = cyd_state.waste.paired && cyd_state.waste.level_percent != LEVEL_INVALID;
-    if (ui_homeFreshLevelArc) {
-        lv_arc_set_value(ui_homeFreshLevelArc, fresh_valid ? cyd_state.fresh.level_percent : 0);
-    }
-    if (ui_homeFreshLevelLabel) {
-        if (fresh_valid) lv_label_set_text_fmt(ui_homeFreshLevelLabel, "%u%%", cyd_state.fresh.level_percent);
-        else lv_label_set_text(ui_homeFreshLevelLabel, "--");
-    }
-    if (ui_homeFreshTempLabel) {
-        if (cyd_state.fresh.paired && !isnan(cyd_state.fresh.temp_c)) {
-            char buf[16];
-            const float temp = s_units_metric ? cyd_state.fresh.temp_c : (cyd_state.fresh.temp_c * 9.0f / 5.0f) + 32.0f;
-            snprintf(buf, sizeof(buf), "%.1f°%c", temp, s_units_metric ? 'C' : 'F');
-            lv_label_set_text(ui_homeFreshTempLabel, buf);
-        } else {
-            lv_label_set_text(ui_homeFreshTempLabel, "--");
-        }
-    }
-    if (ui_homeFreshStatusLabel) {
-        if (!cyd_state.fresh.paired) lv_label_set_text(ui_homeFreshStatusLabel, "--");
-        else lv_label_set_text(ui_homeFreshStatusLabel, cyd_tank_status_to_string(cyd_state.fresh.status));
-    }
+// Widgets. Each helper takes the tank's changed fields and leaves its widgets alone unless one
+// of their source fields is among them.
 
-    if (ui_homeGreyLevelArc) {
-        lv_arc_set_value(ui_homeGreyLevelArc, waste_valid ? cyd_state.waste.level_percent : 0);
-    }
-    if (ui_homeGreyLevelLabel) {
-        if (waste_valid) lv_label_set_text_fmt(ui_homeGreyLevelLabel, "%u%%", cyd_state.waste.level_percent);
-        else lv_label_set_text(ui_homeGreyLevelLabel, "--");
-    }
-    if (ui_homeGreyTempLabel) {
-        if (cyd_state.waste.paired && !isnan(cyd_state.waste.temp_c)) {
-            char buf[16];
-            const float temp = s_units_metric ? cyd_state.waste.temp_c : (cyd_state.waste.temp_c * 9.0f / 5.0f) + 32.0f;
-            snprintf(buf, sizeof(buf), "%.1f°%c", temp, s_units_metric ? 'C' : 'F');
-            lv_label_set_text(ui_homeGreyTempLabel, buf);
-        } else {
-            lv_label_set_text(ui_homeGreyTempLabel, "--");
-        }
-    }
-    if (ui_homeGreyStatusLabel) {
-        if (!cyd_state.waste.paired) lv_label_set_text(ui_homeGreyStatusLabel, "--");
-        else lv_label_set_text(ui_homeGreyStatusLabel, cyd_tank_status_to_string(cyd_state.waste.status));
+static void apply_level(lv_obj_t *gauge, lv_obj_t *label, const tank_state_t *t, uint32_t changed) {
+    if (!(changed & (FIELD(PAIRED) | FIELD(LEVEL)))) return;
+    const bool valid = t->paired && t->level_percent != LEVEL_INVALID;
+    if (gauge) cyd_gauge_set_value(gauge, valid ? t->level_percent : 0);
+    if (label) {
+        if (valid) cyd_label_set_percent(label, t->level_percent);
+        else cyd_label_set_static(label, "--");
     }
 }
 
-void cyd_state_apply_to_fresh_screen(void) {
-    const bool valid = cyd_state.fresh.paired && cyd_state.fresh.level_percent != LEVEL_INVALID;
-    if (ui_freshLevelBar) {
-        lv_bar_set_value(ui_freshLevelBar, valid ? cyd_state.fresh.level_percent : 0, LV_ANIM_OFF);
-    }
-    if (ui_freshLevelLabel) {
-        if (valid) lv_label_set_text_fmt(ui_freshLevelLabel, "%u%%", cyd_state.fresh.level_percent);
-        else lv_label_set_text(ui_freshLevelLabel, "--");
-    }
-    if (ui_freshTempLabel) {
-        if (cyd_state.fresh.paired && !isnan(cyd_state.fresh.temp_c)) {
-            char buf[16];
-            const float temp = s_units_metric ? cyd_state.fresh.temp_c : (cyd_state.fresh.temp_c * 9.0f / 5.0f) + 32.0f;
-            snprintf(buf, sizeof(buf), "%.1f°%c", temp, s_units_metric ? 'C' : 'F');
-            lv_label_set_text(ui_freshTempLabel, buf);
-        } else {
-            lv_label_set_text(ui_freshTempLabel, "--");
-        }
-    }
-    if (ui_FreshStatusLabel) {
-        if (!cyd_state.fresh.paired) lv_label_set_text(ui_FreshStatusLabel, "--");
-        else lv_label_set_text(ui_FreshStatusLabel, cyd_tank_status_to_string(cyd_state.fresh.status));
-    }
-    if (ui_freshLeakLabel) {
-        if (!cyd_state.fresh.paired) lv_label_set_text(ui_freshLeakLabel, "--");
-        else lv_label_set_text(ui_freshLeakLabel, cyd_state.fresh.leak ? "Leak" : "No Leak");
-    }
-    if (ui_freshFreezeLabel) {
-        if (!cyd_state.fresh.paired) lv_label_set_text(ui_freshFreezeLabel, "--");
-        else lv_label_set_text(ui_freshFreezeLabel, cyd_state.fresh.freeze_enabled ? "Freeze On" : "Freeze Off");
-    }
-    if (ui_freshFaultButtonLabel) {
-        if (!cyd_state.fresh.paired || cyd_state.fresh.fault_code == FAULT_INVALID) {
-            lv_label_set_text(ui_freshFaultButtonLabel, "Fault --");
-        } else {
-            lv_label_set_text_fmt(ui_freshFaultButtonLabel, "Fault %u", cyd_state.fresh.fault_code);
-        }
-    }
+static void apply_temp(lv_obj_t *label, const tank_state_t *t, uint32_t changed) {
+    if (!label || !(changed & (FIELD(PAIRED) | FIELD(TEMP) | FIELD(UNITS)))) return;
+    if (t->paired && !isnan(t->temp_c)) cyd_label_set_temp(label, (int32_t)lroundf(t->temp_c * 10.0f), !s_units_metric);
+    else cyd_label_set_static(label, "--");
 }
 
-void cyd_state_apply_to_waste_screen(void) {
-    const bool valid = cyd_state.waste.paired && cyd_state.waste.level_percent != LEVEL_INVALID;
-    if (ui_wasteLevelBar) {
-        lv_bar_set_value(ui_wasteLevelBar, valid ? cyd_state.waste.level_percent : 0, LV_ANIM_OFF);
-    }
-    if (ui_wasteLevelLabel) {
-        if (valid) lv_label_set_text_fmt(ui_wasteLevelLabel, "%u%%", cyd_state.waste.level_percent);
-        else lv_label_set_text(ui_wasteLevelLabel, "--");
-    }
-    if (ui_wasteTempLabel) {
-        if (cyd_state.waste.paired && !isnan(cyd_state.waste.temp_c)) {
-            char buf[16];
-            const float temp = s_units_metric ? cyd_state.waste.temp_c : (cyd_state.waste.temp_c * 9.0f / 5.0f) + 32.0f;
-            snprintf(buf, sizeof(buf), "%.1f°%c", temp, s_units_metric ? 'C' : 'F');
-            lv_label_set_text(ui_wasteTempLabel, buf);
-        } else {
-            lv_label_set_text(ui_wasteTempLabel, "--");
-        }
-    }
-    if (ui_wasteStatusLabel) {
-        if (!cyd_state.waste.paired) lv_label_set_text(ui_wasteStatusLabel, "--");
-        else lv_label_set_text(ui_wasteStatusLabel, cyd_tank_status_to_string(cyd_state.waste.status));
-    }
-    if (ui_wasteLeakLabel) {
-        if (!cyd_state.waste.paired) lv_label_set_text(ui_wasteLeakLabel, "--");
-        else lv_label_set_text(ui_wasteLeakLabel, cyd_state.waste.leak ? "Leak" : "No Leak");
-    }
-    if (ui_wasteFreezeLabel) {
-        if (!cyd_state.waste.paired) lv_label_set_text(ui_wasteFreezeLabel, "--");
-        else lv_label_set_text(ui_wasteFreezeLabel, cyd_state.waste.freeze_enabled ? "Freeze On" : "Freeze Off");
-    }
-    if (ui_wasteFaultButtonLabel) {
-        if (!cyd_state.waste.paired || cyd_state.waste.fault_code == FAULT_INVALID) {
-            lv_label_set_text(ui_wasteFaultButtonLabel, "Fault --");
-        } else {
-            lv_label_set_text_fmt(ui_wasteFaultButtonLabel, "Fault %u", cyd_state.waste.fault_code);
-        }
-    }
+static void apply_status(lv_obj_t *label, const tank_state_t *t, uint32_t changed) {
+    if (!label || !(changed & (FIELD(PAIRED) | FIELD(STATUS)))) return;
+    cyd_label_set_static(label, t->paired ? cyd_tank_status_to_string(t->status) : "--");
 }
 
-void cyd_state_apply_to_freshfaults_screen(void) {
-    if (ui_freshfaultsCodeLabel) {
-        if (!cyd_state.fresh.paired || cyd_state.fresh.fault_code == FAULT_INVALID) {
-            lv_label_set_text(ui_freshfaultsCodeLabel, "--");
-        } else {
-            lv_label_set_text_fmt(ui_freshfaultsCodeLabel, "%u", cyd_state.fresh.fault_code);
-        }
-    }
-    if (ui_freshfaultsCodeDescription) {
-        if (!cyd_state.fresh.paired) {
-            lv_label_set_text(ui_freshfaultsCodeDescription, "No Controller Connected");
-        } else if (cyd_state.fresh.fault_code == FAULT_INVALID || cyd_state.fresh.status != TANK_STATUS_FAULT) {
-            lv_label_set_text(ui_freshfaultsCodeDescription, "No Active Fault");
-        } else {
-            lv_label_set_text(ui_freshfaultsCodeDescription, cyd_state.fresh.fault_description);
-        }
-    }
+static void apply_flag(lv_obj_t *label, const tank_state_t *t, uint32_t changed, uint32_t field, bool on,
+                       const char *on_text, const char *off_text) {
+    if (!label || !(changed & (FIELD(PAIRED) | field))) return;
+    cyd_label_set_static(label, !t->paired ? "--" : (on ? on_text : off_text));
 }
 
-void cyd_state_apply_to_wastefaults_screen(void) {
-    if (ui_wastefaultsCodeLabel) {
-        if (!cyd_state.waste.paired || cyd_state.waste.fault_code == FAULT_INVALID) {
-            lv_label_set_text(ui_wastefaultsCodeLabel, "--");
-        } else {
-            lv_label_set_text_fmt(ui_wastefaultsCodeLabel, "%u", cyd_state.waste.fault_code);
-        }
-    }
-    if (ui_wastefaultsCodeDescription) {
-        if (!cyd_state.waste.paired) {
-            lv_label_set_text(ui_wastefaultsCodeDescription, "No Controller Connected");
-        } else if (cyd_state.waste.fault_code == FAULT_INVALID || cyd_state.waste.status != TANK_STATUS_FAULT) {
-            lv_label_set_text(ui_wastefaultsCodeDescription, "No Active Fault");
+static void apply_fault_button(lv_obj_t *label, const tank_state_t *t, uint32_t changed) {
+    if (!label || !(changed & (FIELD(PAIRED) | FIELD(FAULT)))) return;
+    if (!t->paired || t->fault_code == FAULT_INVALID) cyd_label_set_static(label, "Fault --");
+    else cyd_label_set_int(label, "Fault ", t->fault_code, NULL);
+}
+
+static void apply_home(uint32_t fresh, uint32_t waste) {
+    apply_level(ui_homeFreshLevelArc, ui_homeFreshLevelLabel, &cyd_state.fresh, fresh);
+    apply_temp(ui_homeFreshTempLabel, &cyd_state.fresh, fresh);
+    apply_status(ui_homeFreshStatusLabel, &cyd_state.fresh, fresh);
+
+    apply_level(ui_homeGreyLevelArc, ui_homeGreyLevelLabel, &cyd_state.waste, waste);
+    apply_temp(ui_homeGreyTempLabel, &cyd_state.waste, waste);
+    apply_status(ui_homeGreyStatusLabel, &cyd_state.waste, waste);
+}
+
+static void apply_fresh(uint32_t changed) {
+    const tank_state_t *t = &cyd_state.fresh;
+    apply_level(ui_freshLevelBar, ui_freshLevelLabel, t, changed);
+    apply_temp(ui_freshTempLabel, t, changed);
+    apply_status(ui_FreshStatusLabel, t, changed);
+    apply_flag(ui_freshLeakLabel, t, changed, FIELD(LEAK), t->leak, "Leak", "No Leak");
+    apply_flag(ui_freshFreezeLabel, t, changed, FIELD(FREEZE), t->freeze_enabled, "Freeze On", "Freeze Off");
+    apply_fault_button(ui_freshFaultButtonLabel, t, changed);
+}
+
+static void apply_waste(uint32_t changed) {
+    const tank_state_t *t = &cyd_state.waste;
+    apply_level(ui_wasteLevelBar, ui_wasteLevelLabel, t, changed);
+    apply_temp(ui_wasteTempLabel, t, changed);
+    apply_status(ui_wasteStatusLabel, t, changed);
+    apply_flag(ui_wasteLeakLabel, t, changed, FIELD(LEAK), t->leak, "Leak", "No Leak");
+    apply_flag(ui_wasteFreezeLabel, t, changed, FIELD(FREEZE), t->freeze_enabled, "Freeze On", "Freeze Off");
+    apply_fault_button(ui_wasteFaultButtonLabel, t, changed);
+}
+
+static void apply_faults(lv_obj_t *code, lv_obj_t *description, const tank_state_t *t, uint32_t changed) {
+    if (!(changed & (FIELD(PAIRED) | FIELD(FAULT) | FIELD(STATUS)))) return;
+    if (code) {
+        if (!t->paired || t->fault_code == FAULT_INVALID) cyd_label_set_static(code, "--");
+        else cyd_label_set_int(code, NULL, t->fault_code, NULL);
+    }
+    if (description) {
+        if (!t->paired) {
+            cyd_label_set_static(description, "No Controller Connected");
+        } else if (t->fault_code == FAULT_INVALID || t->status != TANK_STATUS_FAULT) {
+            cyd_label_set_static(description, "No Active Fault");
         } else {
-            lv_label_set_text(ui_wastefaultsCodeDescription, cyd_state.waste.fault_description);
+            cyd_label_set_text(description, t->fault_description);
         }
     }
 }
 
-static void apply_fill_stop(lv_obj_t *slider, lv_obj_t *label, uint8_t percent) {
-    if (slider) {
-        lv_slider_set_value(slider, percent == SETTING_INVALID ? 0 : percent, LV_ANIM_OFF);
+static void apply_stop_level(lv_obj_t *slider, lv_obj_t *overlay_label, lv_obj_t *label, const tank_state_t *t,
+                             uint32_t changed) {
+    const uint8_t percent = t->stop_level_percent;
+    if (changed & FIELD(STOP_LEVEL)) {
+        if (slider) lv_slider_set_value(slider, percent == SETTING_INVALID ? 0 : percent, LV_ANIM_OFF);
+        if (overlay_label) {
+            if (percent == SETTING_INVALID) cyd_label_set_static(overlay_label, "--");
+            else cyd_label_set_percent(overlay_label, percent);
+        }
     }
-    if (label) {
-        if (percent == SETTING_INVALID) lv_label_set_text(label, "--");
-        else lv_label_set_text_fmt(label, "%u%%", percent);
+    if (label && (changed & (FIELD(PAIRED) | FIELD(STOP_LEVEL)))) {
+        if (percent == SETTING_INVALID || !t->paired) cyd_label_set_static(label, "--");
+        else cyd_label_set_percent(label, percent);
     }
 }
 
 static void apply_voltage(lv_obj_t *label, uint16_t mv) {
     if (!label) return;
-    if (mv == VOLT_INVALID) lv_label_set_text(label, "--");
-    else lv_label_set_text_fmt(label, "%.2fV", mv / 1000.0f);
+    if (mv == VOLT_INVALID) cyd_label_set_static(label, "--");
+    else cyd_label_set_millivolts(label, mv);
 }
 
 static void apply_toggle(lv_obj_t *sw, bool on) {
@@ -280,106 +305,66 @@ static void apply_toggle(lv_obj_t *sw, bool on) {
     else lv_obj_clear_state(sw, LV_STATE_CHECKED);
 }
 
-static void apply_freeze_options(lv_obj_t *dd, uint8_t setting) {
+static void apply_freeze_options(lv_obj_t *dd, uint8_t setting, uint32_t changed) {
     if (!dd) return;
-    char opts[64];
-    if (s_units_metric) {
-        snprintf(opts, sizeof(opts), "Off\n1\n2\n3\n4\n5");
-    } else {
-        int f1 = lroundf(1.0f * 9.0f / 5.0f + 32.0f);
-        int f2 = lroundf(2.0f * 9.0f / 5.0f + 32.0f);
-        int f3 = lroundf(3.0f * 9.0f / 5.0f + 32.0f);
-        int f4 = lroundf(4.0f * 9.0f / 5.0f + 32.0f);
-        int f5 = lroundf(5.0f * 9.0f / 5.0f + 32.0f);
-        snprintf(opts, sizeof(opts), "Off\n%d\n%d\n%d\n%d\n%d", f1, f2, f3, f4, f5);
+    if (changed & FIELD(UNITS)) {
+        char opts[64];
+        if (s_units_metric) {
+            snprintf(opts, sizeof(opts), "Off\n1\n2\n3\n4\n5");
+        } else {
+            int f1 = lroundf(1.0f * 9.0f / 5.0f + 32.0f);
+            int f2 = lroundf(2.0f * 9.0f / 5.0f + 32.0f);
+            int f3 = lroundf(3.0f * 9.0f / 5.0f + 32.0f);
+            int f4 = lroundf(4.0f * 9.0f / 5.0f + 32.0f);
+            int f5 = lroundf(5.0f * 9.0f / 5.0f + 32.0f);
+            snprintf(opts, sizeof(opts), "Off\n%d\n%d\n%d\n%d\n%d", f1, f2, f3, f4, f5);
+        }
+        lv_dropdown_set_options(dd, opts);
+    } else if (!(changed & FIELD(FREEZE))) {
+        return;
     }
-    lv_dropdown_set_options(dd, opts);
     uint8_t sel = setting;
     if (sel > 5) sel = 0;
     lv_dropdown_set_selected(dd, sel);
 }
 
-void cyd_state_apply_to_freshsettings_screen(void) {
-    apply_fill_stop(ui_freshsettingsOverlayFillSlider, ui_freshsettingsOverlayFillPercentage, cyd_state.fresh.stop_level_percent);
-    if (ui_freshsettingsFillStopLevelLabel) {
-        if (cyd_state.fresh.stop_level_percent == SETTING_INVALID || !cyd_state.fresh.paired) {
-            lv_label_set_text(ui_freshsettingsFillStopLevelLabel, "--");
-        } else {
-            lv_label_set_text_fmt(ui_freshsettingsFillStopLevelLabel, "%u%%", cyd_state.fresh.stop_level_percent);
-        }
-    }
-    apply_voltage(ui_freshsettingsFullVoltage, cyd_state.fresh.full_voltage_mv);
-    apply_voltage(ui_freshsettingsEmptyVoltage, cyd_state.fresh.empty_voltage_mv);
-    apply_freeze_options(ui_freshsettingsFreezeProtection, cyd_state.fresh.freeze_setting);
-    apply_toggle(ui_freshsettingsSafetyOveride, cyd_state.fresh.safety_override_enabled);
-    apply_toggle(ui_freshsettingsValveOveride, cyd_state.fresh.valve_override_enabled);
-}
-
-void cyd_state_apply_to_wastesettings_screen(void) {
-    apply_fill_stop(ui_wastesettingsOverlayDrainSlider, ui_wastesettingsOverlayDrainPercentage, cyd_state.waste.stop_level_percent);
-    if (ui_wastesettingsDrainStopLevelLabel) {
-        if (cyd_state.waste.stop_level_percent == SETTING_INVALID || !cyd_state.waste.paired) {
-            lv_label_set_text(ui_wastesettingsDrainStopLevelLabel, "--");
-        } else {
-            lv_label_set_text_fmt(ui_wastesettingsDrainStopLevelLabel, "%u%%", cyd_state.waste.stop_level_percent);
-        }
-    }
-    apply_voltage(ui_wastesettingsFullVoltage, cyd_state.waste.full_voltage_mv);
-    apply_voltage(ui_wastesettingsEmptyVoltage, cyd_state.waste.empty_voltage_mv);
-    apply_freeze_options(ui_wastesettingsFreezeProtection, cyd_state.waste.freeze_setting);
-    apply_toggle(ui_wastesettingsSafetyOveride, cyd_state.waste.safety_override_enabled);
-    apply_toggle(ui_wastesettingsValveOveride, cyd_state.waste.valve_override_enabled);
-}
-
-void cyd_state_apply_to_cydsettings_screen(void) {
-    if (ui_cydFirmwareLabel) {
-        lv_label_set_text(ui_cydFirmwareLabel, cyd_state.firmware_version);
-    }
-}
-
-void cyd_state_apply_to_boot_screen(void) {
-    if (ui_bootFirmwareLabel) {
-        lv_label_set_text(ui_bootFirmwareLabel, cyd_state.firmware_version);
-    }
-}
-
-static void apply_diag_overlay(const tank_state_t *t, lv_obj_t *ip, lv_obj_t *id, lv_obj_t *mac,
+static void apply_diag_overlay(const tank_state_t *t, uint32_t changed, lv_obj_t *ip, lv_obj_t *id, lv_obj_t *mac,
                                lv_obj_t *status, lv_obj_t *role, lv_obj_t *uptime,
                                lv_obj_t *signal, lv_obj_t *version) {
+    if (!(changed & (FIELD(PAIRED) | FIELD(DIAG)))) return;
     if (!t->paired) {
-        if (ip) lv_label_set_text(ip, "Not connected");
-        if (id) lv_label_set_text(id, "--");
-        if (mac) lv_label_set_text(mac, "--");
-        if (status) lv_label_set_text(status, "Not connected");
-        if (role) lv_label_set_text(role, "--");
-        if (uptime) lv_label_set_text(uptime, "--");
-        if (signal) lv_label_set_text(signal, "--");
-        if (version) lv_label_set_text(version, "--");
+        cyd_label_set_static(ip, "Not connected");
+        cyd_label_set_static(id, "--");
+        cyd_label_set_static(mac, "--");
+        cyd_label_set_static(status, "Not connected");
+        cyd_label_set_static(role, "--");
+        cyd_label_set_static(uptime, "--");
+        cyd_label_set_static(signal, "--");
+        cyd_label_set_static(version, "--");
         return;
     }
-    if (ip) lv_label_set_text(ip, t->diag_ip[0] ? t->diag_ip : "--");
-    if (id) lv_label_set_text(id, t->diag_id[0] ? t->diag_id : "--");
-    if (mac) lv_label_set_text(mac, t->diag_mac[0] ? t->diag_mac : "--");
-    if (status) lv_label_set_text(status, t->diag_status[0] ? t->diag_status : "--");
-    if (role) lv_label_set_text(role, t->diag_role[0] ? t->diag_role : "--");
-    if (uptime) {
-        if (t->diag_uptime_s == 0) {
-            lv_label_set_text(uptime, "--");
-        } else {
-            uint32_t mins = t->diag_uptime_s / 60;
-            uint32_t secs = t->diag_uptime_s % 60;
-            lv_label_set_text_fmt(uptime, "%lum %02lus", (unsigned long)mins, (unsigned long)secs);
-        }
-    }
-    if (signal) {
-        if (t->diag_signal_dbm == 0) lv_label_set_text(signal, "--");
-        else lv_label_set_text_fmt(signal, "%d dBm", t->diag_signal_dbm);
-    }
-    if (version) lv_label_set_text(version, t->diag_version[0] ? t->diag_version : "--");
+    cyd_label_set_text(ip, t->diag_ip[0] ? t->diag_ip : "--");
+    cyd_label_set_text(id, t->diag_id[0] ? t->diag_id : "--");
+    cyd_label_set_text(mac, t->diag_mac[0] ? t->diag_mac : "--");
+    cyd_label_set_text(status, t->diag_status[0] ? t->diag_status : "--");
+    cyd_label_set_text(role, t->diag_role[0] ? t->diag_role : "--");
+    if (t->diag_uptime_s == 0) cyd_label_set_static(uptime, "--");
+    else cyd_label_set_uptime(uptime, t->diag_uptime_s);
+    if (t->diag_signal_dbm == 0) cyd_label_set_static(signal, "--");
+    else cyd_label_set_int(signal, NULL, t->diag_signal_dbm, " dBm");
+    cyd_label_set_text(version, t->diag_version[0] ? t->diag_version : "--");
 }
 
-void cyd_state_apply_to_freshsettings_diag_overlay(void) {
-    apply_diag_overlay(&cyd_state.fresh,
+static void apply_freshsettings(uint32_t changed) {
+    const tank_state_t *t = &cyd_state.fresh;
+    apply_stop_level(ui_freshsettingsOverlayFillSlider, ui_freshsettingsOverlayFillPercentage,
+                     ui_freshsettingsFillStopLevelLabel, t, changed);
+    if (changed & FIELD(FULL_MV)) apply_voltage(ui_freshsettingsFullVoltage, t->full_voltage_mv);
+    if (changed & FIELD(EMPTY_MV)) apply_voltage(ui_freshsettingsEmptyVoltage, t->empty_voltage_mv);
+    apply_freeze_options(ui_freshsettingsFreezeProtection, t->freeze_setting, changed);
+    if (changed & FIELD(SAFETY)) apply_toggle(ui_freshsettingsSafetyOveride, t->safety_override_enabled);
+    if (changed & FIELD(VALVE)) apply_toggle(ui_freshsettingsValveOveride, t->valve_override_enabled);
+    apply_diag_overlay(t, changed,
                        ui_freshsettingsdiagoverlayIP,
                        ui_freshsettingsdiagoverlayID,
                        ui_freshsettingsdiagoverlayMAC,
@@ -390,8 +375,16 @@ void cyd_state_apply_to_freshsettings_diag_overlay(void) {
                        ui_freshsettingsdiagoverlayVersion);
 }
 
-void cyd_state_apply_to_wastesettings_diag_overlay(void) {
-    apply_diag_overlay(&cyd_state.waste,
+static void apply_wastesettings(uint32_t changed) {
+    const tank_state_t *t = &cyd_state.waste;
+    apply_stop_level(ui_wastesettingsOverlayDrainSlider, ui_wastesettingsOverlayDrainPercentage,
+                     ui_wastesettingsDrainStopLevelLabel, t, changed);
+    if (changed & FIELD(FULL_MV)) apply_voltage(ui_wastesettingsFullVoltage, t->full_voltage_mv);
+    if (changed & FIELD(EMPTY_MV)) apply_voltage(ui_wastesettingsEmptyVoltage, t->empty_voltage_mv);
+    apply_freeze_options(ui_wastesettingsFreezeProtection, t->freeze_setting, changed);
+    if (changed & FIELD(SAFETY)) apply_toggle(ui_wastesettingsSafetyOveride, t->safety_override_enabled);
+    if (changed & FIELD(VALVE)) apply_toggle(ui_wastesettingsValveOveride, t->valve_override_enabled);
+    apply_diag_overlay(t, changed,
                        ui_wastesettingsdiagoverlayIP,
                        ui_wastesettingsdiagoverlayID,
                        ui_wastesettingsdiagoverlayMAC,
@@ -401,3 +394,53 @@ void cyd_state_apply_to_wastesettings_diag_overlay(void) {
                        ui_wastesettingsdiagoverlaySignal,
                        ui_wastesettingsdiagoverlayVersion);
 }
+
+// Binding
+
+static void sync(cyd_screen_t screen) {
+    if (screen >= CYD_SCREEN_COUNT || s_synced[screen] == s_version) return;
+    const uint32_t since = s_synced[screen];
+    const uint32_t fresh = changed_since(&cyd_state.fresh, since);
+    const uint32_t waste = changed_since(&cyd_state.waste, since);
+    s_synced[screen] = s_version;
+    switch (screen) {
+        case CYD_SCREEN_BOOT:
+            if (since == 0) cyd_label_set_text(ui_bootFirmwareLabel, cyd_state.firmware_version);
+            break;
+        case CYD_SCREEN_HOME: apply_home(fresh, waste); break;
+        case CYD_SCREEN_FRESH: apply_fresh(fresh); break;
+        case CYD_SCREEN_FRESHFAULTS: apply_faults(ui_freshfaultsCodeLabel, ui_freshfaultsCodeDescription, &cyd_state.fresh, fresh); break;
+        case CYD_SCREEN_FRESHSETTINGS: apply_freshsettings(fresh); break;
+        case CYD_SCREEN_WASTE: apply_waste(waste); break;
+        case CYD_SCREEN_WASTEFAULTS: apply_faults(ui_wastefaultsCodeLabel, ui_wastefaultsCodeDescription, &cyd_state.waste, waste); break;
+        case CYD_SCREEN_WASTESETTINGS: apply_wastesettings(waste); break;
+        case CYD_SCREEN_CYDSETTINGS:
+            if (since == 0) cyd_label_set_text(ui_cydFirmwareLabel, cyd_state.firmware_version);
+            break;
+        default: break;
+    }
+}
+
+static void screen_load_cb(lv_event_t *e) {
+    sync((cyd_screen_t)(uintptr_t)lv_event_get_user_data(e));
+}
+
+void cyd_state_bind_screen(cyd_screen_t screen) {
+    lv_obj_t *obj = cyd_screens_get(screen);
+    if (obj == NULL) return;
+    lv_obj_add_event_cb(obj, screen_load_cb, LV_EVENT_SCREEN_LOAD_START, (void *)(uintptr_t)screen);
+    s_synced[screen] = 0;
+    sync(screen);
+}
+
+void cyd_state_bind_active(void) {
+    sync(cyd_screens_active());
+}
+
+void cyd_state_sync_screen(cyd_screen_t screen) {
+    if (cyd_screens_get(screen)) sync(screen);
+}
+
+uint32_t cyd_state_version(void) {
+    return s_version;
+}
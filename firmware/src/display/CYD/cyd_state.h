@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "cyd_screens.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -49,6 +50,28 @@ typedef struct {
     char diag_version[16];
 } tank_state_t;
 
+// Fields of a tank the screens show, for change tracking. UNITS is not stored in the tank: it
+// marks what depends on the unit setting (temperatures, freeze options).
+typedef enum {
+    CYD_FIELD_PAIRED = 0,
+    CYD_FIELD_LEVEL,
+    CYD_FIELD_TEMP,
+    CYD_FIELD_STATUS,
+    CYD_FIELD_LEAK,
+    CYD_FIELD_FREEZE,      // freeze_setting, freeze_enabled
+    CYD_FIELD_FAULT,       // fault_code, fault_description
+    CYD_FIELD_STOP_LEVEL,
+    CYD_FIELD_FULL_MV,
+    CYD_FIELD_EMPTY_MV,
+    CYD_FIELD_SAFETY,
+    CYD_FIELD_VALVE,
+    CYD_FIELD_DIAG,        // all diag_* fields
+    CYD_FIELD_UNITS,
+    CYD_FIELD_COUNT
+} cyd_state_field_t;
+
+#define CYD_FIELD_BIT(field) (1u << (field))
+
 typedef struct {
     tank_state_t fresh;
     tank_state_t waste;
@@ -58,20 +81,43 @@ typedef struct {
 
 extern cyd_state_t cyd_state;
 
+// The tank fields above are written through the setters below, on the LVGL task (other contexts
+// post them with cyd_ui_post()). Each change bumps a version counter and records it for that
+// field; a setter that does not change the value records nothing. Fields written directly (the
+// diag_* strings) are reported with cyd_state_mark_changed().
+//
+// Every built screen remembers the version it shows. cyd_state_bind_active() brings the active
+// screen up to date, touching only the widgets whose source fields changed since then; screens
+// that are not shown catch up when they are loaded. Nothing is applied to widgets directly.
+
 void cyd_state_init_defaults(void);
-void cyd_state_apply_to_home_screen(void);
-void cyd_state_apply_to_fresh_screen(void);
-void cyd_state_apply_to_waste_screen(void);
-void cyd_state_apply_to_freshsettings_screen(void);
-void cyd_state_apply_to_wastesettings_screen(void);
-void cyd_state_apply_to_cydsettings_screen(void);
-void cyd_state_apply_to_freshsettings_diag_overlay(void);
-void cyd_state_apply_to_wastesettings_diag_overlay(void);
-void cyd_state_apply_to_boot_screen(void);
+void cyd_state_set_paired(tank_state_t *tank, bool paired);
+void cyd_state_set_level(tank_state_t *tank, uint8_t percent);
+void cyd_state_set_temp(tank_state_t *tank, float temp_c);
+void cyd_state_set_status(tank_state_t *tank, tank_status_t status);
+void cyd_state_set_leak(tank_state_t *tank, bool leak);
+// 0 = Off, 1..5 as in the settings dropdown; also sets freeze_enabled.
+void cyd_state_set_freeze(tank_state_t *tank, uint8_t setting);
+void cyd_state_set_fault(tank_state_t *tank, uint16_t code, const char *description);
+void cyd_state_set_stop_level(tank_state_t *tank, uint8_t percent);
+void cyd_state_set_full_voltage(tank_state_t *tank, uint16_t mv);
+void cyd_state_set_empty_voltage(tank_state_t *tank, uint16_t mv);
+void cyd_state_set_safety_override(tank_state_t *tank, bool enabled);
+void cyd_state_set_valve_override(tank_state_t *tank, bool enabled);
+// fields: CYD_FIELD_BIT()s of fields written directly.
+void cyd_state_mark_changed(tank_state_t *tank, uint32_t fields);
 void cyd_state_set_units_metric(bool metric);
 bool cyd_state_units_metric(void);
-void cyd_state_apply_to_freshfaults_screen(void);
-void cyd_state_apply_to_wastefaults_screen(void);
+
+// Call from the screen built callback: fills in the whole screen and has it catch up whenever
+// it is loaded.
+void cyd_state_bind_screen(cyd_screen_t screen);
+// Once per LVGL pass, and after a setter in an event handler to show the change in this frame.
+void cyd_state_bind_active(void);
+// Bring a built screen up to date without loading it, e.g. before rendering it off screen.
+void cyd_state_sync_screen(cyd_screen_t screen);
+// Bumped by every change: while it holds still, no screen has anything new to show.
+uint32_t cyd_state_version(void);
 
 #ifdef __cplusplus
 }  // extern "C"
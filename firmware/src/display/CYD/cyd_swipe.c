@@ -0,0 +1,325 @@
+#include "cyd_swipe.h"
+
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cyd_state.h"
+
+typedef enum {
+    PHASE_IDLE = 0,
+    PHASE_TRACKING,  // pressed, not yet a swipe
+    PHASE_REJECTED,  // this touch belongs to LVGL
+    PHASE_DRAGGING,
+    PHASE_SETTLING,
+} phase_t;
+
+typedef struct {
+    void *data;  // PSRAM, panel byte order
+    size_t data_size;
+    lv_draw_buf_t buf;
+    uint32_t version;  // cyd_state_version() when taken
+    bool valid;
+} snap_t;
+
+static const cyd_screen_t ORDER[] = {CYD_SCREEN_FRESH, CYD_SCREEN_HOME, CYD_SCREEN_WASTE};
+#define ORDER_LEN (sizeof(ORDER) / sizeof(ORDER[0]))
+
+static bool s_enabled = false;
+static size_t s_psram_reserve = 0;
+static int64_t s_period_us = 16000;
+static cyd_swipe_push_cb_t s_push = NULL;
+static cyd_swipe_wait_cb_t s_wait = NULL;
+static cyd_swipe_done_cb_t s_done = NULL;
+static snap_t s_snaps[ORDER_LEN];
+static cyd_swipe_stats_t s_stats;
+
+// The swipe in progress.
+static struct {
+    phase_t phase;
+    lv_point_t origin;
+    cyd_screen_t to;
+    int32_t dir;  // -1: the target comes in from the right (finger moving left), 1: from the left
+    const snap_t *from_snap;
+    const snap_t *to_snap;
+    int32_t offset;  // of the screen being left, px
+    int32_t drawn_offset;
+    int32_t last_x;
+    int64_t last_x_us;
+    float velocity;  // px/ms
+    int64_t want_us;  // when the screens last moved without a frame showing it; 0: shown
+    int64_t prev_start_us;
+    int64_t prev_end_us;
+    int32_t settle_from;
+    int32_t settle_to;
+    int64_t settle_start_us;
+    int64_t settle_us;
+    lv_timer_t *timer;
+} s_swipe;
+
+static int order_index(cyd_screen_t screen) {
+    for (size_t i = 0; i < ORDER_LEN; i++) {
+        if (ORDER[i] == screen) return (int)i;
+    }
+    return -1;
+}
+
+static void free_snap(snap_t *snap) {
+    if (snap->data) heap_caps_free(snap->data);
+    memset(snap, 0, sizeof(*snap));
+}
+
+// The screen's snapshot, taken now unless the cached one still matches it.
+static const snap_t *snapshot(cyd_screen_t screen, lv_obj_t *obj) {
+    const int i = order_index(screen);
+    if (i < 0 || obj == NULL) return NULL;
+    snap_t *snap = &s_snaps[i];
+    if (snap->valid && snap->version == cyd_state_version()) return snap;
+
+    lv_obj_update_layout(obj);
+    const uint32_t w = (uint32_t)lv_obj_get_width(obj);
+    const uint32_t h = (uint32_t)lv_obj_get_height(obj);
+    const uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    const size_t data_size = (size_t)stride * h;
+    if (snap->data && snap->data_size != data_size) free_snap(snap);
+    if (!snap->data) {
+        if (heap_caps_get_free_size(MALLOC_CAP_SPIRAM) < data_size + s_psram_reserve) return NULL;
+        snap->data = heap_caps_aligned_alloc(LV_DRAW_BUF_ALIGN, data_size, MALLOC_CAP_SPIRAM);
+        if (!snap->data) return NULL;
+        snap->data_size = data_size;
+    }
+    snap->valid = false;
+    if (lv_draw_buf_init(&snap->buf, w, h, LV_COLOR_FORMAT_RGB565, stride, snap->data, data_size) != LV_RESULT_OK ||
+        lv_snapshot_take_to_draw_buf(obj, LV_COLOR_FORMAT_RGB565, &snap->buf) != LV_RESULT_OK) {
+        return NULL;
+    }
+    // Once, here, instead of every frame: the DMA can then read the pixels as they are.
+    lv_draw_sw_rgb565_swap(snap->data, stride / sizeof(uint16_t) * h);
+    snap->version = cyd_state_version();
+    snap->valid = true;
+    s_stats.snapshots++;
+    return snap;
+}
+
+// Columns [src_x, src_x + w) of a snapshot to panel column x.
+static void push_columns(const snap_t *snap, int32_t src_x, int32_t x, int32_t w) {
+    if (w <= 0) return;
+    const int32_t stride = (int32_t)(snap->buf.header.stride / sizeof(uint16_t));
+    s_push(x, 0, w, (int32_t)snap->buf.header.h, (const uint16_t *)snap->data + src_x, stride);
+}
+
+static void draw_frame(int32_t offset) {
+    const int64_t start = esp_timer_get_time();
+    if (s_swipe.want_us) {
+        // While the screens keep moving a frame is due one period after the previous one;
+        // after a pause, one period after they moved again. Every period it is late by (to the
+        // nearest period) is a frame the panel showed without the screens moving.
+        const bool moving = s_swipe.prev_start_us && s_swipe.want_us - s_swipe.prev_end_us < s_period_us;
+        const int64_t due = moving ? s_swipe.prev_start_us + s_period_us : s_swipe.want_us;
+        if (start > due) s_stats.dropped += (uint32_t)((start - due + s_period_us / 2) / s_period_us);
+    }
+
+    const int32_t w = (int32_t)s_swipe.from_snap->buf.header.w;
+    if (offset <= 0) {
+        push_columns(s_swipe.from_snap, -offset, 0, w + offset);
+        push_columns(s_swipe.to_snap, 0, w + offset, -offset);
+    } else {
+        push_columns(s_swipe.to_snap, w - offset, 0, offset);
+        push_columns(s_swipe.from_snap, 0, offset, w - offset);
+    }
+    s_wait();
+
+    const int64_t end = esp_timer_get_time();
+    const uint32_t us = (uint32_t)(end - start);
+    s_stats.frames++;
+    s_stats.frame_us += us;
+    if (us > s_stats.max_frame_us) s_stats.max_frame_us = us;
+    s_swipe.drawn_offset = offset;
+    s_swipe.want_us = 0;
+    s_swipe.prev_start_us = start;
+    s_swipe.prev_end_us = end;
+}
+
+static void finish(void) {
+    const bool completed = s_swipe.settle_to != 0;
+    lv_timer_delete(s_swipe.timer);
+    s_swipe.timer = NULL;
+    s_swipe.phase = PHASE_IDLE;
+    if (completed) {
+        s_stats.completed++;
+        cyd_screens_show(s_swipe.to);
+    }
+    // The panel shows the snapshot of what LVGL is about to draw; have it all drawn anyway, as
+    // the snapshot may be a frame older than the live screen.
+    lv_obj_invalidate(lv_screen_active());
+    if (s_done) s_done();
+    lv_timer_resume(lv_display_get_refr_timer(lv_display_get_default()));
+}
+
+static void frame_timer_cb(lv_timer_t *timer) {
+    LV_UNUSED(timer);
+    if (s_swipe.phase == PHASE_SETTLING) {
+        const int64_t now = esp_timer_get_time();
+        const int64_t elapsed = now - s_swipe.settle_start_us;
+        if (elapsed >= s_swipe.settle_us) {
+            if (s_swipe.drawn_offset != s_swipe.settle_to) draw_frame(s_swipe.settle_to);
+            finish();
+            return;
+        }
+        // Ease out: fast off the finger, gentle into place.
+        const float t = 1.0f - (float)elapsed / (float)s_swipe.settle_us;
+        const float p = 1.0f - t * t * t;
+        const int32_t offset = s_swipe.settle_from + (int32_t)((s_swipe.settle_to - s_swipe.settle_from) * p);
+        if (offset != s_swipe.drawn_offset) {
+            if (!s_swipe.want_us) s_swipe.want_us = s_swipe.prev_end_us ? s_swipe.prev_end_us : now;
+            draw_frame(offset);
+        }
+        return;
+    }
+    if (s_swipe.phase == PHASE_DRAGGING && s_swipe.offset != s_swipe.drawn_offset) draw_frame(s_swipe.offset);
+}
+
+// Whether a touch starting on obj should stay with LVGL.
+static bool belongs_to_widget(const lv_obj_t *obj) {
+    return obj && (lv_obj_check_type(obj, &lv_slider_class) || lv_obj_check_type(obj, &lv_arc_class));
+}
+
+static bool begin(cyd_screen_t from, int32_t dir) {
+    const int i = order_index(from) - dir;
+    if (i < 0 || i >= (int)ORDER_LEN) return false;
+    const int64_t start = esp_timer_get_time();
+    // The press that turned into the swipe is not part of the screen.
+    lv_obj_t *pressed = lv_indev_search_obj(lv_screen_active(), &s_swipe.origin);
+    if (pressed) lv_obj_remove_state(pressed, LV_STATE_PRESSED);
+    const snap_t *from_snap = snapshot(from, lv_screen_active());
+    const cyd_screen_t to = ORDER[i];
+    lv_obj_t *to_obj = cyd_screens_prefetch(to);
+    cyd_state_sync_screen(to);
+    const snap_t *to_snap = from_snap ? snapshot(to, to_obj) : NULL;
+    if (!to_snap || to_snap->buf.header.w != from_snap->buf.header.w ||
+        to_snap->buf.header.h != from_snap->buf.header.h) {
+        return false;
+    }
+    const uint32_t start_us = (uint32_t)(esp_timer_get_time() - start);
+    if (start_us > s_stats.max_start_us) s_stats.max_start_us = start_us;
+
+    s_swipe.to = to;
+    s_swipe.dir = dir;
+    s_swipe.from_snap = from_snap;
+    s_swipe.to_snap = to_snap;
+    s_swipe.drawn_offset = 0;
+    s_swipe.want_us = 0;
+    s_swipe.prev_start_us = 0;
+    s_swipe.prev_end_us = 0;
+    s_swipe.velocity = 0.0f;
+    lv_timer_pause(lv_display_get_refr_timer(lv_display_get_default()));
+    s_swipe.timer = lv_timer_create(frame_timer_cb, (uint32_t)(s_period_us / 1000), NULL);
+    s_stats.swipes++;
+    return true;
+}
+
+static void drag_to(int32_t x) {
+    const int64_t now = esp_timer_get_time();
+    const int32_t w = (int32_t)s_swipe.from_snap->buf.header.w;
+    int32_t offset = x - s_swipe.origin.x;
+    if (s_swipe.dir < 0) offset = offset > 0 ? 0 : offset < -w ? -w : offset;
+    else offset = offset < 0 ? 0 : offset > w ? w : offset;
+    if (s_swipe.last_x_us && now > s_swipe.last_x_us) {
+        s_swipe.velocity = (float)(x - s_swipe.last_x) * 1000.0f / (float)(now - s_swipe.last_x_us);
+    }
+    s_swipe.last_x = x;
+    s_swipe.last_x_us = now;
+    if (offset != s_swipe.offset && !s_swipe.want_us) s_swipe.want_us = now;
+    s_swipe.offset = offset;
+}
+
+static void release(void) {
+    const int32_t w = (int32_t)s_swipe.from_snap->buf.header.w;
+    const int32_t progress = s_swipe.offset * s_swipe.dir;  // px towards the target
+    const bool flung = s_swipe.velocity * (float)s_swipe.dir >= CYD_SWIPE_FLING_PX_MS && progress > 0;
+    s_swipe.settle_from = s_swipe.offset;
+    s_swipe.settle_to = progress * 3 >= w || flung ? w * s_swipe.dir : 0;
+    s_swipe.settle_start_us = esp_timer_get_time();
+    s_swipe.settle_us = (int64_t)CYD_SWIPE_SETTLE_MS * 1000 * abs(s_swipe.settle_to - s_swipe.settle_from) / w;
+    s_swipe.phase = PHASE_SETTLING;
+}
+
+void cyd_swipe_init(size_t psram_reserve, uint32_t frame_ms, cyd_swipe_push_cb_t push, cyd_swipe_wait_cb_t wait,
+                    cyd_swipe_done_cb_t done) {
+    s_psram_reserve = psram_reserve;
+    s_period_us = (int64_t)(frame_ms ? frame_ms : 1) * 1000;
+    s_push = push;
+    s_wait = wait;
+    s_done = done;
+    s_enabled = push && wait && heap_caps_get_total_size(MALLOC_CAP_SPIRAM) > 0;
+}
+
+bool cyd_swipe_track(lv_indev_t *indev, bool pressed, int32_t x, int32_t y) {
+    if (!s_enabled) return false;
+    switch (s_swipe.phase) {
+        case PHASE_IDLE:
+            if (!pressed) return false;
+            s_swipe.origin.x = x;
+            s_swipe.origin.y = y;
+            s_swipe.phase = PHASE_TRACKING;
+            return false;
+        case PHASE_TRACKING: {
+            if (!pressed) {
+                s_swipe.phase = PHASE_IDLE;
+                return false;
+            }
+            const int32_t dx = x - s_swipe.origin.x;
+            const int32_t dy = y - s_swipe.origin.y;
+            if (abs(dy) >= CYD_SWIPE_SLOP_PX || lv_indev_get_scroll_obj(indev)) {
+                s_swipe.phase = PHASE_REJECTED;
+                return false;
+            }
+            if (abs(dx) < CYD_SWIPE_SLOP_PX || abs(dx) < 2 * abs(dy)) return false;
+            const cyd_screen_t from = cyd_screens_active();
+            if (order_index(from) < 0 || belongs_to_widget(lv_indev_search_obj(lv_screen_active(), &s_swipe.origin)) ||
+                !begin(from, dx < 0 ? -1 : 1)) {
+                s_swipe.phase = PHASE_REJECTED;
+                return false;
+            }
+            // LVGL sends PRESS_LOST on the release this caller reports next, and no click.
+            lv_indev_wait_release(indev);
+            s_swipe.phase = PHASE_DRAGGING;
+            s_swipe.offset = 0;
+            s_swipe.last_x_us = 0;
+            drag_to(x);
+            return true;
+        }
+        case PHASE_REJECTED:
+            if (!pressed) s_swipe.phase = PHASE_IDLE;
+            return false;
+        case PHASE_DRAGGING:
+            if (pressed) drag_to(x);
+            else release();
+            return true;
+        case PHASE_SETTLING:
+            return true;  // a new touch waits for the screens to settle
+    }
+    return false;
+}
+
+void cyd_swipe_invalidate_active(const lv_area_t *area) {
+    const int i = order_index(cyd_screens_active());
+    if (i < 0 || !s_snaps[i].valid) return;
+    lv_display_t *disp = lv_display_get_default();
+    if (area->x1 <= 0 && area->y1 <= 0 && area->x2 >= lv_display_get_horizontal_resolution(disp) - 1 &&
+        area->y2 >= lv_display_get_vertical_resolution(disp) - 1) {
+        return;  // a load or forced redraw; content changes invalidate only what changed
+    }
+    s_snaps[i].valid = false;
+}
+
+void cyd_swipe_drop_all(void) {
+    if (s_swipe.phase == PHASE_DRAGGING || s_swipe.phase == PHASE_SETTLING) return;  // in use
+    for (size_t i = 0; i < ORDER_LEN; i++) free_snap(&s_snaps[i]);
+}
+
+void cyd_swipe_take_stats(cyd_swipe_stats_t *out) {
+    *out = s_stats;
+    memset(&s_stats, 0, sizeof(s_stats));
+}
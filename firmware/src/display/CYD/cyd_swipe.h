@@ -0,0 +1,69 @@
+#ifndef CYD_SWIPE_H
+#define CYD_SWIPE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <lvgl.h>
+
+#include "cyd_screens.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Swipe navigation between the tank screens, in the order fresh - home - waste: dragging left
+// pulls in the screen to the right. Once a touch moves sideways past CYD_SWIPE_SLOP_PX (and
+// clearly more than it moves up or down, and no LVGL scroll has claimed it), the swipe takes the
+// touch from LVGL, which gets a PRESS_LOST instead of a click.
+//
+// While the finger drags, both screens are pushed straight to the panel from RGB565 snapshots in
+// PSRAM, one frame per timer tick; LVGL's refresh is paused, so nothing is rendered per frame.
+// On release the screens settle on the nearer one (or the one flung towards), the target is
+// loaded through cyd_screens and LVGL redraws it. Snapshots are kept per screen and reused while
+// the screen is unchanged: the active screen's is dropped when part of it is invalidated, the
+// others' by a change in cyd_state; theme and resolution changes drop them all. Boards without
+// PSRAM keep tap-only navigation.
+
+#define CYD_SWIPE_SLOP_PX 16
+#define CYD_SWIPE_SETTLE_MS 180   // a full screen width; shorter distances settle proportionally
+#define CYD_SWIPE_FLING_PX_MS 0.5f  // release speed that completes a swipe however short
+
+// Push a rectangle of pixels already in the panel's byte order; stride is in pixels.
+typedef void (*cyd_swipe_push_cb_t)(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *px, int32_t stride);
+// Block until the pushed pixels have left the buffer.
+typedef void (*cyd_swipe_wait_cb_t)(void);
+// The panel was written outside LVGL; LVGL's refresh resumes after this returns.
+typedef void (*cyd_swipe_done_cb_t)(void);
+
+typedef struct {
+    uint32_t swipes;       // drags taken from LVGL
+    uint32_t completed;    // of which ended on the other screen
+    uint32_t frames;
+    uint32_t dropped;      // frame periods in which the screens should have moved but did not
+    uint32_t frame_us;     // total push time of the frames
+    uint32_t max_frame_us;
+    uint32_t snapshots;    // taken; the rest of 2 per swipe came from the cache
+    uint32_t max_start_us; // from taking the touch to the first frame's inputs being ready
+} cyd_swipe_stats_t;
+
+// Call after cyd_screens_init(). frame_ms: the frame period frames are paced and counted against;
+// no shorter than a full-screen push, or every frame counts as dropped.
+void cyd_swipe_init(size_t psram_reserve, uint32_t frame_ms, cyd_swipe_push_cb_t push, cyd_swipe_wait_cb_t wait,
+                    cyd_swipe_done_cb_t done);
+// Call from the touch read callback with each reported point (screen coordinates). true: the
+// swipe owns the touch and LVGL must be told it is released.
+bool cyd_swipe_track(lv_indev_t *indev, bool pressed, int32_t x, int32_t y);
+// Call from the display's LV_EVENT_INVALIDATE_AREA. Whole-screen areas (loads, forced redraws)
+// are taken to leave the content as it was.
+void cyd_swipe_invalidate_active(const lv_area_t *area);
+// Free every snapshot, e.g. before a theme or resolution change.
+void cyd_swipe_drop_all(void);
+// Since the previous call; resets the counters.
+void cyd_swipe_take_stats(cyd_swipe_stats_t *out);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // CYD_SWIPE_H
@@ -0,0 +1,125 @@
+#include "cyd_theme.h"
+
+#include "ui.h"
+
+// Distinct theme variable and property pairs the screens use; six today.
+#define CYD_THEME_MAX_STYLES 16
+// Themes in the SquareLine project (ui_themes.h sizes its theme tables by it).
+#define SQUARELINE_THEME_COUNT (sizeof(ui_theme_colors) / sizeof(ui_theme_colors[0]))
+
+typedef struct {
+    const ui_theme_variable_t *var;
+    lv_style_prop_t prop;
+    ui_style_variable_t value;  // what the style holds now
+    lv_style_t style;
+} shared_style_t;
+
+static shared_style_t s_styles[CYD_THEME_MAX_STYLES];
+static uint32_t s_style_cnt;
+static int8_t s_applied_dark = -1;  // -1 until the first cyd_theme_apply()
+
+lv_style_value_t _ui_style_value_convert(lv_style_prop_t property, ui_style_variable_t value) {
+    lv_style_value_t v = {0};
+    switch (property) {
+        case LV_STYLE_BG_COLOR:
+        case LV_STYLE_BG_GRAD_COLOR:
+        case LV_STYLE_BG_IMAGE_RECOLOR:
+        case LV_STYLE_BORDER_COLOR:
+        case LV_STYLE_OUTLINE_COLOR:
+        case LV_STYLE_SHADOW_COLOR:
+        case LV_STYLE_IMAGE_RECOLOR:
+        case LV_STYLE_LINE_COLOR:
+        case LV_STYLE_ARC_COLOR:
+        case LV_STYLE_TEXT_COLOR:
+            v.color = lv_color_hex((uint32_t)value);
+            break;
+        case LV_STYLE_BG_GRAD:
+        case LV_STYLE_BG_IMAGE_SRC:
+        case LV_STYLE_ARC_IMAGE_SRC:
+        case LV_STYLE_TEXT_FONT:
+        case LV_STYLE_COLOR_FILTER_DSC:
+        case LV_STYLE_ANIM:
+        case LV_STYLE_TRANSITION:
+        case LV_STYLE_BITMAP_MASK_SRC:
+            v.ptr = (const void *)(uintptr_t)value;
+            break;
+        default:
+            v.num = (int32_t)value;
+            break;
+    }
+    return v;
+}
+
+ui_style_variable_t ui_get_theme_value(const ui_theme_variable_t *var) {
+    return var[ui_theme_idx];
+}
+
+void ui_object_set_local_style_property(lv_obj_t *object_p, lv_style_selector_t selector, lv_style_prop_t property,
+                                        ui_style_variable_t value) {
+    if (object_p == NULL) return;
+    lv_obj_set_local_style_prop(object_p, property, _ui_style_value_convert(property, value), selector);
+}
+
+static lv_style_t *shared_style(const ui_theme_variable_t *var, lv_style_prop_t prop) {
+    for (uint32_t i = 0; i < s_style_cnt; i++) {
+        if (s_styles[i].var == var && s_styles[i].prop == prop) return &s_styles[i].style;
+    }
+    if (s_style_cnt == CYD_THEME_MAX_STYLES) return NULL;
+    shared_style_t *s = &s_styles[s_style_cnt++];
+    s->var = var;
+    s->prop = prop;
+    s->value = ui_get_theme_value(var);
+    lv_style_init(&s->style);
+    lv_style_set_prop(&s->style, prop, _ui_style_value_convert(prop, s->value));
+    return &s->style;
+}
+
+void ui_object_set_themeable_style_property(lv_obj_t *object_p, lv_style_selector_t selector,
+                                            lv_style_prop_t property, const ui_theme_variable_t *theme_variable_p) {
+    if (object_p == NULL || theme_variable_p == NULL) return;
+    lv_style_t *style = shared_style(theme_variable_p, property);
+    if (style == NULL) {
+        LV_LOG_WARN("out of shared theme styles; property %d stays fixed", (int)property);
+        ui_object_set_local_style_property(object_p, selector, property, ui_get_theme_value(theme_variable_p));
+        return;
+    }
+    lv_obj_remove_local_style_prop(object_p, property, selector);
+    lv_obj_add_style(object_p, style, selector);
+}
+
+// Point every shared style at the current theme's value. Rewriting a property a style already
+// has reuses its slot, so this allocates nothing. Returns whether anything changed.
+static bool refresh_styles(void) {
+    bool changed = false;
+    for (uint32_t i = 0; i < s_style_cnt; i++) {
+        shared_style_t *s = &s_styles[i];
+        const ui_style_variable_t value = ui_get_theme_value(s->var);
+        if (value == s->value) continue;
+        s->value = value;
+        lv_style_set_prop(&s->style, s->prop, _ui_style_value_convert(s->prop, value));
+        changed = true;
+    }
+    return changed;
+}
+
+void _ui_theme_set_variable_styles(uint8_t mode) {
+    LV_UNUSED(mode);
+    if (refresh_styles()) lv_obj_report_style_change(NULL);
+}
+
+void cyd_theme_apply(lv_display_t *display, bool dark) {
+    ui_theme_idx = (dark && SQUARELINE_THEME_COUNT > 1) ? 1 : 0;
+    bool changed = refresh_styles();
+
+    // lv_theme_default_init() restyles every widget by itself when it is already the display's
+    // theme. Detach it first so its styles and the shared ones go out in a single report.
+    lv_theme_t *previous = lv_display_get_theme(display);
+    lv_display_set_theme(display, NULL);
+    lv_theme_t *theme = lv_theme_default_init(display, lv_palette_main(LV_PALETTE_BLUE),
+                                              lv_palette_main(LV_PALETTE_RED), dark, LV_FONT_DEFAULT);
+    lv_display_set_theme(display, theme);
+    changed |= theme != previous || s_applied_dark != (int8_t)dark;
+    s_applied_dark = (int8_t)dark;
+
+    if (changed) lv_obj_report_style_change(NULL);
+}
@@ -0,0 +1,28 @@
+#ifndef CYD_THEME_H
+#define CYD_THEME_H
+
+#include <stdbool.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Theme engine behind SquareLine's theme manager API (ui_theme_manager.h), built in place of
+// ui/ui_theme_manager.c. Instead of a local style property per widget, tracked in heap lists and
+// rewritten widget by widget on every switch, each theme variable and property pair
+// (_ui_theme_color_black with LV_STYLE_BG_COLOR, ...) is one shared lv_style_t that the widgets
+// reference. A switch rewrites those few styles in place and reports one style change.
+//
+// As with SquareLine's version, a themeable property replaces a local one set before it, and a
+// local property set after it wins.
+
+// Light or Dark: LVGL's default theme in that mode, plus the SquareLine theme of the same index
+// when the project defines one (the first theme otherwise). Restyles all built screens once.
+void cyd_theme_apply(lv_display_t *display, bool dark);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // CYD_THEME_H
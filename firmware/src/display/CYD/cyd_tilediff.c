@@ -0,0 +1,143 @@
+#include "cyd_tilediff.h"
+
+#include <string.h>
+
+#define TILE_COLS_MAX ((CYD_TILEDIFF_MAX_W + CYD_TILE_SIZE - 1) / CYD_TILE_SIZE)
+#define TILE_ROWS_MAX ((CYD_TILEDIFF_MAX_H + CYD_TILE_SIZE - 1) / CYD_TILE_SIZE)
+
+static const uint32_t HASH_UNKNOWN = 0;  // never produced by hash_rect()
+static const uint32_t FNV_OFFSET = 2166136261u;
+static const uint32_t FNV_PRIME = 16777619u;
+
+// Hash of what the panel last received for each tile, including which part of the tile it covered.
+static uint32_t s_hashes[TILE_COLS_MAX * TILE_ROWS_MAX];
+static int32_t s_cols = 0;
+static int32_t s_rows = 0;
+static int32_t s_screen_w = 0;
+static int32_t s_screen_h = 0;
+static cyd_tilediff_push_cb_t s_push_cb = NULL;
+
+static cyd_tilediff_stats_t s_stats[CYD_TILEDIFF_MAX_SCREENS];
+static uint8_t s_stats_count = 0;
+static cyd_tilediff_stats_t *s_current = NULL;
+
+void cyd_tilediff_init(int32_t screen_w, int32_t screen_h, cyd_tilediff_push_cb_t push_cb) {
+    if (screen_w > CYD_TILEDIFF_MAX_W) screen_w = CYD_TILEDIFF_MAX_W;
+    if (screen_h > CYD_TILEDIFF_MAX_H) screen_h = CYD_TILEDIFF_MAX_H;
+    s_screen_w = screen_w;
+    s_screen_h = screen_h;
+    s_cols = (screen_w + CYD_TILE_SIZE - 1) / CYD_TILE_SIZE;
+    s_rows = (screen_h + CYD_TILE_SIZE - 1) / CYD_TILE_SIZE;
+    s_push_cb = push_cb;
+    cyd_tilediff_invalidate_all();
+    cyd_tilediff_stats_reset();
+}
+
+void cyd_tilediff_invalidate_all(void) {
+    memset(s_hashes, 0, sizeof(s_hashes));
+}
+
+void cyd_tilediff_round_area(lv_area_t *area) {
+    area->x1 -= area->x1 % CYD_TILE_SIZE;
+    area->y1 -= area->y1 % CYD_TILE_SIZE;
+    area->x2 += CYD_TILE_SIZE - 1 - (area->x2 % CYD_TILE_SIZE);
+    area->y2 += CYD_TILE_SIZE - 1 - (area->y2 % CYD_TILE_SIZE);
+    if (area->x2 >= s_screen_w) area->x2 = s_screen_w - 1;
+    if (area->y2 >= s_screen_h) area->y2 = s_screen_h - 1;
+}
+
+void cyd_tilediff_set_screen(const void *screen) {
+    s_current = NULL;
+    for (uint8_t i = 0; i < s_stats_count; i++) {
+        if (s_stats[i].screen == screen) {
+            s_current = &s_stats[i];
+            return;
+        }
+    }
+    if (s_stats_count < CYD_TILEDIFF_MAX_SCREENS) {
+        s_current = &s_stats[s_stats_count++];
+        s_current->screen = screen;
+        s_current->tiles_sent = 0;
+        s_current->tiles_skipped = 0;
+    }
+}
+
+// FNV-1a over the pixels, seeded with the covered sub-rectangle so a partial tile never
+// matches a hash recorded for a different part of the same tile.
+static uint32_t hash_rect(const uint16_t *px, int32_t stride, int32_t w, int32_t h, uint32_t geometry) {
+    uint32_t hash = (FNV_OFFSET ^ geometry) * FNV_PRIME;
+    for (int32_t y = 0; y < h; y++) {
+        const uint16_t *row = px + y * stride;
+        for (int32_t x = 0; x < w; x++) {
+            hash = (hash ^ row[x]) * FNV_PRIME;
+        }
+    }
+    return hash == HASH_UNKNOWN ? 1 : hash;
+}
+
+void cyd_tilediff_flush(const lv_area_t *area, const uint16_t *px, int32_t stride) {
+    if (!s_push_cb || s_cols == 0) return;
+
+    const int32_t tx0 = area->x1 / CYD_TILE_SIZE;
+    const int32_t tx1 = LV_MIN(area->x2 / CYD_TILE_SIZE, s_cols - 1);
+    const int32_t ty0 = area->y1 / CYD_TILE_SIZE;
+    const int32_t ty1 = LV_MIN(area->y2 / CYD_TILE_SIZE, s_rows - 1);
+    uint32_t sent = 0;
+    uint32_t skipped = 0;
+
+    for (int32_t ty = ty0; ty <= ty1; ty++) {
+        const int32_t y0 = LV_MAX(area->y1, ty * CYD_TILE_SIZE);
+        const int32_t y1 = LV_MIN(area->y2, ty * CYD_TILE_SIZE + CYD_TILE_SIZE - 1);
+        const uint16_t *row_px = px + (y0 - area->y1) * stride;
+        int32_t run_x0 = -1;
+
+        // One step past the last tile closes a pending run.
+        for (int32_t tx = tx0; tx <= tx1 + 1; tx++) {
+            bool dirty = false;
+            int32_t x0 = 0;
+            if (tx <= tx1) {
+                x0 = LV_MAX(area->x1, tx * CYD_TILE_SIZE);
+                const int32_t x1 = LV_MIN(area->x2, tx * CYD_TILE_SIZE + CYD_TILE_SIZE - 1);
+                const uint32_t geometry = (uint32_t)(x0 - tx * CYD_TILE_SIZE) | ((uint32_t)(x1 - tx * CYD_TILE_SIZE) << 8) |
+                                          ((uint32_t)(y0 - ty * CYD_TILE_SIZE) << 16) |
+                                          ((uint32_t)(y1 - ty * CYD_TILE_SIZE) << 24);
+                const uint32_t hash = hash_rect(row_px + (x0 - area->x1), stride, x1 - x0 + 1, y1 - y0 + 1, geometry);
+                uint32_t *slot = &s_hashes[ty * s_cols + tx];
+                if (*slot != hash) {
+                    *slot = hash;
+                    dirty = true;
+                    sent++;
+                } else {
+                    skipped++;
+                }
+            }
+            if (dirty && run_x0 < 0) {
+                run_x0 = x0;
+            } else if (!dirty && run_x0 >= 0) {
+                const int32_t run_x1 = LV_MIN(area->x2, tx * CYD_TILE_SIZE - 1);
+                s_push_cb(run_x0, y0, run_x1 - run_x0 + 1, y1 - y0 + 1, row_px + (run_x0 - area->x1), stride);
+                run_x0 = -1;
+            }
+        }
+    }
+
+    if (s_current) {
+        s_current->tiles_sent += sent;
+        s_current->tiles_skipped += skipped;
+    }
+}
+
+uint8_t cyd_tilediff_stats_count(void) {
+    return s_stats_count;
+}
+
+const cyd_tilediff_stats_t *cyd_tilediff_stats_get(uint8_t index) {
+    return index < s_stats_count ? &s_stats[index] : NULL;
+}
+
+void cyd_tilediff_stats_reset(void) {
+    for (uint8_t i = 0; i < s_stats_count; i++) {
+        s_stats[i].tiles_sent = 0;
+        s_stats[i].tiles_skipped = 0;
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef CYD_TILEDIFF_H
+#define CYD_TILEDIFF_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Tile-hash frame differencing for the flush path. Each flushed area is split into
+// CYD_TILE_SIZE x CYD_TILE_SIZE screen tiles; tiles whose content hash matches what was last
+// sent to the panel are skipped and runs of changed tiles on a tile row go out as one window.
+
+#define CYD_TILE_SIZE 16
+#define CYD_TILEDIFF_MAX_W 320
+#define CYD_TILEDIFF_MAX_H 320
+#define CYD_TILEDIFF_MAX_SCREENS 12
+
+// Push a rectangle to the panel. px points at the rectangle's first pixel, stride is in pixels.
+typedef void (*cyd_tilediff_push_cb_t)(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *px, int32_t stride);
+
+typedef struct {
+    const void *screen;  // key set via cyd_tilediff_set_screen()
+    uint32_t tiles_sent;
+    uint32_t tiles_skipped;
+} cyd_tilediff_stats_t;
+
+void cyd_tilediff_init(int32_t screen_w, int32_t screen_h, cyd_tilediff_push_cb_t push_cb);
+// Forget all hashes, e.g. after the panel lost its contents or was written outside LVGL.
+void cyd_tilediff_invalidate_all(void);
+// Expand an invalidated area to the tile grid so partial-mode bands line up with tiles.
+void cyd_tilediff_round_area(lv_area_t *area);
+// Attribute the following flushes to a screen for the per-screen counters.
+void cyd_tilediff_set_screen(const void *screen);
+// Send the changed tiles of area. px points at the area's first pixel, stride is in pixels.
+void cyd_tilediff_flush(const lv_area_t *area, const uint16_t *px, int32_t stride);
+
+uint8_t cyd_tilediff_stats_count(void);
+const cyd_tilediff_stats_t *cyd_tilediff_stats_get(uint8_t index);
+void cyd_tilediff_stats_reset(void);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // CYD_TILEDIFF_H
@@ -0,0 +1,129 @@
+#include "cyd_touch.h"
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <atomic>
+
+#include "cyd_ui_task.h"
+
+namespace {
+
+constexpr uint32_t TOUCH_TASK_STACK_BYTES = 3072;
+constexpr UBaseType_t TOUCH_TASK_PRIORITY = 3;  // above the LVGL task, so a read is never held up by a render
+
+static_assert((CYD_TOUCH_RING_LEN & (CYD_TOUCH_RING_LEN - 1)) == 0, "CYD_TOUCH_RING_LEN must be a power of two");
+
+TaskHandle_t touch_task = nullptr;
+cyd_touch_read_t touch_read = nullptr;
+int touch_irq_pin = -1;
+uint32_t touch_period_ms = 0;
+
+// Written by the sampler only (head) and the consumer only (tail).
+cyd_touch_point_t ring[CYD_TOUCH_RING_LEN];
+std::atomic<uint32_t> ring_head{0};
+std::atomic<uint32_t> ring_tail{0};
+
+volatile uint32_t irq_us = 0;
+
+// Reset by cyd_touch_take_stats().
+volatile uint32_t stats_irqs = 0;
+volatile uint32_t stats_reads = 0;
+volatile uint32_t stats_points = 0;
+volatile uint32_t stats_dropped = 0;
+int64_t stats_since_us = 0;
+
+void IRAM_ATTR touch_isr() {
+    irq_us = static_cast<uint32_t>(esp_timer_get_time());
+    stats_irqs = stats_irqs + 1;
+    if (!touch_task) return;
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(touch_task, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+// Queue p if at least min_free slots are free. Pressed points leave one slot for the release.
+bool push(const cyd_touch_point_t &p, uint32_t min_free) {
+    const uint32_t head = ring_head.load(std::memory_order_relaxed);
+    if (CYD_TOUCH_RING_LEN - (head - ring_tail.load(std::memory_order_acquire)) < min_free) return false;
+    ring[head % CYD_TOUCH_RING_LEN] = p;
+    ring_head.store(head + 1, std::memory_order_release);
+    stats_points = stats_points + 1;
+    cyd_ui_wake();
+    return true;
+}
+
+void touch_task_main(void * /*arg*/) {
+    cyd_touch_point_t last = {};
+    bool down = false;
+    for (;;) {
+        if (!down) {
+            // Untouched: sleep until the IRQ line falls (or the next poll).
+            ulTaskNotifyTake(pdTRUE, touch_irq_pin >= 0 ? portMAX_DELAY : pdMS_TO_TICKS(CYD_TOUCH_IDLE_POLL_MS));
+        }
+        int16_t x = 0;
+        int16_t y = 0;
+        const bool touched = touch_read(&x, &y);
+        const uint32_t now = static_cast<uint32_t>(esp_timer_get_time());
+        stats_reads = stats_reads + 1;
+        if (touched) {
+            last = {x, y, down || touch_irq_pin < 0 ? now : irq_us, true};
+            down = true;
+            if (!push(last, 2)) stats_dropped = stats_dropped + 1;
+        } else if (down) {
+            last.us = now;
+            last.pressed = false;
+            if (push(last, 1)) {
+                down = false;
+                continue;
+            }
+            // Ring full: the LVGL task is behind (e.g. a screen animation); retry the release.
+        } else {
+            continue;  // woken without a touch (IRQ glitch or idle poll)
+        }
+        vTaskDelay(pdMS_TO_TICKS(touch_period_ms));
+    }
+}
+
+}  // namespace
+
+bool cyd_touch_start(int core, int irq_pin, uint32_t period_ms, cyd_touch_read_t read) {
+    if (touch_task) return true;
+    if (!read) return false;
+    touch_read = read;
+    touch_irq_pin = irq_pin;
+    touch_period_ms = period_ms ? period_ms : 1;
+    stats_since_us = esp_timer_get_time();
+    if (xTaskCreatePinnedToCore(touch_task_main, "touch", TOUCH_TASK_STACK_BYTES, nullptr, TOUCH_TASK_PRIORITY,
+                                &touch_task, core) != pdPASS) {
+        return false;
+    }
+    if (irq_pin >= 0) attachInterrupt(digitalPinToInterrupt(irq_pin), touch_isr, FALLING);
+    return true;
+}
+
+bool cyd_touch_peek(cyd_touch_point_t *out) {
+    const uint32_t tail = ring_tail.load(std::memory_order_relaxed);
+    if (ring_head.load(std::memory_order_acquire) == tail) return false;
+    *out = ring[tail % CYD_TOUCH_RING_LEN];
+    return true;
+}
+
+bool cyd_touch_pop(cyd_touch_point_t *out) {
+    if (!cyd_touch_peek(out)) return false;
+    ring_tail.store(ring_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    return true;
+}
+
+void cyd_touch_take_stats(cyd_touch_stats_t *out) {
+    const int64_t now = esp_timer_get_time();
+    out->irqs = stats_irqs;
+    out->reads = stats_reads;
+    out->points = stats_points;
+    out->dropped = stats_dropped;
+    out->elapsed_us = static_cast<uint32_t>(now - stats_since_us);
+    stats_irqs = 0;
+    stats_reads = 0;
+    stats_points = 0;
+    stats_dropped = 0;
+    stats_since_us = now;
+}
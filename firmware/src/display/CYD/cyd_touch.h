@@ -0,0 +1,54 @@
+#ifndef CYD_TOUCH_H
+#define CYD_TOUCH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Touch sampling off the LVGL task. A falling edge on the controller's IRQ line wakes a sampler
+// task, which reads the controller every period_ms until the finger lifts and queues timestamped
+// points in a single-producer, single-consumer ring; nothing reads the bus while the screen is
+// untouched. The LVGL read callback only drains the ring. Boards without an IRQ line are polled
+// every CYD_TOUCH_IDLE_POLL_MS instead.
+//
+// Points are raw controller coordinates: mapping them to the screen is left to the LVGL task,
+// which owns the panel rotation. Each queued point wakes the LVGL task (cyd_ui_wake).
+
+#define CYD_TOUCH_RING_LEN 16  // power of two
+#define CYD_TOUCH_IDLE_POLL_MS 30
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+    uint32_t us;   // low 32 bits of esp_timer_get_time(): the IRQ for a touch's first point, else the read
+    bool pressed;  // false: the finger lifted (x, y repeat the last point)
+} cyd_touch_point_t;
+
+// Reads one raw point; returns false when nothing touches the screen. Runs on the sampler task.
+typedef bool (*cyd_touch_read_t)(int16_t *x, int16_t *y);
+
+typedef struct {
+    uint32_t irqs;
+    uint32_t reads;       // controller reads (an FT5x06 read is two or more I2C transactions)
+    uint32_t points;      // queued
+    uint32_t dropped;     // pressed points lost to a full ring
+    uint32_t elapsed_us;  // window length
+} cyd_touch_stats_t;
+
+// Start the sampler task on core; irq_pin < 0 polls.
+bool cyd_touch_start(int core, int irq_pin, uint32_t period_ms, cyd_touch_read_t read);
+
+// Consumer side, one task only. A release is always queued, even when pressed points were dropped.
+bool cyd_touch_peek(cyd_touch_point_t *out);
+bool cyd_touch_pop(cyd_touch_point_t *out);
+// Since the previous call (or start); resets the counters.
+void cyd_touch_take_stats(cyd_touch_stats_t *out);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // CYD_TOUCH_H
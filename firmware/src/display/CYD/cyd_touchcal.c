@@ -0,0 +1,156 @@
+#include "cyd_touchcal.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#define ONE (1L << CYD_TOUCHCAL_SHIFT)
+// With 12-bit raw coordinates, |gain| * 4095 twice plus |offset| plus a rotation's offset stays
+// below 2^31.
+#define MAX_GAIN (1L << 17)
+#define MAX_OFFSET (1L << 27)
+
+void cyd_touchcal_targets(uint8_t n, int16_t w, int16_t h, int16_t *x, int16_t *y) {
+    const int16_t inset = (w < h ? w : h) / 8;
+    if (n == 3) {
+        // Spread over both axes, far from collinear.
+        const int16_t tx[3] = {inset, (int16_t)(w - 1 - inset), (int16_t)(w / 2)};
+        const int16_t ty[3] = {inset, (int16_t)(h / 2), (int16_t)(h - 1 - inset)};
+        for (uint8_t i = 0; i < 3; i++) {
+            x[i] = tx[i];
+            y[i] = ty[i];
+        }
+        return;
+    }
+    // Corners, then the centre.
+    const int16_t tx[5] = {inset, (int16_t)(w - 1 - inset), (int16_t)(w - 1 - inset), inset, (int16_t)(w / 2)};
+    const int16_t ty[5] = {inset, inset, (int16_t)(h - 1 - inset), (int16_t)(h - 1 - inset), (int16_t)(h / 2)};
+    for (uint8_t i = 0; i < 5; i++) {
+        x[i] = tx[i];
+        y[i] = ty[i];
+    }
+}
+
+void cyd_touchcal_from_bounds(cyd_touchcal_t *out, int32_t x_min, int32_t x_max, int32_t y_min, int32_t y_max,
+                              int16_t w, int16_t h) {
+    const double gx = x_max != x_min ? (double)(w - 1) / (x_max - x_min) : 0.0;
+    const double gy = y_max != y_min ? (double)(h - 1) / (y_max - y_min) : 0.0;
+    out->xx = (int32_t)lround(gx * ONE);
+    out->xy = 0;
+    out->x0 = (int32_t)lround(-gx * x_min * ONE);
+    out->yx = 0;
+    out->yy = (int32_t)lround(gy * ONE);
+    out->y0 = (int32_t)lround(-gy * y_min * ONE);
+}
+
+bool cyd_touchcal_fit(cyd_touchcal_t *out, const int16_t *raw_x, const int16_t *raw_y, const int16_t *x,
+                      const int16_t *y, uint8_t n, float *max_err_px) {
+    if (n < 3) return false;
+    // Least squares on centred raw coordinates, so the offsets drop out of the normal equations.
+    double mu = 0.0, mv = 0.0, mx = 0.0, my = 0.0;
+    for (uint8_t i = 0; i < n; i++) {
+        mu += raw_x[i];
+        mv += raw_y[i];
+        mx += x[i];
+        my += y[i];
+    }
+    mu /= n;
+    mv /= n;
+    mx /= n;
+    my /= n;
+    double suu = 0.0, suv = 0.0, svv = 0.0, sux = 0.0, svx = 0.0, suy = 0.0, svy = 0.0;
+    for (uint8_t i = 0; i < n; i++) {
+        const double u = raw_x[i] - mu;
+        const double v = raw_y[i] - mv;
+        suu += u * u;
+        suv += u * v;
+        svv += v * v;
+        sux += u * (x[i] - mx);
+        svx += v * (x[i] - mx);
+        suy += u * (y[i] - my);
+        svy += v * (y[i] - my);
+    }
+    const double det = suu * svv - suv * suv;
+    if (!(det > 1e-6 * suu * svv)) return false;  // taps (nearly) on one line
+    const double xx = (sux * svv - svx * suv) / det;
+    const double xy = (svx * suu - sux * suv) / det;
+    const double yx = (suy * svv - svy * suv) / det;
+    const double yy = (svy * suu - suy * suv) / det;
+    const double x0 = mx - xx * mu - xy * mv;
+    const double y0 = my - yx * mu - yy * mv;
+
+    if (max_err_px) {
+        double worst = 0.0;
+        for (uint8_t i = 0; i < n; i++) {
+            const double ex = xx * raw_x[i] + xy * raw_y[i] + x0 - x[i];
+            const double ey = yx * raw_x[i] + yy * raw_y[i] + y0 - y[i];
+            const double e = sqrt(ex * ex + ey * ey);
+            if (e > worst) worst = e;
+        }
+        *max_err_px = (float)worst;
+    }
+
+    const double lim_gain = (double)MAX_GAIN / ONE;
+    const double lim_offset = (double)MAX_OFFSET / ONE;
+    if (fabs(xx) >= lim_gain || fabs(xy) >= lim_gain || fabs(yx) >= lim_gain || fabs(yy) >= lim_gain ||
+        fabs(x0) >= lim_offset || fabs(y0) >= lim_offset) {
+        return false;
+    }
+    out->xx = (int32_t)lround(xx * ONE);
+    out->xy = (int32_t)lround(xy * ONE);
+    out->x0 = (int32_t)lround(x0 * ONE);
+    out->yx = (int32_t)lround(yx * ONE);
+    out->yy = (int32_t)lround(yy * ONE);
+    out->y0 = (int32_t)lround(y0 * ONE);
+    return true;
+}
+
+bool cyd_touchcal_valid(const cyd_touchcal_t *cal) {
+    return labs(cal->xx) < MAX_GAIN && labs(cal->xy) < MAX_GAIN && labs(cal->yx) < MAX_GAIN &&
+           labs(cal->yy) < MAX_GAIN && labs(cal->x0) < MAX_OFFSET && labs(cal->y0) < MAX_OFFSET &&
+           (int64_t)cal->xx * cal->yy != (int64_t)cal->xy * cal->yx;
+}
+
+void cyd_touchcal_rotate(cyd_touchcal_t *out, const cyd_touchcal_t *native, uint8_t rotation, int16_t w, int16_t h) {
+    // The same steps as LovyanGFX's convertRawXY(): odd rotations swap the axes, then rotations
+    // 2 and 3 mirror x and 1 and 2 mirror y, against the rotated screen's size.
+    const int32_t mirror_w = (int32_t)((rotation & 1) ? h - 1 : w - 1) * ONE;
+    const int32_t mirror_h = (int32_t)((rotation & 1) ? w - 1 : h - 1) * ONE;
+    cyd_touchcal_t m = *native;
+    if (rotation & 1) {
+        m.xx = native->yx;
+        m.xy = native->yy;
+        m.x0 = native->y0;
+        m.yx = native->xx;
+        m.yy = native->xy;
+        m.y0 = native->x0;
+    }
+    if (rotation & 2) {
+        m.xx = -m.xx;
+        m.xy = -m.xy;
+        m.x0 = mirror_w - m.x0;
+    }
+    if (rotation == 1 || rotation == 2) {
+        m.yx = -m.yx;
+        m.yy = -m.yy;
+        m.y0 = mirror_h - m.y0;
+    }
+    // apply() shifts right, which floors; round to the nearest pixel instead.
+    m.x0 += ONE / 2;
+    m.y0 += ONE / 2;
+    *out = m;
+}
+
+void cyd_touchcal_to_native(uint8_t rotation, int16_t w, int16_t h, int16_t *x, int16_t *y) {
+    int16_t sx = *x;
+    int16_t sy = *y;
+    // Undo rotate(): the mirrors first, then the swap.
+    if (rotation & 2) sx = (int16_t)(((rotation & 1) ? h - 1 : w - 1) - sx);
+    if (rotation == 1 || rotation == 2) sy = (int16_t)(((rotation & 1) ? w - 1 : h - 1) - sy);
+    if (rotation & 1) {
+        *x = sy;
+        *y = sx;
+    } else {
+        *x = sx;
+        *y = sy;
+    }
+}
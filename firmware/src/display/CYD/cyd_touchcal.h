@@ -0,0 +1,60 @@
+#ifndef CYD_TOUCHCAL_H
+#define CYD_TOUCHCAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Touch calibration: an affine map from raw controller coordinates to screen pixels, fitted to
+// taps on known targets (3 points: exact; 5 points: least squares, which also shows a bad tap as
+// a large residual). The fit is kept in the touch frame of an unrotated panel ("native", w x h);
+// cyd_touchcal_rotate() folds a panel rotation into it, so each sample costs two Q16 dot products
+// whatever the orientation.
+//
+// Rotations are LovyanGFX's 0..3 as seen by the touch frame (panel rotation plus the touch's
+// offset_rotation). The coefficient bounds checked by cyd_touchcal_valid() keep
+// cyd_touchcal_apply() within int32 for 12-bit raw coordinates.
+
+#define CYD_TOUCHCAL_SHIFT 16
+#define CYD_TOUCHCAL_MAX_POINTS 5
+
+// x = (xx * raw_x + xy * raw_y + x0) >> CYD_TOUCHCAL_SHIFT, likewise y.
+typedef struct {
+    int32_t xx;
+    int32_t xy;
+    int32_t x0;
+    int32_t yx;
+    int32_t yy;
+    int32_t y0;
+} cyd_touchcal_t;
+
+// Screen targets for an n-point calibration (3 or 5) on a w x h screen.
+void cyd_touchcal_targets(uint8_t n, int16_t w, int16_t h, int16_t *x, int16_t *y);
+// The linear map of a raw bounding box (x_min may exceed x_max for a mirrored axis) to native.
+void cyd_touchcal_from_bounds(cyd_touchcal_t *out, int32_t x_min, int32_t x_max, int32_t y_min, int32_t y_max,
+                              int16_t w, int16_t h);
+// Fit raw points to native targets. false for fewer than 3 points, collinear taps or a result
+// outside the int32 bounds. max_err_px (may be NULL): the largest distance of a fitted point from
+// its target.
+bool cyd_touchcal_fit(cyd_touchcal_t *out, const int16_t *raw_x, const int16_t *raw_y, const int16_t *x,
+                      const int16_t *y, uint8_t n, float *max_err_px);
+bool cyd_touchcal_valid(const cyd_touchcal_t *cal);
+// The map to screen pixels for a rotation of a native w x h frame, rounding included.
+void cyd_touchcal_rotate(cyd_touchcal_t *out, const cyd_touchcal_t *native, uint8_t rotation, int16_t w, int16_t h);
+// Screen point of a rotation back to the native frame.
+void cyd_touchcal_to_native(uint8_t rotation, int16_t w, int16_t h, int16_t *x, int16_t *y);
+
+static inline void cyd_touchcal_apply(const cyd_touchcal_t *cal, int16_t raw_x, int16_t raw_y, int16_t *x,
+                                      int16_t *y) {
+    *x = (int16_t)((cal->xx * raw_x + cal->xy * raw_y + cal->x0) >> CYD_TOUCHCAL_SHIFT);
+    *y = (int16_t)((cal->yx * raw_x + cal->yy * raw_y + cal->y0) >> CYD_TOUCHCAL_SHIFT);
+}
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // CYD_TOUCHCAL_H
@@ -0,0 +1,147 @@
+#include "cyd_touchfilter.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// A gap this long between samples means the velocity estimate no longer describes the finger.
+#define STALE_SAMPLE_MS 100.0f
+
+static int16_t median(const int16_t *win, uint8_t len) {
+    int16_t v[CYD_TOUCHFILTER_MEDIAN_MAX];
+    memcpy(v, win, len * sizeof(v[0]));
+    for (uint8_t i = 1; i < len; i++) {
+        const int16_t key = v[i];
+        int j = i - 1;
+        while (j >= 0 && v[j] > key) {
+            v[j + 1] = v[j];
+            j--;
+        }
+        v[j + 1] = key;
+    }
+    // Until the window fills it may hold an even count; take the middle pair's mean then.
+    return (len & 1) ? v[len / 2] : (int16_t)((v[len / 2 - 1] + v[len / 2]) / 2);
+}
+
+void cyd_touchfilter_init(cyd_touchfilter_t *f, const cyd_touchfilter_cfg_t *cfg) {
+    memset(f, 0, sizeof(*f));
+    f->cfg = *cfg;
+    if (f->cfg.median < 1) f->cfg.median = 1;
+    if (f->cfg.median > CYD_TOUCHFILTER_MEDIAN_MAX) f->cfg.median = CYD_TOUCHFILTER_MEDIAN_MAX;
+}
+
+void cyd_touchfilter_reset(cyd_touchfilter_t *f) {
+    f->active = false;
+}
+
+void cyd_touchfilter_add(cyd_touchfilter_t *f, int16_t x, int16_t y, uint32_t t_us) {
+    if (!f->active) {
+        f->win_len = 0;
+        f->win_next = 0;
+    }
+    f->win_x[f->win_next] = x;
+    f->win_y[f->win_next] = y;
+    f->win_us[f->win_next] = t_us;
+    f->win_next = (uint8_t)((f->win_next + 1) % f->cfg.median);
+    if (f->win_len < f->cfg.median) f->win_len++;
+
+    if (!f->active) {
+        f->x = x;
+        f->y = y;
+        f->vx = 0.0f;
+        f->vy = 0.0f;
+        f->decel = 0.0f;
+        f->step_speed = 0.0f;
+        f->raw_step = 0.0f;
+        f->raw_x = x;
+        f->raw_y = y;
+        f->t_us = t_us;
+        f->x_age_us = 0;
+        f->active = true;
+        return;
+    }
+
+    int16_t mx = median(f->win_x, f->win_len);
+    int16_t my = median(f->win_y, f->win_len);
+    if (abs(mx - f->x) <= f->cfg.deadband_px && abs(my - f->y) <= f->cfg.deadband_px) {
+        mx = f->x;
+        my = f->y;
+    }
+
+    // For steady motion the median is the window's middle sample, from the window's mean time.
+    uint32_t age_sum = 0;
+    for (uint8_t i = 0; i < f->win_len; i++) age_sum += t_us - f->win_us[i];
+    const uint32_t x_age_us = age_sum / f->win_len;
+
+    const float dt_ms = (float)((t_us - x_age_us) - (f->t_us - f->x_age_us)) / 1000.0f;
+    if (dt_ms >= STALE_SAMPLE_MS) {
+        f->vx = 0.0f;
+        f->vy = 0.0f;
+        f->decel = 0.0f;
+    } else if (dt_ms > 0.5f) {
+        const float vx = (float)(mx - f->x) / dt_ms;
+        const float vy = (float)(my - f->y) / dt_ms;
+        const float speed = sqrtf(vx * vx + vy * vy);
+        const float prev_speed = sqrtf(f->vx * f->vx + f->vy * f->vy);
+        f->decel = 0.0f;
+        if (vx * f->vx + vy * f->vy < 0.0f) {
+            // Reversal: the old direction would carry the prediction past the turning point.
+            f->vx = 0.0f;
+            f->vy = 0.0f;
+        } else if (speed < prev_speed) {
+            // Slowing down: smoothing here is what makes a prediction overshoot.
+            f->decel = (prev_speed - speed) / dt_ms;
+            f->vx = vx;
+            f->vy = vy;
+        } else {
+            const float gain = f->cfg.velocity_gain / 256.0f;
+            f->vx += gain * (vx - f->vx);
+            f->vy += gain * (vy - f->vy);
+        }
+    }
+    // Along the estimated direction: the finger's last step, as seen by the raw samples (which
+    // stop at once) and by the median (which ignores noise that looks like a step).
+    const float speed = sqrtf(f->vx * f->vx + f->vy * f->vy);
+    const float raw_dt_ms = (float)(t_us - f->t_us) / 1000.0f;
+    if (speed > 0.0f && raw_dt_ms > 0.5f) {
+        const float raw_step = ((x - f->raw_x) * f->vx + (y - f->raw_y) * f->vy) / (speed * raw_dt_ms);
+        const float median_step = ((mx - f->x) * f->vx + (my - f->y) * f->vy) / (speed * raw_dt_ms);
+        f->step_speed = fminf(fminf(raw_step, f->raw_step), median_step);
+        f->raw_step = raw_step;
+    } else {
+        f->step_speed = 0.0f;
+        f->raw_step = 0.0f;
+    }
+    f->raw_x = x;
+    f->raw_y = y;
+    f->x = mx;
+    f->y = my;
+    f->t_us = t_us;
+    f->x_age_us = x_age_us;
+}
+
+void cyd_touchfilter_predict(const cyd_touchfilter_t *f, uint32_t now_us, int16_t *x, int16_t *y) {
+    *x = f->x;
+    *y = f->y;
+    const float velocity = sqrtf(f->vx * f->vx + f->vy * f->vy);  // px/ms
+    const float speed = velocity < f->step_speed ? velocity : f->step_speed;
+    if (speed * 1000.0f < f->cfg.min_speed) return;
+
+    // From the median's sample time to the read, then on to the panel; a late read does not
+    // stretch the lead.
+    float elapsed_ms = (float)(now_us - f->t_us) / 1000.0f;
+    if (elapsed_ms > f->cfg.horizon_ms) elapsed_ms = f->cfg.horizon_ms;
+    float lead = speed * (f->x_age_us / 1000.0f + elapsed_ms + f->cfg.horizon_ms);
+    if (f->decel > 0.0f) {
+        const float stop = speed * speed / (2.0f * f->decel);
+        if (lead > stop) lead = stop;
+    }
+    if (lead > f->cfg.max_lead_px) lead = f->cfg.max_lead_px;
+    *x = (int16_t)(f->x + lroundf(f->vx / velocity * lead));
+    *y = (int16_t)(f->y + lroundf(f->vy / velocity * lead));
+}
+
+void cyd_touchfilter_settled(const cyd_touchfilter_t *f, int16_t *x, int16_t *y) {
+    *x = f->x;
+    *y = f->y;
+}
@@ -0,0 +1,79 @@
+#ifndef CYD_TOUCHFILTER_H
+#define CYD_TOUCHFILTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Per-touch input filter between the touch ring (cyd_touch) and LVGL, in screen pixels. Each
+// sample goes through a short median window (single-sample spikes and resistive-panel jitter), a
+// dead band that holds a resting finger still, and a smoothed velocity estimate. What LVGL reads
+// is the filtered position carried forward by that velocity to when the frame will be on the
+// panel, so a dragged slider knob keeps up with the finger instead of trailing it by a frame or
+// two.
+//
+// The velocity is smoothed while the finger speeds up but follows it straight down when it slows,
+// and a reversal restarts it from zero. The lead is capped, limited to the distance the finger
+// needs to stop at its current deceleration, and only given while the last steps (raw and median)
+// still move on; noise at rest stays below min_speed. cyd_touchfilter_settled() gives the
+// position without prediction, which is what a release should land on.
+
+#define CYD_TOUCHFILTER_MEDIAN_MAX 5
+
+typedef struct {
+    uint8_t median;         // window in samples: 1 (off), 3 or 5
+    uint8_t deadband_px;    // a resting finger's position moves only once it leaves this radius
+    uint8_t velocity_gain;  // weight of the newest velocity sample, /256
+    uint8_t horizon_ms;     // look-ahead past the read: the read-to-panel delay to hide
+    uint8_t max_lead_px;    // cap on the predicted displacement
+    uint16_t min_speed;     // px/s below which nothing is predicted
+} cyd_touchfilter_cfg_t;
+
+// Capacitive controller: clean coordinates, so hardly any dead band.
+#define CYD_TOUCHFILTER_FT5X06 {3, 1, 128, 24, 24, 150}
+// Resistive controller: a few pixels of noise and the odd spike, so a wider dead band. A
+// five-sample median would trail the finger further than the prediction can make up. Its noisy
+// velocity overshoots a stop when carried on to the panel, so the lead only makes up the median's
+// own delay (no horizon): less lag than without prediction, though still more than raw points.
+#define CYD_TOUCHFILTER_XPT2046 {3, 2, 128, 0, 12, 150}
+// Raw points: no median, no dead band, nothing predicted.
+#define CYD_TOUCHFILTER_OFF {1, 0, 0, 0, 0, UINT16_MAX}
+
+typedef struct {
+    cyd_touchfilter_cfg_t cfg;
+    int16_t win_x[CYD_TOUCHFILTER_MEDIAN_MAX];
+    int16_t win_y[CYD_TOUCHFILTER_MEDIAN_MAX];
+    uint32_t win_us[CYD_TOUCHFILTER_MEDIAN_MAX];
+    uint8_t win_len;
+    uint8_t win_next;
+    int16_t x;  // median, held within the dead band
+    int16_t y;
+    float vx;  // px/ms
+    float vy;
+    float decel;        // px/ms², 0 unless the finger is slowing down
+    float step_speed;   // px/ms along (vx, vy): the least of the last two raw steps and the last median step
+    float raw_step;     // px/ms along (vx, vy) of the last raw step
+    int16_t raw_x;      // last raw sample
+    int16_t raw_y;
+    uint32_t t_us;      // of the last sample
+    uint32_t x_age_us;  // how far x, y lag t_us: a median trails a moving finger by half its window
+    bool active;    // a touch is in progress
+} cyd_touchfilter_t;
+
+void cyd_touchfilter_init(cyd_touchfilter_t *f, const cyd_touchfilter_cfg_t *cfg);
+// A new touch starts with the next sample.
+void cyd_touchfilter_reset(cyd_touchfilter_t *f);
+// t_us: sample time (cyd_touch_point_t.us).
+void cyd_touchfilter_add(cyd_touchfilter_t *f, int16_t x, int16_t y, uint32_t t_us);
+// Position expected horizon_ms after now_us. Only meaningful while a touch is in progress.
+void cyd_touchfilter_predict(const cyd_touchfilter_t *f, uint32_t now_us, int16_t *x, int16_t *y);
+void cyd_touchfilter_settled(const cyd_touchfilter_t *f, int16_t *x, int16_t *y);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // CYD_TOUCHFILTER_H
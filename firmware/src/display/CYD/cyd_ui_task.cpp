@@ -0,0 +1,149 @@
+#include "cyd_ui_task.h"
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <lvgl.h>
+
+#include <atomic>
+
+namespace {
+
+constexpr uint32_t UI_TASK_STACK_BYTES = 8192;
+constexpr UBaseType_t UI_TASK_PRIORITY = 2;  // above loop() (1), below the Wi-Fi stack
+constexpr uint32_t UI_TASK_MIN_SLEEP_MS = 1;
+constexpr uint32_t UI_TASK_MAX_SLEEP_MS = 1000;  // keeps the hook's timeout/log checks running
+constexpr UBaseType_t UI_QUEUE_LEN = 16;
+
+struct UiCall {
+    cyd_ui_call_t fn;
+    cyd_ui_apply_t apply;
+    void *arg;
+};
+
+SemaphoreHandle_t ui_mutex = nullptr;
+QueueHandle_t ui_queue = nullptr;
+TaskHandle_t ui_task = nullptr;
+cyd_ui_hook_t ui_hook = nullptr;
+volatile bool ui_paused = false;
+volatile uint32_t ui_paused_poll_ms = 0;
+
+// Load accounting: added to on the LVGL task, taken and reset by cyd_ui_take_stats() from another
+// core, so each counter is swapped out in one atomic step. stats_since_us is the reader's alone.
+std::atomic<uint32_t> stats_busy_us{0};
+std::atomic<uint32_t> stats_wakeups{0};
+int64_t stats_since_us = 0;
+volatile uint32_t last_pass_us = 0;
+
+void run_call(const UiCall &call) {
+    if (call.fn) call.fn(call.arg);
+    if (call.apply) call.apply();
+}
+
+bool post_call(const UiCall &call) {
+    if (cyd_ui_in_task() || ui_queue == nullptr) {
+        // Already on the LVGL task (or it has not started yet): no hand-off needed.
+        cyd_ui_lock(portMAX_DELAY);
+        run_call(call);
+        cyd_ui_unlock();
+        return true;
+    }
+    if (xQueueSend(ui_queue, &call, 0) != pdTRUE) return false;
+    cyd_ui_wake();
+    return true;
+}
+
+void ui_task_main(void * /*arg*/) {
+    for (;;) {
+        const int64_t start_us = esp_timer_get_time();
+        cyd_ui_lock(portMAX_DELAY);
+        UiCall call;
+        while (xQueueReceive(ui_queue, &call, 0) == pdTRUE) {
+            run_call(call);
+        }
+        if (ui_hook) ui_hook();
+        const bool paused = ui_paused;
+        uint32_t sleep_ms = paused ? 0 : lv_timer_handler();
+        cyd_ui_unlock();
+        last_pass_us = static_cast<uint32_t>(esp_timer_get_time() - start_us);
+        stats_busy_us.fetch_add(last_pass_us, std::memory_order_relaxed);
+        stats_wakeups.fetch_add(1, std::memory_order_relaxed);
+
+        if (paused) {
+            // No LVGL timers run; only a wake (or the poll interval) brings the hook back.
+            ulTaskNotifyTake(pdTRUE, ui_paused_poll_ms ? pdMS_TO_TICKS(ui_paused_poll_ms) : portMAX_DELAY);
+            continue;
+        }
+        // Sleep until the next LVGL timer is due unless something wakes the task first.
+        if (sleep_ms < UI_TASK_MIN_SLEEP_MS) sleep_ms = UI_TASK_MIN_SLEEP_MS;
+        if (sleep_ms > UI_TASK_MAX_SLEEP_MS) sleep_ms = UI_TASK_MAX_SLEEP_MS;
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sleep_ms));
+    }
+}
+
+}  // namespace
+
+bool cyd_ui_task_start(int core, cyd_ui_hook_t hook) {
+    if (ui_task) return true;
+    if (!ui_mutex) ui_mutex = xSemaphoreCreateRecursiveMutex();
+    if (!ui_queue) ui_queue = xQueueCreate(UI_QUEUE_LEN, sizeof(UiCall));
+    if (!ui_mutex || !ui_queue) return false;
+    ui_hook = hook;
+    stats_since_us = esp_timer_get_time();
+    return xTaskCreatePinnedToCore(ui_task_main, "lvgl", UI_TASK_STACK_BYTES, nullptr, UI_TASK_PRIORITY, &ui_task,
+                                   core) == pdPASS;
+}
+
+bool cyd_ui_in_task(void) {
+    return ui_task != nullptr && xTaskGetCurrentTaskHandle() == ui_task;
+}
+
+void cyd_ui_wake(void) {
+    if (ui_task && xTaskGetCurrentTaskHandle() != ui_task) xTaskNotifyGive(ui_task);
+}
+
+void IRAM_ATTR cyd_ui_wake_from_isr(void) {
+    if (!ui_task) return;
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(ui_task, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+void cyd_ui_pause(uint32_t poll_ms) {
+    ui_paused_poll_ms = poll_ms;
+    ui_paused = true;
+}
+
+void cyd_ui_resume(void) {
+    ui_paused = false;
+    cyd_ui_wake();
+}
+
+void cyd_ui_take_stats(cyd_ui_stats_t *out) {
+    const int64_t now = esp_timer_get_time();
+    out->busy_us = stats_busy_us.exchange(0, std::memory_order_relaxed);
+    out->wakeups = stats_wakeups.exchange(0, std::memory_order_relaxed);
+    out->elapsed_us = static_cast<uint32_t>(now - stats_since_us);
+    stats_since_us = now;
+}
+
+uint32_t cyd_ui_last_pass_us(void) {
+    return last_pass_us;
+}
+
+bool cyd_ui_lock(uint32_t timeout_ms) {
+    if (!ui_mutex) return true;  // single-threaded until the task starts
+    const TickType_t ticks = timeout_ms == portMAX_DELAY ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    return xSemaphoreTakeRecursive(ui_mutex, ticks) == pdTRUE;
+}
+
+void cyd_ui_unlock(void) {
+    if (ui_mutex) xSemaphoreGiveRecursive(ui_mutex);
+}
+
+bool cyd_ui_post(cyd_ui_call_t fn, void *arg) {
+    return post_call(UiCall{fn, nullptr, arg});
+}
+
+bool cyd_ui_post_apply(cyd_ui_apply_t fn) {
+    return post_call(UiCall{nullptr, fn, nullptr});
+}
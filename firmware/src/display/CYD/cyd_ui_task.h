@@ -0,0 +1,58 @@
+#ifndef CYD_UI_TASK_H
+#define CYD_UI_TASK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// LVGL runs in its own FreeRTOS task. Code on that task (LVGL event callbacks, flush, touch)
+// may touch LVGL objects directly. Any other context must either post a call with
+// cyd_ui_post()/cyd_ui_post_apply(), which runs on the LVGL task before its next
+// lv_timer_handler(), or bracket the access with cyd_ui_lock()/cyd_ui_unlock().
+//
+// Between passes the task sleeps until LVGL's next timer is due. Posting a call wakes it early,
+// as do cyd_ui_wake() and cyd_ui_wake_from_isr().
+
+typedef void (*cyd_ui_call_t)(void *arg);
+typedef void (*cyd_ui_apply_t)(void);
+typedef void (*cyd_ui_hook_t)(void);
+
+typedef struct {
+    uint32_t busy_us;     // time spent awake (queue, hook, lv_timer_handler)
+    uint32_t wakeups;     // passes
+    uint32_t elapsed_us;  // window length
+} cyd_ui_stats_t;
+
+// Start the LVGL task on core. hook runs on the task before every lv_timer_handler() pass.
+bool cyd_ui_task_start(int core, cyd_ui_hook_t hook);
+bool cyd_ui_in_task(void);
+
+void cyd_ui_wake(void);
+void cyd_ui_wake_from_isr(void);
+// Stop running lv_timer_handler() (no rendering, animations or input polling). Queued calls
+// and the hook still run whenever the task is woken, or every poll_ms when it is not 0.
+void cyd_ui_pause(uint32_t poll_ms);
+void cyd_ui_resume(void);
+// Load since the previous call (or task start); resets the counters.
+void cyd_ui_take_stats(cyd_ui_stats_t *out);
+// Busy time of the task's previous pass (queue, hook, lv_timer_handler), e.g. for the hook to
+// record: the task's longest passes are what delays input and frames.
+uint32_t cyd_ui_last_pass_us(void);
+
+bool cyd_ui_lock(uint32_t timeout_ms);
+void cyd_ui_unlock(void);
+
+// Queue fn(arg) for the LVGL task. Returns false when the queue is full. Calls made from the
+// LVGL task itself run immediately.
+bool cyd_ui_post(cyd_ui_call_t fn, void *arg);
+// Same for argument-less calls such as cyd_state_bind_active.
+bool cyd_ui_post_apply(cyd_ui_apply_t fn);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // CYD_UI_TASK_H
@@ -0,0 +1,21 @@
+#include "cyd_uitable.h"
+
+void cyd_uitable_build(const cyd_uitable_screen_t *screen) {
+    const cyd_uitable_style_t *style = screen->styles;
+    const cyd_uitable_themed_t *themed = screen->themed;
+    for (uint16_t i = 0; i < screen->node_cnt; i++) {
+        const cyd_uitable_node_t *node = &screen->nodes[i];
+        lv_obj_t *obj = node->create(node->parent ? *node->parent : NULL);
+        *node->obj = obj;
+        if (node->bare) lv_obj_remove_style_all(obj);
+        for (uint8_t s = 0; s < node->style_cnt; s++, style++) {
+            lv_obj_add_style(obj, style->style, style->selector);
+        }
+        for (uint8_t t = 0; t < node->themed_cnt; t++, themed++) {
+            ui_object_set_themeable_style_property(obj, themed->selector, themed->prop, themed->var);
+        }
+        if (node->remove_flags) lv_obj_remove_flag(obj, (lv_obj_flag_t)node->remove_flags);
+        if (node->add_flags) lv_obj_add_flag(obj, (lv_obj_flag_t)node->add_flags);
+        if (node->text) lv_label_set_text_static(obj, node->text);
+    }
+}
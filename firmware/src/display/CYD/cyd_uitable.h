@@ -0,0 +1,59 @@
+#ifndef CYD_UITABLE_H
+#define CYD_UITABLE_H
+
+#include <stdint.h>
+#include <lvgl.h>
+#include "ui_theme_manager.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Table-driven screen construction. tools/build_ui_tables.py turns each SquareLine screen
+// (ui/ui_<screen>.c) into screens/scr_<screen>.c: one const node per widget plus shared const
+// styles (screens/scr_styles.c) in place of SquareLine's per-widget local style properties. A
+// screen's init function builds its table, then runs whatever SquareLine code the tables do not
+// describe (widget values, options, image sources, event callbacks) as generated.
+//
+// Widgets are created in table order, so parents always precede their children. Each node takes
+// its style_cnt entries from the screen's style list and themed_cnt from its themed list, in
+// order; properties set through the SquareLine theme manager reference cyd_theme's shared styles
+// so theme switches still reach them.
+
+typedef struct {
+    const lv_style_t *style;
+    lv_style_selector_t selector;
+} cyd_uitable_style_t;
+
+typedef struct {
+    const ui_theme_variable_t *var;
+    lv_style_selector_t selector;
+    lv_style_prop_t prop;
+} cyd_uitable_themed_t;
+
+typedef struct {
+    lv_obj_t **obj;     // variable that receives the widget
+    lv_obj_t **parent;  // NULL for the screen itself
+    lv_obj_t *(*create)(lv_obj_t *parent);
+    const char *text;   // label text, kept static; NULL to leave it
+    uint32_t add_flags;
+    uint32_t remove_flags;
+    uint8_t style_cnt;
+    uint8_t themed_cnt;
+    uint8_t bare;       // drop the theme's styles (lv_obj_remove_style_all) before styling
+} cyd_uitable_node_t;
+
+typedef struct {
+    const cyd_uitable_node_t *nodes;
+    const cyd_uitable_style_t *styles;
+    const cyd_uitable_themed_t *themed;
+    uint16_t node_cnt;
+} cyd_uitable_screen_t;
+
+void cyd_uitable_build(const cyd_uitable_screen_t *screen);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // CYD_UITABLE_H
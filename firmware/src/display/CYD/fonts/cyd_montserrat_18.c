@@ -0,0 +1,1176 @@
+/*******************************************************************************
+ * Size: 18 px
+ * Bpp: 4
+ * Subset of LVGL's lv_font_montserrat_18.c, generated by tools/subset_fonts.py. Do not edit.
+ * Glyphs (71):  %'-./0123456789:<ABCDEFHIKLMNOPRSTUVWX[]_abcdefghiklmnopqrstuvwxyz° + 3 symbols
+ ******************************************************************************/
+
+#include <lvgl.h>
+
+#if CYD_FONT_SUBSET
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0025 "%" */
+    0x1, 0xbf, 0xc3, 0x0, 0x0, 0x2f, 0x40, 0x0,
+    0xc9, 0x16, 0xe0, 0x0, 0xc, 0x90, 0x0, 0x2f,
+    0x0, 0xc, 0x50, 0x7, 0xe0, 0x0, 0x4, 0xd0,
+    0x0, 0xa7, 0x2, 0xf4, 0x0, 0x0, 0x3f, 0x0,
+    0xc, 0x60, 0xc9, 0x0, 0x0, 0x0, 0xd7, 0x4,
+    0xf1, 0x7e, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xe4,
+    0x2f, 0x41, 0xae, 0xb2, 0x0, 0x0, 0x10, 0xc,
+    0x90, 0xc9, 0x28, 0xe0, 0x0, 0x0, 0x6, 0xe1,
+    0x3f, 0x0, 0xd, 0x50, 0x0, 0x2, 0xf4, 0x4,
+    0xd0, 0x0, 0xa7, 0x0, 0x0, 0xba, 0x0, 0x3e,
+    0x0, 0xc, 0x50, 0x0, 0x6e, 0x10, 0x0, 0xd7,
+    0x5, 0xe1, 0x0, 0x1f, 0x50, 0x0, 0x2, 0xbf,
+    0xc3, 0x0,
+
+    /* U+0027 "'" */
+    0xda, 0xd9, 0xd9, 0xc8, 0xc8, 0x0,
+
+    /* U+002D "-" */
+    0x88, 0x88, 0x7f, 0xff, 0xfe,
+
+    /* U+002E "." */
+    0x5, 0x60, 0x1f, 0xf2, 0xc, 0xd0,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0x0, 0x57, 0x0, 0x0, 0x0, 0xea,
+    0x0, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x9, 0xf0,
+    0x0, 0x0, 0xe, 0xa0, 0x0, 0x0, 0x4f, 0x40,
+    0x0, 0x0, 0x9e, 0x0, 0x0, 0x0, 0xe9, 0x0,
+    0x0, 0x4, 0xf4, 0x0, 0x0, 0x9, 0xe0, 0x0,
+    0x0, 0xe, 0x90, 0x0, 0x0, 0x4f, 0x40, 0x0,
+    0x0, 0xae, 0x0, 0x0, 0x0, 0xf9, 0x0, 0x0,
+    0x5, 0xf3, 0x0, 0x0, 0xa, 0xe0, 0x0, 0x0,
+    0xf, 0x90, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x4, 0xbe, 0xeb, 0x40, 0x0, 0x0, 0x6f,
+    0xfb, 0xbf, 0xf6, 0x0, 0x2, 0xfd, 0x10, 0x1,
+    0xdf, 0x20, 0xa, 0xf3, 0x0, 0x0, 0x3f, 0xa0,
+    0xe, 0xe0, 0x0, 0x0, 0xe, 0xe0, 0xf, 0xb0,
+    0x0, 0x0, 0xb, 0xf0, 0x1f, 0xa0, 0x0, 0x0,
+    0xa, 0xf1, 0xf, 0xb0, 0x0, 0x0, 0xb, 0xf0,
+    0xe, 0xe0, 0x0, 0x0, 0xe, 0xe0, 0x9, 0xf3,
+    0x0, 0x0, 0x3f, 0x90, 0x2, 0xfd, 0x10, 0x1,
+    0xdf, 0x20, 0x0, 0x6f, 0xfb, 0xbf, 0xf6, 0x0,
+    0x0, 0x4, 0xbe, 0xeb, 0x40, 0x0,
+
+    /* U+0031 "1" */
+    0xdf, 0xff, 0xc8, 0xaa, 0xfc, 0x0, 0xf, 0xc0,
+    0x0, 0xfc, 0x0, 0xf, 0xc0, 0x0, 0xfc, 0x0,
+    0xf, 0xc0, 0x0, 0xfc, 0x0, 0xf, 0xc0, 0x0,
+    0xfc, 0x0, 0xf, 0xc0, 0x0, 0xfc, 0x0, 0xf,
+    0xc0,
+
+    /* U+0032 "2" */
+    0x1, 0x8d, 0xfe, 0xc5, 0x0, 0x4f, 0xfd, 0xac,
+    0xff, 0x70, 0x3c, 0x30, 0x0, 0x2f, 0xf0, 0x0,
+    0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0xc,
+    0xf1, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
+    0x2, 0xee, 0x20, 0x0, 0x0, 0x2e, 0xf3, 0x0,
+    0x0, 0x2, 0xef, 0x30, 0x0, 0x0, 0x2e, 0xf3,
+    0x0, 0x0, 0x2, 0xef, 0x30, 0x0, 0x0, 0x2e,
+    0xfc, 0xaa, 0xaa, 0xa7, 0x5f, 0xff, 0xff, 0xff,
+    0xfb,
+
+    /* U+0033 "3" */
+    0x5f, 0xff, 0xff, 0xff, 0xf0, 0x3a, 0xaa, 0xaa,
+    0xcf, 0xc0, 0x0, 0x0, 0x1, 0xee, 0x10, 0x0,
+    0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x9f, 0x60,
+    0x0, 0x0, 0x4, 0xfe, 0x61, 0x0, 0x0, 0x5,
+    0xdf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x3e, 0xf2,
+    0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0,
+    0x6, 0xf6, 0x69, 0x10, 0x0, 0x1d, 0xf2, 0x9f,
+    0xfc, 0xbc, 0xff, 0x80, 0x4, 0xae, 0xfe, 0xb5,
+    0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0,
+    0x1, 0xed, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0,
+    0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xc0, 0x3, 0xc5, 0x0, 0x0, 0xde, 0x10, 0x4,
+    0xf7, 0x0, 0xb, 0xf4, 0x0, 0x4, 0xf7, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x39, 0x99,
+    0x99, 0x9b, 0xfc, 0x98, 0x0, 0x0, 0x0, 0x5,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xf7, 0x0,
+
+    /* U+0035 "5" */
+    0x2, 0xff, 0xff, 0xff, 0xf0, 0x4, 0xfc, 0xaa,
+    0xaa, 0xa0, 0x5, 0xf5, 0x0, 0x0, 0x0, 0x7,
+    0xf3, 0x0, 0x0, 0x0, 0x9, 0xf1, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xc7, 0x0, 0x7, 0xaa,
+    0xab, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xb, 0xf6,
+    0x0, 0x0, 0x0, 0x3, 0xfa, 0x0, 0x0, 0x0,
+    0x3, 0xfa, 0x3c, 0x20, 0x0, 0xb, 0xf6, 0x6f,
+    0xfd, 0xbb, 0xef, 0xb0, 0x3, 0x9d, 0xff, 0xc7,
+    0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x1, 0x8d, 0xfe, 0xc6, 0x0, 0x4, 0xef,
+    0xca, 0xad, 0x90, 0x1, 0xee, 0x40, 0x0, 0x0,
+    0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0xe, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0xfb, 0x2a, 0xef, 0xd7,
+    0x0, 0x1f, 0xdf, 0xd9, 0x9d, 0xfb, 0x1, 0xff,
+    0xa0, 0x0, 0xa, 0xf5, 0xf, 0xf2, 0x0, 0x0,
+    0x3f, 0x90, 0xbf, 0x20, 0x0, 0x3, 0xf8, 0x4,
+    0xfa, 0x0, 0x0, 0xaf, 0x40, 0x9, 0xfd, 0x99,
+    0xdf, 0xa0, 0x0, 0x5, 0xcf, 0xfc, 0x60, 0x0,
+
+    /* U+0037 "7" */
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0x7, 0xfb, 0xaa,
+    0xaa, 0xaf, 0xe0, 0x7f, 0x40, 0x0, 0x5, 0xf8,
+    0x6, 0xf4, 0x0, 0x0, 0xcf, 0x10, 0x0, 0x0,
+    0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0, 0xa, 0xf3,
+    0x0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0x50, 0x0, 0x0, 0x0, 0xe, 0xe0,
+    0x0, 0x0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0x4f, 0x90,
+    0x0, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x2a, 0xef, 0xfc, 0x70, 0x0, 0x3f, 0xfb,
+    0x89, 0xdf, 0xb0, 0xa, 0xf5, 0x0, 0x0, 0xbf,
+    0x30, 0xbf, 0x10, 0x0, 0x8, 0xf4, 0x4, 0xfc,
+    0x42, 0x26, 0xfd, 0x0, 0x6, 0xff, 0xff, 0xfe,
+    0x10, 0x5, 0xfe, 0x85, 0x6a, 0xfd, 0x10, 0xee,
+    0x10, 0x0, 0x7, 0xf8, 0x2f, 0xa0, 0x0, 0x0,
+    0x1f, 0xb2, 0xfb, 0x0, 0x0, 0x2, 0xfb, 0xd,
+    0xf4, 0x0, 0x0, 0xaf, 0x70, 0x3f, 0xfb, 0x89,
+    0xdf, 0xc0, 0x0, 0x29, 0xdf, 0xfc, 0x60, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x6c, 0xff, 0xc6, 0x0, 0x0, 0xaf, 0xd9,
+    0x8c, 0xfa, 0x0, 0x3f, 0xb0, 0x0, 0x7, 0xf6,
+    0x7, 0xf5, 0x0, 0x0, 0xf, 0xd0, 0x6f, 0x60,
+    0x0, 0x2, 0xff, 0x11, 0xff, 0x51, 0x4, 0xdf,
+    0xf2, 0x4, 0xef, 0xff, 0xfb, 0x9f, 0x30, 0x0,
+    0x57, 0x73, 0xa, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0,
+    0x0, 0x0, 0x3e, 0xf2, 0x0, 0x8e, 0xba, 0xcf,
+    0xf5, 0x0, 0x5, 0xbe, 0xfd, 0x92, 0x0, 0x0,
+
+    /* U+003A ":" */
+    0xc, 0xd0, 0x1f, 0xf2, 0x5, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x60,
+    0x1f, 0xf2, 0xc, 0xd0,
+
+    /* U+003C "<" */
+    0x0, 0x0, 0x0, 0x5, 0x20, 0x0, 0x1, 0x8e,
+    0xf4, 0x0, 0x4b, 0xff, 0x93, 0x6, 0xdf, 0xc6,
+    0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x5, 0xcf,
+    0xe7, 0x10, 0x0, 0x0, 0x39, 0xff, 0xb4, 0x0,
+    0x0, 0x1, 0x6d, 0xf4, 0x0, 0x0, 0x0, 0x4,
+    0x20,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xf6, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdd, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0x60, 0x4f, 0x70, 0x0, 0x0, 0x0, 0xb,
+    0xe0, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x2, 0xf8,
+    0x0, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x9f, 0x10,
+    0x0, 0xe, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x7, 0xf8, 0x88, 0x88,
+    0x88, 0xfa, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0,
+    0xb, 0xf1, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0,
+    0x4f, 0x80, 0xc, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0xee, 0x0,
+
+    /* U+0042 "B" */
+    0x1f, 0xff, 0xff, 0xfe, 0xb4, 0x0, 0x1f, 0xd8,
+    0x88, 0x8a, 0xff, 0x70, 0x1f, 0xb0, 0x0, 0x0,
+    0x2f, 0xf0, 0x1f, 0xb0, 0x0, 0x0, 0xc, 0xf0,
+    0x1f, 0xb0, 0x0, 0x0, 0x2f, 0xc0, 0x1f, 0xd8,
+    0x88, 0x8a, 0xfe, 0x30, 0x1f, 0xff, 0xff, 0xff,
+    0xfd, 0x40, 0x1f, 0xb0, 0x0, 0x1, 0x4d, 0xf3,
+    0x1f, 0xb0, 0x0, 0x0, 0x4, 0xf9, 0x1f, 0xb0,
+    0x0, 0x0, 0x2, 0xfb, 0x1f, 0xb0, 0x0, 0x0,
+    0x8, 0xf8, 0x1f, 0xd8, 0x88, 0x89, 0xcf, 0xe1,
+    0x1f, 0xff, 0xff, 0xff, 0xd9, 0x10,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x4a, 0xef, 0xeb, 0x50, 0x0, 0x1,
+    0xbf, 0xfc, 0xac, 0xff, 0xb0, 0x0, 0xbf, 0xb2,
+    0x0, 0x1, 0x9c, 0x0, 0x6f, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xb2, 0x0, 0x1, 0xac, 0x10,
+    0x1, 0xbf, 0xfc, 0xbc, 0xff, 0xb0, 0x0, 0x0,
+    0x4b, 0xef, 0xeb, 0x50, 0x0,
+
+    /* U+0044 "D" */
+    0x1f, 0xff, 0xff, 0xfd, 0xa4, 0x0, 0x1, 0xfe,
+    0xaa, 0xaa, 0xcf, 0xfa, 0x0, 0x1f, 0xb0, 0x0,
+    0x0, 0x2b, 0xfa, 0x1, 0xfb, 0x0, 0x0, 0x0,
+    0xc, 0xf4, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x3f,
+    0xb1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xee, 0x1f,
+    0xb0, 0x0, 0x0, 0x0, 0xd, 0xf1, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0xee, 0x1f, 0xb0, 0x0, 0x0,
+    0x0, 0x3f, 0xb1, 0xfb, 0x0, 0x0, 0x0, 0xc,
+    0xf4, 0x1f, 0xb0, 0x0, 0x0, 0x2b, 0xfa, 0x1,
+    0xfe, 0xaa, 0xaa, 0xcf, 0xfa, 0x0, 0x1f, 0xff,
+    0xff, 0xfd, 0xa4, 0x0, 0x0,
+
+    /* U+0045 "E" */
+    0x1f, 0xff, 0xff, 0xff, 0xfc, 0x1, 0xfe, 0xaa,
+    0xaa, 0xaa, 0x70, 0x1f, 0xb0, 0x0, 0x0, 0x0,
+    0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
+    0x0, 0x0, 0x0, 0x1, 0xfd, 0x99, 0x99, 0x99,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0xf0, 0x1, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
+    0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xb0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0xaa, 0xaa,
+    0xaa, 0xa0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x0,
+
+    /* U+0046 "F" */
+    0x1f, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xea, 0xaa,
+    0xaa, 0xa7, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f,
+    0xb0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
+    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xf0, 0x1f, 0xe9, 0x99, 0x99, 0x90,
+    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
+    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f,
+    0xb0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
+    0x0,
+
+    /* U+0048 "H" */
+    0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xb0,
+    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xb0, 0x0, 0x0,
+    0x1, 0xfb, 0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb,
+    0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xea,
+    0xaa, 0xaa, 0xaa, 0xfb, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb,
+    0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xb0,
+    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xb0, 0x0, 0x0,
+    0x1, 0xfb, 0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb,
+    0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb,
+
+    /* U+0049 "I" */
+    0x1f, 0xb1, 0xfb, 0x1f, 0xb1, 0xfb, 0x1f, 0xb1,
+    0xfb, 0x1f, 0xb1, 0xfb, 0x1f, 0xb1, 0xfb, 0x1f,
+    0xb1, 0xfb, 0x1f, 0xb0,
+
+    /* U+004B "K" */
+    0x1f, 0xb0, 0x0, 0x0, 0x1d, 0xe2, 0x1f, 0xb0,
+    0x0, 0x1, 0xdf, 0x30, 0x1f, 0xb0, 0x0, 0xc,
+    0xf4, 0x0, 0x1f, 0xb0, 0x0, 0xbf, 0x50, 0x0,
+    0x1f, 0xb0, 0xb, 0xf7, 0x0, 0x0, 0x1f, 0xb0,
+    0xaf, 0x80, 0x0, 0x0, 0x1f, 0xb9, 0xff, 0xb0,
+    0x0, 0x0, 0x1f, 0xff, 0xbb, 0xf8, 0x0, 0x0,
+    0x1f, 0xfb, 0x1, 0xdf, 0x50, 0x0, 0x1f, 0xd0,
+    0x0, 0x2f, 0xf2, 0x0, 0x1f, 0xb0, 0x0, 0x4,
+    0xfd, 0x10, 0x1f, 0xb0, 0x0, 0x0, 0x7f, 0xb0,
+    0x1f, 0xb0, 0x0, 0x0, 0x9, 0xf8,
+
+    /* U+004C "L" */
+    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
+    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f,
+    0xb0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
+    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
+    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
+    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
+    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f,
+    0xea, 0xaa, 0xaa, 0xa5, 0x1f, 0xff, 0xff, 0xff,
+    0xf8,
+
+    /* U+004D "M" */
+    0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x41,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x1f, 0xf4, 0x1f,
+    0xfc, 0x0, 0x0, 0x0, 0x9, 0xff, 0x41, 0xff,
+    0xf5, 0x0, 0x0, 0x2, 0xfe, 0xf4, 0x1f, 0xad,
+    0xe0, 0x0, 0x0, 0xbe, 0x8f, 0x41, 0xfa, 0x4f,
+    0x80, 0x0, 0x4f, 0x67, 0xf4, 0x1f, 0xa0, 0xaf,
+    0x20, 0xd, 0xd0, 0x7f, 0x41, 0xfa, 0x2, 0xfa,
+    0x7, 0xf4, 0x7, 0xf4, 0x1f, 0xa0, 0x8, 0xf5,
+    0xea, 0x0, 0x7f, 0x41, 0xfa, 0x0, 0xe, 0xff,
+    0x20, 0x6, 0xf4, 0x1f, 0xa0, 0x0, 0x5f, 0x80,
+    0x0, 0x6f, 0x41, 0xfa, 0x0, 0x0, 0x60, 0x0,
+    0x6, 0xf4, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0x40,
+
+    /* U+004E "N" */
+    0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xf8,
+    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xff, 0x50, 0x0,
+    0x1, 0xfb, 0x1f, 0xdf, 0xf2, 0x0, 0x1, 0xfb,
+    0x1f, 0xb6, 0xfd, 0x0, 0x1, 0xfb, 0x1f, 0xb0,
+    0x9f, 0xa0, 0x1, 0xfb, 0x1f, 0xb0, 0xc, 0xf6,
+    0x1, 0xfb, 0x1f, 0xb0, 0x1, 0xef, 0x31, 0xfb,
+    0x1f, 0xb0, 0x0, 0x4f, 0xe2, 0xfb, 0x1f, 0xb0,
+    0x0, 0x7, 0xfd, 0xfb, 0x1f, 0xb0, 0x0, 0x0,
+    0xbf, 0xfb, 0x1f, 0xb0, 0x0, 0x0, 0x1d, 0xfb,
+    0x1f, 0xb0, 0x0, 0x0, 0x2, 0xfb,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x4a, 0xdf, 0xeb, 0x50, 0x0, 0x0,
+    0x0, 0xaf, 0xfc, 0xbc, 0xff, 0xc1, 0x0, 0x0,
+    0xbf, 0xb2, 0x0, 0x1, 0xaf, 0xd0, 0x0, 0x6f,
+    0xb0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0xc, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xf2, 0x1f, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0x30, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xf2, 0xc, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0xfe, 0x0, 0x6f, 0xb0, 0x0, 0x0,
+    0x0, 0x9f, 0x80, 0x0, 0xbf, 0xb2, 0x0, 0x1,
+    0xaf, 0xd0, 0x0, 0x0, 0xaf, 0xfc, 0xbc, 0xff,
+    0xc1, 0x0, 0x0, 0x0, 0x4a, 0xef, 0xeb, 0x50,
+    0x0, 0x0,
+
+    /* U+0050 "P" */
+    0x1f, 0xff, 0xff, 0xfc, 0x70, 0x0, 0x1f, 0xea,
+    0xaa, 0xbe, 0xfd, 0x10, 0x1f, 0xb0, 0x0, 0x0,
+    0x9f, 0x90, 0x1f, 0xb0, 0x0, 0x0, 0xe, 0xf0,
+    0x1f, 0xb0, 0x0, 0x0, 0xc, 0xf0, 0x1f, 0xb0,
+    0x0, 0x0, 0xe, 0xf0, 0x1f, 0xb0, 0x0, 0x0,
+    0x9f, 0x90, 0x1f, 0xea, 0xaa, 0xbe, 0xfd, 0x10,
+    0x1f, 0xff, 0xff, 0xfc, 0x70, 0x0, 0x1f, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0052 "R" */
+    0x1f, 0xff, 0xff, 0xfc, 0x70, 0x0, 0x1f, 0xea,
+    0xaa, 0xbe, 0xfd, 0x10, 0x1f, 0xb0, 0x0, 0x0,
+    0x9f, 0x90, 0x1f, 0xb0, 0x0, 0x0, 0xe, 0xf0,
+    0x1f, 0xb0, 0x0, 0x0, 0xc, 0xf0, 0x1f, 0xb0,
+    0x0, 0x0, 0xe, 0xe0, 0x1f, 0xb0, 0x0, 0x0,
+    0x9f, 0x90, 0x1f, 0xd9, 0x99, 0xae, 0xfd, 0x10,
+    0x1f, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x1f, 0xb0,
+    0x0, 0x1f, 0xd0, 0x0, 0x1f, 0xb0, 0x0, 0x6,
+    0xf9, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0xbf, 0x40,
+    0x1f, 0xb0, 0x0, 0x0, 0x1e, 0xe0,
+
+    /* U+0053 "S" */
+    0x0, 0x29, 0xdf, 0xfd, 0x81, 0x0, 0x3f, 0xfc,
+    0x9a, 0xdf, 0xc0, 0xb, 0xf4, 0x0, 0x0, 0x23,
+    0x0, 0xed, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xfa, 0x61, 0x0,
+    0x0, 0x0, 0x3b, 0xff, 0xfd, 0x70, 0x0, 0x0,
+    0x0, 0x48, 0xef, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0x40, 0x0, 0x0, 0x0, 0x6, 0xf6, 0xb,
+    0x50, 0x0, 0x0, 0xcf, 0x31, 0xdf, 0xeb, 0x9a,
+    0xef, 0x90, 0x0, 0x6b, 0xef, 0xeb, 0x50, 0x0,
+
+    /* U+0054 "T" */
+    0xef, 0xff, 0xff, 0xff, 0xff, 0x89, 0xaa, 0xad,
+    0xfb, 0xaa, 0xa5, 0x0, 0x0, 0x9f, 0x20, 0x0,
+    0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0x20, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0,
+    0x9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20,
+    0x0, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x9, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
+
+    /* U+0055 "U" */
+    0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90,
+    0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0,
+    0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7,
+    0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90,
+    0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0,
+    0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf6,
+    0x2f, 0xb0, 0x0, 0x0, 0x7, 0xf5, 0xe, 0xf0,
+    0x0, 0x0, 0xb, 0xf2, 0x8, 0xfa, 0x0, 0x0,
+    0x7f, 0xb0, 0x0, 0xcf, 0xfb, 0xbe, 0xfe, 0x20,
+    0x0, 0x7, 0xcf, 0xfd, 0x81, 0x0,
+
+    /* U+0056 "V" */
+    0xc, 0xf2, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x6,
+    0xf8, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x0, 0xef,
+    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x8f, 0x60,
+    0x0, 0x0, 0x7f, 0x50, 0x0, 0x1f, 0xd0, 0x0,
+    0x0, 0xee, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x5,
+    0xf7, 0x0, 0x0, 0x3, 0xfb, 0x0, 0xc, 0xf1,
+    0x0, 0x0, 0x0, 0xdf, 0x20, 0x2f, 0xa0, 0x0,
+    0x0, 0x0, 0x6f, 0x80, 0x9f, 0x30, 0x0, 0x0,
+    0x0, 0xe, 0xe1, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xfc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0x80, 0x0, 0x0,
+
+    /* U+0057 "W" */
+    0x4f, 0x90, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
+    0x2, 0xf8, 0xe, 0xe0, 0x0, 0x0, 0x2f, 0xf8,
+    0x0, 0x0, 0x8, 0xf3, 0x9, 0xf3, 0x0, 0x0,
+    0x7f, 0xfd, 0x0, 0x0, 0xd, 0xd0, 0x4, 0xf8,
+    0x0, 0x0, 0xcd, 0x8f, 0x20, 0x0, 0x2f, 0x80,
+    0x0, 0xfe, 0x0, 0x2, 0xf8, 0x3f, 0x80, 0x0,
+    0x7f, 0x30, 0x0, 0xaf, 0x30, 0x7, 0xf3, 0xe,
+    0xd0, 0x0, 0xde, 0x0, 0x0, 0x5f, 0x80, 0xc,
+    0xd0, 0x8, 0xf2, 0x2, 0xf9, 0x0, 0x0, 0xf,
+    0xd0, 0x2f, 0x80, 0x3, 0xf7, 0x7, 0xf4, 0x0,
+    0x0, 0xa, 0xf2, 0x7f, 0x30, 0x0, 0xed, 0xc,
+    0xe0, 0x0, 0x0, 0x5, 0xf7, 0xdd, 0x0, 0x0,
+    0x9f, 0x4f, 0x90, 0x0, 0x0, 0x0, 0xfe, 0xf8,
+    0x0, 0x0, 0x3f, 0xdf, 0x40, 0x0, 0x0, 0x0,
+    0xbf, 0xf3, 0x0, 0x0, 0xe, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xe0, 0x0, 0x0, 0x9, 0xfa,
+    0x0, 0x0,
+
+    /* U+0058 "X" */
+    0x2f, 0xd0, 0x0, 0x0, 0xb, 0xf3, 0x6, 0xfa,
+    0x0, 0x0, 0x7f, 0x70, 0x0, 0xbf, 0x50, 0x2,
+    0xfc, 0x0, 0x0, 0x1e, 0xe1, 0xd, 0xf2, 0x0,
+    0x0, 0x5, 0xfb, 0x8f, 0x50, 0x0, 0x0, 0x0,
+    0x9f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xfe, 0x10, 0x0,
+    0x0, 0x9, 0xf6, 0x5f, 0xa0, 0x0, 0x0, 0x4f,
+    0xb0, 0xa, 0xf6, 0x0, 0x1, 0xee, 0x10, 0x1,
+    0xef, 0x20, 0xb, 0xf5, 0x0, 0x0, 0x4f, 0xc0,
+    0x6f, 0xa0, 0x0, 0x0, 0x8, 0xf8,
+
+    /* U+005B "[" */
+    0x1f, 0xff, 0xa1, 0xfc, 0x74, 0x1f, 0xa0, 0x1,
+    0xfa, 0x0, 0x1f, 0xa0, 0x1, 0xfa, 0x0, 0x1f,
+    0xa0, 0x1, 0xfa, 0x0, 0x1f, 0xa0, 0x1, 0xfa,
+    0x0, 0x1f, 0xa0, 0x1, 0xfa, 0x0, 0x1f, 0xa0,
+    0x1, 0xfa, 0x0, 0x1f, 0xa0, 0x1, 0xfa, 0x0,
+    0x1f, 0xc7, 0x41, 0xff, 0xfa,
+
+    /* U+005D "]" */
+    0xaf, 0xff, 0x14, 0x7c, 0xf1, 0x0, 0xaf, 0x10,
+    0xa, 0xf1, 0x0, 0xaf, 0x10, 0xa, 0xf1, 0x0,
+    0xaf, 0x10, 0xa, 0xf1, 0x0, 0xaf, 0x10, 0xa,
+    0xf1, 0x0, 0xaf, 0x10, 0xa, 0xf1, 0x0, 0xaf,
+    0x10, 0xa, 0xf1, 0x0, 0xaf, 0x10, 0xa, 0xf1,
+    0x47, 0xcf, 0x1a, 0xff, 0xf1,
+
+    /* U+005F "_" */
+    0xff, 0xff, 0xff, 0xff, 0xf2, 0x22, 0x22, 0x22,
+    0x22,
+
+    /* U+0061 "a" */
+    0x1, 0x7c, 0xff, 0xd6, 0x0, 0x9, 0xfc, 0x99,
+    0xef, 0x80, 0x1, 0x30, 0x0, 0xd, 0xf0, 0x0,
+    0x0, 0x0, 0x9, 0xf2, 0x1, 0x9e, 0xff, 0xff,
+    0xf3, 0xa, 0xf8, 0x43, 0x3a, 0xf3, 0xf, 0xb0,
+    0x0, 0x8, 0xf3, 0xf, 0xb0, 0x0, 0xe, 0xf3,
+    0x9, 0xf9, 0x46, 0xdf, 0xf3, 0x0, 0x8d, 0xfe,
+    0x87, 0xf3,
+
+    /* U+0062 "b" */
+    0x5f, 0x50, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0,
+    0x5, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x56,
+    0xdf, 0xea, 0x20, 0x5, 0xfd, 0xfc, 0x9b, 0xff,
+    0x30, 0x5f, 0xf5, 0x0, 0x4, 0xfe, 0x5, 0xfa,
+    0x0, 0x0, 0x8, 0xf4, 0x5f, 0x60, 0x0, 0x0,
+    0x4f, 0x75, 0xf6, 0x0, 0x0, 0x4, 0xf7, 0x5f,
+    0xa0, 0x0, 0x0, 0x8f, 0x45, 0xff, 0x50, 0x0,
+    0x4f, 0xe0, 0x5f, 0xcf, 0xc9, 0xbf, 0xf3, 0x5,
+    0xf4, 0x6d, 0xfe, 0xa2, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x7, 0xdf, 0xeb, 0x30, 0x0, 0xcf, 0xd9,
+    0xaf, 0xf4, 0x9, 0xf7, 0x0, 0x2, 0xc3, 0xf,
+    0xd0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
+    0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0xf, 0xc0,
+    0x0, 0x0, 0x0, 0x9, 0xf7, 0x0, 0x2, 0xc3,
+    0x0, 0xcf, 0xd9, 0xaf, 0xf3, 0x0, 0x7, 0xdf,
+    0xeb, 0x30,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
+    0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xa0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x8,
+    0xdf, 0xe8, 0x2f, 0xa0, 0x1d, 0xfd, 0x9b, 0xfd,
+    0xfa, 0xa, 0xf8, 0x0, 0x2, 0xef, 0xa0, 0xfd,
+    0x0, 0x0, 0x6, 0xfa, 0x3f, 0x80, 0x0, 0x0,
+    0x2f, 0xa3, 0xf8, 0x0, 0x0, 0x2, 0xfa, 0xf,
+    0xc0, 0x0, 0x0, 0x5f, 0xa0, 0xaf, 0x60, 0x0,
+    0x1e, 0xfa, 0x1, 0xdf, 0xb7, 0x9e, 0xdf, 0xa0,
+    0x0, 0x8d, 0xfe, 0x91, 0xfa,
+
+    /* U+0065 "e" */
+    0x0, 0x8, 0xdf, 0xe9, 0x10, 0x0, 0x1d, 0xfb,
+    0x8a, 0xfe, 0x20, 0xa, 0xf3, 0x0, 0x3, 0xfb,
+    0x0, 0xfa, 0x0, 0x0, 0x9, 0xf1, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0x33, 0xfa, 0x33, 0x33, 0x33,
+    0x30, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0x90, 0x0, 0x9, 0x10, 0x0, 0xdf, 0xda, 0xae,
+    0xf6, 0x0, 0x0, 0x7d, 0xff, 0xc5, 0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x1a, 0xee, 0x90, 0xa, 0xf9, 0x88, 0x0,
+    0xfb, 0x0, 0x0, 0x1f, 0x90, 0x0, 0xbf, 0xff,
+    0xff, 0x55, 0x8f, 0xc7, 0x72, 0x1, 0xfa, 0x0,
+    0x0, 0x1f, 0xa0, 0x0, 0x1, 0xfa, 0x0, 0x0,
+    0x1f, 0xa0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x1f,
+    0xa0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x1f, 0xa0,
+    0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x8, 0xdf, 0xe9, 0x1e, 0xc0, 0x1d, 0xfd,
+    0x9b, 0xfe, 0xec, 0xa, 0xf8, 0x0, 0x1, 0xdf,
+    0xc0, 0xfd, 0x0, 0x0, 0x4, 0xfc, 0x3f, 0x90,
+    0x0, 0x0, 0xf, 0xc3, 0xf8, 0x0, 0x0, 0x0,
+    0xfc, 0xf, 0xd0, 0x0, 0x0, 0x4f, 0xc0, 0xaf,
+    0x80, 0x0, 0x1d, 0xfc, 0x1, 0xdf, 0xd9, 0xaf,
+    0xdf, 0xc0, 0x0, 0x8d, 0xfe, 0x91, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0x90, 0x27, 0x0, 0x0,
+    0xb, 0xf4, 0x7, 0xff, 0xb9, 0xae, 0xfa, 0x0,
+    0x4, 0xae, 0xff, 0xc6, 0x0,
+
+    /* U+0068 "h" */
+    0x5f, 0x50, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0,
+    0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x5f,
+    0x50, 0x0, 0x0, 0x0, 0x5f, 0x56, 0xdf, 0xea,
+    0x10, 0x5f, 0xef, 0xca, 0xdf, 0xd0, 0x5f, 0xf4,
+    0x0, 0xa, 0xf6, 0x5f, 0x90, 0x0, 0x2, 0xf9,
+    0x5f, 0x60, 0x0, 0x0, 0xfa, 0x5f, 0x50, 0x0,
+    0x0, 0xfb, 0x5f, 0x50, 0x0, 0x0, 0xfb, 0x5f,
+    0x50, 0x0, 0x0, 0xfb, 0x5f, 0x50, 0x0, 0x0,
+    0xfb, 0x5f, 0x50, 0x0, 0x0, 0xfb,
+
+    /* U+0069 "i" */
+    0x6f, 0x69, 0xf9, 0x4, 0x0, 0x0, 0x5f, 0x55,
+    0xf5, 0x5f, 0x55, 0xf5, 0x5f, 0x55, 0xf5, 0x5f,
+    0x55, 0xf5, 0x5f, 0x55, 0xf5,
+
+    /* U+006B "k" */
+    0x5f, 0x50, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0,
+    0x5, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x50,
+    0x0, 0x1d, 0xf3, 0x5, 0xf5, 0x0, 0x2d, 0xf3,
+    0x0, 0x5f, 0x50, 0x2e, 0xf4, 0x0, 0x5, 0xf5,
+    0x2e, 0xf4, 0x0, 0x0, 0x5f, 0x9e, 0xfe, 0x0,
+    0x0, 0x5, 0xff, 0xfa, 0xfa, 0x0, 0x0, 0x5f,
+    0xe3, 0xc, 0xf6, 0x0, 0x5, 0xf6, 0x0, 0x1e,
+    0xf3, 0x0, 0x5f, 0x50, 0x0, 0x4f, 0xd0, 0x5,
+    0xf5, 0x0, 0x0, 0x7f, 0xa0,
+
+    /* U+006C "l" */
+    0x5f, 0x55, 0xf5, 0x5f, 0x55, 0xf5, 0x5f, 0x55,
+    0xf5, 0x5f, 0x55, 0xf5, 0x5f, 0x55, 0xf5, 0x5f,
+    0x55, 0xf5, 0x5f, 0x55, 0xf5,
+
+    /* U+006D "m" */
+    0x5f, 0x58, 0xdf, 0xe8, 0x0, 0x8d, 0xfe, 0x80,
+    0x5, 0xfe, 0xfa, 0x9d, 0xfb, 0xdf, 0xa9, 0xdf,
+    0xb0, 0x5f, 0xf2, 0x0, 0xd, 0xff, 0x30, 0x0,
+    0xcf, 0x35, 0xf9, 0x0, 0x0, 0x7f, 0xa0, 0x0,
+    0x6, 0xf6, 0x5f, 0x60, 0x0, 0x5, 0xf7, 0x0,
+    0x0, 0x4f, 0x75, 0xf5, 0x0, 0x0, 0x5f, 0x60,
+    0x0, 0x4, 0xf7, 0x5f, 0x50, 0x0, 0x5, 0xf6,
+    0x0, 0x0, 0x4f, 0x75, 0xf5, 0x0, 0x0, 0x5f,
+    0x60, 0x0, 0x4, 0xf7, 0x5f, 0x50, 0x0, 0x5,
+    0xf6, 0x0, 0x0, 0x4f, 0x75, 0xf5, 0x0, 0x0,
+    0x5f, 0x60, 0x0, 0x4, 0xf7,
+
+    /* U+006E "n" */
+    0x5f, 0x57, 0xdf, 0xea, 0x10, 0x5f, 0xef, 0xa8,
+    0xcf, 0xd0, 0x5f, 0xf3, 0x0, 0x9, 0xf6, 0x5f,
+    0x90, 0x0, 0x2, 0xf9, 0x5f, 0x60, 0x0, 0x0,
+    0xfa, 0x5f, 0x50, 0x0, 0x0, 0xfb, 0x5f, 0x50,
+    0x0, 0x0, 0xfb, 0x5f, 0x50, 0x0, 0x0, 0xfb,
+    0x5f, 0x50, 0x0, 0x0, 0xfb, 0x5f, 0x50, 0x0,
+    0x0, 0xfb,
+
+    /* U+006F "o" */
+    0x0, 0x7, 0xdf, 0xea, 0x30, 0x0, 0xd, 0xfd,
+    0x9a, 0xff, 0x50, 0x9, 0xf7, 0x0, 0x2, 0xef,
+    0x10, 0xfd, 0x0, 0x0, 0x6, 0xf7, 0x3f, 0x80,
+    0x0, 0x0, 0x2f, 0x93, 0xf8, 0x0, 0x0, 0x2,
+    0xf9, 0xf, 0xd0, 0x0, 0x0, 0x6f, 0x60, 0x9f,
+    0x80, 0x0, 0x2e, 0xf1, 0x0, 0xcf, 0xd9, 0xaf,
+    0xf4, 0x0, 0x0, 0x7d, 0xfe, 0xa3, 0x0,
+
+    /* U+0070 "p" */
+    0x5f, 0x46, 0xdf, 0xea, 0x20, 0x5, 0xfd, 0xfa,
+    0x8a, 0xff, 0x30, 0x5f, 0xf4, 0x0, 0x3, 0xfe,
+    0x5, 0xfa, 0x0, 0x0, 0x8, 0xf4, 0x5f, 0x60,
+    0x0, 0x0, 0x4f, 0x75, 0xf6, 0x0, 0x0, 0x4,
+    0xf7, 0x5f, 0xa0, 0x0, 0x0, 0x9f, 0x45, 0xff,
+    0x50, 0x0, 0x4f, 0xe0, 0x5f, 0xdf, 0xc9, 0xbf,
+    0xf3, 0x5, 0xf5, 0x6d, 0xfe, 0xa2, 0x0, 0x5f,
+    0x50, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x5,
+    0xf5, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0071 "q" */
+    0x0, 0x8, 0xdf, 0xe8, 0x1f, 0xa0, 0x1d, 0xfd,
+    0x9b, 0xfc, 0xfa, 0xa, 0xf7, 0x0, 0x2, 0xef,
+    0xa0, 0xfd, 0x0, 0x0, 0x6, 0xfa, 0x3f, 0x80,
+    0x0, 0x0, 0x2f, 0xa3, 0xf8, 0x0, 0x0, 0x2,
+    0xfa, 0xf, 0xd0, 0x0, 0x0, 0x6f, 0xa0, 0xaf,
+    0x80, 0x0, 0x2e, 0xfa, 0x1, 0xdf, 0xd9, 0xaf,
+    0xdf, 0xa0, 0x0, 0x8d, 0xfe, 0x82, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0,
+    0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0,
+    0x0, 0x0, 0x0, 0x1, 0xfa,
+
+    /* U+0072 "r" */
+    0x5f, 0x46, 0xdb, 0x5f, 0xcf, 0xd9, 0x5f, 0xf5,
+    0x0, 0x5f, 0xa0, 0x0, 0x5f, 0x70, 0x0, 0x5f,
+    0x50, 0x0, 0x5f, 0x50, 0x0, 0x5f, 0x50, 0x0,
+    0x5f, 0x50, 0x0, 0x5f, 0x50, 0x0,
+
+    /* U+0073 "s" */
+    0x1, 0x8d, 0xfe, 0xc7, 0x0, 0xcf, 0xb8, 0xad,
+    0xd0, 0x3f, 0x90, 0x0, 0x1, 0x2, 0xfb, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xb8, 0x40, 0x0, 0x5,
+    0x9c, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x9f, 0x60,
+    0x50, 0x0, 0x5, 0xf7, 0x5f, 0xea, 0x9a, 0xfe,
+    0x10, 0x6c, 0xef, 0xd9, 0x20,
+
+    /* U+0074 "t" */
+    0x1, 0xfa, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0xbf,
+    0xff, 0xff, 0x55, 0x8f, 0xc7, 0x72, 0x1, 0xfa,
+    0x0, 0x0, 0x1f, 0xa0, 0x0, 0x1, 0xfa, 0x0,
+    0x0, 0x1f, 0xa0, 0x0, 0x1, 0xfa, 0x0, 0x0,
+    0xf, 0xc0, 0x0, 0x0, 0xbf, 0xa9, 0x90, 0x1,
+    0xbe, 0xe9,
+
+    /* U+0075 "u" */
+    0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0,
+    0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f,
+    0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3,
+    0xf8, 0x7f, 0x40, 0x0, 0x4, 0xf8, 0x6f, 0x60,
+    0x0, 0x6, 0xf8, 0x2f, 0xc0, 0x0, 0x1e, 0xf8,
+    0xa, 0xfd, 0x89, 0xee, 0xf8, 0x0, 0x8d, 0xfe,
+    0x92, 0xf8,
+
+    /* U+0076 "v" */
+    0xd, 0xe0, 0x0, 0x0, 0xd, 0xd0, 0x6, 0xf6,
+    0x0, 0x0, 0x3f, 0x70, 0x0, 0xfc, 0x0, 0x0,
+    0xaf, 0x10, 0x0, 0x9f, 0x30, 0x1, 0xf9, 0x0,
+    0x0, 0x2f, 0x90, 0x7, 0xf3, 0x0, 0x0, 0xb,
+    0xf0, 0xe, 0xc0, 0x0, 0x0, 0x5, 0xf6, 0x5f,
+    0x50, 0x0, 0x0, 0x0, 0xed, 0xbe, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xf1, 0x0, 0x0,
+
+    /* U+0077 "w" */
+    0xbe, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0xae,
+    0x5, 0xf4, 0x0, 0x2, 0xff, 0x60, 0x0, 0xf,
+    0x80, 0xf, 0x90, 0x0, 0x8f, 0xeb, 0x0, 0x5,
+    0xf2, 0x0, 0xae, 0x0, 0xd, 0xb8, 0xf1, 0x0,
+    0xbd, 0x0, 0x4, 0xf4, 0x3, 0xf5, 0x2f, 0x70,
+    0x1f, 0x70, 0x0, 0xe, 0xa0, 0x9e, 0x0, 0xcc,
+    0x6, 0xf1, 0x0, 0x0, 0x9f, 0x1e, 0x90, 0x6,
+    0xf2, 0xcc, 0x0, 0x0, 0x3, 0xfa, 0xf3, 0x0,
+    0x1f, 0xaf, 0x60, 0x0, 0x0, 0xd, 0xfd, 0x0,
+    0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0x70,
+    0x0, 0x5, 0xfb, 0x0, 0x0,
+
+    /* U+0078 "x" */
+    0x3f, 0xb0, 0x0, 0xc, 0xf2, 0x7, 0xf7, 0x0,
+    0x7f, 0x60, 0x0, 0xbf, 0x33, 0xfa, 0x0, 0x0,
+    0x1e, 0xde, 0xd0, 0x0, 0x0, 0x4, 0xff, 0x30,
+    0x0, 0x0, 0x6, 0xff, 0x50, 0x0, 0x0, 0x3f,
+    0xbc, 0xf2, 0x0, 0x0, 0xde, 0x12, 0xfc, 0x0,
+    0xa, 0xf4, 0x0, 0x5f, 0x90, 0x6f, 0x80, 0x0,
+    0xa, 0xf5,
+
+    /* U+0079 "y" */
+    0xd, 0xe0, 0x0, 0x0, 0xc, 0xd0, 0x6, 0xf6,
+    0x0, 0x0, 0x3f, 0x70, 0x0, 0xfc, 0x0, 0x0,
+    0x9f, 0x10, 0x0, 0x9f, 0x30, 0x1, 0xfa, 0x0,
+    0x0, 0x2f, 0x90, 0x6, 0xf3, 0x0, 0x0, 0xc,
+    0xf0, 0xd, 0xc0, 0x0, 0x0, 0x5, 0xf6, 0x3f,
+    0x60, 0x0, 0x0, 0x0, 0xed, 0xae, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xf, 0xb0,
+    0x0, 0x0, 0x1, 0x0, 0x7f, 0x40, 0x0, 0x0,
+    0x1f, 0xaa, 0xfb, 0x0, 0x0, 0x0, 0x19, 0xee,
+    0xa1, 0x0, 0x0, 0x0,
+
+    /* U+007A "z" */
+    0x2f, 0xff, 0xff, 0xff, 0x91, 0x77, 0x77, 0x7e,
+    0xf4, 0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x3,
+    0xfc, 0x0, 0x0, 0x1, 0xee, 0x10, 0x0, 0x0,
+    0xbf, 0x40, 0x0, 0x0, 0x8f, 0x70, 0x0, 0x0,
+    0x4f, 0xb0, 0x0, 0x0, 0x1e, 0xf8, 0x77, 0x77,
+    0x54, 0xff, 0xff, 0xff, 0xfb,
+
+    /* U+00B0 "°" */
+    0x1, 0xaf, 0xd5, 0x0, 0xb8, 0x3, 0xe4, 0x1e,
+    0x0, 0x6, 0xa2, 0xe0, 0x0, 0x6a, 0xc, 0x70,
+    0x1d, 0x50, 0x2c, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+F00C "<symbol>" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0x90, 0x9, 0xd2, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xf9, 0x0, 0x9f, 0xfe,
+    0x20, 0x0, 0x8, 0xff, 0xff, 0x90, 0x0, 0xdf,
+    0xff, 0xe2, 0x0, 0x8f, 0xff, 0xf9, 0x0, 0x0,
+    0x2e, 0xff, 0xfe, 0x28, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xd8, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F077 "<symbol>" */
+    0x0, 0x0, 0x0, 0x4, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xfa, 0xcf, 0xfe, 0x30, 0x0,
+    0x0, 0x6f, 0xff, 0x90, 0xc, 0xff, 0xe3, 0x0,
+    0x6, 0xff, 0xf9, 0x0, 0x0, 0xcf, 0xfe, 0x30,
+    0x5f, 0xff, 0x90, 0x0, 0x0, 0xc, 0xff, 0xe2,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf6,
+    0x1b, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0x90,
+
+    /* U+F078 "<symbol>" */
+    0x3, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3, 0x20,
+    0x6f, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2,
+    0xaf, 0xfe, 0x20, 0x0, 0x0, 0x5, 0xff, 0xf6,
+    0x1c, 0xff, 0xe3, 0x0, 0x0, 0x5f, 0xff, 0x90,
+    0x1, 0xcf, 0xfe, 0x30, 0x5, 0xff, 0xf9, 0x0,
+    0x0, 0x1c, 0xff, 0xe3, 0x5f, 0xff, 0x90, 0x0,
+    0x0, 0x1, 0xcf, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0x90, 0x0, 0x0, 0x0
+};
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 77, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 243, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 98, .adv_w = 60, .box_w = 2, .box_h = 6, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 104, .adv_w = 110, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 109, .adv_w = 65, .box_w = 4, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 115, .adv_w = 101, .box_w = 8, .box_h = 18, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 187, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 265, .adv_w = 107, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 298, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 363, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 428, .adv_w = 193, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 506, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 571, .adv_w = 178, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 643, .adv_w = 172, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 715, .adv_w = 185, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 787, .adv_w = 178, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 859, .adv_w = 65, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 879, .adv_w = 168, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 920, .adv_w = 211, .box_w = 15, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1018, .adv_w = 218, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1096, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1181, .adv_w = 238, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1266, .adv_w = 193, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1338, .adv_w = 183, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1403, .adv_w = 234, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1481, .adv_w = 89, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1501, .adv_w = 207, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1579, .adv_w = 171, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1644, .adv_w = 275, .box_w = 15, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1742, .adv_w = 234, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1820, .adv_w = 242, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1918, .adv_w = 208, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1996, .adv_w = 209, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2074, .adv_w = 179, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2146, .adv_w = 169, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2218, .adv_w = 228, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2296, .adv_w = 205, .box_w = 14, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 2387, .adv_w = 324, .box_w = 20, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2517, .adv_w = 194, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2595, .adv_w = 96, .box_w = 5, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 2640, .adv_w = 96, .box_w = 5, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 2685, .adv_w = 144, .box_w = 9, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2694, .adv_w = 172, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2744, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2821, .adv_w = 164, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2871, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2948, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3003, .adv_w = 102, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3052, .adv_w = 199, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 3129, .adv_w = 196, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3199, .adv_w = 80, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3220, .adv_w = 177, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3297, .adv_w = 80, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3318, .adv_w = 304, .box_w = 17, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3403, .adv_w = 196, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3453, .adv_w = 183, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3508, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 3585, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 3662, .adv_w = 118, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3692, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3737, .adv_w = 119, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3779, .adv_w = 195, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3829, .adv_w = 161, .box_w = 12, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 3889, .adv_w = 259, .box_w = 17, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3974, .adv_w = 159, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4024, .adv_w = 161, .box_w = 12, .box_h = 14, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 4108, .adv_w = 150, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4153, .adv_w = 121, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 4178, .adv_w = 288, .box_w = 18, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4304, .adv_w = 252, .box_w = 16, .box_h = 10, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 4384, .adv_w = 252, .box_w = 16, .box_h = 10, .ofs_x = 0, .ofs_y = 2}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint8_t glyph_id_ofs_list_0[] = {
+    1, 0, 0, 0, 0, 2, 0, 3,
+    0, 0, 0, 0, 0, 4, 5, 6,
+    7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 0, 18, 0, 0, 0,
+    0, 19, 20, 21, 22, 23, 24, 0,
+    25, 26, 0, 27, 28, 29, 30, 31,
+    32, 0, 33, 34, 35, 36, 37, 38,
+    39, 0, 0, 40, 0, 41, 0, 42,
+    0, 43, 44, 45, 46, 47, 48, 49,
+    50, 51, 0, 52, 53, 54, 55, 56,
+    57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67
+};
+
+static const uint16_t unicode_list_1[] = {
+    0x0, 0xef5c, 0xefc7, 0xefc8
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 91, .glyph_id_start = 0,
+        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_0, .list_length = 91, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
+    },
+    {
+        .range_start = 176, .range_length = 61385, .glyph_id_start = 68,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 4, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 3, 1, 4, 5, 6, 7,
+    0, 8, 9, 10, 11, 12, 13, 14,
+    7, 15, 0, 17, 18, 19, 16, 20,
+    21, 22, 22, 24, 25, 22, 22, 16,
+    26, 27, 2, 28, 23, 29, 29, 30,
+    31, 32, 33, 34, 35, 36, 37, 38,
+    39, 40, 34, 41, 42, 37, 34, 34,
+    35, 35, 43, 44, 45, 46, 40, 47,
+    47, 48, 47, 49, 50, 0, 0, 0
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 3, 1, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 7, 13, 14,
+    15, 16, 0, 18, 19, 17, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 17,
+    19, 19, 2, 20, 21, 22, 22, 23,
+    24, 25, 26, 27, 28, 29, 29, 29,
+    0, 29, 28, 30, 28, 28, 31, 31,
+    29, 31, 29, 31, 32, 33, 34, 35,
+    35, 36, 35, 37, 38, 0, 0, 0
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    13, 0, 8, 0, -16, -17, 2, 14,
+    6, 5, -12, 2, 14, 1, 12, 3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 6, -9, 0,
+    0, 5, 6, 0, 0, -3, 0, -2,
+    3, 0, -3, 0, -3, -1, 0, 0,
+    0, -3, 0, 0, -4, 0, 0, -6,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -3, -3, 0, -4, -8, 0, -35, 6,
+    9, 0, 0, -6, 3, 3, 10, 6,
+    -5, 6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -8, 0, 0, -11, 1, -2, 0,
+    2, -5, -4, -6, 2, 0, -3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -16, 0, -18, -2, 0, 29, -3, -4,
+    3, 3, -3, 0, -4, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -18, 17, 0,
+    0, -20, -28, -20, -6, 9, 0, 0,
+    -19, 0, 3, -7, 0, -4, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, -35,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 2, 0, 0, 2,
+    -3, -6, 0, -1, -1, -3, 0, 0,
+    -2, 0, 0, 0, 0, -2, 0, -6,
+    0, -7, -10, 0, 0, -6, 0, 0,
+    0, 0, 0, 0, 3, 0, 2, -3,
+    0, 1, 0, 0, 3, -2, 3, 3,
+    -1, 0, 0, 0, -5, 0, -1, 0,
+    0, 0, 0, 1, 0, -2, 0, -3,
+    0, 0, 0, 9, 0, 0, -3, 0,
+    0, 0, 0, -1, 1, -2, -2, 0,
+    -3, 0, -3, 0, 0, 0, 0, 0,
+    -1, -1, 0, -3, -3, 0, 0, 0,
+    0, 1, 0, -2, 0, -3, -3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -4, 0, -4, -9, -2,
+    -9, 3, 6, 8, 0, -7, -1, -3,
+    0, -1, -14, 3, -2, 2, 3, 0,
+    0, -15, 0, -15, -2, 0, 0, 6,
+    8, 0, 4, 0, 0, 0, 1, 0,
+    -5, -4, 0, -9, 0, 0, -3, 0,
+    0, 0, 0, 0, -1, -1, 0, -1,
+    -4, 0, 0, 0, 0, 0, 0, -3,
+    0, -2, -3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, -2,
+    0, -3, -2, 0, -6, 1, 3, 3,
+    0, 0, 0, 0, 0, 0, -2, 0,
+    0, 0, 0, 2, 0, -3, 0, -3,
+    -2, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, -3, -4, 0, -5,
+    9, -2, 1, -14, -15, -12, -6, 3,
+    0, -2, -19, -5, 0, -5, 0, -6,
+    -5, -18, 0, 0, 0, 1, -1, 0,
+    0, -9, -11, 0, -14, -7, -7, -9,
+    -3, -8, -1, -5, -8, 2, 1, 0,
+    -3, 0, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1,
+    0, -3, 0, -5, -6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, -2, 0, 0, 3, 0, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -5, 0, 0, 2, -6, -6,
+    0, -3, -3, -3, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, -3, 0, -6,
+    -7, 0, 0, -9, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -4, 0, 3,
+    -12, 0, 0, -5, 10, 9, -2, -12,
+    0, 3, -4, 0, -14, -1, -4, 3,
+    -3, 4, 0, -10, -4, -11, -10, 0,
+    0, 16, 0, 0, -1, 0, 0, -1,
+    -1, -3, -8, -10, -1, -27, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, -1, -3, 0, 0, -3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1,
+    4, 0, -6, 3, -2, -1, -7, -3,
+    0, -4, -3, -2, -4, -5, 0, -2,
+    -1, -2, -5, 0, 0, 3, -2, 0,
+    -6, 0, 0, -6, 0, -5, 0, -5,
+    -5, 3, 0, 0, 0, -6, 3, 0,
+    -4, 0, -2, -3, -9, -2, -2, -2,
+    -1, -2, -1, 0, 0, 0, 0, -3,
+    -2, 0, 0, 3, -2, 0, -2, 0,
+    0, -2, -3, -2, -3, -3, -3, 0,
+    12, -1, 0, 0, -3, -12, -4, 4,
+    0, 0, -14, -5, 3, -5, 2, 0,
+    -2, -9, 0, 1, 0, 0, -5, 0,
+    3, -6, -5, 0, -5, -3, -3, -3,
+    0, -5, 1, -5, -5, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -4, 0, -4,
+    0, 0, -3, 0, 0, -3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, -4, 0, -10, 0, 2,
+    -6, 6, 1, -2, -14, 0, 0, -6,
+    -3, 0, -7, -8, 0, -12, -3, -12,
+    -11, -7, 2, 19, -4, 0, -7, -3,
+    -3, -5, -8, -5, -11, -12, -7, -3,
+    0, -2, 0, -3, 9, 6, -6, -11,
+    0, 1, -9, 0, -14, -2, -3, 6,
+    -4, 1, 0, -19, -3, -15, -3, 0,
+    0, 17, 1, 0, -2, 0, 0, 0,
+    -1, -2, -11, -2, 0, -19, 0, 0,
+    0, -1, -8, -14, 0, 0, -1, -4,
+    -9, -3, 0, -2, 0, 0, 0, -13,
+    -3, -9, -2, -5, -7, 0, -3, -10,
+    -4, 0, -3, -5, -5, 0, 1, 0,
+    -2, -10, 0, 6, 0, 0, 0, -1,
+    0, 0, 0, 0, 0, -2, -6, 0,
+    0, 0, 0, 0, 0, 0, 0, -3,
+    0, 0, -6, 0, 0, 5, -1, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 4, 2, -3, 0, -10, -9, -6,
+    -6, 12, 5, 3, -25, -2, 6, -3,
+    0, -3, -3, -10, 0, 3, -4, -2,
+    -9, 0, 6, 0, -8, 0, -16, -4,
+    -4, -11, 1, -4, -10, -10, -3, 12,
+    0, -4, 0, -7, -11, -12, -7, 9,
+    0, 1, -21, -2, 3, -5, -2, -7,
+    -6, -11, -4, -2, 0, 0, -7, 0,
+    7, -3, -16, 0, -16, -4, -10, -17,
+    -1, -9, -5, -10, -8, 8, 0, -4,
+    0, -5, 0, 5, -10, 3, 0, 0,
+    -15, 0, -3, -6, -5, -2, -7, -10,
+    -7, -9, -3, -7, -5, 0, 1, 14,
+    -5, 0, -9, -3, -3, -6, -7, -8,
+    -8, -11, -4, -6, 2, 0, 0, -2,
+    0, 11, 0, 5, 1, 1, -4, 0,
+    6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 8, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -5, 0, 0,
+    -5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, -8, 0, 3, 37, -6, -2,
+    9, 8, -8, 3, 0, 0, 3, 3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    8, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -8, 0, 0, 0, 0, -6, -1, 0,
+    0, 0, -6, 0, -3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    -3, 0, 0, -5, -4, 0, -8, 3,
+    -3, 0, 0, -8, -3, -7, 0, 0,
+    -8, 0, -3, 0, 0, -3, 0, -23,
+    -5, -12, -3, 0, 0, -8, -1, 0,
+    0, 0, 0, 0, 0, 0, -4, -5,
+    -2, -5, 0, 0, 0, -3, 6, 0,
+    -2, -7, -2, -5, -5, 0, -3, -1,
+    -2, 2, -1, 0, 0, -25, -2, -4,
+    0, -2, -3, 0, 0, -2, -2, 0,
+    0, 0, 2, 0, -2, -5, -2, 5,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, -6, 0,
+    -2, 3, 0, 0, 0, -8, -3, -6,
+    0, 0, -8, 0, -3, 0, 0, 0,
+    0, -28, 0, -6, -11, 0, 0, -2,
+    -4, 0, 0, 0, 0, 0, 0, 0,
+    -3, -4, -1, -4, 0, 0, 5, -3,
+    -3, -9, 3, 14, 5, 6, -8, 3,
+    12, 3, 8, 6, 0, 0, 0, 0,
+    0, 0, 0, 0, 14, -5, -3, 0,
+    -2, 23, 23, 0, 0, 0, 3, 0,
+    0, 11, 0, -5, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -24, -3, -2,
+    -12, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -5, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -24, -3, -2, -12, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -7, 3, 0, -3, 2, 5, 3,
+    -9, 0, -1, -2, 3, 0, 0, 0,
+    0, -7, 0, -3, -2, -3, 0, 18,
+    -3, 0, -6, -2, -2, -5, 0, -3,
+    -8, -6, -3, 0, 0, -5, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -24,
+    -3, -2, -12, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -5, 0, -3, -3, -12,
+    1, -2, 1, -2, -8, 1, 6, 1,
+    2, 1, -7, -12, -3, -11, -5, -8,
+    -12, -5, -3, -4, -2, -2, -3, -2,
+    -2, -1, 4, 0, 4, -2, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, -2,
+    -3, -3, 0, 0, -8, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -3, 0, -4, 0, 0,
+    0, -3, 3, 0, -5, -5, -2, 0,
+    -8, -2, -6, -2, -3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, -5, 0, 0, 0, -4, 0,
+    -3, 0, 0, -1, 0, -2, 0, -4,
+    -10, -9, 2, 3, 3, -1, -8, 2,
+    4, 2, 9, 2, -2, -8, 0, -12,
+    0, 0, -9, 0, 0, -4, -5, 0,
+    -4, 0, 0, -2, 4, 0, -2, -9,
+    -3, 11, 0, -3, 0, -7, 0, 3,
+    -3, 2, 0, 0, -10, 0, -2, -1,
+    0, -3, -2, 0, 0, -12, -3, -6,
+    0, 0, 0, 11, -3, 0, -5, 0,
+    0, -3, 0, -3, -9, 0, -3, 3,
+    0, 0, 0, -4, 1, 0, 0, -3,
+    -2, 0, -3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 0, 0, -2, 0, 0, 0,
+    1, 0, -3, -3, 0, 0, 6, 0,
+    7, 0, -18, -16, 1, 12, 9, 5,
+    -12, 2, 12, 0, 11, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0
+};
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 50,
+    .right_class_cnt     = 38,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+const lv_font_t lv_font_montserrat_18 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 21,
+    .base_line = 4,
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -1,
+    .underline_thickness = 1,
+    .dsc = &font_dsc,
+    .fallback = &lv_font_montserrat_16,
+};
+
+#endif /*CYD_FONT_SUBSET*/
@@ -0,0 +1,1685 @@
+/*******************************************************************************
+ * Size: 26 px
+ * Bpp: 4
+ * Subset of LVGL's lv_font_montserrat_26.c, generated by tools/subset_fonts.py. Do not edit.
+ * Glyphs (71):  %'-./0123456789:<ABCDEFHIKLMNOPRSTUVWX[]_abcdefghiklmnopqrstuvwxyz° + 3 symbols
+ ******************************************************************************/
+
+#include <lvgl.h>
+
+#if CYD_FONT_SUBSET
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0025 "%" */
+    0x0, 0x1a, 0xef, 0xc5, 0x0, 0x0, 0x0, 0x3,
+    0xfc, 0x0, 0x0, 0x1e, 0xfa, 0x9d, 0xf6, 0x0,
+    0x0, 0x0, 0xdf, 0x20, 0x0, 0x9, 0xf5, 0x0,
+    0xd, 0xf0, 0x0, 0x0, 0x8f, 0x70, 0x0, 0x0,
+    0xed, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x4f, 0xb0,
+    0x0, 0x0, 0xf, 0xb0, 0x0, 0x4, 0xf6, 0x0,
+    0xe, 0xf1, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
+    0x5f, 0x50, 0xa, 0xf6, 0x0, 0x0, 0x0, 0xb,
+    0xf1, 0x0, 0xa, 0xf1, 0x5, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xd4, 0x38, 0xfa, 0x1, 0xee,
+    0x10, 0x1, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfa,
+    0x0, 0xbf, 0x40, 0x7e, 0xff, 0xb1, 0x0, 0x0,
+    0x4, 0x42, 0x0, 0x6f, 0x90, 0x8f, 0xb6, 0x8f,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x1f,
+    0xc0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0xc,
+    0xf3, 0x5, 0xf5, 0x0, 0x0, 0xec, 0x0, 0x0,
+    0x0, 0x7, 0xf8, 0x0, 0x7f, 0x30, 0x0, 0xc,
+    0xe0, 0x0, 0x0, 0x2, 0xfd, 0x0, 0x7, 0xf3,
+    0x0, 0x0, 0xce, 0x0, 0x0, 0x0, 0xcf, 0x30,
+    0x0, 0x5f, 0x50, 0x0, 0xe, 0xc0, 0x0, 0x0,
+    0x8f, 0x70, 0x0, 0x0, 0xfc, 0x0, 0x5, 0xf6,
+    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x6, 0xfb,
+    0x68, 0xfc, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0,
+    0x0, 0x5, 0xcf, 0xe9, 0x0,
+
+    /* U+0027 "'" */
+    0x5f, 0xd5, 0xfc, 0x4f, 0xc4, 0xfb, 0x4f, 0xb3,
+    0xfa, 0x3f, 0xa0, 0x10,
+
+    /* U+002D "-" */
+    0x12, 0x22, 0x22, 0x21, 0x8f, 0xff, 0xff, 0xf7,
+    0x8f, 0xff, 0xff, 0xf7,
+
+    /* U+002E "." */
+    0x7, 0x70, 0x9f, 0xf8, 0xbf, 0xf9, 0x4e, 0xd2,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0x0, 0x0, 0x18, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x60, 0x0, 0x0, 0x0, 0x3, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0,
+    0x4, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x6, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0x70, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0x10, 0x0, 0x0, 0x0, 0x8, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x0, 0x4a, 0xef, 0xfc, 0x60, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0xbf, 0xfd, 0x85, 0x6b, 0xff, 0xe1, 0x0,
+    0x5, 0xff, 0xa0, 0x0, 0x0, 0x5f, 0xfb, 0x0,
+    0xe, 0xfd, 0x0, 0x0, 0x0, 0x8, 0xff, 0x30,
+    0x3f, 0xf6, 0x0, 0x0, 0x0, 0x1, 0xff, 0x80,
+    0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xd0,
+    0x9f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf0,
+    0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf0,
+    0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf0,
+    0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf0,
+    0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xd0,
+    0x3f, 0xf6, 0x0, 0x0, 0x0, 0x1, 0xff, 0x80,
+    0xe, 0xfd, 0x0, 0x0, 0x0, 0x8, 0xff, 0x30,
+    0x6, 0xff, 0xa0, 0x0, 0x0, 0x5f, 0xfb, 0x0,
+    0x0, 0xbf, 0xfd, 0x75, 0x6b, 0xff, 0xe1, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x4a, 0xef, 0xfc, 0x60, 0x0, 0x0,
+
+    /* U+0031 "1" */
+    0xcf, 0xff, 0xff, 0xec, 0xff, 0xff, 0xfe, 0x34,
+    0x44, 0xcf, 0xe0, 0x0, 0xb, 0xfe, 0x0, 0x0,
+    0xbf, 0xe0, 0x0, 0xb, 0xfe, 0x0, 0x0, 0xbf,
+    0xe0, 0x0, 0xb, 0xfe, 0x0, 0x0, 0xbf, 0xe0,
+    0x0, 0xb, 0xfe, 0x0, 0x0, 0xbf, 0xe0, 0x0,
+    0xb, 0xfe, 0x0, 0x0, 0xbf, 0xe0, 0x0, 0xb,
+    0xfe, 0x0, 0x0, 0xbf, 0xe0, 0x0, 0xb, 0xfe,
+    0x0, 0x0, 0xbf, 0xe0, 0x0, 0xb, 0xfe,
+
+    /* U+0032 "2" */
+    0x0, 0x5, 0xad, 0xff, 0xea, 0x40, 0x0, 0x0,
+    0x4d, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x5f,
+    0xff, 0xb7, 0x56, 0x9f, 0xff, 0x90, 0x0, 0xbd,
+    0x20, 0x0, 0x0, 0x1e, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1c,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xfd, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0x64, 0x44, 0x44, 0x44, 0x40,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+
+    /* U+0033 "3" */
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x4, 0x44,
+    0x44, 0x44, 0x4b, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xa4, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x6, 0x78, 0xbf, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xf9, 0x2e, 0x60, 0x0, 0x0, 0x0, 0xaf,
+    0xf4, 0xaf, 0xfe, 0xa6, 0x56, 0x8e, 0xff, 0xb0,
+    0x1b, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x28, 0xce, 0xff, 0xda, 0x40, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xe2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xe1, 0x0, 0xa, 0xc7, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0x30, 0x0, 0xd, 0xfa, 0x0,
+    0x0, 0x0, 0x7f, 0xf6, 0x0, 0x0, 0xd, 0xfa,
+    0x0, 0x0, 0x4, 0xff, 0x90, 0x0, 0x0, 0xd,
+    0xfa, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf1, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf1, 0x4, 0x44, 0x44,
+    0x44, 0x44, 0x4e, 0xfb, 0x44, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfa,
+    0x0, 0x0,
+
+    /* U+0035 "5" */
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x8f, 0xe4, 0x44, 0x44, 0x44, 0x40, 0x0, 0xa,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x94,
+    0x43, 0x10, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xff, 0xfa, 0x30, 0x0, 0x2, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x13,
+    0x8f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xd0, 0xd, 0xa2, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x5, 0xff, 0xfb, 0x76, 0x67, 0xdf, 0xfe, 0x10,
+    0x8, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x0,
+    0x1, 0x6a, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x6, 0xbe, 0xff, 0xda, 0x50, 0x0,
+    0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x7f, 0xff, 0xa6, 0x44, 0x6b, 0xa0, 0x0, 0x3f,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf1, 0x0,
+    0x1, 0x10, 0x0, 0x0, 0xa, 0xfe, 0x3, 0xaf,
+    0xff, 0xfb, 0x50, 0x0, 0xbf, 0xd6, 0xff, 0xff,
+    0xff, 0xff, 0xa0, 0xb, 0xff, 0xff, 0x72, 0x1,
+    0x5d, 0xff, 0x80, 0xaf, 0xff, 0x30, 0x0, 0x0,
+    0xc, 0xff, 0x9, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x5f, 0xf3, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0x41, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x5f,
+    0xf3, 0x9, 0xff, 0x40, 0x0, 0x0, 0x1d, 0xfd,
+    0x0, 0xd, 0xff, 0x94, 0x23, 0x6e, 0xff, 0x50,
+    0x0, 0x1c, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x5, 0xae, 0xff, 0xd8, 0x20, 0x0,
+
+    /* U+0037 "7" */
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f,
+    0xf7, 0x44, 0x44, 0x44, 0x4b, 0xff, 0x33, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0xef, 0xb0, 0x3f, 0xf4,
+    0x0, 0x0, 0x0, 0x6f, 0xf4, 0x1, 0x77, 0x20,
+    0x0, 0x0, 0xd, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0x60, 0x0, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x4, 0x9d, 0xff, 0xec, 0x82, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0xa,
+    0xff, 0xc6, 0x32, 0x37, 0xef, 0xf5, 0x0, 0xff,
+    0xb0, 0x0, 0x0, 0x1, 0xef, 0xc0, 0x2f, 0xf6,
+    0x0, 0x0, 0x0, 0xa, 0xfe, 0x0, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0xdf, 0xb0, 0x8, 0xff, 0xa3,
+    0x10, 0x15, 0xcf, 0xf3, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xd4, 0x0, 0x1, 0x9f, 0xff, 0xff,
+    0xff, 0xfe, 0x70, 0x0, 0xcf, 0xfa, 0x31, 0x2,
+    0x5c, 0xff, 0x80, 0x6f, 0xf6, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0x2b, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xf7, 0xdf, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0x8b, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xf7, 0x6f, 0xf8, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0x20, 0xdf, 0xfc, 0x53, 0x23, 0x7e, 0xff, 0x90,
+    0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x49, 0xde, 0xfe, 0xc8, 0x20, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x1, 0x8c, 0xef, 0xea, 0x50, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x4,
+    0xff, 0xe7, 0x32, 0x49, 0xff, 0xd0, 0x0, 0xcf,
+    0xd1, 0x0, 0x0, 0x3, 0xff, 0x90, 0x1f, 0xf6,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0x13, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x7f, 0xf6, 0x2f, 0xf6, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0x90, 0xef, 0xd1, 0x0,
+    0x0, 0x3, 0xff, 0xfb, 0x6, 0xff, 0xe7, 0x32,
+    0x39, 0xff, 0xff, 0xc0, 0x8, 0xff, 0xff, 0xff,
+    0xff, 0x6d, 0xfc, 0x0, 0x3, 0x9d, 0xff, 0xd9,
+    0x20, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xf4,
+    0x0, 0x9, 0xb6, 0x54, 0x5a, 0xff, 0xf8, 0x0,
+    0x2, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x5, 0xad, 0xff, 0xeb, 0x71, 0x0, 0x0,
+
+    /* U+003A ":" */
+    0x3e, 0xd3, 0xbf, 0xfa, 0x9f, 0xf7, 0x7, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0x70, 0x9f, 0xf8,
+    0xbf, 0xf9, 0x4e, 0xd2,
+
+    /* U+003C "<" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0x50, 0x0,
+    0x0, 0x0, 0x5, 0xcf, 0xf6, 0x0, 0x0, 0x2,
+    0x9e, 0xff, 0xf9, 0x20, 0x0, 0x6c, 0xff, 0xfc,
+    0x60, 0x0, 0x19, 0xff, 0xfe, 0x82, 0x0, 0x0,
+    0x4, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xff,
+    0xfd, 0x71, 0x0, 0x0, 0x0, 0x1, 0x7d, 0xff,
+    0xfb, 0x40, 0x0, 0x0, 0x0, 0x4, 0xaf, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x0, 0x17, 0xdf, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x33,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xef, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xf2, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x9,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0x10, 0x2f, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xa0, 0x0, 0xaf, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x3,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
+    0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0x40, 0x0, 0x0, 0x4f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xc0, 0x0, 0x0, 0x0,
+    0xcf, 0x90, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0xef, 0x81, 0x11, 0x11, 0x11, 0x11,
+    0x8f, 0xf0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0x70, 0x0, 0xd, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfe, 0x0,
+    0x5, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xf5, 0x0, 0xcf, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xd0,
+
+    /* U+0042 "B" */
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x60, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2,
+    0x0, 0x4f, 0xf6, 0x22, 0x22, 0x23, 0x5c, 0xff,
+    0xd0, 0x4, 0xff, 0x50, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0x30, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xf6, 0x4, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0x50, 0x4f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xf1, 0x4, 0xff, 0x62, 0x22, 0x22,
+    0x35, 0xcf, 0xf7, 0x0, 0x4f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x4f, 0xf5, 0x0,
+    0x0, 0x0, 0x14, 0xbf, 0xf8, 0x4, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf1, 0x4f, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x44, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf5, 0x4f,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x24,
+    0xff, 0x62, 0x22, 0x22, 0x23, 0x6c, 0xff, 0xb0,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x50,
+    0x0,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x1, 0x7b, 0xef, 0xfd, 0xa5, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x50, 0x0, 0x1c, 0xff, 0xfc, 0x76, 0x57, 0xcf,
+    0xff, 0x60, 0xc, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x3d, 0xe2, 0x8, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0xcf, 0xfc, 0x20, 0x0, 0x0, 0x3, 0xde, 0x30,
+    0x1, 0xcf, 0xff, 0xc7, 0x65, 0x7c, 0xff, 0xf6,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xd4,
+    0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xda, 0x50,
+    0x0,
+
+    /* U+0044 "D" */
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x40, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd4, 0x0, 0x0, 0x4f, 0xf8, 0x44, 0x44, 0x46,
+    0x9e, 0xff, 0xf7, 0x0, 0x4, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xf6, 0x0, 0x4f, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf1, 0x4,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0x90, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xfe, 0x4, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf1, 0x4f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0x34, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf3, 0x4f,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x14, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xe0, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xf9, 0x4, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0x10, 0x4f, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0x60, 0x4, 0xff,
+    0x84, 0x44, 0x44, 0x68, 0xef, 0xff, 0x70, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x94,
+    0x0, 0x0, 0x0,
+
+    /* U+0045 "E" */
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x4f, 0xf8,
+    0x44, 0x44, 0x44, 0x44, 0x42, 0x4f, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xf7, 0x33, 0x33, 0x33, 0x33, 0x10,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x4f, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xf8, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+
+    /* U+0046 "F" */
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x4f, 0xf8,
+    0x44, 0x44, 0x44, 0x44, 0x42, 0x4f, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x4f, 0xf7,
+    0x44, 0x44, 0x44, 0x44, 0x10, 0x4f, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0048 "H" */
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0x64, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xf6, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0x64, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xf6, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0x64, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xf6, 0x4f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0x64, 0xff, 0x84, 0x44, 0x44,
+    0x44, 0x44, 0x6f, 0xf6, 0x4f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf6, 0x4f, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0x64, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x4f, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x64, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x4f,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x64,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0x64, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xf6,
+
+    /* U+0049 "I" */
+    0x4f, 0xf5, 0x4f, 0xf5, 0x4f, 0xf5, 0x4f, 0xf5,
+    0x4f, 0xf5, 0x4f, 0xf5, 0x4f, 0xf5, 0x4f, 0xf5,
+    0x4f, 0xf5, 0x4f, 0xf5, 0x4f, 0xf5, 0x4f, 0xf5,
+    0x4f, 0xf5, 0x4f, 0xf5, 0x4f, 0xf5, 0x4f, 0xf5,
+    0x4f, 0xf5, 0x4f, 0xf5,
+
+    /* U+004B "K" */
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfa,
+    0x4, 0xff, 0x50, 0x0, 0x0, 0x0, 0x4f, 0xfb,
+    0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x4f, 0xfb,
+    0x0, 0x4, 0xff, 0x50, 0x0, 0x0, 0x4f, 0xfc,
+    0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x4f, 0xfc,
+    0x0, 0x0, 0x4, 0xff, 0x50, 0x0, 0x3f, 0xfd,
+    0x10, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x3f, 0xfd,
+    0x10, 0x0, 0x0, 0x4, 0xff, 0x50, 0x3f, 0xfd,
+    0x10, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0x3f, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x8e, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfe,
+    0x3c, 0xff, 0x60, 0x0, 0x0, 0x4, 0xff, 0xfe,
+    0x30, 0x1e, 0xff, 0x40, 0x0, 0x0, 0x4f, 0xff,
+    0x30, 0x0, 0x2f, 0xfe, 0x20, 0x0, 0x4, 0xff,
+    0x60, 0x0, 0x0, 0x4f, 0xfd, 0x10, 0x0, 0x4f,
+    0xf5, 0x0, 0x0, 0x0, 0x6f, 0xfb, 0x0, 0x4,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x8f, 0xf9, 0x0,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf6,
+    0x4, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xf4,
+
+    /* U+004C "L" */
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xf8, 0x44, 0x44, 0x44, 0x44, 0x40,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+
+    /* U+004D "M" */
+    0x4f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0x14, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xf1, 0x4f, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x14,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xf1, 0x4f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0x14, 0xff, 0xaf, 0xf2,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xaf, 0xf1, 0x4f,
+    0xf3, 0xdf, 0xc0, 0x0, 0x0, 0x0, 0xdf, 0x96,
+    0xff, 0x14, 0xff, 0x34, 0xff, 0x50, 0x0, 0x0,
+    0x8f, 0xe1, 0x6f, 0xf1, 0x4f, 0xf3, 0xa, 0xfe,
+    0x0, 0x0, 0x2f, 0xf6, 0x6, 0xff, 0x14, 0xff,
+    0x30, 0x1f, 0xf8, 0x0, 0xa, 0xfc, 0x0, 0x6f,
+    0xf1, 0x4f, 0xf3, 0x0, 0x6f, 0xf2, 0x4, 0xff,
+    0x30, 0x6, 0xff, 0x14, 0xff, 0x30, 0x0, 0xdf,
+    0xc0, 0xdf, 0x90, 0x0, 0x6f, 0xf1, 0x4f, 0xf3,
+    0x0, 0x3, 0xff, 0xbf, 0xe1, 0x0, 0x6, 0xff,
+    0x14, 0xff, 0x30, 0x0, 0x9, 0xff, 0xf6, 0x0,
+    0x0, 0x6f, 0xf1, 0x4f, 0xf3, 0x0, 0x0, 0x1e,
+    0xfc, 0x0, 0x0, 0x6, 0xff, 0x14, 0xff, 0x30,
+    0x0, 0x0, 0x6d, 0x30, 0x0, 0x0, 0x6f, 0xf1,
+    0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0x14, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xf1,
+
+    /* U+004E "N" */
+    0x4f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0x64, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xf6, 0x4f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0x64, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x3f, 0xf6, 0x4f, 0xfe, 0xff, 0x80, 0x0, 0x0,
+    0x3, 0xff, 0x64, 0xff, 0x6d, 0xff, 0x50, 0x0,
+    0x0, 0x3f, 0xf6, 0x4f, 0xf5, 0x2f, 0xff, 0x20,
+    0x0, 0x3, 0xff, 0x64, 0xff, 0x50, 0x4f, 0xfe,
+    0x10, 0x0, 0x3f, 0xf6, 0x4f, 0xf5, 0x0, 0x7f,
+    0xfc, 0x0, 0x3, 0xff, 0x64, 0xff, 0x50, 0x0,
+    0xaf, 0xf9, 0x0, 0x3f, 0xf6, 0x4f, 0xf5, 0x0,
+    0x0, 0xdf, 0xf6, 0x3, 0xff, 0x64, 0xff, 0x50,
+    0x0, 0x1, 0xef, 0xf3, 0x3f, 0xf6, 0x4f, 0xf5,
+    0x0, 0x0, 0x3, 0xff, 0xe5, 0xff, 0x64, 0xff,
+    0x50, 0x0, 0x0, 0x6, 0xff, 0xef, 0xf6, 0x4f,
+    0xf5, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x64,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf6,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
+    0x64, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xf6,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x1, 0x7b, 0xef, 0xfe, 0xb6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xfc,
+    0x76, 0x68, 0xcf, 0xff, 0xa0, 0x0, 0x0, 0xbf,
+    0xfc, 0x20, 0x0, 0x0, 0x3, 0xdf, 0xf9, 0x0,
+    0x8, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0x60, 0x1f, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0xe0, 0x6f, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3, 0x9f, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7,
+    0xbf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xf8, 0xbf, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xf9, 0x9f, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7, 0x6f, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3,
+    0x1f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xef, 0xe0, 0x8, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0x60, 0x0, 0xcf, 0xfc, 0x20,
+    0x0, 0x0, 0x3, 0xdf, 0xfa, 0x0, 0x0, 0x1c,
+    0xff, 0xfb, 0x76, 0x68, 0xcf, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x7b, 0xef, 0xfe,
+    0xb6, 0x0, 0x0, 0x0,
+
+    /* U+0050 "P" */
+    0x4f, 0xff, 0xff, 0xff, 0xfe, 0xb6, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
+    0x4f, 0xf8, 0x44, 0x44, 0x57, 0xbf, 0xff, 0x30,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x5, 0xff, 0xd0,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf4,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe0,
+    0x4f, 0xf5, 0x0, 0x0, 0x2, 0x7e, 0xff, 0x60,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x30, 0x0,
+    0x4f, 0xf8, 0x44, 0x44, 0x32, 0x0, 0x0, 0x0,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0052 "R" */
+    0x4f, 0xff, 0xff, 0xff, 0xfe, 0xb6, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
+    0x4f, 0xf8, 0x44, 0x44, 0x57, 0xbf, 0xff, 0x30,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x5, 0xff, 0xd0,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf4,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe0,
+    0x4f, 0xf5, 0x0, 0x0, 0x2, 0x7e, 0xff, 0x60,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0,
+    0x4f, 0xf7, 0x33, 0x33, 0x3c, 0xfe, 0x10, 0x0,
+    0x4f, 0xf5, 0x0, 0x0, 0x2, 0xff, 0xa0, 0x0,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x7f, 0xf5, 0x0,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x10,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x2, 0xff, 0xb0,
+    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf6,
+
+    /* U+0053 "S" */
+    0x0, 0x3, 0x9d, 0xef, 0xec, 0x94, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0xa,
+    0xff, 0xc7, 0x43, 0x47, 0xbf, 0xe0, 0x3, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x25, 0x0, 0x6f, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0x94,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xc8, 0x30, 0x0, 0x0, 0x0, 0x16, 0xbf, 0xff,
+    0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7c,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xf0, 0x5d, 0x40, 0x0, 0x0, 0x0, 0x1e, 0xfc,
+    0xc, 0xff, 0xd9, 0x54, 0x35, 0x8e, 0xff, 0x40,
+    0x1a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x2, 0x7b, 0xef, 0xfe, 0xb7, 0x10, 0x0,
+
+    /* U+0054 "T" */
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x44, 0x44, 0x44, 0xcf, 0xf4, 0x44, 0x44, 0x40,
+    0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+0055 "U" */
+    0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0x6f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0x5f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfd,
+    0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfb,
+    0xe, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf6,
+    0x7, 0xff, 0xb0, 0x0, 0x0, 0x3, 0xff, 0xe0,
+    0x0, 0xcf, 0xfe, 0x96, 0x57, 0xbf, 0xff, 0x50,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x39, 0xdf, 0xfe, 0xc7, 0x10, 0x0,
+
+    /* U+0056 "V" */
+    0xc, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xf4, 0x5, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xd0, 0x0, 0xef, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0x60, 0x0, 0x7f,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x0,
+    0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xf8, 0x0, 0x0, 0x9, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x8f, 0xf1, 0x0, 0x0, 0x2, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0xef, 0xa0, 0x0, 0x0, 0x0,
+    0xbf, 0xf1, 0x0, 0x0, 0x6, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0xd, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x0, 0x0,
+    0x5f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0x60, 0x0, 0xcf, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xd0, 0x3, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf5, 0xa, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc, 0x1f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xbf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0057 "W" */
+    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x3, 0xff, 0x40, 0xaf,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xe0, 0x5, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0xe, 0xf9, 0x0, 0xf, 0xfb, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0x20, 0x0, 0x0, 0x3,
+    0xff, 0x40, 0x0, 0xaf, 0xf0, 0x0, 0x0, 0x0,
+    0xff, 0x6f, 0xf7, 0x0, 0x0, 0x0, 0x9f, 0xe0,
+    0x0, 0x4, 0xff, 0x50, 0x0, 0x0, 0x6f, 0xf0,
+    0xbf, 0xc0, 0x0, 0x0, 0xe, 0xf9, 0x0, 0x0,
+    0xf, 0xfb, 0x0, 0x0, 0xb, 0xfa, 0x5, 0xff,
+    0x20, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0, 0xaf,
+    0xf0, 0x0, 0x1, 0xff, 0x50, 0xf, 0xf7, 0x0,
+    0x0, 0x9f, 0xe0, 0x0, 0x0, 0x4, 0xff, 0x50,
+    0x0, 0x6f, 0xf0, 0x0, 0xaf, 0xd0, 0x0, 0xe,
+    0xf9, 0x0, 0x0, 0x0, 0xe, 0xfb, 0x0, 0xc,
+    0xfa, 0x0, 0x5, 0xff, 0x20, 0x4, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x9f, 0xf0, 0x2, 0xff, 0x40,
+    0x0, 0xf, 0xf8, 0x0, 0x9f, 0xe0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0x50, 0x7f, 0xe0, 0x0, 0x0,
+    0x9f, 0xd0, 0xe, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xfb, 0xd, 0xf9, 0x0, 0x0, 0x4, 0xff,
+    0x34, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xf4, 0xff, 0x40, 0x0, 0x0, 0xe, 0xf8, 0xaf,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xdf,
+    0xe0, 0x0, 0x0, 0x0, 0x9f, 0xef, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf8, 0x0, 0x0, 0x0,
+
+    /* U+0058 "X" */
+    0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x50, 0x2, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f,
+    0xf9, 0x0, 0x0, 0x6f, 0xf8, 0x0, 0x0, 0x1,
+    0xef, 0xc0, 0x0, 0x0, 0xa, 0xff, 0x40, 0x0,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x1, 0xef, 0xe1,
+    0x0, 0x6f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xfc, 0x2, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0x8d, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xdf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfe, 0x19,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf4,
+    0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0x90, 0x0, 0x2f, 0xfc, 0x0, 0x0, 0x0, 0x2f,
+    0xfd, 0x0, 0x0, 0x6, 0xff, 0x90, 0x0, 0x0,
+    0xcf, 0xf2, 0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0,
+    0x8, 0xff, 0x60, 0x0, 0x0, 0x0, 0xd, 0xfe,
+    0x10, 0x4f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xc0,
+
+    /* U+005B "[" */
+    0x4f, 0xff, 0xff, 0x24, 0xff, 0xff, 0xf2, 0x4f,
+    0xf4, 0x11, 0x4, 0xff, 0x30, 0x0, 0x4f, 0xf3,
+    0x0, 0x4, 0xff, 0x30, 0x0, 0x4f, 0xf3, 0x0,
+    0x4, 0xff, 0x30, 0x0, 0x4f, 0xf3, 0x0, 0x4,
+    0xff, 0x30, 0x0, 0x4f, 0xf3, 0x0, 0x4, 0xff,
+    0x30, 0x0, 0x4f, 0xf3, 0x0, 0x4, 0xff, 0x30,
+    0x0, 0x4f, 0xf3, 0x0, 0x4, 0xff, 0x30, 0x0,
+    0x4f, 0xf3, 0x0, 0x4, 0xff, 0x30, 0x0, 0x4f,
+    0xf3, 0x0, 0x4, 0xff, 0x30, 0x0, 0x4f, 0xf3,
+    0x0, 0x4, 0xff, 0x41, 0x10, 0x4f, 0xff, 0xff,
+    0x24, 0xff, 0xff, 0xf2,
+
+    /* U+005D "]" */
+    0x8f, 0xff, 0xfe, 0x8f, 0xff, 0xfe, 0x1, 0x19,
+    0xfe, 0x0, 0x9, 0xfe, 0x0, 0x9, 0xfe, 0x0,
+    0x9, 0xfe, 0x0, 0x9, 0xfe, 0x0, 0x9, 0xfe,
+    0x0, 0x9, 0xfe, 0x0, 0x9, 0xfe, 0x0, 0x9,
+    0xfe, 0x0, 0x9, 0xfe, 0x0, 0x9, 0xfe, 0x0,
+    0x9, 0xfe, 0x0, 0x9, 0xfe, 0x0, 0x9, 0xfe,
+    0x0, 0x9, 0xfe, 0x0, 0x9, 0xfe, 0x0, 0x9,
+    0xfe, 0x0, 0x9, 0xfe, 0x0, 0x9, 0xfe, 0x1,
+    0x19, 0xfe, 0x8f, 0xff, 0xfe, 0x8f, 0xff, 0xfe,
+
+    /* U+005F "_" */
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff,
+
+    /* U+0061 "a" */
+    0x0, 0x39, 0xdf, 0xfe, 0xb6, 0x0, 0x1, 0xbf,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0xe, 0xfa, 0x63,
+    0x36, 0xdf, 0xf8, 0x0, 0x42, 0x0, 0x0, 0x0,
+    0xcf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf4, 0x0,
+    0x6b, 0xef, 0xff, 0xff, 0xff, 0x40, 0xbf, 0xff,
+    0xdd, 0xdd, 0xdf, 0xf4, 0x6f, 0xf7, 0x0, 0x0,
+    0x3, 0xff, 0x4a, 0xfd, 0x0, 0x0, 0x0, 0x3f,
+    0xf4, 0xaf, 0xe0, 0x0, 0x0, 0xa, 0xff, 0x45,
+    0xff, 0x80, 0x0, 0x1a, 0xff, 0xf4, 0xa, 0xff,
+    0xfd, 0xdf, 0xfa, 0xff, 0x40, 0x6, 0xcf, 0xfe,
+    0xb5, 0x1f, 0xf4,
+
+    /* U+0062 "b" */
+    0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfd, 0x2,
+    0x9e, 0xfe, 0xc6, 0x0, 0x0, 0xaf, 0xd6, 0xff,
+    0xff, 0xff, 0xfd, 0x30, 0xa, 0xff, 0xff, 0xa5,
+    0x35, 0xaf, 0xff, 0x20, 0xaf, 0xff, 0x40, 0x0,
+    0x0, 0x5f, 0xfc, 0xa, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x8f, 0xf3, 0xaf, 0xf1, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0x7a, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xf9, 0xaf, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0x9a, 0xff, 0x10, 0x0, 0x0, 0x0, 0x1f,
+    0xf7, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x3a, 0xff, 0xf4, 0x0, 0x0, 0x5, 0xff, 0xc0,
+    0xaf, 0xff, 0xfa, 0x53, 0x5a, 0xff, 0xf2, 0xa,
+    0xfc, 0x6f, 0xff, 0xff, 0xff, 0xd3, 0x0, 0xaf,
+    0xc0, 0x39, 0xef, 0xec, 0x60, 0x0, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x1, 0x7c, 0xef, 0xea, 0x50, 0x0, 0x4,
+    0xef, 0xff, 0xff, 0xff, 0xb0, 0x4, 0xff, 0xf9,
+    0x43, 0x5b, 0xff, 0xa1, 0xef, 0xe2, 0x0, 0x0,
+    0x7, 0xd3, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xfe, 0x20, 0x0, 0x0, 0x7d, 0x40,
+    0x4f, 0xff, 0x94, 0x35, 0xbf, 0xfa, 0x0, 0x4e,
+    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x17, 0xce,
+    0xfe, 0xa4, 0x0,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0x50, 0x0, 0x18,
+    0xde, 0xfd, 0x81, 0x2f, 0xf5, 0x0, 0x6f, 0xff,
+    0xff, 0xff, 0xe5, 0xff, 0x50, 0x5f, 0xff, 0x84,
+    0x36, 0xcf, 0xff, 0xf5, 0x1f, 0xfe, 0x20, 0x0,
+    0x0, 0x8f, 0xff, 0x57, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0xcf, 0xf5, 0xbf, 0xd0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0x5d, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xf5, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0x5b, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xf5, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0x51, 0xff, 0xd1, 0x0, 0x0, 0x6, 0xff, 0xf5,
+    0x5, 0xff, 0xe6, 0x21, 0x3a, 0xff, 0xff, 0x50,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xf5, 0x0,
+    0x2, 0x8d, 0xff, 0xd8, 0x10, 0xff, 0x50,
+
+    /* U+0065 "e" */
+    0x0, 0x2, 0x8d, 0xff, 0xd8, 0x10, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x5, 0xff,
+    0xd5, 0x22, 0x5d, 0xff, 0x40, 0x1f, 0xfb, 0x0,
+    0x0, 0x0, 0xbf, 0xe0, 0x7f, 0xf1, 0x0, 0x0,
+    0x0, 0x1f, 0xf5, 0xbf, 0xb0, 0x0, 0x0, 0x0,
+    0xa, 0xfa, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0xdf, 0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xda,
+    0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfd,
+    0x20, 0x0, 0x0, 0x19, 0x0, 0x4, 0xff, 0xf9,
+    0x43, 0x48, 0xef, 0xa0, 0x0, 0x4e, 0xff, 0xff,
+    0xff, 0xfe, 0x30, 0x0, 0x1, 0x6c, 0xef, 0xeb,
+    0x60, 0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x0, 0x5c, 0xff, 0xd7, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xc0, 0x0, 0xf, 0xfc, 0x31, 0x43,
+    0x0, 0x3, 0xff, 0x40, 0x0, 0x0, 0x0, 0x4f,
+    0xf2, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
+    0x20, 0x9f, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x14,
+    0xff, 0x41, 0x11, 0x0, 0x0, 0x4f, 0xf3, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x4f, 0xf3, 0x0, 0x0, 0x0, 0x4, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0x30, 0x0, 0x0, 0x0, 0x4f, 0xf3,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0,
+    0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x2, 0x8d, 0xef, 0xd9, 0x20, 0xdf, 0x80,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0x6d, 0xf8, 0x7,
+    0xff, 0xe8, 0x43, 0x49, 0xff, 0xff, 0x82, 0xff,
+    0xc1, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x8f, 0xf2,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0x8c, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xf8, 0xef, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0x8c, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xf8, 0x9f, 0xf1, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0x83, 0xff, 0xb0, 0x0, 0x0,
+    0x2, 0xef, 0xf8, 0x9, 0xff, 0xd5, 0x10, 0x27,
+    0xef, 0xff, 0x80, 0xa, 0xff, 0xff, 0xff, 0xff,
+    0x9f, 0xf8, 0x0, 0x5, 0xbf, 0xff, 0xfc, 0x40,
+    0xff, 0x80, 0x0, 0x0, 0x2, 0x20, 0x0, 0x1f,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0x30, 0x4a, 0x10, 0x0, 0x0, 0x1, 0xef, 0xe0,
+    0xe, 0xff, 0xa6, 0x43, 0x48, 0xef, 0xf5, 0x0,
+    0x6e, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x5, 0xad, 0xff, 0xec, 0x82, 0x0, 0x0,
+
+    /* U+0068 "h" */
+    0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xd0, 0x3a, 0xef, 0xfc,
+    0x60, 0x0, 0xaf, 0xd8, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0xaf, 0xff, 0xf8, 0x54, 0x6d, 0xff, 0x90,
+    0xaf, 0xfe, 0x20, 0x0, 0x0, 0xdf, 0xf1, 0xaf,
+    0xf5, 0x0, 0x0, 0x0, 0x5f, 0xf4, 0xaf, 0xf0,
+    0x0, 0x0, 0x0, 0x2f, 0xf6, 0xaf, 0xe0, 0x0,
+    0x0, 0x0, 0xf, 0xf6, 0xaf, 0xd0, 0x0, 0x0,
+    0x0, 0xf, 0xf7, 0xaf, 0xd0, 0x0, 0x0, 0x0,
+    0xf, 0xf7, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0xf,
+    0xf7, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0xf, 0xf7,
+    0xaf, 0xd0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0xaf,
+    0xd0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0xaf, 0xd0,
+    0x0, 0x0, 0x0, 0xf, 0xf7,
+
+    /* U+0069 "i" */
+    0x8, 0xfb, 0x0, 0xff, 0xf3, 0xc, 0xfe, 0x10,
+    0x3, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xd0, 0xa,
+    0xfd, 0x0, 0xaf, 0xd0, 0xa, 0xfd, 0x0, 0xaf,
+    0xd0, 0xa, 0xfd, 0x0, 0xaf, 0xd0, 0xa, 0xfd,
+    0x0, 0xaf, 0xd0, 0xa, 0xfd, 0x0, 0xaf, 0xd0,
+    0xa, 0xfd, 0x0, 0xaf, 0xd0, 0xa, 0xfd, 0x0,
+
+    /* U+006B "k" */
+    0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xd0, 0x0, 0x0, 0x3,
+    0xef, 0xd1, 0xaf, 0xd0, 0x0, 0x0, 0x4f, 0xfc,
+    0x10, 0xaf, 0xd0, 0x0, 0x5, 0xff, 0xc1, 0x0,
+    0xaf, 0xd0, 0x0, 0x6f, 0xfc, 0x10, 0x0, 0xaf,
+    0xd0, 0x7, 0xff, 0xc1, 0x0, 0x0, 0xaf, 0xd0,
+    0x8f, 0xfd, 0x10, 0x0, 0x0, 0xaf, 0xd9, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0xaf, 0xff, 0xfc, 0xff,
+    0xd1, 0x0, 0x0, 0xaf, 0xff, 0xa0, 0x7f, 0xfb,
+    0x0, 0x0, 0xaf, 0xf9, 0x0, 0xa, 0xff, 0x70,
+    0x0, 0xaf, 0xd0, 0x0, 0x0, 0xdf, 0xf4, 0x0,
+    0xaf, 0xd0, 0x0, 0x0, 0x2f, 0xfe, 0x10, 0xaf,
+    0xd0, 0x0, 0x0, 0x4, 0xff, 0xc0, 0xaf, 0xd0,
+    0x0, 0x0, 0x0, 0x8f, 0xf9,
+
+    /* U+006C "l" */
+    0xaf, 0xda, 0xfd, 0xaf, 0xda, 0xfd, 0xaf, 0xda,
+    0xfd, 0xaf, 0xda, 0xfd, 0xaf, 0xda, 0xfd, 0xaf,
+    0xda, 0xfd, 0xaf, 0xda, 0xfd, 0xaf, 0xda, 0xfd,
+    0xaf, 0xda, 0xfd, 0xaf, 0xd0,
+
+    /* U+006D "m" */
+    0xaf, 0xc0, 0x5b, 0xef, 0xea, 0x40, 0x0, 0x5a,
+    0xef, 0xeb, 0x50, 0x0, 0xaf, 0xca, 0xff, 0xff,
+    0xff, 0xf8, 0xb, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0xaf, 0xff, 0xd6, 0x22, 0x6e, 0xff, 0xdf, 0xe7,
+    0x32, 0x5d, 0xff, 0x60, 0xaf, 0xfd, 0x0, 0x0,
+    0x2, 0xff, 0xfe, 0x20, 0x0, 0x0, 0xef, 0xd0,
+    0xaf, 0xf4, 0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0,
+    0x0, 0x0, 0x7f, 0xf1, 0xaf, 0xf0, 0x0, 0x0,
+    0x0, 0x7f, 0xf2, 0x0, 0x0, 0x0, 0x4f, 0xf3,
+    0xaf, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0xf1, 0x0,
+    0x0, 0x0, 0x4f, 0xf3, 0xaf, 0xd0, 0x0, 0x0,
+    0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x4f, 0xf4,
+    0xaf, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0,
+    0x0, 0x0, 0x4f, 0xf4, 0xaf, 0xd0, 0x0, 0x0,
+    0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x4f, 0xf4,
+    0xaf, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0,
+    0x0, 0x0, 0x4f, 0xf4, 0xaf, 0xd0, 0x0, 0x0,
+    0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x4f, 0xf4,
+    0xaf, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0,
+    0x0, 0x0, 0x4f, 0xf4, 0xaf, 0xd0, 0x0, 0x0,
+    0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x4f, 0xf4,
+
+    /* U+006E "n" */
+    0xaf, 0xc0, 0x4a, 0xef, 0xfc, 0x60, 0x0, 0xaf,
+    0xc9, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xaf, 0xff,
+    0xe6, 0x32, 0x4c, 0xff, 0x90, 0xaf, 0xfd, 0x10,
+    0x0, 0x0, 0xcf, 0xf1, 0xaf, 0xf4, 0x0, 0x0,
+    0x0, 0x4f, 0xf4, 0xaf, 0xf0, 0x0, 0x0, 0x0,
+    0x1f, 0xf6, 0xaf, 0xe0, 0x0, 0x0, 0x0, 0xf,
+    0xf6, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0xf, 0xf7,
+    0xaf, 0xd0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0xaf,
+    0xd0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0xaf, 0xd0,
+    0x0, 0x0, 0x0, 0xf, 0xf7, 0xaf, 0xd0, 0x0,
+    0x0, 0x0, 0xf, 0xf7, 0xaf, 0xd0, 0x0, 0x0,
+    0x0, 0xf, 0xf7, 0xaf, 0xd0, 0x0, 0x0, 0x0,
+    0xf, 0xf7,
+
+    /* U+006F "o" */
+    0x0, 0x1, 0x7c, 0xef, 0xda, 0x40, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x4,
+    0xff, 0xf8, 0x43, 0x5c, 0xff, 0xc0, 0x1, 0xff,
+    0xe2, 0x0, 0x0, 0x8, 0xff, 0x80, 0x7f, 0xf4,
+    0x0, 0x0, 0x0, 0xb, 0xfe, 0xb, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xf3, 0xdf, 0xa0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0x5d, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xf5, 0xbf, 0xd0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0x37, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0xbf, 0xe0, 0x1e, 0xfe, 0x20, 0x0, 0x0,
+    0x8f, 0xf8, 0x0, 0x4f, 0xff, 0x84, 0x36, 0xcf,
+    0xfc, 0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xfa,
+    0x10, 0x0, 0x0, 0x17, 0xce, 0xfd, 0xa4, 0x0,
+    0x0,
+
+    /* U+0070 "p" */
+    0xaf, 0xc0, 0x3a, 0xef, 0xec, 0x60, 0x0, 0xa,
+    0xfc, 0x8f, 0xff, 0xff, 0xff, 0xd3, 0x0, 0xaf,
+    0xff, 0xf8, 0x31, 0x38, 0xff, 0xf2, 0xa, 0xff,
+    0xf3, 0x0, 0x0, 0x3, 0xff, 0xc0, 0xaf, 0xf6,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0x3a, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xf7, 0xaf, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0x9a, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xf9, 0xaf, 0xf1, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0x7a, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x8f, 0xf3, 0xaf, 0xff, 0x40, 0x0, 0x0,
+    0x5f, 0xfc, 0xa, 0xff, 0xff, 0xa5, 0x35, 0xaf,
+    0xff, 0x20, 0xaf, 0xd6, 0xff, 0xff, 0xff, 0xfd,
+    0x30, 0xa, 0xfd, 0x2, 0x9d, 0xfe, 0xc6, 0x0,
+    0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0071 "q" */
+    0x0, 0x1, 0x8d, 0xef, 0xd8, 0x10, 0xff, 0x50,
+    0x6, 0xff, 0xff, 0xff, 0xfe, 0x4f, 0xf5, 0x5,
+    0xff, 0xf8, 0x43, 0x6c, 0xff, 0xff, 0x51, 0xff,
+    0xe2, 0x0, 0x0, 0x8, 0xff, 0xf5, 0x7f, 0xf4,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0x5b, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xf5, 0xdf, 0xa0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0x5d, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xf5, 0xbf, 0xd0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0x57, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0xbf, 0xf5, 0x1f, 0xfe, 0x20, 0x0, 0x0,
+    0x8f, 0xff, 0x50, 0x5f, 0xff, 0x84, 0x36, 0xcf,
+    0xff, 0xf5, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xe5,
+    0xff, 0x50, 0x0, 0x28, 0xdf, 0xfd, 0x81, 0x2f,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x50,
+
+    /* U+0072 "r" */
+    0xaf, 0xc0, 0x3a, 0xec, 0xaf, 0xc7, 0xff, 0xfc,
+    0xaf, 0xef, 0xfb, 0x75, 0xaf, 0xff, 0x30, 0x0,
+    0xaf, 0xf6, 0x0, 0x0, 0xaf, 0xf1, 0x0, 0x0,
+    0xaf, 0xe0, 0x0, 0x0, 0xaf, 0xd0, 0x0, 0x0,
+    0xaf, 0xd0, 0x0, 0x0, 0xaf, 0xd0, 0x0, 0x0,
+    0xaf, 0xd0, 0x0, 0x0, 0xaf, 0xd0, 0x0, 0x0,
+    0xaf, 0xd0, 0x0, 0x0, 0xaf, 0xd0, 0x0, 0x0,
+
+    /* U+0073 "s" */
+    0x0, 0x5, 0xbe, 0xff, 0xda, 0x50, 0x0, 0xb,
+    0xff, 0xff, 0xff, 0xff, 0x90, 0x8, 0xff, 0xa4,
+    0x23, 0x59, 0xf2, 0x0, 0xdf, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xfa, 0x40, 0x0, 0x0, 0x0, 0x1,
+    0xdf, 0xff, 0xfd, 0xa6, 0x0, 0x0, 0x0, 0x6b,
+    0xef, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x14,
+    0x9f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xf3, 0x4, 0x20, 0x0, 0x0, 0x5, 0xff, 0x30,
+    0xef, 0xb6, 0x33, 0x47, 0xff, 0xd0, 0x2d, 0xff,
+    0xff, 0xff, 0xff, 0xe3, 0x0, 0x5, 0xad, 0xff,
+    0xec, 0x71, 0x0,
+
+    /* U+0074 "t" */
+    0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0xff, 0x20, 0x9f, 0xff,
+    0xff, 0xff, 0xf2, 0x0, 0x14, 0xff, 0x41, 0x11,
+    0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x4f, 0xf3, 0x0, 0x0, 0x0, 0x4, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0xe, 0xfe,
+    0x52, 0x55, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x5c, 0xff, 0xc6, 0x0,
+
+    /* U+0075 "u" */
+    0xcf, 0xb0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0xcf,
+    0xb0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0xcf, 0xb0,
+    0x0, 0x0, 0x0, 0x4f, 0xf3, 0xcf, 0xb0, 0x0,
+    0x0, 0x0, 0x4f, 0xf3, 0xcf, 0xb0, 0x0, 0x0,
+    0x0, 0x4f, 0xf3, 0xcf, 0xb0, 0x0, 0x0, 0x0,
+    0x4f, 0xf3, 0xcf, 0xb0, 0x0, 0x0, 0x0, 0x4f,
+    0xf3, 0xcf, 0xb0, 0x0, 0x0, 0x0, 0x4f, 0xf3,
+    0xbf, 0xd0, 0x0, 0x0, 0x0, 0x6f, 0xf3, 0x9f,
+    0xf0, 0x0, 0x0, 0x0, 0xbf, 0xf3, 0x5f, 0xf7,
+    0x0, 0x0, 0x5, 0xff, 0xf3, 0xe, 0xff, 0x83,
+    0x13, 0x8f, 0xff, 0xf3, 0x3, 0xef, 0xff, 0xff,
+    0xff, 0x7f, 0xf3, 0x0, 0x18, 0xdf, 0xfd, 0x91,
+    0x2f, 0xf3,
+
+    /* U+0076 "v" */
+    0xd, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5,
+    0x6, 0xff, 0x20, 0x0, 0x0, 0x0, 0x8f, 0xe0,
+    0x0, 0xef, 0x90, 0x0, 0x0, 0x0, 0xef, 0x70,
+    0x0, 0x8f, 0xf1, 0x0, 0x0, 0x6, 0xff, 0x10,
+    0x0, 0x1f, 0xf7, 0x0, 0x0, 0xd, 0xf9, 0x0,
+    0x0, 0xa, 0xfd, 0x0, 0x0, 0x4f, 0xf3, 0x0,
+    0x0, 0x3, 0xff, 0x40, 0x0, 0xbf, 0xc0, 0x0,
+    0x0, 0x0, 0xdf, 0xb0, 0x2, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x6f, 0xf2, 0x8, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xf8, 0xe, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xfe, 0x7f, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xfb, 0x0, 0x0, 0x0,
+
+    /* U+0077 "w" */
+    0xaf, 0xb0, 0x0, 0x0, 0x0, 0x8f, 0xf0, 0x0,
+    0x0, 0x0, 0x3f, 0xf1, 0x4f, 0xf1, 0x0, 0x0,
+    0x0, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0x9f, 0xa0,
+    0xe, 0xf6, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0xef, 0x40, 0x9, 0xfc, 0x0, 0x0,
+    0x9, 0xfd, 0xff, 0x10, 0x0, 0x4, 0xfe, 0x0,
+    0x3, 0xff, 0x20, 0x0, 0xf, 0xf4, 0xdf, 0x60,
+    0x0, 0xa, 0xf8, 0x0, 0x0, 0xdf, 0x70, 0x0,
+    0x5f, 0xe0, 0x8f, 0xc0, 0x0, 0x1f, 0xf3, 0x0,
+    0x0, 0x7f, 0xd0, 0x0, 0xbf, 0x80, 0x2f, 0xf2,
+    0x0, 0x6f, 0xd0, 0x0, 0x0, 0x1f, 0xf3, 0x1,
+    0xff, 0x20, 0xc, 0xf8, 0x0, 0xcf, 0x70, 0x0,
+    0x0, 0xb, 0xf9, 0x7, 0xfc, 0x0, 0x6, 0xfe,
+    0x2, 0xff, 0x10, 0x0, 0x0, 0x5, 0xfe, 0xd,
+    0xf6, 0x0, 0x0, 0xff, 0x48, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0x8f, 0xf0, 0x0, 0x0, 0xaf,
+    0x9d, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0x90, 0x0, 0x0, 0x4f, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0x30, 0x0, 0x0, 0xe,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfd,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x30, 0x0, 0x0,
+
+    /* U+0078 "x" */
+    0x1e, 0xfc, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x4,
+    0xff, 0x80, 0x0, 0x2, 0xff, 0x80, 0x0, 0x7f,
+    0xf4, 0x0, 0xd, 0xfc, 0x0, 0x0, 0xb, 0xfe,
+    0x10, 0xaf, 0xe1, 0x0, 0x0, 0x1, 0xef, 0xc6,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfe, 0xfc, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0x83, 0xff, 0x80, 0x0, 0x0, 0x1e,
+    0xfc, 0x0, 0x7f, 0xf4, 0x0, 0x0, 0xbf, 0xe1,
+    0x0, 0xb, 0xfe, 0x20, 0x8, 0xff, 0x40, 0x0,
+    0x1, 0xef, 0xc0, 0x4f, 0xf8, 0x0, 0x0, 0x0,
+    0x3f, 0xf9,
+
+    /* U+0079 "y" */
+    0xd, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5,
+    0x6, 0xff, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xe0,
+    0x0, 0xef, 0xa0, 0x0, 0x0, 0x0, 0xef, 0x70,
+    0x0, 0x8f, 0xf1, 0x0, 0x0, 0x6, 0xff, 0x10,
+    0x0, 0x1f, 0xf8, 0x0, 0x0, 0xd, 0xf9, 0x0,
+    0x0, 0x9, 0xfe, 0x0, 0x0, 0x4f, 0xf2, 0x0,
+    0x0, 0x2, 0xff, 0x60, 0x0, 0xbf, 0xb0, 0x0,
+    0x0, 0x0, 0xbf, 0xd0, 0x2, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x4f, 0xf4, 0x8, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xfb, 0xf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0x8f, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0, 0x0,
+    0xd, 0x73, 0x3a, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xcf, 0xeb, 0x40, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+007A "z" */
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xf5, 0x1, 0x11, 0x11, 0x14,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x1e, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xf2, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0xd, 0xfd, 0x10, 0x0, 0x0, 0x0, 0xaf,
+    0xf3, 0x0, 0x0, 0x0, 0x7, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x4f, 0xfa, 0x11, 0x11, 0x11, 0x10,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf9,
+
+    /* U+00B0 "°" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xe8,
+    0x0, 0xd, 0xe7, 0x58, 0xfb, 0x7, 0xf2, 0x0,
+    0x4, 0xf5, 0xcb, 0x0, 0x0, 0xe, 0xac, 0xb0,
+    0x0, 0x0, 0xda, 0x8f, 0x10, 0x0, 0x3f, 0x71,
+    0xed, 0x52, 0x5e, 0xd0, 0x2, 0xdf, 0xff, 0xc2,
+    0x0, 0x0, 0x24, 0x20, 0x0,
+
+    /* U+F00C "<symbol>" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x53, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0xbd, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0xc, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0xbf, 0xff, 0xfe,
+    0x20, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xe2, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xfe, 0x20, 0x9, 0xff, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xe3, 0x9f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+F077 "<symbol>" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0x91, 0xdf, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0x90, 0x1, 0xdf,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0x90, 0x0, 0x1, 0xdf, 0xff, 0xfb, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x1, 0xdf,
+    0xff, 0xfb, 0x0, 0x3f, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xff, 0xfb, 0xb, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xff, 0xf5, 0x5f, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xfd, 0x10, 0x6e, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcc,
+    0x10,
+
+    /* U+F078 "<symbol>" */
+    0x1, 0x62, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0x40, 0x1, 0xdf, 0xe2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x70, 0xaf,
+    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0x48, 0xff, 0xff, 0xe2, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xf2, 0xa, 0xff,
+    0xff, 0xe2, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xf4, 0x0, 0xa, 0xff, 0xff, 0xe2, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xf4, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xe2, 0x0, 0x7, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xe2, 0x7, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xe9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xe4, 0x0, 0x0, 0x0, 0x0,
+    0x0
+};
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 112, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 351, .box_w = 21, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 189, .adv_w = 87, .box_w = 3, .box_h = 8, .ofs_x = 1, .ofs_y = 10},
+    {.bitmap_index = 201, .adv_w = 159, .box_w = 8, .box_h = 3, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 213, .adv_w = 94, .box_w = 4, .box_h = 4, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 221, .adv_w = 146, .box_w = 12, .box_h = 25, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 371, .adv_w = 277, .box_w = 16, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 515, .adv_w = 154, .box_w = 7, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 578, .adv_w = 239, .box_w = 15, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 713, .adv_w = 238, .box_w = 14, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 839, .adv_w = 278, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1001, .adv_w = 239, .box_w = 15, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1136, .adv_w = 257, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1271, .adv_w = 249, .box_w = 15, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1406, .adv_w = 268, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1541, .adv_w = 257, .box_w = 15, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1676, .adv_w = 94, .box_w = 4, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1704, .adv_w = 242, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 1782, .adv_w = 305, .box_w = 21, .box_h = 18, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1971, .adv_w = 315, .box_w = 17, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2124, .adv_w = 301, .box_w = 17, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2277, .adv_w = 344, .box_w = 19, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2448, .adv_w = 279, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2574, .adv_w = 264, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2700, .adv_w = 338, .box_w = 17, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2853, .adv_w = 129, .box_w = 4, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2889, .adv_w = 299, .box_w = 17, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3042, .adv_w = 247, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3168, .adv_w = 397, .box_w = 21, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3357, .adv_w = 338, .box_w = 17, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3510, .adv_w = 349, .box_w = 20, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3690, .adv_w = 300, .box_w = 16, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3834, .adv_w = 302, .box_w = 16, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3978, .adv_w = 258, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4113, .adv_w = 244, .box_w = 16, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4257, .adv_w = 329, .box_w = 16, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4401, .adv_w = 296, .box_w = 20, .box_h = 18, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4581, .adv_w = 468, .box_w = 29, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4842, .adv_w = 280, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5004, .adv_w = 139, .box_w = 7, .box_h = 24, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 5088, .adv_w = 139, .box_w = 6, .box_h = 24, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 5160, .adv_w = 208, .box_w = 13, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 5173, .adv_w = 249, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5264, .adv_w = 284, .box_w = 15, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5407, .adv_w = 238, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5498, .adv_w = 284, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5641, .adv_w = 255, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5739, .adv_w = 147, .box_w = 11, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5844, .adv_w = 287, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 5987, .adv_w = 283, .box_w = 14, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6120, .adv_w = 116, .box_w = 5, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6168, .adv_w = 256, .box_w = 14, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6301, .adv_w = 116, .box_w = 3, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6330, .adv_w = 440, .box_w = 24, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6498, .adv_w = 283, .box_w = 14, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6596, .adv_w = 264, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6701, .adv_w = 284, .box_w = 15, .box_h = 19, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 6844, .adv_w = 284, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 6987, .adv_w = 171, .box_w = 8, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7043, .adv_w = 208, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7134, .adv_w = 172, .box_w = 11, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7228, .adv_w = 282, .box_w = 14, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7326, .adv_w = 233, .box_w = 16, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7438, .adv_w = 374, .box_w = 24, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7606, .adv_w = 230, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7704, .adv_w = 233, .box_w = 16, .box_h = 19, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 7856, .adv_w = 217, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7940, .adv_w = 174, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 9},
+    {.bitmap_index = 7985, .adv_w = 416, .box_w = 26, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8245, .adv_w = 364, .box_w = 23, .box_h = 14, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 8406, .adv_w = 364, .box_w = 23, .box_h = 14, .ofs_x = 0, .ofs_y = 3}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint8_t glyph_id_ofs_list_0[] = {
+    1, 0, 0, 0, 0, 2, 0, 3,
+    0, 0, 0, 0, 0, 4, 5, 6,
+    7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 0, 18, 0, 0, 0,
+    0, 19, 20, 21, 22, 23, 24, 0,
+    25, 26, 0, 27, 28, 29, 30, 31,
+    32, 0, 33, 34, 35, 36, 37, 38,
+    39, 0, 0, 40, 0, 41, 0, 42,
+    0, 43, 44, 45, 46, 47, 48, 49,
+    50, 51, 0, 52, 53, 54, 55, 56,
+    57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67
+};
+
+static const uint16_t unicode_list_1[] = {
+    0x0, 0xef5c, 0xefc7, 0xefc8
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 91, .glyph_id_start = 0,
+        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_0, .list_length = 91, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
+    },
+    {
+        .range_start = 176, .range_length = 61385, .glyph_id_start = 68,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 4, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 3, 1, 4, 5, 6, 7,
+    0, 8, 9, 10, 11, 12, 13, 14,
+    7, 15, 0, 17, 18, 19, 16, 20,
+    21, 22, 22, 24, 25, 22, 22, 16,
+    26, 27, 2, 28, 23, 29, 29, 30,
+    31, 32, 33, 34, 35, 36, 37, 38,
+    39, 40, 34, 41, 42, 37, 34, 34,
+    35, 35, 43, 44, 45, 46, 40, 47,
+    47, 48, 47, 49, 50, 0, 0, 0
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 3, 1, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 7, 13, 14,
+    15, 16, 0, 18, 19, 17, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 17,
+    19, 19, 2, 20, 21, 22, 22, 23,
+    24, 25, 26, 27, 28, 29, 29, 29,
+    0, 29, 28, 30, 28, 28, 31, 31,
+    29, 31, 29, 31, 32, 33, 34, 35,
+    35, 36, 35, 37, 38, 0, 0, 0
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    19, 0, 11, 0, -23, -25, 3, 20,
+    9, 7, -17, 3, 20, 1, 17, 4,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    3, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 8, -12, 0,
+    0, 7, 8, 0, 0, -4, 0, -3,
+    4, 0, -4, 0, -4, -2, 0, 0,
+    0, -4, 0, 0, -5, 0, 0, -8,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -4, -4, 0, -6, -11, 0, -50, 8,
+    12, 0, 0, -8, 4, 4, 14, 8,
+    -7, 8, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -11, 0, 0, -15, 1, -3, 0,
+    3, -7, -5, -8, 3, 0, -4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -23, 0, -26, -3, 0, 41, -5, -5,
+    4, 4, -4, 0, -5, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -26, 25, 0,
+    0, -28, -40, -28, -8, 12, 0, 0,
+    -28, 0, 5, -10, 0, -6, 0, 0,
+    0, 0, 0, 0, 0, 0, 12, -51,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 20, 3, 0, 0, 3,
+    -5, -8, 0, -1, -1, -4, 0, 0,
+    -3, 0, 0, 0, 0, -3, 0, -8,
+    0, -10, -14, 0, 0, -8, 0, 0,
+    0, 0, 0, 0, 4, 0, 3, -4,
+    0, 1, 0, 0, 4, -3, 4, 4,
+    -1, 0, 0, 0, -8, 0, -1, 0,
+    0, 0, 0, 1, 0, -3, 0, -5,
+    0, 0, 0, 12, 0, 0, -4, 0,
+    0, 0, 0, -1, 1, -3, -3, 0,
+    -4, 0, -4, 0, 0, 0, 0, 0,
+    -2, -2, 0, -4, -5, 0, 0, 0,
+    0, 1, 0, -3, 0, -4, -4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -5, 0, -6, -12, -3,
+    -12, 4, 8, 11, 0, -10, -1, -5,
+    0, -1, -20, 4, -3, 3, 4, 0,
+    0, -22, 0, -22, -3, 0, 0, 8,
+    12, 0, 5, 0, 0, 0, 1, 0,
+    -7, -5, 0, -12, 0, 0, -4, 0,
+    0, 0, 0, 0, -2, -2, 0, -2,
+    -5, 0, 0, 0, 0, 0, 0, -4,
+    0, -3, -5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, -3,
+    0, -5, -3, 0, -8, 2, 4, 4,
+    0, 0, 0, 0, 0, 0, -3, 0,
+    0, 0, 0, 3, 0, -4, 0, -4,
+    -3, 0, 0, 0, 0, 0, 3, 0,
+    0, 0, 0, 0, -5, -6, 0, -8,
+    12, -3, 1, -21, -22, -17, -8, 4,
+    0, -3, -27, -7, 0, -7, 0, -8,
+    -7, -27, 0, 0, 0, 2, -1, 0,
+    0, -12, -16, 0, -21, -10, -10, -12,
+    -5, -11, -1, -8, -11, 2, 1, 0,
+    -4, 0, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2,
+    0, -4, 0, -7, -9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, -2, 0, 0, 4, 0, 0, 0,
+    0, 20, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -7, 0, 0, 3, -8, -8,
+    0, -4, -4, -5, 0, 0, 0, 0,
+    0, 0, 0, -4, 0, -4, 0, -9,
+    -10, 0, 0, -12, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, -5, 0, 4,
+    -18, 0, 0, -7, 14, 12, -3, -17,
+    0, 4, -6, 0, -21, -2, -5, 4,
+    -4, 5, 0, -15, -6, -15, -14, 0,
+    0, 24, 0, 0, -2, 0, 0, -2,
+    -2, -4, -11, -14, -1, -39, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, 0, -2, -4, 0, 0, -4,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1,
+    5, 0, -9, 4, -3, -1, -11, -4,
+    0, -5, -4, -3, -6, -7, 0, -3,
+    -1, -3, -7, 0, 0, 4, -3, 0,
+    -9, 0, 0, -8, 0, -7, 0, -7,
+    -7, 4, 0, 0, 0, -8, 4, 0,
+    -6, 0, -3, -5, -13, -3, -3, -3,
+    -1, -3, -1, 0, 0, 0, 0, -4,
+    -3, 0, 0, 5, -3, 0, -3, 0,
+    0, -3, -5, -3, -4, -5, -4, 0,
+    17, -1, 0, 0, -4, -17, -5, 6,
+    0, 0, -20, -7, 4, -7, 3, 0,
+    -3, -13, 0, 2, 0, 0, -7, 0,
+    4, -8, -8, 0, -7, -4, -4, -4,
+    0, -7, 2, -8, -7, 12, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -3, -4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -6, 0, -5,
+    0, 0, -4, 0, 0, -4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -3,
+    0, 0, 0, -6, 0, -14, 0, 3,
+    -9, 8, 1, -3, -20, 0, 0, -9,
+    -4, 0, -10, -12, 0, -18, -4, -17,
+    -16, -11, 3, 28, -5, 0, -10, -4,
+    -4, -7, -11, -7, -15, -17, -10, -4,
+    0, -3, 0, -4, 12, 9, -9, -15,
+    0, 1, -13, 0, -21, -3, -4, 8,
+    -5, 1, 0, -27, -5, -22, -4, 0,
+    0, 25, 1, 0, -3, 0, 0, 0,
+    -2, -3, -16, -3, 0, -27, 0, 0,
+    0, -1, -12, -20, 0, 0, -2, -6,
+    -12, -4, 0, -3, 0, 0, 0, -19,
+    -4, -13, -3, -7, -10, 0, -4, -14,
+    -6, 0, -5, -8, -8, 0, 2, 0,
+    -3, -14, 0, 8, 0, 0, 0, -1,
+    0, 0, 0, 0, 0, -3, -8, 0,
+    0, 0, 0, 0, 0, 0, 0, -4,
+    0, 0, -8, 0, 0, 7, -2, 0,
+    0, 0, 0, 0, 2, 0, 0, 0,
+    0, 6, 3, -4, 0, -14, -13, -8,
+    -8, 17, 7, 4, -36, -3, 8, -4,
+    0, -4, -4, -15, 0, 4, -5, -3,
+    -12, 0, 8, 0, -12, 0, -23, -5,
+    -5, -16, 1, -5, -14, -14, -4, 17,
+    0, -6, 0, -10, -15, -17, -10, 12,
+    0, 1, -30, -3, 4, -7, -3, -10,
+    -9, -15, -6, -3, 0, 0, -10, 0,
+    10, -4, -23, 0, -23, -6, -15, -24,
+    -1, -13, -7, -14, -12, 11, 0, -5,
+    0, -7, 0, 7, -14, 4, 0, 0,
+    -22, 0, -4, -9, -7, -3, -10, -14,
+    -10, -12, -4, -10, -8, 0, 1, 20,
+    -7, 0, -12, -4, -4, -8, -10, -11,
+    -12, -16, -5, -8, 3, 0, 0, -3,
+    0, 16, 0, 7, 1, 1, -5, 0,
+    8, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 12, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -7, 0, 0,
+    -8, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -3, 0, -11, 0, 4, 54, -8, -3,
+    13, 11, -11, 4, 0, 0, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    12, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -12, 0, 0, 0, 0, -9, -2, 0,
+    0, 0, -9, 0, -5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    -4, 0, 0, -8, -6, 0, -11, 4,
+    -5, 0, 0, -11, -4, -10, 0, 0,
+    -11, 0, -4, 0, 0, -5, 0, -34,
+    -8, -17, -5, 0, 0, -11, -2, 0,
+    0, 0, 0, 0, 0, 0, -6, -7,
+    -3, -7, 0, 0, 0, -5, 8, 0,
+    -3, -10, -3, -7, -8, 0, -5, -2,
+    -3, 3, -1, 0, 0, -37, -3, -6,
+    0, -3, -4, 0, 0, -3, -3, 0,
+    0, 0, 3, 0, -3, -7, -3, 7,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 0, 0, 0, 0, -9, 0,
+    -3, 4, 0, 0, 0, -11, -4, -8,
+    0, 0, -12, 0, -4, 0, 0, 0,
+    0, -40, 0, -8, -15, 0, 0, -3,
+    -6, 0, 0, 0, 0, 0, 0, 0,
+    -4, -6, -2, -6, 0, 0, 7, -4,
+    -4, -12, 5, 20, 7, 9, -11, 5,
+    17, 5, 12, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 20, -7, -4, 0,
+    -3, 33, 33, 0, 0, 0, 4, 0,
+    0, 15, 0, -7, 0, 0, 0, 0,
+    0, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -35, -5, -3,
+    -17, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -7, 0, 0, 0, 0, 0, -3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -35, -5, -3, -17, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -10, 4, 0, -4, 3, 7, 4,
+    -12, 0, -1, -3, 4, 0, 0, 0,
+    0, -10, 0, -4, -3, -4, 0, 26,
+    -4, 0, -9, -3, -3, -7, 0, -4,
+    -12, -8, -5, 0, 0, -7, 0, 0,
+    0, 0, 0, -3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -35,
+    -5, -3, -17, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -7, 0, -4, -4, -17,
+    1, -2, 1, -3, -11, 1, 9, 1,
+    3, 1, -10, -17, -5, -16, -8, -11,
+    -17, -7, -5, -5, -3, -3, -5, -3,
+    -3, -1, 6, 0, 6, -3, 0, 13,
+    0, 0, 0, 0, 0, 0, 0, -3,
+    -4, -4, 0, 0, -11, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, -4, 0, -5, 0, 0,
+    0, -4, 4, 0, -7, -8, -3, 0,
+    -12, -3, -9, -3, -5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 13,
+    0, 0, -7, 0, 0, 0, -5, 0,
+    -4, 0, 0, -2, 0, -3, 0, -5,
+    -14, -13, 3, 5, 5, -1, -12, 3,
+    6, 3, 12, 3, -3, -11, 0, -17,
+    0, 0, -12, 0, 0, -5, -7, 0,
+    -6, 0, 0, -3, 6, 0, -3, -12,
+    -4, 15, 0, -4, 0, -10, 0, 4,
+    -4, 3, 0, 0, -14, 0, -3, -1,
+    0, -4, -3, 0, 0, -17, -5, -9,
+    0, 0, 0, 15, -4, 0, -7, 0,
+    0, -4, 0, -4, -12, 0, -4, 4,
+    0, 0, 0, -5, 1, 0, 0, -5,
+    -3, 0, -5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 9, 0, 0, -3, 0, 0, 0,
+    1, 0, -4, -4, 0, 0, 8, 0,
+    10, 0, -26, -24, 1, 18, 12, 7,
+    -17, 3, 17, 0, 15, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0
+};
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 50,
+    .right_class_cnt     = 38,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+const lv_font_t lv_font_montserrat_26 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 29,
+    .base_line = 5,
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -2,
+    .underline_thickness = 1,
+    .dsc = &font_dsc,
+    .fallback = &lv_font_montserrat_16,
+};
+
+#endif /*CYD_FONT_SUBSET*/
@@ -0,0 +1,2025 @@
+/*******************************************************************************
+ * Size: 30 px
+ * Bpp: 4
+ * Subset of LVGL's lv_font_montserrat_30.c, generated by tools/subset_fonts.py. Do not edit.
+ * Glyphs (71):  %'-./0123456789:<ABCDEFHIKLMNOPRSTUVWX[]_abcdefghiklmnopqrstuvwxyz° + 3 symbols
+ ******************************************************************************/
+
+#include <lvgl.h>
+
+#if CYD_FONT_SUBSET
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0025 "%" */
+    0x0, 0x5c, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xfa, 0x0, 0x0, 0x7, 0xff, 0xcd, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x5f, 0xe0, 0x0, 0x0,
+    0x3f, 0xe3, 0x0, 0x3e, 0xf2, 0x0, 0x0, 0x1,
+    0xff, 0x40, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x7,
+    0xf9, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0,
+    0xdf, 0x30, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x6f,
+    0xd0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x1,
+    0xfd, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0xdf, 0x30, 0x0, 0x3, 0xfc, 0x0, 0xc, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x7,
+    0xf9, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xe2, 0x0, 0x3e, 0xf2, 0x2, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xcc, 0xff,
+    0x70, 0xc, 0xf7, 0x0, 0x59, 0xa8, 0x20, 0x0,
+    0x0, 0x5c, 0xff, 0xc5, 0x0, 0x8f, 0xc0, 0xc,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0x20, 0xaf, 0xb2, 0x5, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x1, 0xfe,
+    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xb0, 0x6, 0xf9, 0x0, 0x0, 0xf, 0xf0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0x10, 0x8, 0xf6,
+    0x0, 0x0, 0xd, 0xf2, 0x0, 0x0, 0x0, 0xe,
+    0xf6, 0x0, 0x8, 0xf6, 0x0, 0x0, 0xc, 0xf2,
+    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x7, 0xf7,
+    0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x4, 0xfe,
+    0x10, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x3f, 0xd0,
+    0x0, 0x0, 0x1e, 0xf5, 0x0, 0x0, 0x0, 0xcf,
+    0x40, 0x0, 0xbf, 0x60, 0x0, 0x0, 0xaf, 0xa0,
+    0x0, 0x0, 0x0, 0x2e, 0xfa, 0x9d, 0xfa, 0x0,
+    0x0, 0x5, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x2,
+    0xae, 0xfd, 0x70, 0x0,
+
+    /* U+0027 "'" */
+    0x1f, 0xf6, 0x1f, 0xf5, 0xf, 0xf5, 0xf, 0xf5,
+    0xf, 0xf4, 0xf, 0xf4, 0xf, 0xf3, 0xf, 0xf3,
+    0x1, 0x10,
+
+    /* U+002D "-" */
+    0x27, 0x77, 0x77, 0x77, 0x64, 0xff, 0xff, 0xff,
+    0xfc, 0x4f, 0xff, 0xff, 0xff, 0xc0,
+
+    /* U+002E "." */
+    0x0, 0x0, 0x1, 0xdf, 0xb0, 0x8f, 0xff, 0x58,
+    0xff, 0xf4, 0x1b, 0xf9, 0x0,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x0, 0x3, 0x9d, 0xff, 0xd9, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xfe, 0xbb, 0xef,
+    0xff, 0xc0, 0x0, 0x0, 0xaf, 0xfe, 0x50, 0x0,
+    0x5, 0xef, 0xfa, 0x0, 0x4, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0x40, 0xb, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xb0, 0xf, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x4f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf4,
+    0x6f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xf6, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf8, 0x8f, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xf8, 0x6f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xf6, 0x4f, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf4, 0xf, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0xb,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x7, 0xff, 0xb0,
+    0x4, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0x40, 0x0, 0xaf, 0xfe, 0x50, 0x0, 0x4, 0xef,
+    0xfa, 0x0, 0x0, 0xc, 0xff, 0xfe, 0xbb, 0xef,
+    0xff, 0xc0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xff,
+    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x3, 0x9d,
+    0xff, 0xda, 0x30, 0x0, 0x0,
+
+    /* U+0031 "1" */
+    0xcf, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
+    0x79, 0x99, 0x9f, 0xff, 0x0, 0x0, 0xf, 0xff,
+    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xf, 0xff,
+    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xf, 0xff,
+    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xf, 0xff,
+    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xf, 0xff,
+    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xf, 0xff,
+    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xf, 0xff,
+    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xf, 0xff,
+    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xf, 0xff,
+    0x0, 0x0, 0xf, 0xff,
+
+    /* U+0032 "2" */
+    0x0, 0x1, 0x6b, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40,
+    0x0, 0x1c, 0xff, 0xff, 0xcb, 0xbd, 0xff, 0xff,
+    0x30, 0x3, 0xef, 0xe5, 0x0, 0x0, 0x4, 0xdf,
+    0xfd, 0x0, 0x2, 0xa1, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xef, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xfd, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf3, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x30,
+
+    /* U+0033 "3" */
+    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x8, 0x99, 0x99, 0x99, 0x99, 0x9f, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xfd, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0x80, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x11, 0x13, 0x8e, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfb,
+    0x8, 0x30, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf7,
+    0x4f, 0xfa, 0x30, 0x0, 0x0, 0x1a, 0xff, 0xf1,
+    0x9f, 0xff, 0xfe, 0xca, 0xbd, 0xff, 0xff, 0x50,
+    0x6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0,
+    0x0, 0x4, 0x8c, 0xef, 0xfd, 0xb6, 0x0, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9,
+    0x0, 0x0, 0x33, 0x20, 0x0, 0x0, 0x0, 0x7f,
+    0xfc, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0,
+    0x3f, 0xfe, 0x20, 0x0, 0x1, 0xff, 0xb0, 0x0,
+    0x0, 0x1e, 0xff, 0x40, 0x0, 0x0, 0x1f, 0xfb,
+    0x0, 0x0, 0xc, 0xff, 0x80, 0x0, 0x0, 0x1,
+    0xff, 0xb0, 0x0, 0x8, 0xff, 0xf9, 0x99, 0x99,
+    0x99, 0x9f, 0xfe, 0x99, 0x96, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xb0, 0x0, 0x0,
+
+    /* U+0035 "5" */
+    0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x1f, 0xfd, 0x99, 0x99, 0x99, 0x99,
+    0x90, 0x0, 0x3, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xfe, 0xb8, 0x20, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x89, 0x99,
+    0x9a, 0xbd, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x8f, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
+    0x5, 0x70, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfc,
+    0x0, 0xef, 0xd5, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x60, 0x3f, 0xff, 0xff, 0xdb, 0xac, 0xff, 0xff,
+    0xa0, 0x0, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x2, 0x7b, 0xdf, 0xfe, 0xc8,
+    0x20, 0x0, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0xc9, 0x40,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0x60, 0x0, 0x8, 0xff, 0xff, 0xca, 0x99, 0xcf,
+    0xe0, 0x0, 0x6, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x13, 0x0, 0x1, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf8, 0x1, 0x7c,
+    0xef, 0xec, 0x71, 0x0, 0x8, 0xff, 0x75, 0xff,
+    0xff, 0xff, 0xff, 0xe5, 0x0, 0x8f, 0xfb, 0xff,
+    0xea, 0x77, 0x9e, 0xff, 0xf5, 0x8, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x9, 0xff, 0xe0, 0x7f, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x65, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf9, 0x1f,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x3, 0xff, 0xa0,
+    0xdf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x6, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0x50, 0xd, 0xff, 0xa0, 0x0, 0x0, 0x9, 0xff,
+    0xd0, 0x0, 0x2e, 0xff, 0xea, 0x77, 0x9e, 0xff,
+    0xf3, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xff, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xeb,
+    0x60, 0x0, 0x0,
+
+    /* U+0037 "7" */
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x1f, 0xfe, 0x99, 0x99, 0x99, 0x99, 0x9e,
+    0xff, 0x81, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf1, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xfa, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0x20, 0x5, 0x54, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x0, 0x39, 0xce, 0xfe, 0xda, 0x50, 0x0,
+    0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xd3,
+    0x0, 0x0, 0xdf, 0xff, 0xb8, 0x78, 0xaf, 0xff,
+    0xf3, 0x0, 0x7f, 0xfe, 0x30, 0x0, 0x0, 0x1a,
+    0xff, 0xc0, 0xc, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0x10, 0xef, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xf3, 0xc, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0x10, 0x7f, 0xfc, 0x10, 0x0,
+    0x0, 0x8, 0xff, 0xb0, 0x0, 0xbf, 0xff, 0x96,
+    0x45, 0x8d, 0xff, 0xe2, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x6e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x7f, 0xff,
+    0x93, 0x10, 0x3, 0x7e, 0xff, 0xb0, 0x2f, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x1d, 0xff, 0x67, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0xaf,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfa,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xc1, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x7, 0xff,
+    0xf5, 0x5, 0xff, 0xff, 0xa7, 0x67, 0x9e, 0xff,
+    0xf9, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x59, 0xde, 0xfe, 0xdb,
+    0x61, 0x0, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x0, 0x38, 0xde, 0xfe, 0xc7, 0x10, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xb7, 0x78, 0xcf,
+    0xff, 0x80, 0x0, 0x6, 0xff, 0xd2, 0x0, 0x0,
+    0x3, 0xdf, 0xf5, 0x0, 0xd, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x2f, 0xfe, 0x0, 0xf, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0x50, 0x1f, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x90, 0xf,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0,
+    0xb, 0xff, 0x90, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xf0, 0x3, 0xff, 0xfb, 0x41, 0x1, 0x5c, 0xff,
+    0xff, 0xf0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
+    0xf5, 0xff, 0xf0, 0x0, 0x3, 0xbf, 0xff, 0xff,
+    0xfb, 0x30, 0xff, 0xf0, 0x0, 0x0, 0x1, 0x46,
+    0x64, 0x10, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xf9,
+    0x0, 0x0, 0x5, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xd0, 0x0, 0x0, 0x7f, 0xeb, 0xa9, 0xae, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xa1, 0x0, 0x0, 0x0, 0x17, 0xbe, 0xff,
+    0xec, 0x82, 0x0, 0x0, 0x0,
+
+    /* U+003A ":" */
+    0x1b, 0xfa, 0x8, 0xff, 0xf4, 0x8f, 0xff, 0x51,
+    0xdf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfb,
+    0x8, 0xff, 0xf5, 0x8f, 0xff, 0x41, 0xbf, 0x90,
+
+    /* U+003C "<" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xa6, 0x0, 0x0,
+    0x0, 0x0, 0x17, 0xdf, 0xf7, 0x0, 0x0, 0x0,
+    0x4b, 0xff, 0xff, 0xc3, 0x0, 0x2, 0x8e, 0xff,
+    0xfe, 0x93, 0x0, 0x5, 0xbf, 0xff, 0xfb, 0x50,
+    0x0, 0x0, 0xef, 0xff, 0xd7, 0x10, 0x0, 0x0,
+    0x0, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xd6, 0x10, 0x0, 0x0, 0x0, 0x6,
+    0xcf, 0xff, 0xfa, 0x40, 0x0, 0x0, 0x0, 0x3,
+    0x9f, 0xff, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x0,
+    0x5c, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x0,
+    0x28, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xb7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xcd, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf5, 0x7f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfe, 0x1,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0x70, 0x9, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xf1, 0x0, 0x2f,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xfa, 0x0, 0x0, 0xbf, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0x30, 0x0, 0x4, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xc0,
+    0x0, 0x0, 0xd, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x6f, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xb6, 0x66, 0x66, 0x66, 0x6c, 0xff, 0x90,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0xf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xe0, 0x0, 0x7, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x60, 0x0,
+    0xef, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xfd, 0x0, 0x5f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf4, 0xc, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xc0,
+
+    /* U+0042 "B" */
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa6, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x40, 0x0, 0xdf, 0xf8, 0x66, 0x66, 0x66,
+    0x8b, 0xff, 0xff, 0x30, 0xd, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xfb, 0x0, 0xdf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf0, 0xd,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf0, 0xd, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf9, 0x0, 0xdf, 0xf2, 0x0, 0x0,
+    0x0, 0x14, 0xaf, 0xfe, 0x10, 0xd, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x0,
+    0xd, 0xff, 0x86, 0x66, 0x66, 0x67, 0x8b, 0xff,
+    0xfb, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xf8, 0xd, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xf0, 0xdf, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x2d, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0x1d, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xff, 0xb0, 0xdf, 0xf8, 0x66, 0x66, 0x66,
+    0x78, 0xbf, 0xff, 0xf2, 0xd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd3, 0x0, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xda, 0x50, 0x0, 0x0,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x0, 0x5, 0x9d, 0xff, 0xed, 0xa5,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xe6, 0x0, 0x0, 0x1, 0xbf, 0xff,
+    0xfe, 0xba, 0xbd, 0xff, 0xff, 0xa0, 0x0, 0x1d,
+    0xff, 0xfb, 0x30, 0x0, 0x0, 0x29, 0xff, 0xf3,
+    0x0, 0xbf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0x40, 0x5, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0x40, 0x0, 0x1d, 0xff, 0xfa, 0x30, 0x0,
+    0x0, 0x29, 0xff, 0xf3, 0x0, 0x1, 0xbf, 0xff,
+    0xfe, 0xba, 0xbd, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xed, 0x95,
+    0x0, 0x0,
+
+    /* U+0044 "D" */
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xec, 0x94, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x50, 0x0, 0x0, 0xdf, 0xfa, 0x99,
+    0x99, 0x9a, 0xce, 0xff, 0xff, 0xa0, 0x0, 0xd,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xff,
+    0xb0, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0x80, 0xd, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x20, 0xdf,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf9, 0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xe0, 0xdf, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x2d, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xf4, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0x5d, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf4, 0xdf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0x2d, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xe0, 0xdf, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf9, 0xd, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x20,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0x80, 0xd, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x4, 0xbf, 0xff, 0xb0, 0x0, 0xdf, 0xfa, 0x99,
+    0x99, 0x9a, 0xce, 0xff, 0xff, 0xa0, 0x0, 0xd,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xec,
+    0x94, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0045 "E" */
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xdf, 0xfa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
+    0xdf, 0xf9, 0x88, 0x88, 0x88, 0x88, 0x86, 0x0,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xfa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+
+    /* U+0046 "F" */
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf,
+    0xfa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9d, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xb0, 0xdf, 0xfa, 0x99, 0x99, 0x99, 0x99,
+    0x96, 0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0048 "H" */
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0x3d, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xf3, 0xdf, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x3d, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf3, 0xdf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x3d,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xf3, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0x3d, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xf3, 0xdf, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0x3d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x3d, 0xff, 0xa9, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0xef, 0xf3, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0x3d, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xf3, 0xdf, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x3d, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf3,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0x3d, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xf3, 0xdf, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x3d, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf3, 0xdf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x30,
+
+    /* U+0049 "I" */
+    0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2,
+    0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2,
+    0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2,
+    0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2,
+    0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2,
+    0xdf, 0xf2,
+
+    /* U+004B "K" */
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xf7, 0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x1,
+    0xdf, 0xf8, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xf9, 0x0, 0xd, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0xcf, 0xfa, 0x0, 0x0, 0xdf, 0xf2,
+    0x0, 0x0, 0x0, 0xcf, 0xfa, 0x0, 0x0, 0xd,
+    0xff, 0x20, 0x0, 0x0, 0xcf, 0xfb, 0x0, 0x0,
+    0x0, 0xdf, 0xf2, 0x0, 0x0, 0xbf, 0xfc, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0x20, 0x0, 0xbf, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0, 0xaf,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0xd, 0xff, 0x20,
+    0xaf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xf2, 0xaf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xbf, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0x35, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x30, 0x7,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x30,
+    0x0, 0x9, 0xff, 0xf3, 0x0, 0x0, 0xd, 0xff,
+    0x40, 0x0, 0x0, 0xb, 0xff, 0xe1, 0x0, 0x0,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0xc, 0xff, 0xc0,
+    0x0, 0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0xa0, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0x70, 0xd, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0x40, 0xdf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x20,
+
+    /* U+004C "L" */
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xfa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x5d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+
+    /* U+004D "M" */
+    0xdf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0x7d, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf7, 0xdf,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0x7d, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf7, 0xdf, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0x7d, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xf7, 0xdf, 0xf9, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf8, 0xff,
+    0x7d, 0xff, 0x1e, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x6f, 0xf8, 0x6f, 0xf7, 0xdf, 0xf0, 0x5f, 0xfa,
+    0x0, 0x0, 0x0, 0xe, 0xfe, 0x6, 0xff, 0x7d,
+    0xff, 0x0, 0xbf, 0xf3, 0x0, 0x0, 0x8, 0xff,
+    0x50, 0x6f, 0xf7, 0xdf, 0xf0, 0x2, 0xff, 0xd0,
+    0x0, 0x2, 0xff, 0xb0, 0x6, 0xff, 0x7d, 0xff,
+    0x0, 0x8, 0xff, 0x60, 0x0, 0xbf, 0xf2, 0x0,
+    0x6f, 0xf7, 0xdf, 0xf0, 0x0, 0xe, 0xff, 0x10,
+    0x4f, 0xf8, 0x0, 0x6, 0xff, 0x7d, 0xff, 0x0,
+    0x0, 0x5f, 0xf9, 0xd, 0xfe, 0x0, 0x0, 0x6f,
+    0xf7, 0xdf, 0xf0, 0x0, 0x0, 0xbf, 0xfa, 0xff,
+    0x50, 0x0, 0x6, 0xff, 0x7d, 0xff, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x6f, 0xf7,
+    0xdf, 0xf0, 0x0, 0x0, 0x8, 0xff, 0xf2, 0x0,
+    0x0, 0x6, 0xff, 0x7d, 0xff, 0x0, 0x0, 0x0,
+    0xe, 0xf9, 0x0, 0x0, 0x0, 0x6f, 0xf7, 0xdf,
+    0xf0, 0x0, 0x0, 0x0, 0x37, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0x7d, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7, 0xdf, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0x70,
+
+    /* U+004E "N" */
+    0xdf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0x3d, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xf3, 0xdf, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x3d, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf3, 0xdf, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0xc, 0xff, 0x3d,
+    0xff, 0xdf, 0xfe, 0x10, 0x0, 0x0, 0x0, 0xcf,
+    0xf3, 0xdf, 0xf3, 0xdf, 0xfc, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0x3d, 0xff, 0x22, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0xcf, 0xf3, 0xdf, 0xf2, 0x5, 0xff,
+    0xf7, 0x0, 0x0, 0xc, 0xff, 0x3d, 0xff, 0x20,
+    0x8, 0xff, 0xf4, 0x0, 0x0, 0xcf, 0xf3, 0xdf,
+    0xf2, 0x0, 0xb, 0xff, 0xe2, 0x0, 0xc, 0xff,
+    0x3d, 0xff, 0x20, 0x0, 0xd, 0xff, 0xd0, 0x0,
+    0xcf, 0xf3, 0xdf, 0xf2, 0x0, 0x0, 0x2f, 0xff,
+    0xa0, 0xc, 0xff, 0x3d, 0xff, 0x20, 0x0, 0x0,
+    0x4f, 0xff, 0x70, 0xcf, 0xf3, 0xdf, 0xf2, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0x4c, 0xff, 0x3d, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0xef, 0xf3,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0x3d, 0xff, 0x20, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xff, 0xf3, 0xdf, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0x3d, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xf3, 0xdf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfd, 0xa6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xfe, 0xba, 0xbd, 0xff, 0xff,
+    0xd2, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xa3, 0x0,
+    0x0, 0x2, 0x8f, 0xff, 0xe2, 0x0, 0x0, 0xaf,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
+    0xd0, 0x0, 0x4f, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0x80, 0xc, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0x2, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xf5, 0x5f, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x98,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xfb, 0x8f, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xb8, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xfb, 0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0x92, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xf5, 0xc, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0x0, 0x4f, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x80,
+    0x0, 0xaf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0xd0, 0x0, 0x0, 0xcf, 0xff, 0xa3,
+    0x0, 0x0, 0x2, 0x8f, 0xff, 0xe2, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xfe, 0xba, 0xbd, 0xff, 0xff,
+    0xd2, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0x9d, 0xff, 0xfd, 0xa6, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+0050 "P" */
+    0xdf, 0xff, 0xff, 0xff, 0xfe, 0xd9, 0x40, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x30, 0x0, 0xdf, 0xfa, 0x99, 0x99, 0x9a, 0xdf,
+    0xff, 0xf4, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0,
+    0x3, 0xcf, 0xff, 0x10, 0xdf, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x90, 0xdf, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0xdf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0xdf,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf1,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xf0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xc0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0x60, 0xdf, 0xf2, 0x0, 0x0, 0x1,
+    0x49, 0xff, 0xfc, 0x0, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc1, 0x0, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe7, 0x0, 0x0, 0xdf, 0xfa,
+    0x99, 0x99, 0x98, 0x63, 0x0, 0x0, 0x0, 0xdf,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0052 "R" */
+    0xdf, 0xff, 0xff, 0xff, 0xfe, 0xd9, 0x40, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x30, 0x0, 0xdf, 0xfa, 0x99, 0x99, 0x9a, 0xdf,
+    0xff, 0xf4, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0,
+    0x3, 0xcf, 0xff, 0x10, 0xdf, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x90, 0xdf, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0xdf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0xdf,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf1,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xf0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xc0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x60, 0xdf, 0xf2, 0x0, 0x0, 0x1,
+    0x49, 0xff, 0xfc, 0x0, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc1, 0x0, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0xdf, 0xf9,
+    0x88, 0x88, 0x89, 0xff, 0xd0, 0x0, 0x0, 0xdf,
+    0xf2, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0,
+    0xdf, 0xf2, 0x0, 0x0, 0x0, 0xe, 0xff, 0x50,
+    0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xe1, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xfb, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0x60, 0xdf, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xf2,
+
+    /* U+0053 "S" */
+    0x0, 0x0, 0x38, 0xce, 0xff, 0xeb, 0x72, 0x0,
+    0x0, 0x2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x20, 0x1, 0xef, 0xff, 0xc9, 0x89, 0xbe, 0xff,
+    0xf4, 0x0, 0xaf, 0xfc, 0x20, 0x0, 0x0, 0x3,
+    0xad, 0x0, 0x1f, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfc, 0x61,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xfd, 0x95, 0x10, 0x0, 0x0, 0x0, 0x4, 0xcf,
+    0xff, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x0, 0x0,
+    0x16, 0xae, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x7c, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5,
+    0x9, 0x20, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0x35, 0xff, 0x92, 0x0, 0x0, 0x0, 0x1a, 0xff,
+    0xc0, 0x7f, 0xff, 0xfe, 0xb9, 0x89, 0xcf, 0xff,
+    0xf3, 0x0, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc3, 0x0, 0x0, 0x3, 0x7b, 0xdf, 0xfe, 0xd9,
+    0x40, 0x0, 0x0,
+
+    /* U+0054 "T" */
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0x89, 0x99, 0x99, 0x9d, 0xff, 0xb9,
+    0x99, 0x99, 0x94, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0x40, 0x0, 0x0, 0x0,
+
+    /* U+0055 "U" */
+    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xb0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xfb, 0xf, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xb0, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb, 0xf, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xb0,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xfb, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xb0, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xfb, 0xf, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xb0, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb, 0xf,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xb0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfb, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xa0, 0xef, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xf9, 0xb, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x70, 0x7f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf3,
+    0x1, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xfc, 0x0, 0x8, 0xff, 0xf7, 0x0, 0x0, 0x2,
+    0xaf, 0xff, 0x40, 0x0, 0xb, 0xff, 0xff, 0xca,
+    0xbd, 0xff, 0xff, 0x70, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x2, 0x8c, 0xef, 0xfe, 0xa6, 0x0, 0x0, 0x0,
+
+    /* U+0056 "V" */
+    0xc, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0x20, 0x5f, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xb0, 0x0,
+    0xef, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf4, 0x0, 0x7, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xfd, 0x0, 0x0, 0x1f,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0x60, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x2, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0x10, 0x0, 0x0, 0x0, 0x4f, 0xfe,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0xcf,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xc0,
+    0x0, 0x0, 0x4f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0x30, 0x0, 0xb, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfa, 0x0,
+    0x2, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xf2, 0x0, 0x9f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x80, 0x1f,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x7, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0xef, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0057 "W" */
+    0xe, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xa0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xf4, 0x3, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0x0, 0xd, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xa0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xdf, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf4, 0x0, 0x3, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x4f, 0xf7, 0xaf, 0xf3, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0x0, 0x0, 0xd, 0xff, 0x30, 0x0,
+    0x0, 0xa, 0xff, 0x24, 0xff, 0x90, 0x0, 0x0,
+    0x3, 0xff, 0xa0, 0x0, 0x0, 0x8f, 0xf8, 0x0,
+    0x0, 0x0, 0xff, 0xc0, 0xe, 0xfe, 0x0, 0x0,
+    0x0, 0x8f, 0xf4, 0x0, 0x0, 0x3, 0xff, 0xd0,
+    0x0, 0x0, 0x5f, 0xf7, 0x0, 0x9f, 0xf4, 0x0,
+    0x0, 0xe, 0xff, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0x30, 0x0, 0xa, 0xff, 0x10, 0x4, 0xff, 0x90,
+    0x0, 0x3, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x8f,
+    0xf8, 0x0, 0x0, 0xff, 0xc0, 0x0, 0xe, 0xfe,
+    0x0, 0x0, 0x9f, 0xf4, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xd0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x9f,
+    0xf4, 0x0, 0xe, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0x30, 0xb, 0xff, 0x10, 0x0, 0x4,
+    0xff, 0x90, 0x3, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf8, 0x1, 0xff, 0xc0, 0x0, 0x0,
+    0xe, 0xfe, 0x0, 0x9f, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xd0, 0x6f, 0xf6, 0x0, 0x0,
+    0x0, 0x9f, 0xf4, 0xe, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0x3b, 0xff, 0x10, 0x0,
+    0x0, 0x3, 0xff, 0xa4, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xfa, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0xe, 0xfe, 0x9f, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+0058 "X" */
+    0xc, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xd0, 0x1, 0xef, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0x30, 0x0, 0x5f, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0xcf, 0xf6, 0x0, 0x0, 0x9,
+    0xff, 0xd0, 0x0, 0x0, 0x8, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0xdf, 0xf9, 0x0, 0x0, 0x4f, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x40, 0x1,
+    0xef, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xe1, 0xb, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xfb, 0x6f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xfd, 0xcf, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf3, 0x2f,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0x70, 0x6, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfc, 0x0, 0x0, 0xaf, 0xfc, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xf1, 0x0, 0x0, 0xd, 0xff,
+    0x80, 0x0, 0x0, 0x1e, 0xff, 0x50, 0x0, 0x0,
+    0x3, 0xff, 0xf3, 0x0, 0x0, 0xcf, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfe, 0x10, 0x8, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0,
+    0x4f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xef, 0xf6,
+
+    /* U+005B "[" */
+    0xdf, 0xff, 0xff, 0x6d, 0xff, 0xff, 0xf6, 0xdf,
+    0xf6, 0x55, 0x2d, 0xff, 0x0, 0x0, 0xdf, 0xf0,
+    0x0, 0xd, 0xff, 0x0, 0x0, 0xdf, 0xf0, 0x0,
+    0xd, 0xff, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0xd,
+    0xff, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0xd, 0xff,
+    0x0, 0x0, 0xdf, 0xf0, 0x0, 0xd, 0xff, 0x0,
+    0x0, 0xdf, 0xf0, 0x0, 0xd, 0xff, 0x0, 0x0,
+    0xdf, 0xf0, 0x0, 0xd, 0xff, 0x0, 0x0, 0xdf,
+    0xf0, 0x0, 0xd, 0xff, 0x0, 0x0, 0xdf, 0xf0,
+    0x0, 0xd, 0xff, 0x0, 0x0, 0xdf, 0xf0, 0x0,
+    0xd, 0xff, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0xd,
+    0xff, 0x65, 0x52, 0xdf, 0xff, 0xff, 0x6d, 0xff,
+    0xff, 0xf6,
+
+    /* U+005D "]" */
+    0x7f, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xfd, 0x25,
+    0x56, 0xff, 0xd0, 0x0, 0xf, 0xfd, 0x0, 0x0,
+    0xff, 0xd0, 0x0, 0xf, 0xfd, 0x0, 0x0, 0xff,
+    0xd0, 0x0, 0xf, 0xfd, 0x0, 0x0, 0xff, 0xd0,
+    0x0, 0xf, 0xfd, 0x0, 0x0, 0xff, 0xd0, 0x0,
+    0xf, 0xfd, 0x0, 0x0, 0xff, 0xd0, 0x0, 0xf,
+    0xfd, 0x0, 0x0, 0xff, 0xd0, 0x0, 0xf, 0xfd,
+    0x0, 0x0, 0xff, 0xd0, 0x0, 0xf, 0xfd, 0x0,
+    0x0, 0xff, 0xd0, 0x0, 0xf, 0xfd, 0x0, 0x0,
+    0xff, 0xd0, 0x0, 0xf, 0xfd, 0x0, 0x0, 0xff,
+    0xd0, 0x0, 0xf, 0xfd, 0x0, 0x0, 0xff, 0xd2,
+    0x55, 0x6f, 0xfd, 0x7f, 0xff, 0xff, 0xd7, 0xff,
+    0xff, 0xfd,
+
+    /* U+005F "_" */
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+
+    /* U+0061 "a" */
+    0x0, 0x4, 0x9d, 0xef, 0xec, 0x82, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0xc,
+    0xff, 0xea, 0x88, 0x9e, 0xff, 0xf4, 0x0, 0x3e,
+    0x50, 0x0, 0x0, 0xa, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0,
+    0x1, 0x11, 0x19, 0xff, 0x50, 0x2, 0x9d, 0xff,
+    0xff, 0xff, 0xff, 0xf5, 0x4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x51, 0xff, 0xf8, 0x20, 0x0,
+    0x0, 0x8f, 0xf5, 0x6f, 0xf9, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0x57, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0xbf, 0xf5, 0x5f, 0xfa, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0x50, 0xef, 0xf9, 0x31, 0x14, 0xaf, 0xff,
+    0xf5, 0x3, 0xef, 0xff, 0xff, 0xff, 0xd8, 0xff,
+    0x50, 0x1, 0x8c, 0xff, 0xec, 0x70, 0x6f, 0xf5,
+
+    /* U+0062 "b" */
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9,
+    0x1, 0x8c, 0xef, 0xea, 0x50, 0x0, 0x0, 0x4f,
+    0xf9, 0x5f, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0,
+    0x4f, 0xfd, 0xff, 0xfb, 0x99, 0xcf, 0xff, 0xf2,
+    0x0, 0x4f, 0xff, 0xfb, 0x10, 0x0, 0x2, 0xcf,
+    0xfd, 0x0, 0x4f, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0x70, 0x4f, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xd0, 0x4f, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xf1, 0x4f, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2, 0x4f, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2, 0x4f,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf1,
+    0x4f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xd0, 0x4f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0x70, 0x4f, 0xff, 0xfb, 0x10, 0x0, 0x2,
+    0xcf, 0xfd, 0x0, 0x4f, 0xfc, 0xff, 0xfb, 0x89,
+    0xbf, 0xff, 0xf2, 0x0, 0x4f, 0xf7, 0x5f, 0xff,
+    0xff, 0xff, 0xfd, 0x20, 0x0, 0x4f, 0xf7, 0x1,
+    0x8c, 0xff, 0xda, 0x40, 0x0, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x0, 0x17, 0xce, 0xfe, 0xc7, 0x10, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x8f, 0xff, 0xea, 0x89, 0xdf, 0xff, 0x70,
+    0x5, 0xff, 0xf7, 0x0, 0x0, 0x5, 0xff, 0xc0,
+    0xe, 0xff, 0x50, 0x0, 0x0, 0x0, 0x46, 0x0,
+    0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0x50, 0x0, 0x0, 0x0, 0x46, 0x0,
+    0x5, 0xff, 0xf6, 0x0, 0x0, 0x5, 0xff, 0xc0,
+    0x0, 0x8f, 0xff, 0xea, 0x89, 0xdf, 0xff, 0x70,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x17, 0xce, 0xfe, 0xc8, 0x20, 0x0,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xfb, 0x0, 0x0, 0x28, 0xdf, 0xfe,
+    0xa4, 0x2, 0xff, 0xb0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xfb, 0x3f, 0xfb, 0x0, 0xaf, 0xff, 0xea,
+    0x8a, 0xef, 0xfd, 0xff, 0xb0, 0x7f, 0xff, 0x70,
+    0x0, 0x0, 0x6f, 0xff, 0xfb, 0x1f, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xb6, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x9f, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xbb, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb, 0xbf,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xb9,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfb,
+    0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xb1, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xfb, 0x7, 0xff, 0xe4, 0x0, 0x0, 0x3, 0xef,
+    0xff, 0xb0, 0xa, 0xff, 0xfb, 0x75, 0x7b, 0xff,
+    0xdf, 0xfb, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xc2, 0xff, 0xb0, 0x0, 0x2, 0x8c, 0xef, 0xea,
+    0x50, 0xf, 0xfb,
+
+    /* U+0065 "e" */
+    0x0, 0x0, 0x28, 0xdf, 0xfe, 0xb5, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0xaf, 0xff, 0xb7, 0x79, 0xef, 0xfe,
+    0x20, 0x0, 0x6f, 0xfd, 0x20, 0x0, 0x0, 0x8f,
+    0xfc, 0x0, 0xf, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x9f, 0xf5, 0x5, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xb0, 0x9f, 0xf4, 0x11, 0x11, 0x11,
+    0x11, 0x1c, 0xfe, 0xb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x19, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x6, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x9,
+    0xff, 0xfe, 0xa8, 0x8b, 0xff, 0xfd, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x1, 0x7b, 0xef, 0xfd, 0x94, 0x0, 0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x0, 0x5, 0xbe, 0xfd, 0x92, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xf6, 0x0, 0x5, 0xff, 0xf8,
+    0x68, 0xc0, 0x0, 0xb, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x36, 0x6e, 0xff, 0x66, 0x66, 0x30, 0x0, 0xd,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0x0, 0x0, 0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x0, 0x28, 0xce, 0xfe, 0xb5, 0x0, 0xcf,
+    0xf0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xfd, 0x2c,
+    0xff, 0x0, 0xbf, 0xff, 0xea, 0x89, 0xcf, 0xfe,
+    0xef, 0xf0, 0x8f, 0xff, 0x60, 0x0, 0x0, 0x3d,
+    0xff, 0xff, 0x1f, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0xf6, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xaf, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfb, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xbf, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xf8, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0x4f, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xf0, 0xdf, 0xfb,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x2, 0xff,
+    0xfd, 0x62, 0x1, 0x4b, 0xff, 0xff, 0xf0, 0x4,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfe, 0x0,
+    0x1, 0xaf, 0xff, 0xff, 0xfe, 0x50, 0xff, 0xe0,
+    0x0, 0x0, 0x4, 0x67, 0x63, 0x0, 0xf, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xa0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xf5, 0x2, 0xfd, 0x50, 0x0, 0x0, 0x1, 0xaf,
+    0xfe, 0x0, 0xaf, 0xff, 0xfb, 0x98, 0x9b, 0xff,
+    0xff, 0x40, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x40, 0x0, 0x0, 0x16, 0xad, 0xef, 0xfd,
+    0xa6, 0x0, 0x0,
+
+    /* U+0068 "h" */
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xf9, 0x2, 0x8d, 0xef, 0xea, 0x40, 0x0,
+    0x4f, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0x4f, 0xfe, 0xff, 0xea, 0x9a, 0xef, 0xff, 0x90,
+    0x4f, 0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xf2,
+    0x4f, 0xff, 0x80, 0x0, 0x0, 0x0, 0xaf, 0xf8,
+    0x4f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfb,
+    0x4f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc,
+    0x4f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+
+    /* U+0069 "i" */
+    0x2d, 0xe7, 0xb, 0xff, 0xf0, 0x9f, 0xfe, 0x1,
+    0x9a, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xf9, 0x4, 0xff, 0x90, 0x4f, 0xf9, 0x4, 0xff,
+    0x90, 0x4f, 0xf9, 0x4, 0xff, 0x90, 0x4f, 0xf9,
+    0x4, 0xff, 0x90, 0x4f, 0xf9, 0x4, 0xff, 0x90,
+    0x4f, 0xf9, 0x4, 0xff, 0x90, 0x4f, 0xf9, 0x4,
+    0xff, 0x90, 0x4f, 0xf9, 0x4, 0xff, 0x90,
+
+    /* U+006B "k" */
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xf4, 0x4, 0xff, 0x90, 0x0, 0x0,
+    0x5, 0xff, 0xf4, 0x0, 0x4f, 0xf9, 0x0, 0x0,
+    0x7, 0xff, 0xf4, 0x0, 0x4, 0xff, 0x90, 0x0,
+    0x8, 0xff, 0xf4, 0x0, 0x0, 0x4f, 0xf9, 0x0,
+    0x9, 0xff, 0xf3, 0x0, 0x0, 0x4, 0xff, 0x90,
+    0xa, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x4f, 0xf9,
+    0xb, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xbc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xdf, 0xff, 0x80, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xd1, 0x5f, 0xff, 0x50, 0x0, 0x0,
+    0x4f, 0xff, 0xc0, 0x0, 0x8f, 0xff, 0x20, 0x0,
+    0x4, 0xff, 0xc0, 0x0, 0x0, 0xbf, 0xfd, 0x0,
+    0x0, 0x4f, 0xf9, 0x0, 0x0, 0x1, 0xdf, 0xfa,
+    0x0, 0x4, 0xff, 0x90, 0x0, 0x0, 0x2, 0xff,
+    0xf7, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xf4, 0x4, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xe1,
+
+    /* U+006C "l" */
+    0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9,
+    0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9,
+    0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9,
+    0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9,
+    0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9,
+    0x4f, 0xf9, 0x4f, 0xf9,
+
+    /* U+006D "m" */
+    0x4f, 0xf7, 0x3, 0x9d, 0xff, 0xd8, 0x20, 0x0,
+    0x6, 0xbe, 0xfe, 0xc7, 0x0, 0x0, 0x4f, 0xf7,
+    0x9f, 0xff, 0xff, 0xff, 0xf6, 0x4, 0xef, 0xff,
+    0xff, 0xff, 0xe2, 0x0, 0x4f, 0xfe, 0xff, 0xc8,
+    0x78, 0xef, 0xff, 0x8f, 0xff, 0xa7, 0x79, 0xff,
+    0xfe, 0x10, 0x4f, 0xff, 0xf5, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xd2, 0x0, 0x0, 0x1d, 0xff, 0x80,
+    0x4f, 0xff, 0x60, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x4, 0xff, 0xd0, 0x4f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xf0, 0x4f, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xf1, 0x4f, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2, 0x4f, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xf2, 0x4f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xf2, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2, 0x4f, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xf2, 0x4f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xf2, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2,
+
+    /* U+006E "n" */
+    0x4f, 0xf7, 0x3, 0x9d, 0xef, 0xea, 0x40, 0x0,
+    0x4f, 0xf7, 0x9f, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0x4f, 0xfe, 0xff, 0xd8, 0x77, 0xcf, 0xff, 0x90,
+    0x4f, 0xff, 0xf6, 0x0, 0x0, 0x5, 0xff, 0xf2,
+    0x4f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x9f, 0xf8,
+    0x4f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb,
+    0x4f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc,
+    0x4f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
+
+    /* U+006F "o" */
+    0x0, 0x0, 0x17, 0xce, 0xff, 0xc8, 0x10, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x9f, 0xff, 0xea, 0x8a, 0xef, 0xff,
+    0xa0, 0x0, 0x6f, 0xff, 0x60, 0x0, 0x0, 0x6f,
+    0xff, 0x60, 0xe, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0x15, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xf6, 0x9f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xab, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xfc, 0xbf, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xc9, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xfa, 0x5f, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x60, 0xef, 0xf5,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xf1, 0x5, 0xff,
+    0xf6, 0x0, 0x0, 0x5, 0xff, 0xf6, 0x0, 0x9,
+    0xff, 0xfe, 0x98, 0x9d, 0xff, 0xf9, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x1, 0x7c, 0xef, 0xfc, 0x81, 0x0, 0x0,
+
+    /* U+0070 "p" */
+    0x4f, 0xf7, 0x2, 0x8d, 0xef, 0xea, 0x50, 0x0,
+    0x0, 0x4f, 0xf7, 0x7f, 0xff, 0xff, 0xff, 0xfc,
+    0x20, 0x0, 0x4f, 0xfd, 0xff, 0xe9, 0x67, 0x9f,
+    0xff, 0xf2, 0x0, 0x4f, 0xff, 0xf9, 0x0, 0x0,
+    0x1, 0xbf, 0xfd, 0x0, 0x4f, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x70, 0x4f, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xd0, 0x4f, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf1, 0x4f,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2,
+    0x4f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xf2, 0x4f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xf1, 0x4f, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xd0, 0x4f, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0x70, 0x4f, 0xff, 0xfb, 0x10,
+    0x0, 0x2, 0xdf, 0xfd, 0x0, 0x4f, 0xfd, 0xff,
+    0xfb, 0x89, 0xbf, 0xff, 0xf2, 0x0, 0x4f, 0xf9,
+    0x5e, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x4f,
+    0xf9, 0x1, 0x8c, 0xef, 0xda, 0x40, 0x0, 0x0,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0071 "q" */
+    0x0, 0x0, 0x28, 0xdf, 0xfe, 0xa4, 0x0, 0xff,
+    0xb0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xfb, 0x1f,
+    0xfb, 0x0, 0xaf, 0xff, 0xea, 0x8a, 0xef, 0xfc,
+    0xff, 0xb0, 0x7f, 0xff, 0x60, 0x0, 0x0, 0x6f,
+    0xff, 0xfb, 0x1f, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xb6, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xfb, 0x9f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xbb, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xfb, 0xbf, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xb9, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xfb, 0x6f, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xb1, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xfb, 0x7, 0xff,
+    0xf6, 0x0, 0x0, 0x6, 0xff, 0xff, 0xb0, 0xa,
+    0xff, 0xfe, 0x98, 0x9d, 0xff, 0xdf, 0xfb, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xb0,
+    0x0, 0x2, 0x8c, 0xef, 0xea, 0x40, 0x2f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xfb,
+
+    /* U+0072 "r" */
+    0x4f, 0xf7, 0x2, 0x8d, 0xe4, 0x4f, 0xf7, 0x6f,
+    0xff, 0xf4, 0x4f, 0xfc, 0xff, 0xfd, 0xc3, 0x4f,
+    0xff, 0xfb, 0x20, 0x0, 0x4f, 0xff, 0xa0, 0x0,
+    0x0, 0x4f, 0xff, 0x10, 0x0, 0x0, 0x4f, 0xfc,
+    0x0, 0x0, 0x0, 0x4f, 0xfa, 0x0, 0x0, 0x0,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0,
+    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x4f,
+    0xf9, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0,
+    0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x4f, 0xf9,
+    0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0,
+
+    /* U+0073 "s" */
+    0x0, 0x1, 0x7b, 0xef, 0xfe, 0xb7, 0x20, 0x0,
+    0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0x60, 0x2,
+    0xff, 0xfd, 0x97, 0x79, 0xdf, 0xf1, 0x0, 0x9f,
+    0xf9, 0x0, 0x0, 0x0, 0x35, 0x0, 0xb, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfb,
+    0x63, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xc9, 0x40, 0x0, 0x0, 0x3, 0xae, 0xff,
+    0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x1, 0x47,
+    0xbf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xf1, 0x6, 0xc4, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0x0, 0xef, 0xfe, 0xa8, 0x78, 0xbf, 0xff,
+    0x80, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x1, 0x7b, 0xdf, 0xfe, 0xc9, 0x30, 0x0,
+
+    /* U+0074 "t" */
+    0x0, 0x6, 0x88, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0x90, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x36, 0x6e, 0xff, 0x66,
+    0x66, 0x30, 0x0, 0xd, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xfa, 0x79, 0xe1, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x6, 0xcf, 0xfd, 0x81,
+
+    /* U+0075 "u" */
+    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x5f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf8,
+    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf8,
+    0xc, 0xff, 0xa0, 0x0, 0x0, 0x2d, 0xff, 0xf8,
+    0x3, 0xff, 0xfe, 0x86, 0x7a, 0xff, 0xef, 0xf8,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0xfc, 0x4f, 0xf8,
+    0x0, 0x1, 0x8c, 0xff, 0xeb, 0x50, 0x3f, 0xf8,
+
+    /* U+0076 "v" */
+    0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xf9, 0x6, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf2, 0x0, 0xef, 0xf0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xb0, 0x0, 0x8f, 0xf6, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x40, 0x0, 0x1f, 0xfd, 0x0,
+    0x0, 0x0, 0xe, 0xfd, 0x0, 0x0, 0xa, 0xff,
+    0x40, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x3,
+    0xff, 0xb0, 0x0, 0x0, 0xdf, 0xe0, 0x0, 0x0,
+    0x0, 0xcf, 0xf2, 0x0, 0x4, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x5f, 0xf8, 0x0, 0xb, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0x0, 0x2f, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x60, 0x9f,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd1,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xfb, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xf1, 0x0, 0x0, 0x0,
+
+    /* U+0077 "w" */
+    0xaf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0x94, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x5f, 0xf3, 0xe, 0xfc, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xb, 0xfd,
+    0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xf1, 0x0, 0x0, 0x1, 0xff, 0x70, 0x2, 0xff,
+    0x80, 0x0, 0x0, 0x5f, 0xf8, 0xff, 0x60, 0x0,
+    0x0, 0x7f, 0xf2, 0x0, 0xc, 0xfe, 0x0, 0x0,
+    0xb, 0xfd, 0xd, 0xfc, 0x0, 0x0, 0xd, 0xfb,
+    0x0, 0x0, 0x6f, 0xf4, 0x0, 0x2, 0xff, 0x70,
+    0x8f, 0xf2, 0x0, 0x3, 0xff, 0x60, 0x0, 0x1,
+    0xff, 0xa0, 0x0, 0x8f, 0xf1, 0x2, 0xff, 0x80,
+    0x0, 0x9f, 0xf0, 0x0, 0x0, 0xa, 0xff, 0x0,
+    0xd, 0xfb, 0x0, 0xb, 0xfe, 0x0, 0xe, 0xfa,
+    0x0, 0x0, 0x0, 0x4f, 0xf5, 0x4, 0xff, 0x50,
+    0x0, 0x5f, 0xf4, 0x5, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0xef, 0xb0, 0xaf, 0xe0, 0x0, 0x0, 0xff,
+    0x90, 0xaf, 0xe0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0x2f, 0xf9, 0x0, 0x0, 0x9, 0xff, 0x1f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0xff, 0x20,
+    0x0, 0x0, 0x3f, 0xfc, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x10, 0x0, 0x0,
+
+    /* U+0078 "x" */
+    0xd, 0xff, 0x50, 0x0, 0x0, 0x0, 0xbf, 0xf6,
+    0x0, 0x2f, 0xff, 0x20, 0x0, 0x0, 0x7f, 0xfa,
+    0x0, 0x0, 0x5f, 0xfc, 0x0, 0x0, 0x3f, 0xfd,
+    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x1e, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0xdf, 0xf5, 0xb, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xfc, 0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xfe, 0x10, 0x8f, 0xfa, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0x40, 0x0, 0xbf, 0xf6, 0x0, 0x0, 0xa,
+    0xff, 0x80, 0x0, 0x1, 0xef, 0xf3, 0x0, 0x6,
+    0xff, 0xc0, 0x0, 0x0, 0x4, 0xff, 0xe1, 0x3,
+    0xff, 0xe1, 0x0, 0x0, 0x0, 0x8, 0xff, 0xb0,
+
+    /* U+0079 "y" */
+    0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xf9, 0x6, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf2, 0x0, 0xef, 0xf1, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xb0, 0x0, 0x8f, 0xf7, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x40, 0x0, 0x1f, 0xfd, 0x0,
+    0x0, 0x0, 0xe, 0xfd, 0x0, 0x0, 0xa, 0xff,
+    0x50, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x3,
+    0xff, 0xc0, 0x0, 0x0, 0xcf, 0xe0, 0x0, 0x0,
+    0x0, 0xcf, 0xf2, 0x0, 0x3, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x5f, 0xf9, 0x0, 0xa, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0x10, 0x1f, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x70, 0x8f,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xe0,
+    0xef, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xfb, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x4, 0x0, 0x0, 0x6f, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xe9, 0x7a, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbe, 0xfd,
+    0x92, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+007A "z" */
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x36, 0x66,
+    0x66, 0x66, 0x6c, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0x75, 0x55, 0x55,
+    0x55, 0x52, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+
+    /* U+00B0 "°" */
+    0x0, 0x3, 0x78, 0x61, 0x0, 0x0, 0x1b, 0xff,
+    0xff, 0xf6, 0x0, 0xb, 0xf8, 0x20, 0x4d, 0xf5,
+    0x4, 0xf8, 0x0, 0x0, 0x1e, 0xd0, 0x9f, 0x20,
+    0x0, 0x0, 0x9f, 0x29, 0xf1, 0x0, 0x0, 0x8,
+    0xf2, 0x7f, 0x50, 0x0, 0x0, 0xcf, 0x1, 0xfe,
+    0x20, 0x0, 0x8f, 0x90, 0x4, 0xff, 0xca, 0xef,
+    0xc0, 0x0, 0x2, 0xae, 0xfd, 0x70, 0x0,
+
+    /* U+F00C "<symbol>" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xfd, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x6e, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x6,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
+    0xa0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xfa,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xa3,
+    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xad,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+F077 "<symbol>" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xde, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
+    0xff, 0xa6, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0xff, 0xfa, 0x0, 0x6f,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xff, 0xff, 0xa0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xf3, 0x0, 0x1,
+    0xdf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xff, 0x30, 0x1d, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xf3, 0x9f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xfd, 0x6f, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xfa, 0x8, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xb0,
+    0x0, 0x56, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x46, 0x0,
+
+    /* U+F078 "<symbol>" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xde, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xce, 0x40, 0x1e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xf4, 0x9f,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xff, 0xfd, 0x5f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff,
+    0xf9, 0x7, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xff, 0xff, 0xa0, 0x0, 0x7f,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf3, 0x0, 0x1d,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0x31, 0xdf, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xfd, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x56, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 129, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 405, .box_w = 24, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 252, .adv_w = 101, .box_w = 4, .box_h = 9, .ofs_x = 1, .ofs_y = 12},
+    {.bitmap_index = 270, .adv_w = 184, .box_w = 9, .box_h = 3, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 284, .adv_w = 109, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 297, .adv_w = 169, .box_w = 13, .box_h = 28, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 479, .adv_w = 320, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 668, .adv_w = 178, .box_w = 8, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 752, .adv_w = 276, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 931, .adv_w = 275, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1099, .adv_w = 321, .box_w = 19, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1299, .adv_w = 276, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1478, .adv_w = 296, .box_w = 17, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1657, .adv_w = 287, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1836, .adv_w = 309, .box_w = 17, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2015, .adv_w = 296, .box_w = 18, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2204, .adv_w = 109, .box_w = 5, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2244, .adv_w = 279, .box_w = 14, .box_h = 15, .ofs_x = 2, .ofs_y = 3},
+    {.bitmap_index = 2349, .adv_w = 351, .box_w = 23, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 2591, .adv_w = 363, .box_w = 19, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 2791, .adv_w = 347, .box_w = 20, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3001, .adv_w = 396, .box_w = 21, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 3222, .adv_w = 322, .box_w = 16, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 3390, .adv_w = 305, .box_w = 15, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 3548, .adv_w = 390, .box_w = 19, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 3748, .adv_w = 149, .box_w = 4, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 3790, .adv_w = 345, .box_w = 19, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 3990, .adv_w = 285, .box_w = 15, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4148, .adv_w = 458, .box_w = 23, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4390, .adv_w = 390, .box_w = 19, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4590, .adv_w = 403, .box_w = 23, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4832, .adv_w = 347, .box_w = 18, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5021, .adv_w = 349, .box_w = 18, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5210, .adv_w = 298, .box_w = 17, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5389, .adv_w = 282, .box_w = 18, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5578, .adv_w = 380, .box_w = 19, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5778, .adv_w = 342, .box_w = 23, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6020, .adv_w = 540, .box_w = 33, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6367, .adv_w = 323, .box_w = 20, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6577, .adv_w = 160, .box_w = 7, .box_h = 28, .ofs_x = 3, .ofs_y = -6},
+    {.bitmap_index = 6675, .adv_w = 160, .box_w = 7, .box_h = 28, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 6773, .adv_w = 240, .box_w = 15, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 6788, .adv_w = 287, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6908, .adv_w = 327, .box_w = 18, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7106, .adv_w = 274, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7234, .adv_w = 327, .box_w = 17, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7421, .adv_w = 294, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7557, .adv_w = 169, .box_w = 12, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7689, .adv_w = 331, .box_w = 17, .box_h = 22, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 7876, .adv_w = 327, .box_w = 16, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8052, .adv_w = 134, .box_w = 5, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8107, .adv_w = 296, .box_w = 17, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8294, .adv_w = 134, .box_w = 4, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8338, .adv_w = 507, .box_w = 28, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8562, .adv_w = 327, .box_w = 16, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8690, .adv_w = 305, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8826, .adv_w = 327, .box_w = 18, .box_h = 22, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 9024, .adv_w = 327, .box_w = 17, .box_h = 22, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 9211, .adv_w = 197, .box_w = 10, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9291, .adv_w = 240, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9411, .adv_w = 199, .box_w = 12, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9531, .adv_w = 325, .box_w = 16, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9659, .adv_w = 268, .box_w = 18, .box_h = 16, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 9803, .adv_w = 432, .box_w = 27, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10019, .adv_w = 265, .box_w = 17, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10155, .adv_w = 268, .box_w = 18, .box_h = 22, .ofs_x = -1, .ofs_y = -6},
+    {.bitmap_index = 10353, .adv_w = 250, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10465, .adv_w = 201, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 11},
+    {.bitmap_index = 10520, .adv_w = 480, .box_w = 30, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10865, .adv_w = 420, .box_w = 26, .box_h = 17, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 11086, .adv_w = 420, .box_w = 26, .box_h = 17, .ofs_x = 0, .ofs_y = 3}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint8_t glyph_id_ofs_list_0[] = {
+    1, 0, 0, 0, 0, 2, 0, 3,
+    0, 0, 0, 0, 0, 4, 5, 6,
+    7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 0, 18, 0, 0, 0,
+    0, 19, 20, 21, 22, 23, 24, 0,
+    25, 26, 0, 27, 28, 29, 30, 31,
+    32, 0, 33, 34, 35, 36, 37, 38,
+    39, 0, 0, 40, 0, 41, 0, 42,
+    0, 43, 44, 45, 46, 47, 48, 49,
+    50, 51, 0, 52, 53, 54, 55, 56,
+    57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67
+};
+
+static const uint16_t unicode_list_1[] = {
+    0x0, 0xef5c, 0xefc7, 0xefc8
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 91, .glyph_id_start = 0,
+        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_0, .list_length = 91, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
+    },
+    {
+        .range_start = 176, .range_length = 61385, .glyph_id_start = 68,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 4, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 3, 1, 4, 5, 6, 7,
+    0, 8, 9, 10, 11, 12, 13, 14,
+    7, 15, 0, 17, 18, 19, 16, 20,
+    21, 22, 22, 24, 25, 22, 22, 16,
+    26, 27, 2, 28, 23, 29, 29, 30,
+    31, 32, 33, 34, 35, 36, 37, 38,
+    39, 40, 34, 41, 42, 37, 34, 34,
+    35, 35, 43, 44, 45, 46, 40, 47,
+    47, 48, 47, 49, 50, 0, 0, 0
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 3, 1, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 7, 13, 14,
+    15, 16, 0, 18, 19, 17, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 17,
+    19, 19, 2, 20, 21, 22, 22, 23,
+    24, 25, 26, 27, 28, 29, 29, 29,
+    0, 29, 28, 30, 28, 28, 31, 31,
+    29, 31, 29, 31, 32, 33, 34, 35,
+    35, 36, 35, 37, 38, 0, 0, 0
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    22, 0, 13, 0, -26, -29, 3, 23,
+    11, 8, -19, 3, 24, 1, 20, 5,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    4, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 10, -14, 0,
+    0, 8, 10, 0, 0, -5, 0, -3,
+    5, 0, -5, 0, -5, -2, 0, 0,
+    0, -5, 0, 0, -6, 0, 0, -10,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -5, -5, 0, -7, -13, 0, -58, 10,
+    14, 0, 0, -10, 5, 5, 16, 10,
+    -8, 10, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -13, 0, 0, -18, 1, -3, 0,
+    3, -9, -6, -10, 3, 0, -5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -26, 0, -30, -3, 0, 48, -6, -6,
+    5, 5, -4, 0, -6, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -30, 29, 0,
+    0, -33, -47, -33, -10, 14, 0, 0,
+    -32, 0, 6, -11, 0, -7, 0, 0,
+    0, 0, 0, 0, 0, 0, 14, -59,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 23, 3, 0, 0, 3,
+    -6, -10, 0, -1, -1, -5, 0, 0,
+    -3, 0, 0, 0, 0, -4, 0, -10,
+    0, -12, -16, 0, 0, -10, 0, 0,
+    0, 0, 0, 0, 5, 0, 3, -5,
+    0, 1, 0, 0, 5, -3, 5, 5,
+    -1, 0, 0, 0, -9, 0, -1, 0,
+    0, 0, 0, 1, 0, -3, 0, -6,
+    0, 0, 0, 14, 0, 0, -5, 0,
+    0, 0, 0, -1, 1, -3, -3, 0,
+    -5, 0, -5, 0, 0, 0, 0, 0,
+    -2, -2, 0, -5, -6, 0, 0, 0,
+    0, 1, 0, -3, 0, -5, -5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -6, 0, -7, -14, -3,
+    -14, 5, 10, 13, 0, -12, -1, -6,
+    0, -1, -23, 5, -3, 3, 5, 0,
+    0, -25, 0, -25, -4, 0, 0, 10,
+    13, 0, 6, 0, 0, 0, 1, 0,
+    -9, -6, 0, -14, 0, 0, -5, 0,
+    0, 0, 0, 0, -2, -2, 0, -2,
+    -6, 0, 0, 0, 0, 0, 0, -5,
+    0, -3, -6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -4, -4,
+    0, -6, -3, 0, -10, 2, 5, 5,
+    0, 0, 0, 0, 0, 0, -3, 0,
+    0, 0, 0, 3, 0, -5, 0, -5,
+    -3, 0, 0, 0, 0, 0, 4, 0,
+    0, 0, 0, 0, -5, -7, 0, -9,
+    14, -3, 1, -24, -25, -20, -10, 5,
+    0, -4, -31, -9, 0, -9, 0, -10,
+    -9, -31, 0, 0, 0, 2, -1, 0,
+    0, -14, -18, 0, -24, -12, -12, -14,
+    -6, -13, -1, -9, -13, 3, 1, 0,
+    -5, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2,
+    0, -5, 0, -8, -11, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, -3, 0, 0, 5, 0, 0, 0,
+    0, 23, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -9, 0, 0, 3, -10, -10,
+    0, -5, -5, -6, 0, 0, 0, 0,
+    0, 0, 0, -5, 0, -5, 0, -11,
+    -12, 0, 0, -14, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, -6, 0, 5,
+    -21, 0, 0, -9, 16, 14, -4, -20,
+    0, 5, -7, 0, -24, -2, -6, 5,
+    -5, 6, 0, -17, -7, -18, -16, 0,
+    0, 27, 0, 0, -2, 0, 0, -2,
+    -2, -5, -13, -16, -1, -45, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -5, 0, -2, -5, 0, 0, -5,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1,
+    6, 0, -11, 5, -3, -1, -12, -5,
+    0, -6, -5, -3, -7, -8, 0, -4,
+    -1, -3, -8, 0, 0, 5, -3, 0,
+    -11, 0, 0, -10, 0, -8, 0, -8,
+    -8, 5, 0, 0, 0, -10, 5, 0,
+    -7, 0, -3, -6, -15, -3, -3, -3,
+    -1, -3, -1, 0, 0, 0, 0, -5,
+    -4, 0, 0, 6, -3, 0, -3, 0,
+    0, -3, -6, -3, -4, -6, -4, 0,
+    19, -1, 0, 0, -5, -20, -6, 7,
+    0, 0, -23, -8, 5, -8, 3, 0,
+    -4, -15, 0, 2, 0, 0, -8, 0,
+    5, -10, -9, 0, -8, -5, -5, -5,
+    0, -8, 2, -9, -8, 14, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -4, -5, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -7, 0, -6,
+    0, 0, -5, 0, 0, -5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -3,
+    0, 0, 0, -7, 0, -16, 0, 3,
+    -11, 10, 1, -3, -23, 0, 0, -11,
+    -5, 0, -12, -13, 0, -21, -5, -19,
+    -18, -12, 4, 32, -6, 0, -11, -5,
+    -5, -8, -13, -9, -18, -20, -11, -5,
+    0, -3, 0, -4, 14, 11, -11, -18,
+    0, 1, -15, 0, -24, -3, -5, 10,
+    -6, 1, 0, -31, -6, -25, -5, 0,
+    0, 28, 1, 0, -3, 0, 0, 0,
+    -2, -3, -18, -3, 0, -31, 0, 0,
+    0, -1, -13, -23, 0, 0, -2, -7,
+    -14, -5, 0, -3, 0, 0, 0, -22,
+    -5, -15, -4, -8, -12, 0, -4, -16,
+    -7, 0, -6, -9, -9, 0, 2, 0,
+    -3, -16, 0, 10, 0, 0, 0, -1,
+    0, 0, 0, 0, 0, -3, -10, 0,
+    0, 0, 0, 0, 0, 0, 0, -5,
+    0, 0, -10, 0, 0, 8, -2, 0,
+    0, 0, 0, 0, 2, 0, 0, 0,
+    0, 7, 4, -4, 0, -16, -15, -10,
+    -10, 19, 9, 5, -42, -3, 10, -5,
+    0, -5, -5, -17, 0, 5, -6, -4,
+    -14, 0, 10, 0, -13, 0, -26, -6,
+    -6, -18, 1, -6, -16, -16, -5, 19,
+    0, -7, 0, -11, -18, -19, -12, 14,
+    0, 1, -35, -4, 5, -8, -3, -11,
+    -11, -18, -7, -4, 0, 0, -11, 0,
+    11, -5, -26, 0, -26, -7, -17, -28,
+    -1, -15, -8, -16, -13, 13, 0, -6,
+    0, -9, 0, 8, -16, 5, 0, 0,
+    -25, 0, -5, -11, -8, -3, -12, -16,
+    -11, -14, -5, -11, -9, 0, 1, 23,
+    -8, 0, -14, -5, -5, -10, -11, -13,
+    -13, -18, -6, -10, 4, 0, 0, -4,
+    0, 18, 0, 9, 1, 1, -6, 0,
+    10, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 13, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -8, 0, 0,
+    -9, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -3, 0, -13, 0, 5, 62, -10, -4,
+    15, 13, -13, 5, 0, 0, 5, 5,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    13, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -13, 0, 0, 0, 0, -11, -2, 0,
+    0, 0, -11, 0, -6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    -5, 0, 0, -9, -7, 0, -13, 5,
+    -6, 0, 0, -13, -5, -11, 0, 0,
+    -13, 0, -5, 0, 0, -5, 0, -39,
+    -9, -19, -5, 0, 0, -13, -2, 0,
+    0, 0, 0, 0, 0, 0, -7, -9,
+    -4, -8, 0, 0, 0, -5, 10, 0,
+    -3, -11, -3, -8, -9, 0, -6, -2,
+    -3, 3, -1, 0, 0, -42, -4, -7,
+    0, -3, -4, 0, 0, -3, -4, 0,
+    0, 0, 3, 0, -3, -8, -3, 8,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    6, 0, 0, 0, 0, 0, -11, 0,
+    -3, 5, 0, 0, 0, -13, -5, -10,
+    0, 0, -13, 0, -5, 0, 0, 0,
+    0, -47, 0, -10, -18, 0, 0, -3,
+    -7, 0, 0, 0, 0, 0, 0, 0,
+    -5, -7, -2, -7, 0, 0, 8, -5,
+    -5, -14, 6, 24, 8, 11, -13, 6,
+    20, 6, 14, 11, 0, 0, 0, 0,
+    0, 0, 0, 0, 23, -9, -5, 0,
+    -4, 38, 38, 0, 0, 0, 5, 0,
+    0, 18, 0, -8, 0, 0, 0, 0,
+    0, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -40, -6, -4,
+    -20, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -8, 0, 0, 0, 0, 0, -3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -40, -6, -4, -20, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -11, 5, 0, -5, 4, 9, 5,
+    -14, 0, -1, -4, 5, 0, 0, 0,
+    0, -12, 0, -4, -3, -4, 0, 30,
+    -5, 0, -11, -3, -3, -8, 0, -5,
+    -13, -10, -6, 0, 0, -8, 0, 0,
+    0, 0, 0, -3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -40,
+    -6, -4, -20, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -8, 0, -4, -5, -19,
+    1, -3, 1, -3, -13, 1, 11, 1,
+    4, 1, -12, -19, -6, -18, -9, -13,
+    -20, -8, -6, -6, -4, -3, -6, -3,
+    -3, -1, 7, 0, 7, -3, 0, 15,
+    0, 0, 0, 0, 0, 0, 0, -3,
+    -5, -5, 0, 0, -13, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -5, -5, 0, -6, 0, 0,
+    0, -5, 5, 0, -8, -9, -3, 0,
+    -14, -3, -11, -3, -6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 15,
+    0, 0, -9, 0, 0, 0, -6, 0,
+    -5, 0, 0, -2, 0, -3, 0, -6,
+    -16, -15, 3, 5, 5, -1, -13, 3,
+    7, 3, 14, 3, -3, -13, 0, -19,
+    0, 0, -14, 0, 0, -6, -8, 0,
+    -7, 0, 0, -3, 7, 0, -4, -14,
+    -5, 18, 0, -4, 0, -11, 0, 5,
+    -5, 4, 0, 0, -16, 0, -3, -1,
+    0, -5, -4, 0, 0, -20, -6, -11,
+    0, 0, 0, 18, -5, 0, -9, 0,
+    0, -5, 0, -5, -14, 0, -5, 5,
+    0, 0, 0, -6, 1, 0, 0, -6,
+    -3, 0, -6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 11, 0, 0, -4, 0, 0, 0,
+    1, 0, -5, -5, 0, 0, 10, 0,
+    11, 0, -30, -27, 1, 21, 14, 8,
+    -19, 3, 20, 0, 18, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0
+};
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 50,
+    .right_class_cnt     = 38,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+const lv_font_t lv_font_montserrat_30 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 33,
+    .base_line = 6,
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -2,
+    .underline_thickness = 2,
+    .dsc = &font_dsc,
+    .fallback = &lv_font_montserrat_16,
+};
+
+#endif /*CYD_FONT_SUBSET*/
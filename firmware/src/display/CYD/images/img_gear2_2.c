@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * Image: assets/gear2-2.png (50x50)
+ * Encoding: RLE indexed, I8; 1109 bytes (5000 unpacked)
+ * Generated by tools/pack_images.py. Do not edit.
+ ******************************************************************************/
+
+#include <lvgl.h>
+#include "cyd_imgcache.h"
+
+#if !LV_USE_RLE
+#error "packed images need LV_USE_RLE"
+#endif
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t ui_img_314706763_data[] = {
+    0x01, 0x00, 0x00, 0x00, 0x49, 0x04, 0x00, 0x00, 0xc4, 0x0d, 0x00, 0x00, 0x04, 0xff, 0x03, 0xe7,
+    0xcd, 0xff, 0x84, 0x86, 0x84, 0xff, 0x39, 0x38, 0x39, 0xff, 0x42, 0x45, 0x42, 0xff, 0x39, 0x3c,
+    0x39, 0xff, 0xad, 0xaa, 0xad, 0xff, 0x52, 0x51, 0x52, 0xff, 0x42, 0x41, 0x42, 0xff, 0x31, 0x34,
+    0x31, 0xff, 0x6b, 0x6d, 0x6b, 0xff, 0xf7, 0xf3, 0xf7, 0xff, 0x63, 0x65, 0x63, 0xff, 0x7b, 0x79,
+    0x7b, 0xff, 0xce, 0xcf, 0xce, 0xff, 0x4a, 0x49, 0x4a, 0xff, 0xef, 0xeb, 0xef, 0xff, 0xbd, 0xbe,
+    0xbd, 0xff, 0xde, 0xd7, 0xde, 0xff, 0x94, 0x96, 0x94, 0xff, 0x5a, 0x59, 0x5a, 0xff, 0x7f, 0x00,
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x2d, 0x00,
+    0x06, 0x01, 0x2b, 0x00, 0x82, 0x02, 0x03, 0x04, 0x04, 0x82, 0x05, 0x06, 0x2a, 0x00, 0x82, 0x07,
+    0x03, 0x04, 0x08, 0x82, 0x09, 0x0a, 0x29, 0x00, 0x83, 0x0b, 0x07, 0x05, 0x03, 0x08, 0x83, 0x04,
+    0x03, 0x0c, 0x29, 0x00, 0x82, 0x01, 0x04, 0x05, 0x08, 0x82, 0x05, 0x07, 0x1f, 0x00, 0x83, 0x0b,
+    0x0d, 0x02, 0x07, 0x00, 0x82, 0x0e, 0x03, 0x05, 0x08, 0x83, 0x05, 0x0f, 0x10, 0x06, 0x00, 0x83,
+    0x10, 0x0d, 0x02, 0x14, 0x00, 0x86, 0x0b, 0x0c, 0x09, 0x09, 0x0c, 0x10, 0x05, 0x00, 0x83, 0x11,
+    0x09, 0x04, 0x05, 0x08, 0x82, 0x05, 0x12, 0x05, 0x00, 0x85, 0x12, 0x07, 0x09, 0x09, 0x0d, 0x12,
+    0x00, 0x88, 0x0b, 0x0c, 0x09, 0x04, 0x04, 0x03, 0x0f, 0x0e, 0x04, 0x00, 0x83, 0x06, 0x09, 0x04,
+    0x04, 0x08, 0x83, 0x04, 0x03, 0x11, 0x04, 0x00, 0x87, 0x11, 0x08, 0x03, 0x04, 0x04, 0x09, 0x0d,
+    0x10, 0x00, 0x8e, 0x0b, 0x0c, 0x09, 0x04, 0x08, 0x08, 0x04, 0x05, 0x05, 0x06, 0x00, 0x11, 0x0a,
+    0x04, 0x08, 0x08, 0x8d, 0x0f, 0x0d, 0x0e, 0x00, 0x13, 0x09, 0x08, 0x04, 0x08, 0x08, 0x04, 0x09,
+    0x0d, 0x0f, 0x00, 0x83, 0x0a, 0x09, 0x04, 0x04, 0x08, 0x86, 0x04, 0x05, 0x05, 0x14, 0x09, 0x09,
+    0x09, 0x08, 0x85, 0x05, 0x09, 0x05, 0x14, 0x03, 0x06, 0x08, 0x83, 0x04, 0x09, 0x02, 0x0e, 0x00,
+    0x83, 0x0c, 0x03, 0x04, 0x07, 0x08, 0x83, 0x05, 0x04, 0x04, 0x0a, 0x08, 0x84, 0x04, 0x08, 0x05,
+    0x04, 0x06, 0x08, 0x83, 0x04, 0x09, 0x02, 0x0e, 0x00, 0x84, 0x01, 0x0f, 0x05, 0x04, 0x1c, 0x08,
+    0x84, 0x04, 0x03, 0x14, 0x0b, 0x0f, 0x00, 0x82, 0x0e, 0x03, 0x1d, 0x08, 0x83, 0x05, 0x04, 0x01,
+    0x11, 0x00, 0x83, 0x06, 0x09, 0x04, 0x0b, 0x08, 0x04, 0x04, 0x0c, 0x08, 0x82, 0x03, 0x11, 0x13,
+    0x00, 0x83, 0x02, 0x03, 0x04, 0x08, 0x08, 0x82, 0x04, 0x03, 0x04, 0x09, 0x82, 0x05, 0x04, 0x08,
+    0x08, 0x83, 0x04, 0x03, 0x06, 0x14, 0x00, 0x83, 0x0b, 0x0f, 0x05, 0x06, 0x08, 0x8c, 0x04, 0x05,
+    0x09, 0x14, 0x02, 0x13, 0x13, 0x02, 0x07, 0x09, 0x05, 0x04, 0x06, 0x08, 0x82, 0x03, 0x14, 0x15,
+    0x00, 0x83, 0x06, 0x09, 0x04, 0x05, 0x08, 0x84, 0x04, 0x03, 0x07, 0x11, 0x05, 0x00, 0x85, 0x0b,
+    0x06, 0x0f, 0x03, 0x04, 0x06, 0x08, 0x82, 0x05, 0x0e, 0x14, 0x00, 0x83, 0x0c, 0x03, 0x04, 0x04,
+    0x08, 0x84, 0x04, 0x03, 0x0a, 0x0b, 0x08, 0x00, 0x84, 0x01, 0x14, 0x03, 0x04, 0x04, 0x08, 0x83,
+    0x04, 0x09, 0x0d, 0x10, 0x00, 0x84, 0x0b, 0x01, 0x12, 0x06, 0x06, 0x08, 0x83, 0x04, 0x03, 0x14,
+    0x0b, 0x00, 0x83, 0x01, 0x0f, 0x05, 0x05, 0x08, 0x86, 0x05, 0x0f, 0x11, 0x12, 0x01, 0x0b, 0x09,
+    0x00, 0x87, 0x13, 0x0c, 0x14, 0x07, 0x04, 0x05, 0x03, 0x07, 0x08, 0x82, 0x03, 0x0e, 0x0c, 0x00,
+    0x83, 0x06, 0x09, 0x04, 0x06, 0x08, 0x87, 0x03, 0x05, 0x04, 0x07, 0x14, 0x0c, 0x06, 0x05, 0x00,
+    0x88, 0x0e, 0x09, 0x03, 0x03, 0x05, 0x08, 0x08, 0x04, 0x05, 0x08, 0x83, 0x04, 0x03, 0x0c, 0x0d,
+    0x00, 0x83, 0x0b, 0x07, 0x05, 0x06, 0x08, 0x88, 0x04, 0x08, 0x08, 0x05, 0x05, 0x09, 0x05, 0x10,
+    0x04, 0x00, 0x84, 0x0e, 0x05, 0x04, 0x04, 0x09, 0x08, 0x83, 0x04, 0x09, 0x13, 0x0e, 0x00, 0x83,
+    0x0d, 0x09, 0x04, 0x09, 0x08, 0x84, 0x04, 0x08, 0x0f, 0x01, 0x04, 0x00, 0x82, 0x0e, 0x03, 0x0b,
+    0x08, 0x83, 0x04, 0x09, 0x11, 0x0e, 0x00, 0x83, 0x13, 0x09, 0x04, 0x0b, 0x08, 0x82, 0x04, 0x01,
+    0x04, 0x00, 0x82, 0x0e, 0x03, 0x0b, 0x08, 0x83, 0x04, 0x09, 0x11, 0x0e, 0x00, 0x83, 0x13, 0x09,
+    0x04, 0x0b, 0x08, 0x82, 0x0f, 0x01, 0x04, 0x00, 0x83, 0x0e, 0x05, 0x04, 0x0a, 0x08, 0x83, 0x04,
+    0x09, 0x13, 0x0e, 0x00, 0x83, 0x0d, 0x09, 0x04, 0x09, 0x08, 0x84, 0x04, 0x08, 0x0f, 0x01, 0x04,
+    0x00, 0x88, 0x0e, 0x09, 0x05, 0x05, 0x08, 0x08, 0x04, 0x04, 0x05, 0x08, 0x83, 0x04, 0x03, 0x0a,
+    0x0d, 0x00, 0x83, 0x0b, 0x07, 0x05, 0x06, 0x08, 0x88, 0x04, 0x04, 0x08, 0x05, 0x05, 0x03, 0x05,
+    0x01, 0x04, 0x00, 0x88, 0x0b, 0x0d, 0x14, 0x07, 0x04, 0x05, 0x03, 0x09, 0x07, 0x08, 0x82, 0x05,
+    0x12, 0x0c, 0x00, 0x83, 0x11, 0x09, 0x04, 0x06, 0x08, 0x87, 0x09, 0x03, 0x05, 0x04, 0x07, 0x14,
+    0x13, 0x08, 0x00, 0x85, 0x0b, 0x01, 0x12, 0x0e, 0x06, 0x06, 0x08, 0x83, 0x04, 0x03, 0x0c, 0x0b,
+    0x00, 0x83, 0x10, 0x07, 0x05, 0x05, 0x08, 0x87, 0x05, 0x0f, 0x06, 0x0e, 0x12, 0x01, 0x0b, 0x0f,
+    0x00, 0x83, 0x14, 0x03, 0x04, 0x04, 0x08, 0x83, 0x04, 0x09, 0x0d, 0x09, 0x00, 0x84, 0x0b, 0x0c,
+    0x03, 0x04, 0x04, 0x08, 0x83, 0x04, 0x09, 0x0d, 0x14, 0x00, 0x83, 0x06, 0x09, 0x04, 0x05, 0x08,
+    0x84, 0x04, 0x09, 0x0c, 0x0e, 0x06, 0x00, 0x84, 0x11, 0x07, 0x03, 0x04, 0x06, 0x08, 0x82, 0x03,
+    0x0e, 0x14, 0x00, 0x83, 0x0b, 0x0f, 0x05, 0x06, 0x08, 0x8c, 0x04, 0x03, 0x03, 0x0c, 0x13, 0x06,
+    0x06, 0x13, 0x14, 0x03, 0x05, 0x04, 0x06, 0x08, 0x82, 0x03, 0x14, 0x15, 0x00, 0x83, 0x13, 0x03,
+    0x04, 0x07, 0x08, 0x83, 0x04, 0x08, 0x03, 0x04, 0x09, 0x82, 0x03, 0x04, 0x09, 0x08, 0x82, 0x05,
+    0x06, 0x13, 0x00, 0x82, 0x06, 0x09, 0x0b, 0x08, 0x06, 0x04, 0x0a, 0x08, 0x83, 0x05, 0x05, 0x0e,
+    0x11, 0x00, 0x82, 0x12, 0x05, 0x1c, 0x08, 0x84, 0x04, 0x05, 0x0f, 0x10, 0x0f, 0x00, 0x84, 0x10,
+    0x07, 0x05, 0x04, 0x1c, 0x08, 0x83, 0x04, 0x03, 0x0c, 0x0f, 0x00, 0x83, 0x0a, 0x09, 0x04, 0x07,
+    0x08, 0x83, 0x05, 0x04, 0x04, 0x0a, 0x08, 0x84, 0x04, 0x04, 0x05, 0x04, 0x06, 0x08, 0x83, 0x04,
+    0x09, 0x02, 0x0e, 0x00, 0x83, 0x0c, 0x09, 0x04, 0x06, 0x08, 0x84, 0x03, 0x0f, 0x09, 0x03, 0x0a,
+    0x08, 0x85, 0x09, 0x03, 0x0f, 0x03, 0x04, 0x05, 0x08, 0x83, 0x04, 0x09, 0x02, 0x0e, 0x00, 0x8d,
+    0x10, 0x14, 0x03, 0x04, 0x08, 0x08, 0x04, 0x05, 0x09, 0x13, 0x0b, 0x06, 0x14, 0x09, 0x08, 0x8d,
+    0x04, 0x0c, 0x11, 0x0b, 0x02, 0x09, 0x08, 0x04, 0x08, 0x08, 0x04, 0x09, 0x0a, 0x10, 0x00, 0x88,
+    0x10, 0x07, 0x03, 0x04, 0x04, 0x03, 0x04, 0x11, 0x04, 0x00, 0x83, 0x13, 0x09, 0x04, 0x04, 0x08,
+    0x83, 0x04, 0x03, 0x11, 0x04, 0x00, 0x87, 0x06, 0x03, 0x05, 0x04, 0x04, 0x09, 0x0a, 0x12, 0x00,
+    0x86, 0x10, 0x14, 0x09, 0x09, 0x07, 0x12, 0x05, 0x00, 0x83, 0x11, 0x09, 0x04, 0x05, 0x08, 0x82,
+    0x05, 0x12, 0x05, 0x00, 0x85, 0x0e, 0x0f, 0x03, 0x09, 0x0a, 0x14, 0x00, 0x84, 0x10, 0x0c, 0x0d,
+    0x0b, 0x06, 0x00, 0x82, 0x0e, 0x03, 0x05, 0x08, 0x83, 0x05, 0x0f, 0x10, 0x06, 0x00, 0x83, 0x01,
+    0x0c, 0x0d, 0x1f, 0x00, 0x82, 0x01, 0x04, 0x05, 0x08, 0x82, 0x05, 0x07, 0x29, 0x00, 0x83, 0x0b,
+    0x07, 0x05, 0x03, 0x08, 0x83, 0x04, 0x03, 0x0c, 0x2a, 0x00, 0x88, 0x07, 0x05, 0x04, 0x08, 0x08,
+    0x04, 0x03, 0x0a, 0x2a, 0x00, 0x82, 0x0d, 0x09, 0x04, 0x05, 0x82, 0x09, 0x13, 0x2a, 0x00, 0x81,
+    0x0b, 0x06, 0x12, 0x7b, 0x00,
+};
+
+const lv_image_dsc_t ui_img_314706763 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I8,
+    .header.flags = CYD_IMAGE_FLAGS_OPAQUE | LV_IMAGE_FLAGS_COMPRESSED,
+    .header.w = 50,
+    .header.h = 50,
+    .header.stride = 50,
+    .data_size = sizeof(ui_img_314706763_data),
+    .data = ui_img_314706763_data,
+};
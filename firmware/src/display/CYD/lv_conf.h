@@ -32,22 +32,59 @@
 #define LV_DRAW_SW_COMPLEX        1
 #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
 #define LV_DRAW_SW_TEXT_CACHE     1
+
+/* ESP32-S3 PIE blend loops (cyd_blend_s3.*); tools/strip_lvgl.py sets CYD_BLEND_S3 on S3 boards only.
+ * 16-byte aligned draw buffers let whole rows run on the vector unit. */
+#if defined(CYD_BLEND_S3) && CYD_BLEND_S3
+#define LV_USE_DRAW_SW_ASM        LV_DRAW_SW_ASM_CUSTOM
+#define LV_DRAW_SW_ASM_CUSTOM_INCLUDE "cyd_blend_s3.h"
+#define LV_DRAW_BUF_ALIGN         16
+#endif
 #define LV_USE_GPU_SDL            0
 #define LV_USE_DRAW_SDL           0
 
 #define LV_BUILD_EXAMPLES         0
 #define LV_USE_PERF_MONITOR       0
-#define LV_USE_OS                 LV_OS_NONE
 
-/* Fonts used by the generated UI */
-#define LV_FONT_MONTSERRAT_10     1
-#define LV_FONT_MONTSERRAT_12     1
-#define LV_FONT_MONTSERRAT_16     1
-#define LV_FONT_MONTSERRAT_18     1
-#define LV_FONT_MONTSERRAT_20     1
-#define LV_FONT_MONTSERRAT_24     1
-#define LV_FONT_MONTSERRAT_26     1
-#define LV_FONT_MONTSERRAT_30     1
+/* Software draw units. With more than one, LVGL runs on its FreeRTOS OSAL and each unit gets
+ * its own render task; the tasks are created without core affinity, so the scheduler spreads
+ * them over both cores while the LVGL task waits for the dispatch to finish. */
+#ifndef CYD_LVGL_DRAW_UNITS
+#define CYD_LVGL_DRAW_UNITS       1
+#endif
+#if CYD_LVGL_DRAW_UNITS > 1
+#define LV_USE_OS                 LV_OS_FREERTOS
+#define LV_DRAW_SW_DRAW_UNIT_CNT  CYD_LVGL_DRAW_UNITS
+#else
+#define LV_USE_OS                 LV_OS_NONE
+#define LV_DRAW_SW_DRAW_UNIT_CNT  1
+#endif
+
+/* Fonts used by the generated UI. With CYD_FONT_SUBSET the lv_font_montserrat_NN symbols come
+ * from fonts/, cut down by tools/subset_fonts.py to the glyphs the UI can show; 0 builds LVGL's
+ * full fonts instead. CYD_FONT_COMPRESSED is set by that script (custom_font_compress). */
+#ifndef CYD_FONT_SUBSET
+#define CYD_FONT_SUBSET           1
+#endif
+#ifndef CYD_FONT_COMPRESSED
+#define CYD_FONT_COMPRESSED       0
+#endif
+#if CYD_FONT_SUBSET
+#define LV_FONT_CUSTOM_DECLARE \
+    LV_FONT_DECLARE(lv_font_montserrat_10) LV_FONT_DECLARE(lv_font_montserrat_12) \
+    LV_FONT_DECLARE(lv_font_montserrat_16) LV_FONT_DECLARE(lv_font_montserrat_18) \
+    LV_FONT_DECLARE(lv_font_montserrat_20) LV_FONT_DECLARE(lv_font_montserrat_24) \
+    LV_FONT_DECLARE(lv_font_montserrat_26) LV_FONT_DECLARE(lv_font_montserrat_30)
+#define LV_USE_FONT_COMPRESSED    CYD_FONT_COMPRESSED
+#endif
+#define LV_FONT_MONTSERRAT_10     (!CYD_FONT_SUBSET)
+#define LV_FONT_MONTSERRAT_12     (!CYD_FONT_SUBSET)
+#define LV_FONT_MONTSERRAT_16     (!CYD_FONT_SUBSET)
+#define LV_FONT_MONTSERRAT_18     (!CYD_FONT_SUBSET)
+#define LV_FONT_MONTSERRAT_20     (!CYD_FONT_SUBSET)
+#define LV_FONT_MONTSERRAT_24     (!CYD_FONT_SUBSET)
+#define LV_FONT_MONTSERRAT_26     (!CYD_FONT_SUBSET)
+#define LV_FONT_MONTSERRAT_30     (!CYD_FONT_SUBSET)
 #define LV_FONT_DEFAULT           &lv_font_montserrat_16
 
 /* Widgets and themes */
@@ -76,6 +113,7 @@
 #define LV_USE_TEXTAREA           1
 
 #define LV_USE_IMGFONT            0
+#define LV_USE_SNAPSHOT           1  /* cyd_layercache */
 #define LV_USE_MSGBOX             1
 #define LV_USE_TABVIEW            1
 #define LV_USE_WIN                1
@@ -85,5 +123,7 @@
 #define LV_USE_BMP                0
 #define LV_USE_SJPG               0
 #define LV_USE_GIF                0
+/* Packed images (images/, tools/pack_images.py) are RLE-compressed; cyd_imgcache decodes them. */
+#define LV_USE_RLE                1
 
 #endif /* LV_CONF_H */
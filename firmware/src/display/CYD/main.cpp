@@ -7,12 +7,31 @@
 #include <WebServer.h>
 #include <DNSServer.h>
 #include <esp_heap_caps.h>
+#include <atomic>
+#include <cmath>
+#include <esp_pm.h>
+#include <esp_sleep.h>
+#include <driver/gpio.h>
 
 extern "C" {
 #include "ui.h"
 }
 #include "ui_custom.h"
 #include "cyd_state.h"
+#include "cyd_blend_s3.h"
+#include "cyd_layercache.h"
+#include "cyd_gauge.h"
+#include "cyd_imgcache.h"
+#include "cyd_label.h"
+#include "cyd_metrics.h"
+#include "cyd_screens.h"
+#include "cyd_swipe.h"
+#include "cyd_tilediff.h"
+#include "cyd_theme.h"
+#include "cyd_touch.h"
+#include "cyd_touchcal.h"
+#include "cyd_touchfilter.h"
+#include "cyd_ui_task.h"
 
 #ifndef CYD_PANEL_ST7789
 #define CYD_PANEL_ST7789 0
@@ -57,6 +76,85 @@ extern "C" {
 #define CYD_TOUCH_SHARED 0
 #endif
 
+// Most full-frame PSRAM buffers (1 or 2) the draw buffer planner may use for LVGL direct mode;
+// 0 keeps the draw buffers in internal RAM.
+#ifndef CYD_PSRAM_FRAMEBUFFERS
+#define CYD_PSRAM_FRAMEBUFFERS 0
+#endif
+
+// Skip SPI writes for screen tiles whose content has not changed since they were last sent.
+#ifndef CYD_FLUSH_TILE_DIFF
+#define CYD_FLUSH_TILE_DIFF 1
+#endif
+
+// Snapshot the static containers of each screen into PSRAM once per theme and draw them as one
+// image (see cyd_layercache.h). Needs PSRAM; ignored without it.
+#ifndef CYD_LAYER_CACHE
+#define CYD_LAYER_CACHE 1
+#endif
+
+// Draw the tank levels with cyd_gauge sprites instead of the generated lv_arc/lv_bar widgets.
+#ifndef CYD_LEVEL_GAUGE
+#define CYD_LEVEL_GAUGE 1
+#endif
+
+// Serial benchmark at boot comparing converted vs. panel-native flush throughput.
+#ifndef CYD_BENCH_FLUSH
+#define CYD_BENCH_FLUSH 0
+#endif
+
+// Serial benchmark at boot timing full redraws of the gauge and settings screens. Build once with
+// CYD_LVGL_DRAW_UNITS=1 and once with 2 to compare single- and dual-unit rendering.
+#ifndef CYD_BENCH_RENDER
+#define CYD_BENCH_RENDER 0
+#endif
+
+// Serial benchmark at boot comparing LVGL's scalar blend loops with the S3 PIE backend.
+#ifndef CYD_BENCH_BLEND
+#define CYD_BENCH_BLEND 0
+#endif
+
+// Serial benchmark at boot timing level updates of a stock lv_arc against a cyd_gauge.
+#ifndef CYD_BENCH_GAUGE
+#define CYD_BENCH_GAUGE 0
+#endif
+
+// Serial benchmark at boot timing redraws of a text-only screen in the UI's fonts. Build with
+// CYD_FONT_SUBSET=0 (LVGL's full fonts) and with custom_font_compress to compare.
+#ifndef CYD_BENCH_TEXT
+#define CYD_BENCH_TEXT 0
+#endif
+
+// De-jitter and motion prediction for touch points (cyd_touchfilter); 0 hands LVGL raw points.
+#ifndef CYD_TOUCH_FILTER
+#define CYD_TOUCH_FILTER 1
+#endif
+
+// Targets of the on-device touch calibration: 3 (exact fit) or 5 (least squares, rejects a bad tap).
+#ifndef CYD_TOUCH_CAL_POINTS
+#define CYD_TOUCH_CAL_POINTS 5
+#endif
+
+// Let the chip drop into automatic light sleep while the display sleeps (needs the touch IRQ
+// and an SDK built with power management + tickless idle).
+#ifndef CYD_LIGHT_SLEEP
+#define CYD_LIGHT_SLEEP 0
+#endif
+
+// Rough board current model for the stats log (mA); calibrate against a USB meter.
+#ifndef CYD_EST_BASE_MA
+#define CYD_EST_BASE_MA 40  // both cores idle, radio idle, panel on
+#endif
+#ifndef CYD_EST_CPU_MA
+#define CYD_EST_CPU_MA 30  // extra for one fully busy core at 240 MHz
+#endif
+#ifndef CYD_EST_BACKLIGHT_MA
+#define CYD_EST_BACKLIGHT_MA 80  // backlight at full duty
+#endif
+
+// Raw touch bounds for a board without a stored calibration (cyd_touchcal); a calibration done on
+// the device (hold the CYD settings header, or keep a finger on the screen at power-up) replaces
+// them.
 #ifndef CYD_TOUCH_X_MIN
 #define CYD_TOUCH_X_MIN 3736
 #endif
@@ -72,12 +170,59 @@ extern "C" {
 
 constexpr uint16_t SCREEN_WIDTH = 240;
 constexpr uint16_t SCREEN_HEIGHT = 320;
-constexpr uint32_t LVGL_TICK_MS = 5;
-constexpr uint16_t DRAW_BUF_LINES = 16;  // lines per buffer; keeps RAM use reasonable
-constexpr uint8_t SETTINGS_VERSION = 1;
+constexpr uint16_t DRAW_BUF_LINES = 16;      // band height for the flush/blend benchmarks
+constexpr uint16_t DRAW_BUF_MIN_LINES = CYD_TILE_SIZE;  // one row of diff tiles
+constexpr size_t FRAMEBUFFER_BYTES = static_cast<size_t>(SCREEN_WIDTH) * SCREEN_HEIGHT * sizeof(uint16_t);
+constexpr size_t PSRAM_HEADROOM_BYTES = 64 * 1024;  // left free for other PSRAM users
+constexpr size_t INTERNAL_HEADROOM_BYTES = 96 * 1024;    // Wi-Fi, sockets and task stacks
+constexpr size_t INTERNAL_DRAW_BUF_MAX_BYTES = 64 * 1024;  // all bands together; taller bands stop paying off
+constexpr size_t IMAGE_CACHE_MAX_BYTES = 32 * 1024;  // decoded icons (cyd_imgcache)
+constexpr size_t SCREEN_CACHE_BYTES = 32 * 1024;     // LVGL heap for built screens (cyd_screens)
+constexpr uint32_t DRAW_BUF_BENCH_ROUNDS = 3;
+constexpr uint8_t DIRTY_AREA_MAX = 8;                // direct mode: areas tracked per refresh
+constexpr uint16_t DIRECT_STAGE_LINES = CYD_TILE_SIZE;  // direct mode: rows swapped per push
+// Wide enough for landscape rows.
+constexpr size_t DIRECT_STAGE_BYTES = static_cast<size_t>(SCREEN_HEIGHT) * DIRECT_STAGE_LINES * sizeof(uint16_t);
+constexpr int UI_TASK_CORE = 1;   // LVGL render, flush and touch
+constexpr int NET_TASK_CORE = 0;  // Wi-Fi onboarding (DNS + web server), next to the Wi-Fi stack
+constexpr int TOUCH_TASK_CORE = 0;  // touch sampler (cyd_touch); its bus reads never stall a render
+constexpr uint32_t NET_TASK_STACK_BYTES = 6144;
+constexpr uint32_t STATS_LOG_INTERVAL_MS = 5000;
+constexpr uint32_t PERF_HUD_REFRESH_MS = 1000;
+// Histogram buckets for durations: around the 16 ms frame period, then whole frames missed.
+constexpr uint32_t DURATION_BUCKETS_US[] = {1000, 2000, 4000, 8000, 16000, 33000, 66000, 133000};
+constexpr uint32_t REFR_PERIOD_INTERACTIVE_MS = 16;  // refresh ceiling while touched and shortly after
+constexpr uint32_t REFR_PERIOD_IDLE_MS = 100;        // refresh ceiling for data-driven updates
+constexpr uint32_t PANEL_SPI_WRITE_HZ = 40000000;
+// A whole RGB565 frame over the panel's SPI bus takes 30.7 ms, so about 30 fps is this panel's
+// ceiling for full-screen motion (swipes); only partial redraws keep up with the 16 ms period.
+constexpr uint32_t FULL_FRAME_PUSH_MS = static_cast<uint32_t>(
+    (static_cast<uint64_t>(SCREEN_WIDTH) * SCREEN_HEIGHT * 16 * 1000 + PANEL_SPI_WRITE_HZ - 1) / PANEL_SPI_WRITE_HZ);
+constexpr uint32_t INTERACTIVE_HOLD_MS = 2000;
+constexpr uint32_t TOUCH_SAMPLE_PERIOD_MS = REFR_PERIOD_INTERACTIVE_MS;  // while touched: one point per frame
+#if !CYD_TOUCH_FILTER
+constexpr cyd_touchfilter_cfg_t TOUCH_FILTER_CFG = CYD_TOUCHFILTER_OFF;
+#elif defined(CYD_TOUCH_FT5X06) && CYD_TOUCH_FT5X06
+constexpr cyd_touchfilter_cfg_t TOUCH_FILTER_CFG = CYD_TOUCHFILTER_FT5X06;
+#else
+constexpr cyd_touchfilter_cfg_t TOUCH_FILTER_CFG = CYD_TOUCHFILTER_XPT2046;
+#endif
+// The touch frame is the panel's frame turned by 180°, so that LVGL gets unrotated points in
+// every panel rotation.
+constexpr uint8_t TOUCH_ROTATION_OFFSET = 2;
+constexpr uint32_t TOUCH_CAL_HOLD_MS = 3000;        // hold on the CYD settings header to calibrate
+constexpr uint8_t TOUCH_CAL_SETTLE_SAMPLES = 2;     // per tap, skipped while the finger lands
+constexpr float TOUCH_CAL_MAX_ERROR_PX = 6.0f;      // 5-point fit residual above which a tap was off
+constexpr uint8_t TOUCH_CAL_MAX_REJECTS = 3;        // off-target rounds before the old calibration is kept
+constexpr uint32_t TOUCH_CAL_LIFT_MS = 100;         // power-up entry: finger off this long before tapping
+constexpr int32_t TOUCH_CAL_CROSS_PX = 25;          // odd, so the lines cross on the target pixel
+static_assert(CYD_TOUCH_CAL_POINTS == 3 || CYD_TOUCH_CAL_POINTS == 5, "CYD_TOUCH_CAL_POINTS must be 3 or 5");
+constexpr uint32_t PANEL_SLEEP_OUT_MS = 5;    // ILI9341/ST7789: wait after SLPOUT before writing
+constexpr uint8_t SETTINGS_VERSION = 3;  // 2: orientation_index, 3: draw buffer overrides
 constexpr const char *SETUP_FLAG_KEY = "setup_done";
 constexpr const char *WIFI_SSID_KEY = "wifi_ssid";
 constexpr const char *WIFI_PASS_KEY = "wifi_pass";
+constexpr const char *TOUCH_CAL_KEY = "touch_cal";
 
 struct CydSettings {
     uint8_t version = SETTINGS_VERSION;
@@ -85,7 +230,31 @@ struct CydSettings {
     uint8_t timeout_index = 0;     // 0: Never, 1:30s, 2:1m, 3:2m
     uint8_t theme_index = 0;       // 0: Light, 1: Dark
     uint8_t units_index = 0;       // 0: Metric (C), 1: Imperial (F)
+    uint8_t orientation_index = 0;  // 0: Portrait, 1: Inverted portrait, 2: Landscape
+    // Draw buffer overrides; 0 leaves the choice to the boot-time planner.
+    uint8_t draw_buf_region = 0;  // 1: internal RAM, 2: PSRAM
+    uint8_t draw_buf_count = 0;   // 1 or 2
+    uint16_t draw_buf_lines = 0;  // band height; SCREEN_HEIGHT selects full frames (direct mode)
 };
+constexpr size_t SETTINGS_V1_BYTES = offsetof(CydSettings, orientation_index);
+constexpr size_t SETTINGS_V2_BYTES = offsetof(CydSettings, draw_buf_region);
+
+enum DrawBufRegion : uint8_t { DRAW_BUF_AUTO = 0, DRAW_BUF_INTERNAL = 1, DRAW_BUF_PSRAM = 2 };
+
+struct DrawBufConfig {
+    uint8_t region = DRAW_BUF_INTERNAL;
+    uint8_t count = 2;
+    uint16_t lines = DRAW_BUF_MIN_LINES;
+
+    bool direct() const { return lines >= SCREEN_HEIGHT; }
+    size_t bytes() const { return static_cast<size_t>(SCREEN_WIDTH) * lines * sizeof(uint16_t); }
+};
+
+// Panel address-mode rotation per orientation_index. LVGL itself is never rotated: pixels leave
+// the draw buffers untouched and touch points are mapped through the same rotation (cyd_touchcal).
+constexpr uint8_t ORIENTATION_COUNT = 3;
+constexpr uint8_t ORIENTATION_LANDSCAPE = 2;
+constexpr uint8_t PANEL_ROTATION[ORIENTATION_COUNT] = {2, 0, 1};
 class LGFX_CYD : public lgfx::LGFX_Device {
 #if CYD_PANEL_ST7789
     lgfx::Panel_ST7789 _panel;
@@ -106,7 +275,7 @@ public:
             auto cfg = _bus.config();
             cfg.spi_host = CYD_TFT_SPI_HOST;
             cfg.spi_mode = 0;
-            cfg.freq_write = 40000000;
+            cfg.freq_write = PANEL_SPI_WRITE_HZ;
             cfg.freq_read = 16000000;
             cfg.spi_3wire = false;
             cfg.use_lock = true;
@@ -151,7 +320,6 @@ public:
             _panel.setLight(&_light);
         }
 
-        // Bind panel before applying touch calibration
         setPanel(&_panel);
 
         {
@@ -164,11 +332,7 @@ public:
             cfg.pin_int = CYD_TOUCH_IRQ;
             cfg.i2c_addr = 0x38;
             cfg.bus_shared = false;
-            cfg.x_min = CYD_TOUCH_X_MIN;
-            cfg.x_max = CYD_TOUCH_X_MAX;
-            cfg.y_min = CYD_TOUCH_Y_MIN;
-            cfg.y_max = CYD_TOUCH_Y_MAX;
-            cfg.offset_rotation = 0;  // no additional rotation; matches current panel setup
+            // Only raw points are read; cyd_touchcal maps them to the screen.
             _touch.config(cfg);
 #else
             auto cfg = _touch.config();
@@ -180,12 +344,6 @@ public:
             cfg.pin_cs = CYD_TOUCH_CS;
             cfg.pin_int = CYD_TOUCH_IRQ;
             cfg.bus_shared = CYD_TOUCH_SHARED;
-            cfg.offset_rotation = 0;
-            // Mirror X by swapping raw bounds (right touches map to higher raw values)
-            cfg.x_min = CYD_TOUCH_X_MIN;
-            cfg.x_max = CYD_TOUCH_X_MAX;
-            cfg.y_min = CYD_TOUCH_Y_MIN;
-            cfg.y_max = CYD_TOUCH_Y_MAX;
             _touch.config(cfg);
 #endif
             _panel.setTouch(&_touch);
@@ -196,18 +354,123 @@ public:
 static LGFX_CYD lcd;
 static lv_display_t *display = nullptr;
 static lv_indev_t *touch_indev = nullptr;
-static esp_timer_handle_t lvgl_tick_timer = nullptr;
 static Preferences prefs;
 static CydSettings settings;
 static uint32_t inactivity_timeout_ms = 0;
 static uint32_t last_activity_ms = 0;
 static uint32_t last_heap_log_ms = 0;
+static uint32_t last_stats_log_ms = 0;
+static TaskHandle_t net_task = nullptr;
 static bool display_sleep = false;
 static uint8_t current_brightness_duty = 255;
 static bool setup_complete = false;
+static bool refr_interactive = false;
+static lv_indev_state_t touch_state = LV_INDEV_STATE_RELEASED;
+static lv_point_t touch_point = {0, 0};
+static bool touch_wake_stroke = false;  // the touch that woke the display, up to its release
+static cyd_touchfilter_t touch_filter;
+static cyd_touchcal_t touch_cal_native;  // stored calibration, or the CYD_TOUCH_* bounds
+static cyd_touchcal_t touch_cal;         // touch_cal_native in the current panel rotation
+static uint8_t touch_rotation = 0;       // touch frame to screen, LovyanGFX numbering
+
+// On-device calibration: taps on CYD_TOUCH_CAL_POINTS crosses, averaged per tap in raw
+// coordinates, then fitted and stored under TOUCH_CAL_KEY. While it runs LVGL sees no touches.
+struct TouchCalCapture {
+    bool active = false;
+    bool skip_stroke = false;  // the touch that started the calibration, up to its release
+    uint8_t index = 0;         // target being tapped
+    uint8_t rejects = 0;       // rounds whose fit was off target
+    int16_t target_x[CYD_TOUCHCAL_MAX_POINTS];  // screen
+    int16_t target_y[CYD_TOUCHCAL_MAX_POINTS];
+    int16_t raw_x[CYD_TOUCHCAL_MAX_POINTS];
+    int16_t raw_y[CYD_TOUCHCAL_MAX_POINTS];
+    int32_t sum_x = 0;
+    int32_t sum_y = 0;
+    uint16_t samples = 0;  // in the current tap, settle samples included
+    cyd_screen_t return_to = CYD_SCREEN_COUNT;
+    lv_obj_t *screen = nullptr;
+    lv_obj_t *cross = nullptr;
+    lv_obj_t *label = nullptr;
+};
+static TouchCalCapture touch_cal_capture;
+static uint32_t touch_cal_hold_start_ms = 0;
+
+// Frame timing for the LVGL refresh cycle (render + flush). A "frame" is one refresh that
+// actually pushed pixels; idle refresh timer ticks are not counted.
+struct FrameStats {
+    int64_t refr_start_us = 0;
+    uint32_t frame_px = 0;      // pixels rendered and handed to the flush in the refresh in progress
+    uint32_t frames = 0;        // frames since the last log line
+    uint64_t total_us = 0;
+    uint32_t max_us = 0;
+    uint32_t last_full_us = 0;  // most recent full-screen redraw (e.g. screen change)
+    uint32_t invalidations = 0; // areas invalidated since the last log line
+    uint32_t flush_us = 0;      // in the flush and flush-wait callbacks during the refresh in progress
+};
+static FrameStats frame_stats;
+
+// Registry entries (cyd_metrics) for the [metrics] line and the performance HUD. All of them are
+// recorded on the LVGL task.
+struct Metrics {
+    cyd_metric_t frames = CYD_METRIC_NONE;     // refreshes that pushed pixels: FPS
+    cyd_metric_t render_us = CYD_METRIC_NONE;  // per frame, refresh time less the flush
+    cyd_metric_t flush_us = CYD_METRIC_NONE;   // per frame, pushing and waiting for the SPI DMA
+    cyd_metric_t spi_bytes = CYD_METRIC_NONE;  // pixel data sent to the panel
+    cyd_metric_t touch_us = CYD_METRIC_NONE;   // touch-to-press latency
+    cyd_metric_t loop_us = CYD_METRIC_NONE;    // LVGL task passes
+    cyd_metric_t lv_used = CYD_METRIC_NONE;    // LVGL pool bytes in use
+    cyd_metric_t lv_frag = CYD_METRIC_NONE;    // LVGL pool fragmentation, %
+    uint8_t serial_reader = CYD_METRIC_NONE;
+    uint8_t hud_reader = CYD_METRIC_NONE;
+};
+static Metrics metrics;
+
+// Performance HUD on the top layer, toggled by a long press on the home screen's settings gear.
+// Its own once-a-second redraw shows up in the numbers it reports.
+struct PerfHud {
+    lv_obj_t *label = nullptr;
+    lv_timer_t *timer = nullptr;
+    char text[320];
+};
+static PerfHud perf_hud;
+
+// Touch-to-press latency: from the IRQ (or polled read) that saw a touch to the LVGL read that
+// reports it pressed, in which LVGL sends LV_EVENT_PRESSED.
+struct TouchStats {
+    uint32_t presses = 0;
+    uint64_t total_us = 0;
+    uint32_t max_us = 0;
+    uint32_t coalesced = 0;  // drag points superseded by a newer one before LVGL read them
+};
+static TouchStats touch_stats;
+
+// Direct mode: invalidated areas collected over one refresh, pushed from the frame buffer on the
+// last flush of the refresh.
+struct DirtyAreas {
+    lv_area_t areas[DIRTY_AREA_MAX];
+    lv_area_t bounds;
+    uint32_t area_px = 0;  // sum of individual area sizes
+    uint8_t count = 0;
+    bool overflow = false;
+};
+static bool direct_mode = false;
+static DrawBufConfig draw_buf_cfg;
+static void *draw_buf_a = nullptr;
+static void *draw_buf_b = nullptr;
+static uint32_t draw_buf_bytes = 0;
+static DrawBufConfig draw_buf_alt;  // runner-up for the boot self-benchmark
+static bool draw_buf_alt_pending = false;
+static DirtyAreas dirty_areas;
+static uint16_t *direct_stage[2] = {};       // direct mode: DMA-capable rows in panel byte order
+static uint32_t direct_stage_push[2] = {};  // panel_pushes after each stage was last flushed
+static uint32_t panel_pushes = 0;
+
+enum OnboardingRequest : uint8_t { ONBOARDING_REQ_NONE = 0, ONBOARDING_REQ_START, ONBOARDING_REQ_STOP };
 
+// Owned by the network task; the UI only files start/stop requests.
 struct OnboardingContext {
     bool active = false;
+    std::atomic<uint8_t> request{ONBOARDING_REQ_NONE};
     String ap_ssid;
     String ap_pass;
     WebServer server{80};
@@ -223,13 +486,21 @@ static void mark_setup_complete_direct();
 static void log_heap_stats(const char *tag) {
     const size_t free_8bit = heap_caps_get_free_size(MALLOC_CAP_8BIT);
     const size_t largest_8bit = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    const size_t min_free_8bit = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
     const size_t free_psram = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
-    Serial.printf("[heap]%s free=%u largest=%u psram=%u\n", tag ? tag : "", static_cast<unsigned>(free_8bit),
-                  static_cast<unsigned>(largest_8bit), static_cast<unsigned>(free_psram));
+    cyd_ui_stats_t ui = {};
+    cyd_ui_take_stats(&ui);
+    const float load = ui.elapsed_us ? static_cast<float>(ui.busy_us) / ui.elapsed_us : 0.0f;
+    const float backlight = display_sleep ? 0.0f : current_brightness_duty / 255.0f;
+    const float est_ma = CYD_EST_BASE_MA + CYD_EST_CPU_MA * load + CYD_EST_BACKLIGHT_MA * backlight;
+    const uint32_t wakeups_per_s = ui.elapsed_us ? static_cast<uint32_t>(ui.wakeups * 1000000ULL / ui.elapsed_us) : 0;
+    Serial.printf("[heap]%s free=%u min=%u largest=%u psram=%u ui_load=%.1f%% wakeups=%lu/s est_current=%.0fmA\n",
+                  tag ? tag : "", static_cast<unsigned>(free_8bit), static_cast<unsigned>(min_free_8bit),
+                  static_cast<unsigned>(largest_8bit), static_cast<unsigned>(free_psram), load * 100.0f,
+                  static_cast<unsigned long>(wakeups_per_s), est_ma);
 }
 
-static void apply_brightness_from_slider(lv_obj_t *slider) {
-    int val = lv_slider_get_value(slider);
+static void apply_brightness(int val) {
     if (val < 0) val = 0;
     if (val > 100) val = 100;
     // Map 0–100% to 10–100% actual duty to avoid complete off
@@ -241,48 +512,1057 @@ static void apply_brightness_from_slider(lv_obj_t *slider) {
     last_activity_ms = millis();
 }
 
-static void lv_tick_cb(void * /*arg*/) {
-    lv_tick_inc(LVGL_TICK_MS);
+// LVGL reads the clock on demand instead of a periodic tick interrupt.
+static uint32_t lvgl_tick_get_cb() {
+    return millis();
 }
 
-static void lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
-    const uint32_t w = lv_area_get_width(area);
-    const uint32_t h = lv_area_get_height(area);
+// Touch sampler task (cyd_touch): one raw controller point. A controller on the panel's SPI bus
+// may only be read between LVGL passes.
+static bool read_touch_raw(int16_t *x, int16_t *y) {
+    lgfx::touch_point_t tp;
+    if (CYD_TOUCH_SHARED) cyd_ui_lock(portMAX_DELAY);
+    const bool touched = lcd.getTouchRaw(&tp, 1) > 0;
+    if (CYD_TOUCH_SHARED) cyd_ui_unlock();
+    *x = tp.x;
+    *y = tp.y;
+    return touched;
+}
+
+// Push a rectangle whose rows are stride pixels apart. LovyanGFX assumes packed rows, so wider
+// rows are pushed whole and trimmed with the clip rect. With swap565_t (panel byte order) the
+// pixels need no conversion and LovyanGFX DMAs them straight from px, one descriptor per row.
+template <typename T>
+static void push_rect_as(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *px, int32_t stride) {
+    cyd_metrics_add(metrics.spi_bytes, static_cast<uint32_t>(w * h) * sizeof(uint16_t));
+    panel_pushes++;
+    if (w == stride) {
+        lcd.pushImageDMA(x, y, w, h, reinterpret_cast<const T *>(px));
+        return;
+    }
+    lcd.setClipRect(x, y, w, h);
+    lcd.pushImageDMA(x, y, stride, h, reinterpret_cast<const T *>(px));
+    lcd.clearClipRect();
+}
+
+// Everything reaches the panel in its byte order: partial bands are swapped in place by
+// lvgl_flush_cb(), direct-mode areas through the stages (push_framebuffer_area()) and cyd_swipe's
+// snapshots when they are taken.
+static void push_rect(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *px, int32_t stride) {
+    push_rect_as<lgfx::swap565_t>(x, y, w, h, px, stride);
+}
+
+static void wait_panel_dma() {
+    lcd.waitDMA();
+}
+
+static void swipe_done() {
+    cyd_tilediff_invalidate_all();
+}
+
+static void flush_area(const lv_area_t *area, const uint16_t *px, int32_t stride) {
+    frame_stats.frame_px += lv_area_get_size(area);
+#if CYD_FLUSH_TILE_DIFF
+    cyd_tilediff_flush(area, px, stride);
+#else
+    push_rect(area->x1, area->y1, lv_area_get_width(area), lv_area_get_height(area), px, stride);
+#endif
+}
+
+// The direct-mode frame buffer stays in LVGL's byte order because LVGL blends on top of it. Its
+// rows are copied a tile row at a time into one of two DMA-capable stages, swapped there and
+// flushed like a partial band, so LovyanGFX converts nothing in this mode either. LovyanGFX only
+// starts a push once the previous one has finished, so a stage is free again as soon as anything
+// was pushed after it; only otherwise does refilling it wait for the DMA.
+static void push_framebuffer_area(const lv_area_t *area, const uint16_t *fb) {
+    const int32_t stride = lv_display_get_horizontal_resolution(display);
+    const int32_t w = lv_area_get_width(area);
+    uint8_t next = 0;
+    for (int32_t y = area->y1; y <= area->y2; y += DIRECT_STAGE_LINES) {
+        const int32_t h = LV_MIN(static_cast<int32_t>(DIRECT_STAGE_LINES), area->y2 - y + 1);
+        uint16_t *stage = direct_stage[next];
+        if (direct_stage_push[next] == panel_pushes) lcd.waitDMA();
+        for (int32_t r = 0; r < h; r++) {
+            memcpy(stage + r * w, fb + (y + r) * stride + area->x1, w * sizeof(uint16_t));
+        }
+        lv_draw_sw_rgb565_swap(stage, w * h);
+        const lv_area_t band = {area->x1, y, area->x2, y + h - 1};
+        flush_area(&band, stage, w);
+        direct_stage_push[next] = panel_pushes;
+        next ^= 1;
+    }
+}
+
+static void flush_direct(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    DirtyAreas &d = dirty_areas;
+    if (d.count == 0 && !d.overflow) {
+        d.bounds = *area;
+    } else {
+        d.bounds.x1 = LV_MIN(d.bounds.x1, area->x1);
+        d.bounds.y1 = LV_MIN(d.bounds.y1, area->y1);
+        d.bounds.x2 = LV_MAX(d.bounds.x2, area->x2);
+        d.bounds.y2 = LV_MAX(d.bounds.y2, area->y2);
+    }
+    d.area_px += lv_area_get_size(area);
+    if (d.count < DIRTY_AREA_MAX) d.areas[d.count++] = *area;
+    else d.overflow = true;
+
+    if (!lv_display_flush_is_last(disp)) return;
+
+    // px_map is the start of the frame buffer in direct mode. One window for the union is
+    // cheapest unless the areas are far apart (e.g. both home cards), then send them separately.
+    const uint16_t *fb = reinterpret_cast<const uint16_t *>(px_map);
+    if (d.overflow || lv_area_get_size(&d.bounds) <= 2 * d.area_px) {
+        push_framebuffer_area(&d.bounds, fb);
+    } else {
+        for (uint8_t i = 0; i < d.count; i++) {
+            push_framebuffer_area(&d.areas[i], fb);
+        }
+    }
+    d = DirtyAreas();
+}
 
-    lcd.pushImage(area->x1, area->y1, w, h, reinterpret_cast<lgfx::rgb565_t *>(px_map));
+static void lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    const int64_t start_us = esp_timer_get_time();
+    if (direct_mode) {
+        flush_direct(disp, area, px_map);
+        frame_stats.flush_us += static_cast<uint32_t>(esp_timer_get_time() - start_us);
+        return;
+    }
+    // The band is scratch space, so swap it to the ILI9341's big-endian order in one 32-bit pass
+    // and let the DMA read it as-is instead of LovyanGFX converting pixel by pixel.
+    lv_draw_sw_rgb565_swap(px_map, lv_area_get_size(area));
+    // Queue the band on the SPI DMA channel and return straight away so LVGL can render the
+    // next band into the other buffer. lvgl_flush_wait_cb() completes the handshake.
+    flush_area(area, reinterpret_cast<const uint16_t *>(px_map), lv_area_get_width(area));
+    frame_stats.flush_us += static_cast<uint32_t>(esp_timer_get_time() - start_us);
+}
 
+// LovyanGFX has no DMA-complete callback, so LVGL's flush-wait hook stands in for it: LVGL only
+// calls this when it needs a buffer back, and the transfer is usually finished by then.
+static void lvgl_flush_wait_cb(lv_display_t *disp) {
+    const int64_t start_us = esp_timer_get_time();
+    lcd.waitDMA();
+    frame_stats.flush_us += static_cast<uint32_t>(esp_timer_get_time() - start_us);
     lv_display_flush_ready(disp);
 }
 
-static void lvgl_touch_cb(lv_indev_t * /*indev*/, lv_indev_data_t *data) {
-    uint16_t touch_x = 0;
-    uint16_t touch_y = 0;
-    const bool touched = lcd.getTouch(&touch_x, &touch_y);
-    constexpr int16_t TOUCH_X_OFFSET_PX = 0;  // no manual offset
-
-    if (display_sleep && touched) {
-        // Wake on first touch, do not forward to widgets
-        lcd.setBrightness(current_brightness_duty);
-        display_sleep = false;
+static const char *screen_name(const lv_obj_t *scr) {
+    if (scr == nullptr) return "-";
+    return cyd_screens_name(cyd_screens_find(scr));
+}
+
+static void lvgl_refr_event_cb(lv_event_t *e) {
+    const lv_event_code_t code = lv_event_get_code(e);
+    if (code == LV_EVENT_INVALIDATE_AREA) {
+        frame_stats.invalidations++;
+        cyd_swipe_invalidate_active(static_cast<const lv_area_t *>(lv_event_get_param(e)));
+#if CYD_FLUSH_TILE_DIFF
+        // Align dirty areas (and so the partial-mode bands) with the diff tiles.
+        cyd_tilediff_round_area(static_cast<lv_area_t *>(lv_event_get_param(e)));
+#endif
+        // Changes made under cyd_ui_lock() from other tasks should not wait out the task's sleep.
+        if (!cyd_ui_in_task()) cyd_ui_wake();
+        return;
+    }
+    if (code == LV_EVENT_REFR_START) {
+        frame_stats.refr_start_us = esp_timer_get_time();
+        frame_stats.frame_px = 0;
+        frame_stats.flush_us = 0;
+        // Keyed by name: screens are rebuilt at new addresses after an eviction.
+        cyd_tilediff_set_screen(screen_name(lv_display_get_screen_active(display)));
+        cyd_layercache_refr_start(lv_display_get_screen_active(display));
+        return;
+    }
+    if (code != LV_EVENT_REFR_READY || frame_stats.frame_px == 0) return;
+
+    const uint32_t us = static_cast<uint32_t>(esp_timer_get_time() - frame_stats.refr_start_us);
+    frame_stats.frames++;
+    frame_stats.total_us += us;
+    if (us > frame_stats.max_us) frame_stats.max_us = us;
+    cyd_metrics_add(metrics.frames, 1);
+    cyd_metrics_observe(metrics.flush_us, frame_stats.flush_us);
+    cyd_metrics_observe(metrics.render_us, us > frame_stats.flush_us ? us - frame_stats.flush_us : 0);
+    const bool full = frame_stats.frame_px >= static_cast<uint32_t>(SCREEN_WIDTH) * SCREEN_HEIGHT;
+    if (full) frame_stats.last_full_us = us;  // reported by the [frame] stats line
+    cyd_layercache_refr_ready(us, full);
+
+    cyd_screens_nav_t nav;
+    if (cyd_screens_take_nav(&nav)) {
+        const int64_t now_us = esp_timer_get_time();
+        if (nav.from == CYD_SCREEN_COUNT) {
+            Serial.printf("[boot] first frame (%s) at %lu ms, screen built in %lu us\n", cyd_screens_name(nav.to),
+                          static_cast<unsigned long>(now_us / 1000), static_cast<unsigned long>(nav.build_us));
+        } else {
+            Serial.printf("[nav] %s -> %s: first frame %lu us, build %lu us%s\n", cyd_screens_name(nav.from),
+                          cyd_screens_name(nav.to), static_cast<unsigned long>(now_us - nav.start_us),
+                          static_cast<unsigned long>(nav.build_us), nav.prefetched ? " (on press)" : "");
+        }
+    }
+}
+
+#if CYD_FLUSH_TILE_DIFF
+static void log_tile_stats() {
+    for (uint8_t i = 0; i < cyd_tilediff_stats_count(); i++) {
+        const cyd_tilediff_stats_t *st = cyd_tilediff_stats_get(i);
+        const uint32_t total = st->tiles_sent + st->tiles_skipped;
+        if (total == 0) continue;
+        Serial.printf("[tiles] %s sent=%lu skipped=%lu saved=%lu%%\n", static_cast<const char *>(st->screen),
+                      static_cast<unsigned long>(st->tiles_sent), static_cast<unsigned long>(st->tiles_skipped),
+                      static_cast<unsigned long>(st->tiles_skipped * 100 / total));
+    }
+    cyd_tilediff_stats_reset();
+}
+#endif
+
+static void log_layer_stats() {
+    static cyd_layercache_stats_t last = {};
+    cyd_layercache_stats_t st;
+    cyd_layercache_get_stats(&st);
+    if (st.captures == last.captures && st.drops == last.drops && st.no_gain == last.no_gain) return;
+    Serial.printf("[layers] screens=%lu bytes=%lu captures=%lu drops=%lu no_gain=%lu\n",
+                  static_cast<unsigned long>(st.screens), static_cast<unsigned long>(st.bytes),
+                  static_cast<unsigned long>(st.captures), static_cast<unsigned long>(st.drops),
+                  static_cast<unsigned long>(st.no_gain));
+    last = st;
+}
+
+static void log_image_stats() {
+    static cyd_imgcache_stats_t last = {};
+    cyd_imgcache_stats_t st;
+    cyd_imgcache_get_stats(&st);
+    if (st.hits == last.hits && st.misses == last.misses) return;
+    Serial.printf("[images] hits=%lu misses=%lu evictions=%lu entries=%lu bytes=%lu/%lu\n",
+                  static_cast<unsigned long>(st.hits), static_cast<unsigned long>(st.misses),
+                  static_cast<unsigned long>(st.evictions), static_cast<unsigned long>(st.entries),
+                  static_cast<unsigned long>(st.bytes), static_cast<unsigned long>(st.budget));
+    last = st;
+}
+
+static void log_screen_stats() {
+    static cyd_screens_stats_t last = {};
+    cyd_screens_stats_t st;
+    cyd_screens_get_stats(&st);
+    if (st.builds == last.builds && st.lv_peak == last.lv_peak) return;
+    Serial.printf("[screens] built=%lu bytes=%lu/%lu builds=%lu evictions=%lu prefetch_hits=%lu lv_peak=%lu/%u\n",
+                  static_cast<unsigned long>(st.screens), static_cast<unsigned long>(st.bytes),
+                  static_cast<unsigned long>(st.budget), static_cast<unsigned long>(st.builds),
+                  static_cast<unsigned long>(st.evictions), static_cast<unsigned long>(st.prefetch_hits),
+                  static_cast<unsigned long>(st.lv_peak), static_cast<unsigned>(LV_MEM_SIZE));
+    last = st;
+}
+
+// LVGL pool (LV_MEM_SIZE) use and fragmentation: frag is 100% minus the largest free block's
+// share of the free space, so steady label and screen churn shows up as a rising number.
+static void log_lvgl_mem_stats() {
+    static uint8_t frag_max = 0;
+    static uint8_t last_frag = 0;
+    static cyd_label_stats_t last = {};
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    cyd_label_stats_t labels;
+    cyd_label_get_stats(&labels);
+    if (mon.frag_pct > frag_max) frag_max = mon.frag_pct;
+    if (mon.frag_pct == last_frag && labels.updates == last.updates && labels.bound == last.bound) return;
+    Serial.printf("[lvmem] used=%u/%u largest_free=%u frag=%u%% (max %u%%) labels=%lu updates=%lu unchanged=%lu "
+                  "heap_fallbacks=%lu\n",
+                  static_cast<unsigned>(mon.total_size - mon.free_size), static_cast<unsigned>(mon.total_size),
+                  static_cast<unsigned>(mon.free_biggest_size), mon.frag_pct, frag_max,
+                  static_cast<unsigned long>(labels.bound), static_cast<unsigned long>(labels.updates),
+                  static_cast<unsigned long>(labels.unchanged), static_cast<unsigned long>(labels.fallbacks));
+    last_frag = mon.frag_pct;
+    last = labels;
+}
+
+static void log_frame_stats() {
+    if (frame_stats.frames == 0 && frame_stats.invalidations == 0) return;
+    const uint32_t avg_us = frame_stats.frames ? static_cast<uint32_t>(frame_stats.total_us / frame_stats.frames) : 0;
+    const float inv_per_s = frame_stats.invalidations * 1000.0f / STATS_LOG_INTERVAL_MS;
+    Serial.printf("[frame] n=%lu avg=%lu us max=%lu us last_full=%lu us invalidations=%.1f/s\n",
+                  static_cast<unsigned long>(frame_stats.frames), static_cast<unsigned long>(avg_us),
+                  static_cast<unsigned long>(frame_stats.max_us), static_cast<unsigned long>(frame_stats.last_full_us),
+                  inv_per_s);
+    frame_stats.frames = 0;
+    frame_stats.invalidations = 0;
+    frame_stats.total_us = 0;
+    frame_stats.max_us = 0;
+}
+
+static void log_touch_stats() {
+    cyd_touch_stats_t ring = {};
+    cyd_touch_take_stats(&ring);
+    if (ring.reads == 0 && touch_stats.presses == 0) return;
+    const float reads_per_s = ring.elapsed_us ? ring.reads * 1000000.0f / ring.elapsed_us : 0.0f;
+    const uint32_t avg_us = touch_stats.presses ? static_cast<uint32_t>(touch_stats.total_us / touch_stats.presses) : 0;
+    Serial.printf("[touch] irqs=%lu reads=%.1f/s points=%lu coalesced=%lu dropped=%lu presses=%lu "
+                  "press_latency avg=%lu us max=%lu us\n",
+                  static_cast<unsigned long>(ring.irqs), reads_per_s, static_cast<unsigned long>(ring.points),
+                  static_cast<unsigned long>(touch_stats.coalesced), static_cast<unsigned long>(ring.dropped),
+                  static_cast<unsigned long>(touch_stats.presses), static_cast<unsigned long>(avg_us),
+                  static_cast<unsigned long>(touch_stats.max_us));
+    touch_stats = TouchStats();
+}
+
+static void register_metrics() {
+    constexpr uint8_t buckets = sizeof(DURATION_BUCKETS_US) / sizeof(DURATION_BUCKETS_US[0]);
+    metrics.frames = cyd_metrics_counter("frames");
+    metrics.render_us = cyd_metrics_histogram("render_us", DURATION_BUCKETS_US, buckets);
+    metrics.flush_us = cyd_metrics_histogram("flush_us", DURATION_BUCKETS_US, buckets);
+    metrics.spi_bytes = cyd_metrics_counter("spi_bytes");
+    metrics.touch_us = cyd_metrics_histogram("touch_us", DURATION_BUCKETS_US, buckets);
+    metrics.loop_us = cyd_metrics_histogram("loop_us", DURATION_BUCKETS_US, buckets);
+    metrics.lv_used = cyd_metrics_gauge("lv_used");
+    metrics.lv_frag = cyd_metrics_gauge("lv_frag_pct");
+    metrics.serial_reader = cyd_metrics_reader();
+    metrics.hud_reader = cyd_metrics_reader();
+}
+
+// Gauges are read when they are shown rather than kept up to date.
+static void sample_metric_gauges() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    cyd_metrics_set(metrics.lv_used, static_cast<int32_t>(mon.total_size - mon.free_size));
+    cyd_metrics_set(metrics.lv_frag, mon.frag_pct);
+}
+
+static void log_metrics() {
+    static char line[320];
+    sample_metric_gauges();
+    cyd_metrics_format(metrics.serial_reader, ' ', line, sizeof(line));
+    Serial.printf("[metrics] %s\n", line);
+}
+
+static void perf_hud_update(lv_timer_t * /*timer*/) {
+    sample_metric_gauges();
+    cyd_metrics_format(metrics.hud_reader, '\n', perf_hud.text, sizeof(perf_hud.text));
+    lv_label_set_text_static(perf_hud.label, perf_hud.text);
+}
+
+static void perf_hud_toggle() {
+    PerfHud &hud = perf_hud;
+    if (hud.label) {
+        lv_timer_delete(hud.timer);
+        lv_obj_delete(hud.label);
+        hud = PerfHud();
+        Serial.println("[metrics] HUD off");
+        return;
+    }
+    hud.label = lv_label_create(lv_layer_top());
+    lv_obj_set_style_bg_color(hud.label, lv_color_black(), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(hud.label, LV_OPA_70, LV_PART_MAIN);
+    lv_obj_set_style_text_color(hud.label, lv_color_white(), LV_PART_MAIN);
+    // LVGL's font, or the fonts/ subset, which keeps all of ASCII at this size (custom_font_full_ascii).
+    lv_obj_set_style_text_font(hud.label, &lv_font_montserrat_12, LV_PART_MAIN);
+    lv_obj_set_style_pad_all(hud.label, 4, LV_PART_MAIN);
+    lv_obj_set_align(hud.label, LV_ALIGN_BOTTOM_LEFT);
+    // The first window starts now, not at the previous toggle.
+    cyd_metrics_format(metrics.hud_reader, '\n', hud.text, sizeof(hud.text));
+    lv_label_set_text_static(hud.label, "metrics...");
+    hud.timer = lv_timer_create(perf_hud_update, PERF_HUD_REFRESH_MS, nullptr);
+    Serial.println("[metrics] HUD on");
+}
+
+// The gear navigates on CLICKED; ending the press here turns the release into a PRESS_LOST.
+static void settings_gear_long_press_cb(lv_event_t * /*e*/) {
+    lv_indev_wait_release(lv_indev_active());
+    perf_hud_toggle();
+}
+
+static void log_swipe_stats() {
+    cyd_swipe_stats_t st;
+    cyd_swipe_take_stats(&st);
+    if (st.swipes == 0) return;
+    Serial.printf("[swipe] swipes=%lu completed=%lu frames=%lu dropped=%lu frame avg=%lu us max=%lu us "
+                  "snapshots=%lu start_max=%lu us\n",
+                  static_cast<unsigned long>(st.swipes), static_cast<unsigned long>(st.completed),
+                  static_cast<unsigned long>(st.frames), static_cast<unsigned long>(st.dropped),
+                  static_cast<unsigned long>(st.frames ? st.frame_us / st.frames : 0),
+                  static_cast<unsigned long>(st.max_frame_us), static_cast<unsigned long>(st.snapshots),
+                  static_cast<unsigned long>(st.max_start_us));
+}
+
+// Screen position of a raw point: calibration and the current panel rotation in one fixed-point
+// transform.
+static lv_point_t touch_to_screen(const cyd_touch_point_t &p) {
+    int16_t x = 0;
+    int16_t y = 0;
+    cyd_touchcal_apply(&touch_cal, p.x, p.y, &x, &y);
+    return {x, y};
+}
+
+static lv_point_t clamp_to_display(int16_t x, int16_t y) {
+    return {LV_CLAMP(0, static_cast<int32_t>(x), lv_display_get_horizontal_resolution(display) - 1),
+            LV_CLAMP(0, static_cast<int32_t>(y), lv_display_get_vertical_resolution(display) - 1)};
+}
+
+// After a calibration or a change of touch_rotation.
+static void update_touch_cal() {
+    cyd_touchcal_rotate(&touch_cal, &touch_cal_native, touch_rotation, SCREEN_WIDTH, SCREEN_HEIGHT);
+}
+
+static void load_touch_cal() {
+    cyd_touchcal_t stored;
+    if (prefs.getBytesLength(TOUCH_CAL_KEY) == sizeof(stored) &&
+        prefs.getBytes(TOUCH_CAL_KEY, &stored, sizeof(stored)) == sizeof(stored) && cyd_touchcal_valid(&stored)) {
+        touch_cal_native = stored;
+        Serial.println("[touchcal] using the stored calibration");
+    } else {
+        cyd_touchcal_from_bounds(&touch_cal_native, CYD_TOUCH_X_MIN, CYD_TOUCH_X_MAX, CYD_TOUCH_Y_MIN, CYD_TOUCH_Y_MAX,
+                                 SCREEN_WIDTH, SCREEN_HEIGHT);
+    }
+    update_touch_cal();
+}
+
+static lv_obj_t *create_touch_cal_bar(lv_obj_t *parent, int32_t w, int32_t h) {
+    lv_obj_t *bar = lv_obj_create(parent);
+    lv_obj_remove_style_all(bar);
+    lv_obj_set_size(bar, w, h);
+    lv_obj_set_align(bar, LV_ALIGN_CENTER);
+    lv_obj_set_style_bg_color(bar, lv_color_white(), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(bar, LV_OPA_COVER, LV_PART_MAIN);
+    return bar;
+}
+
+static void show_touch_cal_target(const char *prompt) {
+    TouchCalCapture &c = touch_cal_capture;
+    lv_obj_set_pos(c.cross, c.target_x[c.index] - TOUCH_CAL_CROSS_PX / 2, c.target_y[c.index] - TOUCH_CAL_CROSS_PX / 2);
+    lv_label_set_text_fmt(c.label, "Touch calibration\n%s %u / %u", prompt, static_cast<unsigned>(c.index + 1),
+                          static_cast<unsigned>(CYD_TOUCH_CAL_POINTS));
+}
+
+// Hidden calibration mode on a screen of its own; the screen shown before comes back when it is
+// done. skip_stroke: a finger is down that must lift before the first tap counts.
+static void touch_cal_start(bool skip_stroke) {
+    TouchCalCapture &c = touch_cal_capture;
+    if (c.active) return;
+    c.active = true;
+    c.skip_stroke = skip_stroke;
+    c.index = 0;
+    c.rejects = 0;
+    c.samples = 0;
+    c.sum_x = 0;
+    c.sum_y = 0;
+    c.return_to = cyd_screens_active();
+    cyd_touchcal_targets(CYD_TOUCH_CAL_POINTS, lv_display_get_horizontal_resolution(display),
+                         lv_display_get_vertical_resolution(display), c.target_x, c.target_y);
+
+    c.screen = lv_obj_create(nullptr);
+    lv_obj_remove_flag(c.screen, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_style_bg_color(c.screen, lv_color_black(), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(c.screen, LV_OPA_COVER, LV_PART_MAIN);
+    c.label = lv_label_create(c.screen);
+    lv_obj_set_style_text_color(c.label, lv_color_white(), LV_PART_MAIN);
+    lv_obj_set_style_text_align(c.label, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    lv_obj_set_align(c.label, LV_ALIGN_CENTER);
+    lv_obj_set_y(c.label, -40);
+    c.cross = lv_obj_create(c.screen);
+    lv_obj_remove_style_all(c.cross);
+    lv_obj_set_size(c.cross, TOUCH_CAL_CROSS_PX, TOUCH_CAL_CROSS_PX);
+    create_touch_cal_bar(c.cross, TOUCH_CAL_CROSS_PX, 1);
+    create_touch_cal_bar(c.cross, 1, TOUCH_CAL_CROSS_PX);
+    show_touch_cal_target("Tap the cross");
+    lv_screen_load(c.screen);
+
+    // LVGL gets a release for whatever the starting touch pressed.
+    touch_state = LV_INDEV_STATE_RELEASED;
+    cyd_touchfilter_reset(&touch_filter);
+    Serial.printf("[touchcal] started, %u points\n", static_cast<unsigned>(CYD_TOUCH_CAL_POINTS));
+}
+
+// Back to the screen shown before; the calibration in use is whatever touch_cal_native holds.
+static void touch_cal_close() {
+    TouchCalCapture &c = touch_cal_capture;
+    c.active = false;
+    cyd_screens_show(c.return_to != CYD_SCREEN_COUNT ? c.return_to : setup_complete ? CYD_SCREEN_HOME : CYD_SCREEN_BOOT);
+    lv_obj_delete_async(c.screen);
+    c.screen = nullptr;
+    c.cross = nullptr;
+    c.label = nullptr;
+}
+
+static void touch_cal_finish() {
+    TouchCalCapture &c = touch_cal_capture;
+    int16_t x[CYD_TOUCHCAL_MAX_POINTS];
+    int16_t y[CYD_TOUCHCAL_MAX_POINTS];
+    for (uint8_t i = 0; i < CYD_TOUCH_CAL_POINTS; i++) {
+        x[i] = c.target_x[i];
+        y[i] = c.target_y[i];
+        cyd_touchcal_to_native(touch_rotation, SCREEN_WIDTH, SCREEN_HEIGHT, &x[i], &y[i]);
+    }
+    cyd_touchcal_t fit;
+    float max_err_px = 0.0f;
+    const bool ok = cyd_touchcal_fit(&fit, c.raw_x, c.raw_y, x, y, CYD_TOUCH_CAL_POINTS, &max_err_px) &&
+                    max_err_px <= TOUCH_CAL_MAX_ERROR_PX;
+    Serial.printf("[touchcal] max error %.1f px: %s\n", max_err_px, ok ? "saved" : "rejected");
+    if (!ok) {
+        if (++c.rejects >= TOUCH_CAL_MAX_REJECTS) {
+            // A panel this far off every time needs more than taps; keep what worked so far.
+            Serial.printf("[touchcal] %u rounds off target, calibration kept\n", static_cast<unsigned>(c.rejects));
+            touch_cal_close();
+            return;
+        }
+        c.index = 0;
+        show_touch_cal_target("Off target, once more");
+        return;
+    }
+    touch_cal_native = fit;
+    update_touch_cal();
+    prefs.putBytes(TOUCH_CAL_KEY, &fit, sizeof(fit));
+    touch_cal_close();
+}
+
+// Calibration in progress: each tap's raw points, past the first few while the finger lands, are
+// averaged into the current target's sample.
+static void touch_cal_read() {
+    TouchCalCapture &c = touch_cal_capture;
+    cyd_touch_point_t p;
+    while (c.active && cyd_touch_pop(&p)) {
         last_activity_ms = millis();
+        if (touch_wake_stroke || c.skip_stroke) {
+            if (!p.pressed) {
+                touch_wake_stroke = false;
+                c.skip_stroke = false;
+            }
+            continue;
+        }
+        if (p.pressed) {
+            if (++c.samples > TOUCH_CAL_SETTLE_SAMPLES) {
+                c.sum_x += p.x;
+                c.sum_y += p.y;
+            }
+            continue;
+        }
+        const int32_t taken = static_cast<int32_t>(c.samples) - TOUCH_CAL_SETTLE_SAMPLES;
+        c.samples = 0;
+        if (taken <= 0) continue;  // too short a tap to trust; same target again
+        c.raw_x[c.index] = static_cast<int16_t>(c.sum_x / taken);
+        c.raw_y[c.index] = static_cast<int16_t>(c.sum_y / taken);
+        c.sum_x = 0;
+        c.sum_y = 0;
+        if (++c.index == CYD_TOUCH_CAL_POINTS) {
+            touch_cal_finish();
+        } else {
+            show_touch_cal_target("Tap the cross");
+        }
+    }
+}
+
+// Reports the newest queued touch point, filtered and carried ahead to when the frame will be on
+// the panel (cyd_touchfilter), or the last state when none is queued. Drag points that queued up
+// within one frame all go through the filter; a press or release is never skipped. Never reads
+// the controller itself.
+static void lvgl_touch_cb(lv_indev_t * /*indev*/, lv_indev_data_t *data) {
+    if (touch_cal_capture.active) {
+        touch_cal_read();
         data->state = LV_INDEV_STATE_RELEASED;
+        data->point = touch_point;
         return;
     }
+    uint32_t drag_points = 0;
+    bool settle = false;
+    cyd_touch_point_t p;
+    while (cyd_touch_peek(&p)) {
+        if (touch_wake_stroke) {
+            // Waking is handled by wake_display(); the waking touch never reaches widgets.
+            cyd_touch_pop(&p);
+            if (!p.pressed) touch_wake_stroke = false;
+            continue;
+        }
+        if (!p.pressed) {
+            int16_t x = 0;
+            int16_t y = 0;
+            cyd_touchfilter_settled(&touch_filter, &x, &y);
+            const lv_point_t settled = clamp_to_display(x, y);
+            if (touch_state == LV_INDEV_STATE_PRESSED && (settled.x != touch_point.x || settled.y != touch_point.y)) {
+                // Widgets keep the position of the last pressed read, so first report where the
+                // finger is rather than where it was heading; the release follows on the next read.
+                settle = true;
+                break;
+            }
+            cyd_touch_pop(&p);
+            touch_state = LV_INDEV_STATE_RELEASED;
+            cyd_touchfilter_reset(&touch_filter);
+            break;
+        }
+        cyd_touch_pop(&p);
+        const lv_point_t pos = touch_to_screen(p);
+        cyd_touchfilter_add(&touch_filter, static_cast<int16_t>(pos.x), static_cast<int16_t>(pos.y), p.us);
+        last_activity_ms = millis();
+        if (touch_state == LV_INDEV_STATE_RELEASED) {
+            const uint32_t latency_us = static_cast<uint32_t>(esp_timer_get_time()) - p.us;
+            touch_stats.presses++;
+            touch_stats.total_us += latency_us;
+            if (latency_us > touch_stats.max_us) touch_stats.max_us = latency_us;
+            cyd_metrics_observe(metrics.touch_us, latency_us);
+            touch_state = LV_INDEV_STATE_PRESSED;
+            break;  // LVGL gets the press where the finger came down
+        }
+        drag_points++;
+    }
+    if (drag_points > 1) touch_stats.coalesced += drag_points - 1;
 
-    if (!touched) {
+    if (touch_state == LV_INDEV_STATE_PRESSED) {
+        int16_t x = 0;
+        int16_t y = 0;
+        if (settle) {
+            cyd_touchfilter_settled(&touch_filter, &x, &y);
+        } else {
+            cyd_touchfilter_predict(&touch_filter, static_cast<uint32_t>(esp_timer_get_time()), &x, &y);
+        }
+        touch_point = clamp_to_display(x, y);
+    }
+    if (!display_sleep &&
+        cyd_swipe_track(touch_indev, touch_state == LV_INDEV_STATE_PRESSED, touch_point.x, touch_point.y)) {
         data->state = LV_INDEV_STATE_RELEASED;
-    } else {
-        int32_t corrected_x = static_cast<int32_t>(touch_x) - TOUCH_X_OFFSET_PX;
-        if (corrected_x < 0) corrected_x = 0;
-        if (corrected_x >= SCREEN_WIDTH) corrected_x = SCREEN_WIDTH - 1;
-        touch_x = static_cast<uint16_t>(corrected_x);
-        if (touch_y >= SCREEN_HEIGHT) touch_y = SCREEN_HEIGHT - 1;
-        data->state = LV_INDEV_STATE_PRESSED;
-        data->point.x = touch_x;
-        data->point.y = touch_y;
-        Serial.printf("[touch] x=%u y=%u\n", touch_x, touch_y);
-        last_activity_ms = millis();
+        data->point = touch_point;
+        return;
+    }
+    data->state = display_sleep ? LV_INDEV_STATE_RELEASED : touch_state;
+    data->point = touch_point;
+}
+
+#if CYD_BENCH_FLUSH
+// Push full screens from a DMA-capable band buffer through both pixel paths and report MB/s.
+static void run_flush_benchmark() {
+    constexpr uint32_t ROUNDS = 10;
+    constexpr uint32_t BAND_PX = SCREEN_WIDTH * DRAW_BUF_LINES;
+    uint16_t *band = static_cast<uint16_t *>(heap_caps_malloc(BAND_PX * sizeof(uint16_t), MALLOC_CAP_DMA));
+    if (!band) {
+        Serial.println("[bench] flush: no DMA memory");
+        return;
+    }
+    for (uint32_t i = 0; i < BAND_PX; i++) band[i] = static_cast<uint16_t>(i * 2654435761u >> 16);
+
+    const double mb = static_cast<double>(ROUNDS) * SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint16_t) / (1024.0 * 1024.0);
+    for (int pass = 0; pass < 2; pass++) {
+        const bool native = pass == 1;
+        const int64_t start = esp_timer_get_time();
+        for (uint32_t r = 0; r < ROUNDS; r++) {
+            for (uint16_t y = 0; y < SCREEN_HEIGHT; y += DRAW_BUF_LINES) {
+                lcd.waitDMA();  // the band is reused, as LVGL would after a flush-wait
+                if (native) {
+                    lv_draw_sw_rgb565_swap(band, BAND_PX);
+                    push_rect_as<lgfx::swap565_t>(0, y, SCREEN_WIDTH, DRAW_BUF_LINES, band, SCREEN_WIDTH);
+                } else {
+                    push_rect_as<lgfx::rgb565_t>(0, y, SCREEN_WIDTH, DRAW_BUF_LINES, band, SCREEN_WIDTH);
+                }
+            }
+        }
+        lcd.waitDMA();
+        const double secs = static_cast<double>(esp_timer_get_time() - start) / 1e6;
+        Serial.printf("[bench] flush %s: %.2f MB/s (%.1f ms/frame)\n", native ? "panel-native swap565" : "rgb565 convert",
+                      mb / secs, secs * 1000.0 / ROUNDS);
     }
+    heap_caps_free(band);
+    cyd_tilediff_invalidate_all();
+}
+#endif
+
+#if CYD_BENCH_BLEND && defined(CYD_BLEND_S3) && CYD_BLEND_S3
+// Run each blend primitive over a draw band with the scalar loops and with the PIE backend.
+static void run_blend_benchmark() {
+    constexpr uint32_t ROUNDS = 200;
+    constexpr uint32_t BAND_PX = SCREEN_WIDTH * DRAW_BUF_LINES;
+    uint16_t *dest = static_cast<uint16_t *>(heap_caps_aligned_alloc(16, BAND_PX * sizeof(uint16_t), MALLOC_CAP_INTERNAL));
+    uint16_t *src = static_cast<uint16_t *>(heap_caps_aligned_alloc(16, BAND_PX * sizeof(uint16_t), MALLOC_CAP_INTERNAL));
+    if (!dest || !src) {
+        Serial.println("[bench] blend: no memory");
+        if (dest) heap_caps_free(dest);
+        if (src) heap_caps_free(src);
+        return;
+    }
+    for (uint32_t i = 0; i < BAND_PX; i++) {
+        dest[i] = static_cast<uint16_t>(i * 2654435761u >> 16);
+        src[i] = static_cast<uint16_t>(i * 40503u);
+    }
+
+    _lv_draw_sw_blend_fill_dsc_t fill = {};
+    fill.dest_buf = dest;
+    fill.dest_w = SCREEN_WIDTH;
+    fill.dest_h = DRAW_BUF_LINES;
+    fill.dest_stride = SCREEN_WIDTH * sizeof(uint16_t);
+    fill.color = lv_color_hex(0x2196F3);
+    _lv_draw_sw_blend_image_dsc_t img = {};
+    img.dest_buf = dest;
+    img.dest_w = SCREEN_WIDTH;
+    img.dest_h = DRAW_BUF_LINES;
+    img.dest_stride = SCREEN_WIDTH * sizeof(uint16_t);
+    img.src_buf = src;
+    img.src_stride = SCREEN_WIDTH * sizeof(uint16_t);
+    img.src_color_format = LV_COLOR_FORMAT_RGB565;
+    img.blend_mode = LV_BLEND_MODE_NORMAL;
+
+    static const char *const names[] = {"fill", "fill opa", "copy", "copy opa"};
+    const double mpx = static_cast<double>(ROUNDS) * BAND_PX / 1e6;
+    for (int op = 0; op < 4; op++) {
+        fill.opa = op == 1 ? LV_OPA_50 : LV_OPA_COVER;
+        img.opa = op == 3 ? LV_OPA_50 : LV_OPA_COVER;
+        double secs[2];
+        for (int pie = 0; pie < 2; pie++) {
+            cyd_blend_s3_set_enabled(pie == 1);
+            const int64_t start = esp_timer_get_time();
+            for (uint32_t r = 0; r < ROUNDS; r++) {
+                if (op < 2) {
+                    lv_draw_sw_blend_color_to_rgb565(&fill);
+                } else {
+                    lv_draw_sw_blend_image_to_rgb565(&img);
+                }
+            }
+            secs[pie] = static_cast<double>(esp_timer_get_time() - start) / 1e6;
+        }
+        Serial.printf("[bench] blend %s: scalar %.1f Mpx/s, pie %.1f Mpx/s (x%.2f)\n", names[op], mpx / secs[0],
+                      mpx / secs[1], secs[0] / secs[1]);
+    }
+    cyd_blend_s3_set_enabled(true);
+    heap_caps_free(dest);
+    heap_caps_free(src);
+}
+#endif
+
+#if CYD_BENCH_RENDER
+// Redraw each screen from scratch a few times and report per-frame times. After the first pass
+// the tile diff skips the unchanged SPI traffic, so the figures are dominated by rendering.
+static void run_render_benchmark() {
+    constexpr uint32_t ROUNDS = 10;
+    const cyd_screen_t screens[] = {CYD_SCREEN_HOME, CYD_SCREEN_FRESHSETTINGS, CYD_SCREEN_WASTESETTINGS,
+                                    CYD_SCREEN_CYDSETTINGS};
+    const cyd_screen_t previous = cyd_screens_active();
+
+    for (cyd_screen_t id : screens) {
+        cyd_screens_show(id);
+        lv_obj_t *scr = lv_screen_active();
+        lv_refr_now(display);  // warm-up: glyph cache, first full flush
+        int64_t total_us = 0;
+        int64_t max_us = 0;
+        for (uint32_t r = 0; r < ROUNDS; r++) {
+            lv_obj_invalidate(scr);
+            const int64_t start = esp_timer_get_time();
+            lv_refr_now(display);
+            const int64_t us = esp_timer_get_time() - start;
+            total_us += us;
+            if (us > max_us) max_us = us;
+        }
+        Serial.printf("[bench] render %s: avg=%lu us max=%lu us (%d draw unit%s)\n", cyd_screens_name(id),
+                      static_cast<unsigned long>(total_us / ROUNDS), static_cast<unsigned long>(max_us),
+                      LV_DRAW_SW_DRAW_UNIT_CNT, LV_DRAW_SW_DRAW_UNIT_CNT > 1 ? "s" : "");
+    }
+    cyd_screens_show(previous);
+    lv_obj_invalidate(lv_screen_active());
+}
+#endif
+
+#if CYD_BENCH_GAUGE
+// Time set-value-and-refresh of a stock arc and of a gauge with the same geometry as the home
+// screen's, for one-percent steps (a tank filling) and for large jumps.
+static void run_gauge_benchmark() {
+    constexpr uint32_t ROUNDS = 40;
+    static const char *const names[] = {"lv_arc", "cyd_gauge"};
+    lv_obj_t *const previous = lv_screen_active();
+    lv_obj_t *scr = lv_obj_create(nullptr);
+    lv_obj_t *widgets[2];
+    for (int i = 0; i < 2; i++) {
+        lv_obj_t *arc = lv_arc_create(scr);
+        lv_obj_set_size(arc, 109, 95);
+        lv_obj_center(arc);
+        lv_obj_remove_flag(arc, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_set_style_arc_width(arc, 20, LV_PART_MAIN);
+        lv_obj_set_style_arc_width(arc, 20, LV_PART_INDICATOR);
+        lv_obj_set_style_opa(arc, 0, LV_PART_KNOB);
+        widgets[i] = i == 0 ? arc : cyd_gauge_replace(arc);
+    }
+    lv_screen_load(scr);
+
+    for (int i = 0; i < 2; i++) {
+        lv_obj_add_flag(widgets[1 - i], LV_OBJ_FLAG_HIDDEN);
+        lv_obj_remove_flag(widgets[i], LV_OBJ_FLAG_HIDDEN);
+        cyd_gauge_set_value(widgets[i], 50);
+        lv_refr_now(display);
+        for (int jump = 0; jump < 2; jump++) {
+            int64_t total_us = 0;
+            uint64_t total_px = 0;
+            for (uint32_t r = 0; r < ROUNDS; r++) {
+                const int32_t value = jump ? ((r & 1) ? 20 : 80) : ((r & 1) ? 50 : 51);
+                const int64_t start = esp_timer_get_time();
+                cyd_gauge_set_value(widgets[i], value);
+                lv_refr_now(display);
+                total_us += esp_timer_get_time() - start;
+                total_px += frame_stats.frame_px;
+            }
+            Serial.printf("[bench] gauge %s %s: %lu us/update, %lu px/update\n", names[i], jump ? "20<->80" : "+/-1",
+                          static_cast<unsigned long>(total_us / ROUNDS), static_cast<unsigned long>(total_px / ROUNDS));
+        }
+    }
+    lv_screen_load(previous);
+    lv_obj_delete(scr);
+    lv_obj_invalidate(previous);
+}
+#endif
+
+#if CYD_BENCH_TEXT
+// Full redraws of a screen holding one two-line label per UI font, so most of the frame time is
+// glyph lookup, bitmap decoding and blending.
+static void run_text_benchmark() {
+    constexpr uint32_t ROUNDS = 20;
+    const lv_font_t *const fonts[] = {&lv_font_montserrat_12, &lv_font_montserrat_16, &lv_font_montserrat_20,
+                                      &lv_font_montserrat_26, &lv_font_montserrat_30};
+    lv_obj_t *const previous = lv_screen_active();
+    lv_obj_t *scr = lv_obj_create(nullptr);
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_COLUMN);
+    for (const lv_font_t *font : fonts) {
+        lv_obj_t *label = lv_label_create(scr);
+        lv_obj_set_style_text_font(label, font, LV_PART_MAIN);
+        lv_label_set_text(label, "Fresh 87% 21.5°C\nFill Stop Level");
+    }
+    lv_screen_load(scr);
+    lv_refr_now(display);
+
+    int64_t total_us = 0;
+    int64_t max_us = 0;
+    for (uint32_t r = 0; r < ROUNDS; r++) {
+        lv_obj_invalidate(scr);
+        const int64_t start = esp_timer_get_time();
+        lv_refr_now(display);
+        const int64_t us = esp_timer_get_time() - start;
+        total_us += us;
+        if (us > max_us) max_us = us;
+    }
+    Serial.printf("[bench] text: avg=%lu us max=%lu us (%s fonts%s)\n", static_cast<unsigned long>(total_us / ROUNDS),
+                  static_cast<unsigned long>(max_us), CYD_FONT_SUBSET ? "subset" : "full",
+                  CYD_FONT_COMPRESSED ? ", compressed" : "");
+    lv_screen_load(previous);
+    lv_obj_delete(scr);
+    lv_obj_invalidate(previous);
+}
+#endif
+
+#if CYD_LEVEL_GAUGE
+// Swap a screen's generated level arcs and bars for cyd_gauge widgets. A widget that cannot be
+// swapped (no memory for its sprites) stays; cyd_gauge_set_value() drives either.
+static void replace_level_widgets(cyd_screen_t screen) {
+    struct LevelSlot {
+        cyd_screen_t screen;
+        lv_obj_t **widget;
+    };
+    static const LevelSlot slots[] = {{CYD_SCREEN_HOME, &ui_homeFreshLevelArc},
+                                      {CYD_SCREEN_HOME, &ui_homeGreyLevelArc},
+                                      {CYD_SCREEN_FRESH, &ui_freshLevelBar},
+                                      {CYD_SCREEN_WASTE, &ui_wasteLevelBar}};
+    unsigned found = 0;
+    int replaced = 0;
+    for (const LevelSlot &slot : slots) {
+        if (slot.screen != screen) continue;
+        found++;
+        lv_obj_t *const widget = *slot.widget;
+        *slot.widget = cyd_gauge_replace(widget);
+        if (*slot.widget != widget) replaced++;
+    }
+    if (found) Serial.printf("[gauge] %s: %d/%u level widgets replaced\n", cyd_screens_name(screen), replaced, found);
+}
+#endif
+
+// (Re)attach the draw buffers; their row stride follows the current display resolution.
+static void bind_draw_buffers() {
+    lv_display_set_buffers(display, draw_buf_a, draw_buf_b, draw_buf_bytes,
+                           direct_mode ? LV_DISPLAY_RENDER_MODE_DIRECT : LV_DISPLAY_RENDER_MODE_PARTIAL);
+}
+
+static const char *draw_buf_region_name(uint8_t region) {
+    return region == DRAW_BUF_PSRAM ? "PSRAM" : "internal";
+}
+
+// Budget for decoded images: the full amount with PSRAM to fall back on, otherwise a share of the
+// internal RAM left after the draw buffers and the headroom.
+static size_t image_cache_budget() {
+    if (heap_caps_get_total_size(MALLOC_CAP_SPIRAM) > 0) return IMAGE_CACHE_MAX_BYTES;
+    const size_t free_bytes = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    const size_t spare = free_bytes > INTERNAL_HEADROOM_BYTES ? free_bytes - INTERNAL_HEADROOM_BYTES : 0;
+    return spare / 4 < IMAGE_CACHE_MAX_BYTES ? spare / 4 : IMAGE_CACHE_MAX_BYTES;
+}
+
+// Partial bands in DMA-capable internal RAM, as tall as the budget left after the headroom allows.
+static bool plan_internal_draw_buffers(DrawBufConfig *cfg) {
+    constexpr uint32_t caps = MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL;
+    constexpr size_t row_bytes = SCREEN_WIDTH * sizeof(uint16_t);
+    const size_t free_bytes = heap_caps_get_free_size(caps);
+    size_t budget = free_bytes > INTERNAL_HEADROOM_BYTES ? free_bytes - INTERNAL_HEADROOM_BYTES : 0;
+    if (budget > INTERNAL_DRAW_BUF_MAX_BYTES) budget = INTERNAL_DRAW_BUF_MAX_BYTES;
+    // Two bands let LVGL render one while the other is going out over SPI DMA.
+    const uint8_t count = budget >= 2 * DRAW_BUF_MIN_LINES * row_bytes ? 2 : 1;
+    size_t per_buf = budget / count;
+    const size_t largest = heap_caps_get_largest_free_block(caps);
+    if (per_buf > largest) per_buf = largest;
+    uint32_t lines = per_buf / row_bytes / CYD_TILE_SIZE * CYD_TILE_SIZE;  // whole tile rows
+    if (lines > SCREEN_HEIGHT) lines = SCREEN_HEIGHT;
+    if (lines < DRAW_BUF_MIN_LINES) return false;
+    cfg->region = DRAW_BUF_INTERNAL;
+    cfg->count = count;
+    cfg->lines = static_cast<uint16_t>(lines);
+    return true;
+}
+
+// Full frames in PSRAM for direct mode, when the build allows it and they fit with headroom.
+static bool plan_psram_draw_buffers(DrawBufConfig *cfg) {
+#if CYD_PSRAM_FRAMEBUFFERS > 0
+    const uint8_t count = CYD_PSRAM_FRAMEBUFFERS > 1 ? 2 : 1;
+    const size_t free_bytes = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    if (free_bytes < count * FRAMEBUFFER_BYTES + PSRAM_HEADROOM_BYTES) return false;
+    if (heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM) < FRAMEBUFFER_BYTES) return false;
+    cfg->region = DRAW_BUF_PSRAM;
+    cfg->count = count;
+    cfg->lines = SCREEN_HEIGHT;
+    return true;
+#else
+    (void)cfg;
+    return false;
+#endif
+}
+
+static void free_direct_stages() {
+    for (uint16_t *&stage : direct_stage) {
+        if (stage) heap_caps_free(stage);
+        stage = nullptr;
+    }
+}
+
+static bool alloc_direct_stages() {
+    for (uint16_t *&stage : direct_stage) {
+        if (!stage) {
+            stage = static_cast<uint16_t *>(heap_caps_malloc(DIRECT_STAGE_BYTES, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL));
+        }
+        if (!stage) {
+            free_direct_stages();
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool alloc_draw_buffers(const DrawBufConfig &cfg, void **a, void **b) {
+    const uint32_t caps = cfg.region == DRAW_BUF_PSRAM ? MALLOC_CAP_SPIRAM : (MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    *a = heap_caps_aligned_alloc(64, cfg.bytes(), caps);
+    *b = cfg.count > 1 ? heap_caps_aligned_alloc(64, cfg.bytes(), caps) : nullptr;
+    if (!*a || (cfg.count > 1 && !*b) || (cfg.direct() && !alloc_direct_stages())) {
+        if (*a) heap_caps_free(*a);
+        if (*b) heap_caps_free(*b);
+        *a = *b = nullptr;
+        return false;
+    }
+    // Direct mode starts from whatever is in the frame buffers.
+    memset(*a, 0, cfg.bytes());
+    if (*b) memset(*b, 0, cfg.bytes());
+    return true;
+}
+
+static void use_draw_buffers(const DrawBufConfig &cfg, void *a, void *b) {
+    draw_buf_cfg = cfg;
+    draw_buf_a = a;
+    draw_buf_b = b;
+    draw_buf_bytes = cfg.bytes();
+    direct_mode = cfg.direct();
+    dirty_areas = DirtyAreas();
+    bind_draw_buffers();
+}
+
+// Probe the heaps and pick band height, count and region from the memory budget. Overrides in
+// CydSettings win over the planner; a failed override falls back to the automatic choice. When
+// both regions qualify the runner-up is kept for confirm_draw_buffers().
+static void setup_draw_buffers() {
+    Serial.printf("[display] heap probe: dma free=%u largest=%u psram free=%u largest=%u\n",
+                  static_cast<unsigned>(heap_caps_get_free_size(MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL)),
+                  static_cast<unsigned>(heap_caps_get_largest_free_block(MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL)),
+                  static_cast<unsigned>(heap_caps_get_free_size(MALLOC_CAP_SPIRAM)),
+                  static_cast<unsigned>(heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM)));
+    DrawBufConfig internal_cfg;
+    DrawBufConfig psram_cfg;
+    const bool have_internal = plan_internal_draw_buffers(&internal_cfg);
+    const bool have_psram = plan_psram_draw_buffers(&psram_cfg);
+    void *a = nullptr;
+    void *b = nullptr;
+
+    if (settings.draw_buf_region || settings.draw_buf_count || settings.draw_buf_lines) {
+        DrawBufConfig cfg = have_psram && settings.draw_buf_region != DRAW_BUF_INTERNAL ? psram_cfg : internal_cfg;
+        if (settings.draw_buf_region) {
+            cfg.region = settings.draw_buf_region;
+            if (cfg.region == DRAW_BUF_PSRAM && !have_psram) cfg.lines = SCREEN_HEIGHT;
+        }
+        if (settings.draw_buf_count) cfg.count = settings.draw_buf_count;
+        if (settings.draw_buf_lines) cfg.lines = settings.draw_buf_lines;
+        if (alloc_draw_buffers(cfg, &a, &b)) {
+            use_draw_buffers(cfg, a, b);
+            Serial.printf("[display] draw buffers from settings: %u x %u lines in %s RAM\n", cfg.count, cfg.lines,
+                          draw_buf_region_name(cfg.region));
+            return;
+        }
+        Serial.printf("[display] draw buffer override (%u x %u lines in %s RAM) failed, planning instead\n",
+                      cfg.count, cfg.lines, draw_buf_region_name(cfg.region));
+    }
+
+    DrawBufConfig candidates[3];
+    uint8_t n = 0;
+    if (have_psram) candidates[n++] = psram_cfg;
+    if (have_internal) candidates[n++] = internal_cfg;
+    DrawBufConfig minimal;
+    minimal.count = 1;
+    candidates[n++] = minimal;  // last resort: a single band
+    for (uint8_t i = 0; i < n; i++) {
+        if (!alloc_draw_buffers(candidates[i], &a, &b)) continue;
+        use_draw_buffers(candidates[i], a, b);
+        draw_buf_alt_pending = i == 0 && have_psram && have_internal;
+        draw_buf_alt = internal_cfg;
+        return;
+    }
+    Serial.println("[display] no memory for draw buffers");
+}
+
+// Average full-screen render + flush of the active screen after one warm-up pass.
+static uint32_t measure_full_render() {
+    lv_obj_t *scr = lv_screen_active();
+    lv_obj_invalidate(scr);
+    lv_refr_now(display);
+    int64_t total_us = 0;
+    for (uint32_t r = 0; r < DRAW_BUF_BENCH_ROUNDS; r++) {
+        lv_obj_invalidate(scr);
+        const int64_t start = esp_timer_get_time();
+        lv_refr_now(display);
+        total_us += esp_timer_get_time() - start;
+    }
+    return static_cast<uint32_t>(total_us / DRAW_BUF_BENCH_ROUNDS);
+}
+
+// Startup self-benchmark: time the planned buffers on the loaded UI and, when the planner had a
+// runner-up, time that too and keep whichever renders a full screen faster.
+static void confirm_draw_buffers() {
+    uint32_t render_us = measure_full_render();
+    if (draw_buf_alt_pending) {
+        draw_buf_alt_pending = false;
+        void *a = nullptr;
+        void *b = nullptr;
+        if (alloc_draw_buffers(draw_buf_alt, &a, &b)) {
+            const DrawBufConfig prev_cfg = draw_buf_cfg;
+            void *prev_a = draw_buf_a;
+            void *prev_b = draw_buf_b;
+            use_draw_buffers(draw_buf_alt, a, b);
+            const uint32_t alt_us = measure_full_render();
+            Serial.printf("[display] self-benchmark: %s %lu us, %s %lu us\n", draw_buf_region_name(prev_cfg.region),
+                          static_cast<unsigned long>(render_us), draw_buf_region_name(draw_buf_alt.region),
+                          static_cast<unsigned long>(alt_us));
+            if (alt_us < render_us) {
+                heap_caps_free(prev_a);
+                if (prev_b) heap_caps_free(prev_b);
+                if (!direct_mode) free_direct_stages();
+                render_us = alt_us;
+            } else {
+                use_draw_buffers(prev_cfg, prev_a, prev_b);
+                heap_caps_free(a);
+                if (b) heap_caps_free(b);
+            }
+            lv_obj_invalidate(lv_screen_active());
+        }
+    }
+    Serial.printf("[display] draw buffers: %u x %u lines (%u B) in %s RAM, %s mode, full-screen render %lu us\n",
+                  draw_buf_cfg.count, draw_buf_cfg.lines, static_cast<unsigned>(draw_buf_bytes),
+                  draw_buf_region_name(draw_buf_cfg.region), direct_mode ? "direct" : "partial",
+                  static_cast<unsigned long>(render_us));
 }
 
 static void apply_timeout_selection(int sel) {
@@ -296,39 +1576,124 @@ static void apply_timeout_selection(int sel) {
     Serial.printf("[timeout] selection=%d -> %lu ms\n", sel, static_cast<unsigned long>(inactivity_timeout_ms));
 }
 
+static void set_light_sleep(bool enable) {
+#if CYD_LIGHT_SLEEP
+    if (CYD_TOUCH_IRQ < 0) return;  // nothing could wake the chip
+#if CONFIG_IDF_TARGET_ESP32S3
+    esp_pm_config_esp32s3_t cfg = {};
+#else
+    esp_pm_config_esp32_t cfg = {};
+#endif
+    cfg.max_freq_mhz = 240;
+    cfg.min_freq_mhz = enable ? 40 : 240;
+    cfg.light_sleep_enable = enable;
+    const esp_err_t err = esp_pm_configure(&cfg);
+    if (enable && err != ESP_OK) {
+        Serial.printf("[sleep] automatic light sleep unavailable: %s\n", esp_err_to_name(err));
+    }
+#else
+    (void)enable;
+#endif
+}
+
+// Panel off, LVGL paused. The panel keeps its frame memory in sleep mode, so the tile hashes
+// stay valid and the wake-up redraw only sends what changed meanwhile.
+static void enter_display_sleep() {
+    display_sleep = true;
+    // Nobody is tapping the crosses; the taps so far are dropped and the old calibration stays.
+    if (touch_cal_capture.active) {
+        Serial.println("[touchcal] cancelled, calibration kept");
+        touch_cal_close();
+    }
+    // Only force-return to Home after initial setup is complete; otherwise just sleep the display.
+    if (setup_complete) {
+        cyd_screens_show(CYD_SCREEN_HOME);
+        cyd_screens_nav_t nav;
+        cyd_screens_take_nav(&nav);  // first drawn on wake-up, which is timed on its own
+    }
+    lv_display_enable_invalidation(display, false);
+    lcd.waitDMA();
+    lcd.sleep();  // backlight off + SLPIN
+    cyd_ui_pause(0);  // a queued touch point wakes the task
+    set_light_sleep(true);
+    Serial.println("[timeout] display sleep");
+}
+
+// Fast path back: one full-screen refresh, then the backlight, so the stale image never shows.
+static void wake_display(uint32_t trigger_us) {
+    set_light_sleep(false);
+    lcd.setBrightness(0);  // wakeup() sends SLPOUT and restores the stored brightness; keep it dark
+    lcd.wakeup();
+    delay(PANEL_SLEEP_OUT_MS);
+    lv_display_enable_invalidation(display, true);
+    lv_obj_invalidate(lv_screen_active());
+    cyd_ui_resume();
+    lv_refr_now(display);
+    lcd.waitDMA();
+    lcd.setBrightness(current_brightness_duty);
+    display_sleep = false;
+    last_activity_ms = millis();
+    Serial.printf("[sleep] wake-to-first-frame %lu us\n",
+                  static_cast<unsigned long>(static_cast<uint32_t>(esp_timer_get_time()) - trigger_us));
+}
+
 static void handle_inactivity() {
     if (display_sleep || inactivity_timeout_ms == 0) return;
     const uint32_t now = millis();
     if (now - last_activity_ms >= inactivity_timeout_ms) {
-        lcd.setBrightness(0);
-        display_sleep = true;
-        // Only force-return to Home after initial setup is complete; otherwise just sleep the display.
-        if (setup_complete) {
-            _ui_screen_change(&ui_home, LV_SCR_LOAD_ANIM_NONE, 0, 0, NULL);
-        }
-        Serial.println("[timeout] display sleep");
+        enter_display_sleep();
     }
 }
 
 static void apply_theme_selection(int sel) {
     const bool dark = (sel == 1);
-    lv_theme_t *theme = lv_theme_default_init(display, lv_palette_main(LV_PALETTE_BLUE),
-                                              lv_palette_main(LV_PALETTE_RED), dark, LV_FONT_DEFAULT);
-    lv_display_set_theme(display, theme);
+    // The cached layers hold the old theme's pixels and need the containers' own styles back.
+    cyd_layercache_drop_all();
+    cyd_swipe_drop_all();
+    cyd_theme_apply(display, dark);
     Serial.printf("[theme] selection=%d (%s)\n", sel, dark ? "dark" : "light");
 }
 
+// Rotate through the panel's address mode only. Landscape swaps LVGL's resolution; the
+// SquareLine screens are laid out for 240 x 320 and stay centred.
+static void apply_orientation_selection(int sel) {
+    if (sel < 0 || sel >= ORIENTATION_COUNT) sel = 0;
+    const bool landscape = sel == ORIENTATION_LANDSCAPE;
+    const int32_t hor_res = landscape ? SCREEN_HEIGHT : SCREEN_WIDTH;
+    const int32_t ver_res = landscape ? SCREEN_WIDTH : SCREEN_HEIGHT;
+    cyd_layercache_drop_all();
+    cyd_swipe_drop_all();
+    lcd.waitDMA();
+    lcd.setRotation(PANEL_ROTATION[sel]);
+    touch_rotation = (PANEL_ROTATION[sel] + TOUCH_ROTATION_OFFSET) & 3;
+    update_touch_cal();
+    if (lv_display_get_horizontal_resolution(display) != hor_res) {
+        lv_display_set_resolution(display, hor_res, ver_res);
+        bind_draw_buffers();
+    }
+    cyd_tilediff_init(hor_res, ver_res, push_rect);
+    lv_obj_invalidate(lv_screen_active());
+    Serial.printf("[orientation] selection=%d rotation=%u %ldx%ld\n", sel, PANEL_ROTATION[sel],
+                  static_cast<long>(hor_res), static_cast<long>(ver_res));
+}
+
 static void save_settings() {
     prefs.putBytes("cfg", &settings, sizeof(settings));
 }
 
 static void load_settings() {
     const size_t len = prefs.getBytesLength("cfg");
-    if (len == sizeof(CydSettings)) {
-        prefs.getBytes("cfg", &settings, sizeof(settings));
+    if (len == sizeof(CydSettings) || len == SETTINGS_V2_BYTES || len == SETTINGS_V1_BYTES) {
+        settings = CydSettings();
+        prefs.getBytes("cfg", &settings, len);
+        // Older layouts are prefixes of this one; the fields they lack keep their defaults.
+        const uint8_t stored_version = len == SETTINGS_V1_BYTES ? 1 : len == SETTINGS_V2_BYTES ? 2 : SETTINGS_VERSION;
+        if (settings.version == stored_version) settings.version = SETTINGS_VERSION;
         const bool version_ok = settings.version == SETTINGS_VERSION;
         const bool ranges_ok = settings.brightness_pct <= 100 && settings.timeout_index <= 3 && settings.theme_index <= 1 &&
-                               settings.units_index <= 1;
+                               settings.units_index <= 1 && settings.orientation_index < ORIENTATION_COUNT &&
+                               settings.draw_buf_region <= DRAW_BUF_PSRAM && settings.draw_buf_count <= 2 &&
+                               settings.draw_buf_lines <= SCREEN_HEIGHT;
         if (!version_ok || !ranges_ok) {
             settings = CydSettings();  // reset to defaults
         }
@@ -353,6 +1718,36 @@ static void lvgl_theme_cb(lv_event_t *e) {
     last_activity_ms = millis();
 }
 
+static void lvgl_orientation_cb(lv_event_t *e) {
+    lv_obj_t *dd = static_cast<lv_obj_t *>(lv_event_get_target(e));
+    const int sel = lv_dropdown_get_selected(dd);
+    if (settings.orientation_index != sel) {
+        settings.orientation_index = static_cast<uint8_t>(sel);
+        save_settings();
+    }
+    apply_orientation_selection(sel);
+    last_activity_ms = millis();
+}
+
+// Orientation row on the CYD settings panel, in the free space under the Units dropdown. It is
+// created here because the SquareLine project has no such control yet.
+static void create_orientation_control() {
+    if (!ui_Panel11) return;
+    lv_obj_t *label = lv_label_create(ui_Panel11);
+    lv_label_set_text(label, "Rotation");
+    lv_obj_set_align(label, LV_ALIGN_CENTER);
+    lv_obj_set_pos(label, -62, 76);
+
+    lv_obj_t *dd = lv_dropdown_create(ui_Panel11);
+    lv_dropdown_set_options(dd, "Portrait\nInverted\nLandscape");
+    lv_dropdown_set_dir(dd, LV_DIR_TOP);
+    lv_obj_set_width(dd, 110);
+    lv_obj_set_align(dd, LV_ALIGN_CENTER);
+    lv_obj_set_pos(dd, 47, 76);
+    lv_dropdown_set_selected(dd, settings.orientation_index);
+    lv_obj_add_event_cb(dd, lvgl_orientation_cb, LV_EVENT_VALUE_CHANGED, nullptr);
+}
+
 static void lvgl_brightness_cb(lv_event_t *e) {
     lv_obj_t *slider = static_cast<lv_obj_t *>(lv_event_get_target(e));
     const int val = lv_slider_get_value(slider);
@@ -360,7 +1755,7 @@ static void lvgl_brightness_cb(lv_event_t *e) {
         settings.brightness_pct = static_cast<uint8_t>(val);
         save_settings();
     }
-    apply_brightness_from_slider(slider);
+    apply_brightness(val);
 }
 
 static void lvgl_timeout_cb(lv_event_t *e) {
@@ -381,12 +1776,8 @@ static void lvgl_units_cb(lv_event_t *e) {
         settings.units_index = static_cast<uint8_t>(sel);
         save_settings();
     }
+    // Screens showing temperatures pick the change up when they are next loaded.
     cyd_state_set_units_metric(settings.units_index == 0);
-    cyd_state_apply_to_home_screen();
-    cyd_state_apply_to_fresh_screen();
-    cyd_state_apply_to_waste_screen();
-    cyd_state_apply_to_freshsettings_screen();
-    cyd_state_apply_to_wastesettings_screen();
     last_activity_ms = millis();
 }
 
@@ -411,14 +1802,14 @@ static String make_temp_password() {
 
 static void update_boot_wifi_labels() {
     if (ui_bootWifissid) {
-        lv_label_set_text(ui_bootWifissid, onboarding.ap_ssid.c_str());
+        cyd_label_set_text(ui_bootWifissid, onboarding.ap_ssid.c_str());
     }
     if (ui_bootWifipass) {
-        lv_label_set_text(ui_bootWifipass, onboarding.ap_pass.c_str());
+        cyd_label_set_text(ui_bootWifipass, onboarding.ap_pass.c_str());
     }
 }
 
-void stop_wifi_onboarding() {
+static void end_wifi_onboarding() {
     if (!onboarding.active) return;
     onboarding.dns.stop();
     onboarding.server.stop();
@@ -533,7 +1924,7 @@ static void handle_connect_route() {
         prefs.putString(WIFI_SSID_KEY, ssid);
         prefs.putString(WIFI_PASS_KEY, pass);
         mark_setup_complete_and_persist();
-        stop_wifi_onboarding();
+        end_wifi_onboarding();
         delay(500);
         ESP.restart();
     } else {
@@ -541,7 +1932,8 @@ static void handle_connect_route() {
     }
 }
 
-void start_wifi_onboarding() {
+static void begin_wifi_onboarding() {
+    if (onboarding.active) return;
     onboarding.ap_ssid = "TankProCYD-" + make_mac_suffix();
     onboarding.ap_pass = make_temp_password();
     WiFi.mode(WIFI_AP_STA);
@@ -564,18 +1956,140 @@ void start_wifi_onboarding() {
     onboarding.server.onNotFound(handle_root_route);
     onboarding.server.begin();
     onboarding.active = true;
-    update_boot_wifi_labels();
+    cyd_ui_post_apply(update_boot_wifi_labels);
+}
+
+// Called from LVGL event handlers; the network task does the actual work.
+void start_wifi_onboarding() {
+    onboarding.request.store(ONBOARDING_REQ_START);
+}
+
+void stop_wifi_onboarding() {
+    onboarding.request.store(ONBOARDING_REQ_STOP);
 }
 
 void handle_onboarding() {
+    switch (onboarding.request.exchange(ONBOARDING_REQ_NONE)) {
+        case ONBOARDING_REQ_START: begin_wifi_onboarding(); break;
+        case ONBOARDING_REQ_STOP: end_wifi_onboarding(); break;
+        default: break;
+    }
     if (!onboarding.active) return;
     onboarding.dns.processNextRequest();
     onboarding.server.handleClient();
 }
 
-static void mark_setup_complete_and_persist() {
+static void net_task_main(void * /*arg*/) {
+    for (;;) {
+        handle_onboarding();
+        delay(2);
+    }
+}
+
+// Raise the refresh ceiling while the user is interacting, drop it once the screen goes quiet.
+static void update_refresh_ceiling(uint32_t now) {
+    const bool interactive = now - last_activity_ms < INTERACTIVE_HOLD_MS;
+    if (interactive == refr_interactive) return;
+    refr_interactive = interactive;
+    lv_timer_set_period(lv_display_get_refr_timer(display),
+                        interactive ? REFR_PERIOD_INTERACTIVE_MS : REFR_PERIOD_IDLE_MS);
+}
+
+// Runs on the LVGL task (lock held) before each lv_timer_handler() pass.
+static void ui_task_hook() {
+    cyd_metrics_observe(metrics.loop_us, cyd_ui_last_pass_us());
+    cyd_touch_point_t touch;
+    while (display_sleep && cyd_touch_peek(&touch)) {
+        if (touch.pressed) {
+            touch_wake_stroke = true;
+            wake_display(touch.us);
+        } else {
+            cyd_touch_pop(&touch);  // release of a touch that started before the display slept
+        }
+    }
+    if (display_sleep) return;
+    // Event-mode indev: one read per queued press, release or run of drag points. Bounded, since
+    // LVGL skips the read during a screen animation.
+    for (uint32_t i = 0; i < CYD_TOUCH_RING_LEN && cyd_touch_peek(&touch); i++) lv_indev_read(touch_indev);
+    cyd_state_bind_active();
+    handle_inactivity();
+    const uint32_t now = millis();
+    update_refresh_ceiling(now);
+    if (now - last_stats_log_ms >= STATS_LOG_INTERVAL_MS) {
+        log_frame_stats();
+#if CYD_FLUSH_TILE_DIFF
+        log_tile_stats();
+#endif
+        log_layer_stats();
+        log_image_stats();
+        log_screen_stats();
+        log_lvgl_mem_stats();
+        log_touch_stats();
+        log_swipe_stats();
+        log_metrics();
+        last_stats_log_ms = now;
+    }
+}
+
+// Hidden entry to the touch calibration: hold the settings header for TOUCH_CAL_HOLD_MS.
+static void cydsettings_header_hold_cb(lv_event_t *e) {
+    const uint32_t now = millis();
+    if (lv_event_get_code(e) == LV_EVENT_PRESSED) {
+        touch_cal_hold_start_ms = now;
+    } else if (now - touch_cal_hold_start_ms >= TOUCH_CAL_HOLD_MS) {
+        touch_cal_start(true);
+    }
+}
+
+// Show the stored settings on the CYD settings screen and save changes made there.
+static void bind_cydsettings_controls() {
+    if (ui_cydsettingsheader) {
+        lv_obj_add_event_cb(ui_cydsettingsheader, cydsettings_header_hold_cb, LV_EVENT_PRESSED, nullptr);
+        lv_obj_add_event_cb(ui_cydsettingsheader, cydsettings_header_hold_cb, LV_EVENT_LONG_PRESSED_REPEAT, nullptr);
+    }
+    if (ui_cydBrightnessSlider) {
+        lv_slider_set_range(ui_cydBrightnessSlider, 0, 100);
+        lv_slider_set_value(ui_cydBrightnessSlider, settings.brightness_pct, LV_ANIM_OFF);
+        lv_obj_add_event_cb(ui_cydBrightnessSlider, lvgl_brightness_cb, LV_EVENT_VALUE_CHANGED, nullptr);
+    }
+    if (ui_cydTimeout) {
+        lv_dropdown_set_selected(ui_cydTimeout, settings.timeout_index);
+        lv_obj_add_event_cb(ui_cydTimeout, lvgl_timeout_cb, LV_EVENT_VALUE_CHANGED, nullptr);
+    }
+    if (ui_cydTheme) {
+        lv_dropdown_set_selected(ui_cydTheme, settings.theme_index);
+        lv_obj_add_event_cb(ui_cydTheme, lvgl_theme_cb, LV_EVENT_VALUE_CHANGED, nullptr);
+    }
+    if (ui_cydUnits) {
+        lv_dropdown_set_selected(ui_cydUnits, settings.units_index);
+        lv_obj_add_event_cb(ui_cydUnits, lvgl_units_cb, LV_EVENT_VALUE_CHANGED, nullptr);
+    }
+    create_orientation_control();
+}
+
+// Runs on every build of a screen (cyd_screens): everything the SquareLine screen lacks.
+static void on_screen_built(cyd_screen_t screen) {
+    ui_register_custom_actions(screen);
+#if CYD_LEVEL_GAUGE
+    replace_level_widgets(screen);
+#endif
+    cyd_state_bind_screen(screen);
+    if (screen == CYD_SCREEN_BOOT && onboarding.active) update_boot_wifi_labels();
+    if (screen == CYD_SCREEN_CYDSETTINGS) bind_cydsettings_controls();
+    if (screen == CYD_SCREEN_HOME && ui_homeCydsettingsButton) {
+        lv_obj_add_event_cb(ui_homeCydsettingsButton, settings_gear_long_press_cb, LV_EVENT_LONG_PRESSED, nullptr);
+    }
+}
+
+static void apply_setup_complete() {
     setup_complete = true;
     cyd_state.setup_complete = true;
+}
+
+// The flags are read by the LVGL task (sleep, screen binders), so they change there; the NVS
+// write stays with the caller, e.g. the network task's /connect route.
+static void mark_setup_complete_and_persist() {
+    cyd_ui_post_apply(apply_setup_complete);
     prefs.putBool(SETUP_FLAG_KEY, true);
 }
 
@@ -589,93 +2103,120 @@ void setup() {
     Serial.println("[boot] CYD display starting");
 
     lcd.init();
-    lcd.setRotation(2);  // Portrait: 240 x 320
+    lcd.setRotation(PANEL_ROTATION[0]);  // Portrait: 240 x 320 until the settings are loaded
     lcd.setBrightness(255);
     current_brightness_duty = 255;
+    // Keep the panel bus claimed so DMA transfers queued from the flush callback run back to back.
+    lcd.startWrite();
     last_activity_ms = millis();
 
     lv_init();
+    lv_tick_set_cb(lvgl_tick_get_cb);
+#if defined(CYD_BLEND_S3) && CYD_BLEND_S3
+    const uint32_t blend_mismatches = cyd_blend_s3_selftest();
+    if (blend_mismatches) {
+        Serial.printf("[blend] PIE self-test failed (%lu px), using scalar loops\n",
+                      static_cast<unsigned long>(blend_mismatches));
+    }
+#endif
     cyd_state_init_defaults();
 
-    static lv_color_t draw_buf1[SCREEN_WIDTH * DRAW_BUF_LINES];
+    // Settings first: the draw buffer overrides and the orientation feed the display bring-up.
+    prefs.begin("cyd", false);
+    load_settings();
+    load_setup_flag();
+    load_touch_cal();
+    register_metrics();
+
     display = lv_display_create(SCREEN_WIDTH, SCREEN_HEIGHT);
     lv_display_set_color_format(display, LV_COLOR_FORMAT_RGB565);
     lv_display_set_flush_cb(display, lvgl_flush_cb);
-    lv_display_set_buffers(display, draw_buf1, nullptr, sizeof(draw_buf1), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_wait_cb(display, lvgl_flush_wait_cb);
+    setup_draw_buffers();
+    cyd_tilediff_init(SCREEN_WIDTH, SCREEN_HEIGHT, push_rect);
+    cyd_imgcache_init(image_cache_budget());
+#if CYD_LAYER_CACHE
+    cyd_layercache_init(PSRAM_HEADROOM_BYTES);
+#endif
+    lv_display_add_event_cb(display, lvgl_refr_event_cb, LV_EVENT_INVALIDATE_AREA, nullptr);
+    lv_display_add_event_cb(display, lvgl_refr_event_cb, LV_EVENT_REFR_START, nullptr);
+    lv_display_add_event_cb(display, lvgl_refr_event_cb, LV_EVENT_REFR_READY, nullptr);
     lv_display_set_default(display);
-    lv_display_set_rotation(display, LV_DISPLAY_ROTATION_180);
 
     touch_indev = lv_indev_create();
     lv_indev_set_type(touch_indev, LV_INDEV_TYPE_POINTER);
     lv_indev_set_read_cb(touch_indev, lvgl_touch_cb);
     lv_indev_set_display(touch_indev, display);
-
-    esp_timer_create_args_t periodic_timer_args = {};
-    periodic_timer_args.callback = lv_tick_cb;
-    periodic_timer_args.name = "lv_tick";
-    periodic_timer_args.dispatch_method = ESP_TIMER_TASK;
-    periodic_timer_args.skip_unhandled_events = false;
-
-    esp_timer_create(&periodic_timer_args, &lvgl_tick_timer);
-    esp_timer_start_periodic(lvgl_tick_timer, LVGL_TICK_MS * 1000);
-
-    prefs.begin("cyd", false);
-    load_settings();
-    load_setup_flag();
-
-    ui_init();
-    ui_register_custom_actions();
-    cyd_state_apply_to_home_screen();
-    cyd_state_apply_to_boot_screen();
-    if (setup_complete) {
-        _ui_screen_change(&ui_home, LV_SCR_LOAD_ANIM_NONE, 0, 0, NULL);
-        cyd_state_apply_to_home_screen();
+    // Read only when ui_task_hook() finds queued points (and by LVGL itself while pressed).
+    lv_indev_set_mode(touch_indev, LV_INDEV_MODE_EVENT);
+    cyd_touchfilter_init(&touch_filter, &TOUCH_FILTER_CFG);
+#if CYD_LIGHT_SLEEP
+    if (CYD_TOUCH_IRQ >= 0) {
+        gpio_wakeup_enable(static_cast<gpio_num_t>(CYD_TOUCH_IRQ), GPIO_INTR_LOW_LEVEL);
+        esp_sleep_enable_gpio_wakeup();
     }
-    log_heap_stats(" setup");
+#endif
+    update_refresh_ceiling(millis());
 
-    // Attach brightness slider with 10–100% range
-    if (ui_cydBrightnessSlider) {
-        lv_slider_set_range(ui_cydBrightnessSlider, 0, 100);
-        lv_slider_set_value(ui_cydBrightnessSlider, settings.brightness_pct, LV_ANIM_OFF);
-        apply_brightness_from_slider(ui_cydBrightnessSlider);
-        lv_obj_add_event_cb(ui_cydBrightnessSlider, lvgl_brightness_cb, LV_EVENT_VALUE_CHANGED, nullptr);
-    }
+    apply_orientation_selection(settings.orientation_index);
+    // The settings act on the display directly; the CYD settings screen only shows them once built.
+    apply_brightness(settings.brightness_pct);
+    apply_timeout_selection(settings.timeout_index);
+    apply_theme_selection(settings.theme_index);
+    cyd_state_set_units_metric(settings.units_index == 0);
 
-    // Attach display timeout dropdown
-    if (ui_cydTimeout) {
-        lv_dropdown_set_selected(ui_cydTimeout, settings.timeout_index);
-        lv_obj_add_event_cb(ui_cydTimeout, lvgl_timeout_cb, LV_EVENT_VALUE_CHANGED, nullptr);
-        apply_timeout_selection(settings.timeout_index);
+    // Screens are built on first use; only the one shown at boot is built now.
+    cyd_screens_init(SCREEN_CACHE_BYTES, on_screen_built);
+    cyd_swipe_init(PSRAM_HEADROOM_BYTES, FULL_FRAME_PUSH_MS, push_rect, wait_panel_dma, swipe_done);
+    cyd_screens_show(setup_complete ? CYD_SCREEN_HOME : CYD_SCREEN_BOOT);
+    // A finger on the screen at power-up calibrates the touch, for when the calibration is too far
+    // off to reach the settings header. Taps count once it has been lifted for a while (a
+    // controller's IRQ pulses can make a held finger look lifted for a read or two).
+    int16_t raw_x = 0;
+    int16_t raw_y = 0;
+    if (read_touch_raw(&raw_x, &raw_y)) {
+        touch_cal_start(false);
+        lv_refr_now(display);
+        for (uint32_t lifted_ms = 0; lifted_ms < TOUCH_CAL_LIFT_MS;) {
+            delay(TOUCH_SAMPLE_PERIOD_MS);
+            lifted_ms = read_touch_raw(&raw_x, &raw_y) ? 0 : lifted_ms + TOUCH_SAMPLE_PERIOD_MS;
+        }
     }
+    confirm_draw_buffers();
+    log_heap_stats(" setup");
+#if CYD_BENCH_FLUSH
+    run_flush_benchmark();
+    lv_obj_invalidate(lv_screen_active());
+#endif
+#if CYD_BENCH_BLEND && defined(CYD_BLEND_S3) && CYD_BLEND_S3
+    run_blend_benchmark();
+#endif
+#if CYD_BENCH_RENDER
+    run_render_benchmark();
+#endif
+#if CYD_BENCH_GAUGE
+    run_gauge_benchmark();
+#endif
+#if CYD_BENCH_TEXT
+    run_text_benchmark();
+#endif
 
-    // Attach theme dropdown
-    if (ui_cydTheme) {
-        lv_dropdown_set_selected(ui_cydTheme, settings.theme_index);
-        lv_obj_add_event_cb(ui_cydTheme, lvgl_theme_cb, LV_EVENT_VALUE_CHANGED, nullptr);
-        apply_theme_selection(settings.theme_index);
+    // From here on LVGL belongs to its own task; other contexts go through cyd_ui_post().
+    if (!cyd_ui_task_start(UI_TASK_CORE, ui_task_hook)) {
+        Serial.println("[boot] failed to start LVGL task");
     }
-
-    // Attach units dropdown
-    if (ui_cydUnits) {
-        cyd_state_set_units_metric(settings.units_index == 0);
-        lv_dropdown_set_selected(ui_cydUnits, settings.units_index);
-        lv_obj_add_event_cb(ui_cydUnits, lvgl_units_cb, LV_EVENT_VALUE_CHANGED, nullptr);
-    } else {
-        cyd_state_set_units_metric(true);
+    // After the LVGL task: a controller sharing the panel bus is read under its lock.
+    if (!cyd_touch_start(TOUCH_TASK_CORE, CYD_TOUCH_IRQ, TOUCH_SAMPLE_PERIOD_MS, read_touch_raw)) {
+        Serial.println("[boot] failed to start touch task");
     }
-
-    // Apply static info to settings
-    cyd_state_apply_to_cydsettings_screen();
+    xTaskCreatePinnedToCore(net_task_main, "net", NET_TASK_STACK_BYTES, nullptr, 1, &net_task, NET_TASK_CORE);
 }
 
 void loop() {
-    lv_timer_handler();
-    handle_onboarding();
-    handle_inactivity();
     const uint32_t now = millis();
-    if (now - last_heap_log_ms >= 5000) {
+    if (now - last_heap_log_ms >= STATS_LOG_INTERVAL_MS) {
         log_heap_stats("");
         last_heap_log_ms = now;
     }
-    delay(5);
+    delay(100);
 }
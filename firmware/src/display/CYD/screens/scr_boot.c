@@ -0,0 +1,361 @@
+/*******************************************************************************
+ * Screen: ui/ui_boot.c
+ * 533 statements -> 60 widgets, 59 style references, 36 themed properties; 13 statements kept as code
+ * Generated by tools/build_ui_tables.py. Do not edit.
+ ******************************************************************************/
+
+#include "ui.h"
+#include "cyd_uitable.h"
+#include "scr_styles.h"
+
+lv_obj_t *uic_directlabel;
+lv_obj_t *uic_bootDirectLabel;
+lv_obj_t *uic_bootDirectButton;
+lv_obj_t *uic_bootDirectPanel;
+lv_obj_t *uic_wifilabel;
+lv_obj_t *uic_wifibuttonlabel;
+lv_obj_t *uic_bootWifiButton;
+lv_obj_t *uic_bootwifipanel;
+lv_obj_t *uic_bootTitle3;
+lv_obj_t *uic_bootTitle;
+lv_obj_t *uic_bootRoot;
+lv_obj_t *uic_boot;
+lv_obj_t *ui_boot = NULL;
+lv_obj_t *ui_bootRoot = NULL;
+lv_obj_t *ui_bootTitle = NULL;
+lv_obj_t *ui_bootTitle3 = NULL;
+lv_obj_t *ui_bootwifipanel = NULL;
+lv_obj_t *ui_bootWifiButton = NULL;
+lv_obj_t *ui_wifibuttonlabel = NULL;
+lv_obj_t *ui_wifidesclabel = NULL;
+lv_obj_t *ui_bootDirectPanel = NULL;
+lv_obj_t *ui_bootDirectButton = NULL;
+lv_obj_t *ui_bootDirectLabel = NULL;
+lv_obj_t *ui_directdesclabel = NULL;
+lv_obj_t *ui_bootFirmwareLabel = NULL;
+lv_obj_t *ui_overlayBootWifi = NULL;
+lv_obj_t *ui_popupbootwifi = NULL;
+lv_obj_t *ui_lblbootwifititle = NULL;
+lv_obj_t *ui_lblbootwifidesc = NULL;
+lv_obj_t *ui_ssid_container = NULL;
+lv_obj_t *ui_Label4 = NULL;
+lv_obj_t *ui_bootWifissid = NULL;
+lv_obj_t *ui_pwd_container1 = NULL;
+lv_obj_t *ui_Label9 = NULL;
+lv_obj_t *ui_bootWifipass = NULL;
+lv_obj_t *ui_Label10 = NULL;
+lv_obj_t *ui_Container4 = NULL;
+lv_obj_t *ui_buttonBootWifiBack = NULL;
+lv_obj_t *ui_Label11 = NULL;
+lv_obj_t *ui_buttonBootWifiNext = NULL;
+lv_obj_t *ui_Label12 = NULL;
+lv_obj_t *ui_overlayBootDirect = NULL;
+lv_obj_t *ui_popupbootwifi1 = NULL;
+lv_obj_t *ui_lbldirect = NULL;
+lv_obj_t *ui_directcont1 = NULL;
+lv_obj_t *ui_Label13 = NULL;
+lv_obj_t *ui_bootdirectlist = NULL;
+lv_obj_t *ui_lblBootDirectEmpty = NULL;
+lv_obj_t *ui_directdevicetemplate = NULL;
+lv_obj_t *ui_lbldirectdevnametemplate = NULL;
+lv_obj_t *ui_lbldirectdeviptemplate = NULL;
+lv_obj_t *ui_direct_buttons = NULL;
+lv_obj_t *ui_buttonbootdirectback = NULL;
+lv_obj_t *ui_Label29 = NULL;
+lv_obj_t *ui_buttonbootdirectscan = NULL;
+lv_obj_t *ui_Label30 = NULL;
+lv_obj_t *ui_overlayAssignDirectRole = NULL;
+lv_obj_t *ui_contasign1 = NULL;
+lv_obj_t *ui_lblasign = NULL;
+lv_obj_t *ui_contasign2 = NULL;
+lv_obj_t *ui_lvlassigndevicetitle = NULL;
+lv_obj_t *ui_DirectAssignDeviceName = NULL;
+lv_obj_t *ui_contasignbuttons = NULL;
+lv_obj_t *ui_buttonbootasignfresh = NULL;
+lv_obj_t *ui_Label28 = NULL;
+lv_obj_t *ui_buttonbootasignwaste = NULL;
+lv_obj_t *ui_Label31 = NULL;
+lv_obj_t *ui_contasignbuttons1 = NULL;
+lv_obj_t *ui_buttonbootasignfresh1 = NULL;
+lv_obj_t *ui_Label23 = NULL;
+lv_obj_t *ui_buttonbootasignwaste1 = NULL;
+lv_obj_t *ui_Label32 = NULL;
+// event functions
+void ui_event_bootWifiButton( lv_event_t * e) {
+    lv_event_code_t event_code = lv_event_get_code(e);
+
+if ( event_code == LV_EVENT_CLICKED) {
+      btn_boot_wifi_event( e );
+}
+}
+
+// build functions
+
+static const cyd_uitable_node_t nodes[] = {
+    {&ui_boot, NULL, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 0, 2, 0},
+    {&ui_bootRoot, &ui_boot, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_bootTitle, &ui_bootRoot, lv_label_create, "SmartRV TankPro", 0, 0, 1, 0, 0},
+    {&ui_bootTitle3, &ui_bootRoot, lv_label_create, "Choose how this display connects to your controller", 0, 0, 1, 0, 0},
+    {&ui_bootwifipanel, &ui_bootRoot, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_bootWifiButton, &ui_bootwifipanel, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_wifibuttonlabel, &ui_bootWifiButton, lv_label_create, "Wi-Fi", 0, 0, 1, 0, 0},
+    {&ui_wifidesclabel, &ui_bootwifipanel, lv_label_create, "Connect to local wifi", 0, 0, 1, 0, 0},
+    {&ui_bootDirectPanel, &ui_bootRoot, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_bootDirectButton, &ui_bootDirectPanel, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_bootDirectLabel, &ui_bootDirectButton, lv_label_create, "Direct", 0, 0, 1, 0, 0},
+    {&ui_directdesclabel, &ui_bootDirectPanel, lv_label_create, "Connect direct to controller", 0, 0, 1, 0, 0},
+    {&ui_bootFirmwareLabel, &ui_bootRoot, lv_label_create, "Firmware: v0.0.1", 0, 0, 1, 2, 0},
+    {&ui_overlayBootWifi, &ui_boot, lv_obj_create, NULL, LV_OBJ_FLAG_HIDDEN, LV_OBJ_FLAG_SCROLLABLE, 1, 2, 1},
+    {&ui_popupbootwifi, &ui_overlayBootWifi, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_lblbootwifititle, &ui_popupbootwifi, lv_label_create, "Wi-Fi Setup", 0, 0, 1, 2, 0},
+    {&ui_lblbootwifidesc, &ui_popupbootwifi, lv_label_create, "Connect to this access point ", 0, 0, 1, 2, 0},
+    {&ui_ssid_container, &ui_overlayBootWifi, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_Label4, &ui_ssid_container, lv_label_create, "SSID", 0, 0, 1, 2, 0},
+    {&ui_bootWifissid, &ui_ssid_container, lv_label_create, "SmartRV-TankPro-xxxx", 0, 0, 1, 2, 0},
+    {&ui_pwd_container1, &ui_overlayBootWifi, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_Label9, &ui_pwd_container1, lv_label_create, "Password", 0, 0, 1, 2, 0},
+    {&ui_bootWifipass, &ui_pwd_container1, lv_label_create, "changeme", 0, 0, 1, 2, 0},
+    {&ui_Label10, &ui_overlayBootWifi, lv_label_create, "-----------------------------------------\nOpen http://192.168.4.1\nFollow Wi-Fi Setup", 0, 0, 1, 2, 0},
+    {&ui_Container4, &ui_overlayBootWifi, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_buttonBootWifiBack, &ui_Container4, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label11, &ui_buttonBootWifiBack, lv_label_create, "Back", 0, 0, 1, 0, 0},
+    {&ui_buttonBootWifiNext, &ui_Container4, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label12, &ui_buttonBootWifiNext, lv_label_create, "Next", 0, 0, 1, 0, 0},
+    {&ui_overlayBootDirect, &ui_boot, lv_obj_create, NULL, LV_OBJ_FLAG_HIDDEN, LV_OBJ_FLAG_SCROLLABLE, 1, 2, 1},
+    {&ui_popupbootwifi1, &ui_overlayBootDirect, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_lbldirect, &ui_popupbootwifi1, lv_label_create, "Direct Setup", 0, 0, 1, 2, 0},
+    {&ui_directcont1, &ui_overlayBootDirect, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_Label13, &ui_directcont1, lv_label_create, "Press and hold PAIR on the controller for 5 seconds\n\nLights on controller will flash\n\nTap SCAN", 0, 0, 1, 2, 0},
+    {&ui_bootdirectlist, &ui_overlayBootDirect, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE, 1, 0, 1},
+    {&ui_lblBootDirectEmpty, &ui_bootdirectlist, lv_label_create, "No Controllers Found", 0, 0, 1, 2, 0},
+    {&ui_directdevicetemplate, &ui_bootdirectlist, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_lbldirectdevnametemplate, &ui_directdevicetemplate, lv_label_create, "TankPro -XXXX", 0, 0, 1, 0, 0},
+    {&ui_lbldirectdeviptemplate, &ui_directdevicetemplate, lv_label_create, "IP: 192.168.10.12", 0, 0, 1, 0, 0},
+    {&ui_direct_buttons, &ui_overlayBootDirect, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_buttonbootdirectback, &ui_direct_buttons, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label29, &ui_buttonbootdirectback, lv_label_create, "Back", 0, 0, 1, 0, 0},
+    {&ui_buttonbootdirectscan, &ui_direct_buttons, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label30, &ui_buttonbootdirectscan, lv_label_create, "Scan", 0, 0, 1, 0, 0},
+    {&ui_overlayAssignDirectRole, &ui_boot, lv_obj_create, NULL, LV_OBJ_FLAG_HIDDEN, LV_OBJ_FLAG_SCROLLABLE, 1, 2, 1},
+    {&ui_contasign1, &ui_overlayAssignDirectRole, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_lblasign, &ui_contasign1, lv_label_create, "Assign Role", 0, 0, 1, 2, 0},
+    {&ui_contasign2, &ui_overlayAssignDirectRole, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_lvlassigndevicetitle, &ui_contasign2, lv_label_create, "Device:", 0, 0, 1, 2, 0},
+    {&ui_DirectAssignDeviceName, &ui_contasign2, lv_label_create, "None", 0, 0, 1, 2, 0},
+    {&ui_contasignbuttons, &ui_overlayAssignDirectRole, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_buttonbootasignfresh, &ui_contasignbuttons, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label28, &ui_buttonbootasignfresh, lv_label_create, "Fresh", 0, 0, 1, 0, 0},
+    {&ui_buttonbootasignwaste, &ui_contasignbuttons, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label31, &ui_buttonbootasignwaste, lv_label_create, "Waste", 0, 0, 1, 0, 0},
+    {&ui_contasignbuttons1, &ui_overlayAssignDirectRole, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_buttonbootasignfresh1, &ui_contasignbuttons1, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label23, &ui_buttonbootasignfresh1, lv_label_create, "Cancel", 0, 0, 1, 0, 0},
+    {&ui_buttonbootasignwaste1, &ui_contasignbuttons1, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label32, &ui_buttonbootasignwaste1, lv_label_create, "Confirm", 0, 0, 1, 0, 0},
+};
+
+static const cyd_uitable_style_t styles[] = {
+    {&scr_style_0, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_bootRoot
+    {&scr_style_1, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_bootTitle
+    {&scr_style_2, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_bootTitle3
+    {&scr_style_3, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_bootwifipanel
+    {&scr_style_4, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_bootWifiButton
+    {&scr_style_5, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wifibuttonlabel
+    {&scr_style_6, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wifidesclabel
+    {&scr_style_3, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_bootDirectPanel
+    {&scr_style_4, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_bootDirectButton
+    {&scr_style_5, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_bootDirectLabel
+    {&scr_style_6, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_directdesclabel
+    {&scr_style_7, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_bootFirmwareLabel
+    {&scr_style_8, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_overlayBootWifi
+    {&scr_style_9, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_popupbootwifi
+    {&scr_style_10, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_lblbootwifititle
+    {&scr_style_11, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_lblbootwifidesc
+    {&scr_style_12, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_ssid_container
+    {&scr_style_13, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label4
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_bootWifissid
+    {&scr_style_15, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_pwd_container1
+    {&scr_style_13, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label9
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_bootWifipass
+    {&scr_style_16, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label10
+    {&scr_style_17, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Container4
+    {&scr_style_18, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_buttonBootWifiBack
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label11
+    {&scr_style_18, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_buttonBootWifiNext
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label12
+    {&scr_style_8, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_overlayBootDirect
+    {&scr_style_19, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_popupbootwifi1
+    {&scr_style_10, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_lbldirect
+    {&scr_style_20, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_directcont1
+    {&scr_style_21, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label13
+    {&scr_style_22, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_bootdirectlist
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_lblBootDirectEmpty
+    {&scr_style_23, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_directdevicetemplate
+    {&scr_style_24, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_lbldirectdevnametemplate
+    {&scr_style_25, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_lbldirectdeviptemplate
+    {&scr_style_26, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_direct_buttons
+    {&scr_style_18, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_buttonbootdirectback
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label29
+    {&scr_style_18, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_buttonbootdirectscan
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label30
+    {&scr_style_8, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_overlayAssignDirectRole
+    {&scr_style_27, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_contasign1
+    {&scr_style_10, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_lblasign
+    {&scr_style_28, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_contasign2
+    {&scr_style_29, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_lvlassigndevicetitle
+    {&scr_style_29, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_DirectAssignDeviceName
+    {&scr_style_30, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_contasignbuttons
+    {&scr_style_18, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_buttonbootasignfresh
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label28
+    {&scr_style_18, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_buttonbootasignwaste
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label31
+    {&scr_style_26, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_contasignbuttons1
+    {&scr_style_18, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_buttonbootasignfresh1
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label23
+    {&scr_style_18, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_buttonbootasignwaste1
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label32
+};
+
+static const cyd_uitable_themed_t themed[] = {
+    {_ui_theme_color_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_COLOR},  // ui_boot
+    {_ui_theme_alpha_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_OPA},  // ui_boot
+    {_ui_theme_color_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_bootFirmwareLabel
+    {_ui_theme_alpha_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_bootFirmwareLabel
+    {_ui_theme_color_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_COLOR},  // ui_overlayBootWifi
+    {_ui_theme_alpha_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_OPA},  // ui_overlayBootWifi
+    {_ui_theme_color_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_lblbootwifititle
+    {_ui_theme_alpha_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_lblbootwifititle
+    {_ui_theme_color_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_lblbootwifidesc
+    {_ui_theme_alpha_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_lblbootwifidesc
+    {_ui_theme_color_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_Label4
+    {_ui_theme_alpha_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_Label4
+    {_ui_theme_color_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_bootWifissid
+    {_ui_theme_alpha_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_bootWifissid
+    {_ui_theme_color_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_Label9
+    {_ui_theme_alpha_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_Label9
+    {_ui_theme_color_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_bootWifipass
+    {_ui_theme_alpha_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_bootWifipass
+    {_ui_theme_color_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_Label10
+    {_ui_theme_alpha_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_Label10
+    {_ui_theme_color_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_COLOR},  // ui_overlayBootDirect
+    {_ui_theme_alpha_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_OPA},  // ui_overlayBootDirect
+    {_ui_theme_color_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_lbldirect
+    {_ui_theme_alpha_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_lbldirect
+    {_ui_theme_color_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_Label13
+    {_ui_theme_alpha_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_Label13
+    {_ui_theme_color_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_lblBootDirectEmpty
+    {_ui_theme_alpha_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_lblBootDirectEmpty
+    {_ui_theme_color_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_COLOR},  // ui_overlayAssignDirectRole
+    {_ui_theme_alpha_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_OPA},  // ui_overlayAssignDirectRole
+    {_ui_theme_color_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_lblasign
+    {_ui_theme_alpha_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_lblasign
+    {_ui_theme_color_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_lvlassigndevicetitle
+    {_ui_theme_alpha_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_lvlassigndevicetitle
+    {_ui_theme_color_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_DirectAssignDeviceName
+    {_ui_theme_alpha_text, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_DirectAssignDeviceName
+};
+
+static const cyd_uitable_screen_t screen = {
+    nodes,
+    styles,
+    themed,
+    sizeof(nodes) / sizeof(nodes[0]),
+};
+
+void ui_boot_screen_init(void)
+{
+    cyd_uitable_build(&screen);
+    lv_obj_add_event_cb(ui_bootWifiButton, ui_event_bootWifiButton, LV_EVENT_ALL, NULL);
+    uic_boot = ui_boot;
+    uic_bootRoot = ui_bootRoot;
+    uic_bootTitle = ui_bootTitle;
+    uic_bootTitle3 = ui_bootTitle3;
+    uic_bootwifipanel = ui_bootwifipanel;
+    uic_bootWifiButton = ui_bootWifiButton;
+    uic_wifibuttonlabel = ui_wifibuttonlabel;
+    uic_wifilabel = ui_wifidesclabel;
+    uic_bootDirectPanel = ui_bootDirectPanel;
+    uic_bootDirectButton = ui_bootDirectButton;
+    uic_bootDirectLabel = ui_bootDirectLabel;
+    uic_directlabel = ui_directdesclabel;
+}
+
+void ui_boot_screen_destroy(void)
+{
+   if (ui_boot) lv_obj_del(ui_boot);
+
+// NULL screen variables
+uic_boot= NULL;
+ui_boot= NULL;
+uic_bootRoot= NULL;
+ui_bootRoot= NULL;
+uic_bootTitle= NULL;
+ui_bootTitle= NULL;
+uic_bootTitle3= NULL;
+ui_bootTitle3= NULL;
+uic_bootwifipanel= NULL;
+ui_bootwifipanel= NULL;
+uic_bootWifiButton= NULL;
+ui_bootWifiButton= NULL;
+uic_wifibuttonlabel= NULL;
+ui_wifibuttonlabel= NULL;
+uic_wifilabel= NULL;
+ui_wifidesclabel= NULL;
+uic_bootDirectPanel= NULL;
+ui_bootDirectPanel= NULL;
+uic_bootDirectButton= NULL;
+ui_bootDirectButton= NULL;
+uic_bootDirectLabel= NULL;
+ui_bootDirectLabel= NULL;
+uic_directlabel= NULL;
+ui_directdesclabel= NULL;
+ui_bootFirmwareLabel= NULL;
+ui_overlayBootWifi= NULL;
+ui_popupbootwifi= NULL;
+ui_lblbootwifititle= NULL;
+ui_lblbootwifidesc= NULL;
+ui_ssid_container= NULL;
+ui_Label4= NULL;
+ui_bootWifissid= NULL;
+ui_pwd_container1= NULL;
+ui_Label9= NULL;
+ui_bootWifipass= NULL;
+ui_Label10= NULL;
+ui_Container4= NULL;
+ui_buttonBootWifiBack= NULL;
+ui_Label11= NULL;
+ui_buttonBootWifiNext= NULL;
+ui_Label12= NULL;
+ui_overlayBootDirect= NULL;
+ui_popupbootwifi1= NULL;
+ui_lbldirect= NULL;
+ui_directcont1= NULL;
+ui_Label13= NULL;
+ui_bootdirectlist= NULL;
+ui_lblBootDirectEmpty= NULL;
+ui_directdevicetemplate= NULL;
+ui_lbldirectdevnametemplate= NULL;
+ui_lbldirectdeviptemplate= NULL;
+ui_direct_buttons= NULL;
+ui_buttonbootdirectback= NULL;
+ui_Label29= NULL;
+ui_buttonbootdirectscan= NULL;
+ui_Label30= NULL;
+ui_overlayAssignDirectRole= NULL;
+ui_contasign1= NULL;
+ui_lblasign= NULL;
+ui_contasign2= NULL;
+ui_lvlassigndevicetitle= NULL;
+ui_DirectAssignDeviceName= NULL;
+ui_contasignbuttons= NULL;
+ui_buttonbootasignfresh= NULL;
+ui_Label28= NULL;
+ui_buttonbootasignwaste= NULL;
+ui_Label31= NULL;
+ui_contasignbuttons1= NULL;
+ui_buttonbootasignfresh1= NULL;
+ui_Label23= NULL;
+ui_buttonbootasignwaste1= NULL;
+ui_Label32= NULL;
+
+}
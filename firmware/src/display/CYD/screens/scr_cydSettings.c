@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * Screen: ui/ui_cydSettings.c
+ * 147 statements -> 18 widgets, 17 style references, 2 themed properties; 7 statements kept as code
+ * Generated by tools/build_ui_tables.py. Do not edit.
+ ******************************************************************************/
+
+#include "ui.h"
+#include "cyd_uitable.h"
+#include "scr_styles.h"
+
+lv_obj_t *ui_cydsettings = NULL;
+lv_obj_t *ui_CYDSettingsRoot = NULL;
+lv_obj_t *ui_cydsettingsheader = NULL;
+lv_obj_t *ui_Label33 = NULL;
+lv_obj_t *ui_cydsettingsBackButton = NULL;
+lv_obj_t *ui_Label39 = NULL;
+lv_obj_t *ui_Panel11 = NULL;
+lv_obj_t *ui_contset = NULL;
+lv_obj_t *ui_cydBrightnessSlider = NULL;
+lv_obj_t *ui_cydTimeout = NULL;
+lv_obj_t *ui_cydTheme = NULL;
+lv_obj_t *ui_cydUnits = NULL;
+lv_obj_t *ui_Container21 = NULL;
+lv_obj_t *ui_Label35 = NULL;
+lv_obj_t *ui_Label14 = NULL;
+lv_obj_t *ui_Label15 = NULL;
+lv_obj_t *ui_Label37 = NULL;
+lv_obj_t *ui_cydFirmwareLabel = NULL;
+// event functions
+
+// build functions
+
+static const cyd_uitable_node_t nodes[] = {
+    {&ui_cydsettings, NULL, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 0, 2, 0},
+    {&ui_CYDSettingsRoot, &ui_cydsettings, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_cydsettingsheader, &ui_CYDSettingsRoot, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label33, &ui_cydsettingsheader, lv_label_create, "Display Settings", 0, 0, 1, 0, 0},
+    {&ui_cydsettingsBackButton, &ui_cydsettingsheader, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label39, &ui_cydsettingsBackButton, lv_label_create, "<", 0, 0, 1, 0, 0},
+    {&ui_Panel11, &ui_CYDSettingsRoot, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_contset, &ui_Panel11, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_cydBrightnessSlider, &ui_contset, lv_slider_create, NULL, 0, 0, 1, 0, 0},
+    {&ui_cydTimeout, &ui_contset, lv_dropdown_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, 0, 1, 0, 0},
+    {&ui_cydTheme, &ui_contset, lv_dropdown_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, 0, 1, 0, 0},
+    {&ui_cydUnits, &ui_contset, lv_dropdown_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, 0, 1, 0, 0},
+    {&ui_Container21, &ui_Panel11, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_Label35, &ui_Container21, lv_label_create, "Brightness", 0, 0, 1, 0, 0},
+    {&ui_Label14, &ui_Container21, lv_label_create, "Timeout", 0, 0, 1, 0, 0},
+    {&ui_Label15, &ui_Container21, lv_label_create, "Theme", 0, 0, 1, 0, 0},
+    {&ui_Label37, &ui_Container21, lv_label_create, "Units", 0, 0, 1, 0, 0},
+    {&ui_cydFirmwareLabel, &ui_Panel11, lv_label_create, "versiontest", 0, 0, 1, 0, 0},
+};
+
+static const cyd_uitable_style_t styles[] = {
+    {&scr_style_31, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_CYDSettingsRoot
+    {&scr_style_32, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_cydsettingsheader
+    {&scr_style_33, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label33
+    {&scr_style_34, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_cydsettingsBackButton
+    {&scr_style_35, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label39
+    {&scr_style_36, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Panel11
+    {&scr_style_37, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_contset
+    {&scr_style_38, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_cydBrightnessSlider
+    {&scr_style_39, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_cydTimeout
+    {&scr_style_39, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_cydTheme
+    {&scr_style_39, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_cydUnits
+    {&scr_style_40, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Container21
+    {&scr_style_41, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label35
+    {&scr_style_42, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label14
+    {&scr_style_43, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label15
+    {&scr_style_44, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label37
+    {&scr_style_45, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_cydFirmwareLabel
+};
+
+static const cyd_uitable_themed_t themed[] = {
+    {_ui_theme_color_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_COLOR},  // ui_cydsettings
+    {_ui_theme_alpha_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_OPA},  // ui_cydsettings
+};
+
+static const cyd_uitable_screen_t screen = {
+    nodes,
+    styles,
+    themed,
+    sizeof(nodes) / sizeof(nodes[0]),
+};
+
+void ui_cydsettings_screen_init(void)
+{
+    cyd_uitable_build(&screen);
+    lv_slider_set_value( ui_cydBrightnessSlider, 0, LV_ANIM_OFF);
+    if (lv_slider_get_mode(ui_cydBrightnessSlider)==LV_SLIDER_MODE_RANGE ) lv_slider_set_left_value( ui_cydBrightnessSlider, 0, LV_ANIM_OFF);
+    //Compensating for LVGL9.1 draw crash with bar/slider max value when top-padding is nonzero and right-padding is 0
+    if (lv_obj_get_style_pad_top(ui_cydBrightnessSlider,LV_PART_MAIN) > 0) lv_obj_set_style_pad_right( ui_cydBrightnessSlider, lv_obj_get_style_pad_right(ui_cydBrightnessSlider,LV_PART_MAIN) + 1, LV_PART_MAIN );
+    lv_dropdown_set_dir( ui_cydTimeout, LV_DIR_TOP);
+    lv_dropdown_set_options( ui_cydTimeout, "Never\n30s\n1m\n2m" );
+    lv_dropdown_set_options( ui_cydTheme, "Light\nDark" );
+    lv_dropdown_set_options( ui_cydUnits, "Metric\nImperial" );
+}
+
+void ui_cydsettings_screen_destroy(void)
+{
+   if (ui_cydsettings) lv_obj_del(ui_cydsettings);
+
+// NULL screen variables
+ui_cydsettings= NULL;
+ui_CYDSettingsRoot= NULL;
+ui_cydsettingsheader= NULL;
+ui_Label33= NULL;
+ui_cydsettingsBackButton= NULL;
+ui_Label39= NULL;
+ui_Panel11= NULL;
+ui_contset= NULL;
+ui_cydBrightnessSlider= NULL;
+ui_cydTimeout= NULL;
+ui_cydTheme= NULL;
+ui_cydUnits= NULL;
+ui_Container21= NULL;
+ui_Label35= NULL;
+ui_Label14= NULL;
+ui_Label15= NULL;
+ui_Label37= NULL;
+ui_cydFirmwareLabel= NULL;
+
+}
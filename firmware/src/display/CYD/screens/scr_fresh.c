@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * Screen: ui/ui_fresh.c
+ * 238 statements -> 29 widgets, 29 style references, 4 themed properties; 7 statements kept as code
+ * Generated by tools/build_ui_tables.py. Do not edit.
+ ******************************************************************************/
+
+#include "ui.h"
+#include "cyd_uitable.h"
+#include "scr_styles.h"
+
+lv_obj_t *uic_fresh;
+lv_obj_t *ui_fresh = NULL;
+lv_obj_t *ui_freshroot = NULL;
+lv_obj_t *ui_freshheader = NULL;
+lv_obj_t *ui_Label36 = NULL;
+lv_obj_t *ui_freshSettingsButton = NULL;
+lv_obj_t *ui_freshBackButton = NULL;
+lv_obj_t *ui_Label41 = NULL;
+lv_obj_t *ui_freshMainCard = NULL;
+lv_obj_t *ui_freshLevelBar = NULL;
+lv_obj_t *ui_freshLevelLabel = NULL;
+lv_obj_t *ui_Container10 = NULL;
+lv_obj_t *ui_freshTempLabel = NULL;
+lv_obj_t *ui_FreshStatusLabel = NULL;
+lv_obj_t *ui_freshLeakLabel = NULL;
+lv_obj_t *ui_freshFreezeLabel = NULL;
+lv_obj_t *ui_freshlabels = NULL;
+lv_obj_t *ui_Label25 = NULL;
+lv_obj_t *ui_Label26 = NULL;
+lv_obj_t *ui_Label1 = NULL;
+lv_obj_t *ui_Label2 = NULL;
+lv_obj_t *ui_freshFaultCont = NULL;
+lv_obj_t *ui_Label27 = NULL;
+lv_obj_t *ui_freshFaultButton = NULL;
+lv_obj_t *ui_freshFaultButtonLabel = NULL;
+lv_obj_t *ui_freshControlPanel = NULL;
+lv_obj_t *ui_freshFillButton = NULL;
+lv_obj_t *ui_freshFillLabel = NULL;
+lv_obj_t *ui_freshDrainButton = NULL;
+lv_obj_t *ui_freshDrainLabel = NULL;
+// event functions
+
+// build functions
+
+static const cyd_uitable_node_t nodes[] = {
+    {&ui_fresh, NULL, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 0, 2, 0},
+    {&ui_freshroot, &ui_fresh, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_freshheader, &ui_freshroot, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label36, &ui_freshheader, lv_label_create, "Fresh", 0, 0, 1, 2, 0},
+    {&ui_freshSettingsButton, &ui_freshheader, lv_image_create, NULL, LV_OBJ_FLAG_CLICKABLE, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_freshBackButton, &ui_freshheader, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label41, &ui_freshBackButton, lv_label_create, "<", 0, 0, 1, 0, 0},
+    {&ui_freshMainCard, &ui_freshroot, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_freshLevelBar, &ui_freshMainCard, lv_bar_create, NULL, 0, 0, 2, 0, 0},
+    {&ui_freshLevelLabel, &ui_freshMainCard, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_Container10, &ui_freshMainCard, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_freshTempLabel, &ui_Container10, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_FreshStatusLabel, &ui_Container10, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_freshLeakLabel, &ui_Container10, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_freshFreezeLabel, &ui_Container10, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_freshlabels, &ui_freshMainCard, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_Label25, &ui_freshlabels, lv_label_create, "Temp", 0, 0, 1, 0, 0},
+    {&ui_Label26, &ui_freshlabels, lv_label_create, "Status", 0, 0, 1, 0, 0},
+    {&ui_Label1, &ui_freshlabels, lv_label_create, "Leak", 0, 0, 1, 0, 0},
+    {&ui_Label2, &ui_freshlabels, lv_label_create, "Freeze", 0, 0, 1, 0, 0},
+    {&ui_freshFaultCont, &ui_freshMainCard, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_Label27, &ui_freshFaultCont, lv_label_create, "Fault", 0, 0, 1, 0, 0},
+    {&ui_freshFaultButton, &ui_freshFaultCont, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_freshFaultButtonLabel, &ui_freshFaultButton, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_freshControlPanel, &ui_freshroot, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_freshFillButton, &ui_freshControlPanel, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_freshFillLabel, &ui_freshFillButton, lv_label_create, "FILL", 0, 0, 1, 0, 0},
+    {&ui_freshDrainButton, &ui_freshControlPanel, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_freshDrainLabel, &ui_freshDrainButton, lv_label_create, "DRAIN", 0, 0, 1, 0, 0},
+};
+
+static const cyd_uitable_style_t styles[] = {
+    {&scr_style_46, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshroot
+    {&scr_style_47, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshheader
+    {&scr_style_48, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label36
+    {&scr_style_49, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshSettingsButton
+    {&scr_style_34, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshBackButton
+    {&scr_style_35, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label41
+    {&scr_style_50, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshMainCard
+    {&scr_style_51, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshLevelBar
+    {&scr_style_52, LV_PART_INDICATOR | LV_STATE_DEFAULT},  // ui_freshLevelBar
+    {&scr_style_53, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshLevelLabel
+    {&scr_style_54, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Container10
+    {&scr_style_55, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshTempLabel
+    {&scr_style_56, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_FreshStatusLabel
+    {&scr_style_55, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshLeakLabel
+    {&scr_style_55, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshFreezeLabel
+    {&scr_style_57, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshlabels
+    {&scr_style_58, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label25
+    {&scr_style_59, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label26
+    {&scr_style_58, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label1
+    {&scr_style_58, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label2
+    {&scr_style_60, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshFaultCont
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label27
+    {&scr_style_61, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshFaultButton
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshFaultButtonLabel
+    {&scr_style_62, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshControlPanel
+    {&scr_style_63, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshFillButton
+    {&scr_style_64, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshFillLabel
+    {&scr_style_63, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshDrainButton
+    {&scr_style_64, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshDrainLabel
+};
+
+static const cyd_uitable_themed_t themed[] = {
+    {_ui_theme_color_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_COLOR},  // ui_fresh
+    {_ui_theme_alpha_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_OPA},  // ui_fresh
+    {_ui_theme_color_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_Label36
+    {_ui_theme_alpha_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_Label36
+};
+
+static const cyd_uitable_screen_t screen = {
+    nodes,
+    styles,
+    themed,
+    sizeof(nodes) / sizeof(nodes[0]),
+};
+
+void ui_fresh_screen_init(void)
+{
+    cyd_uitable_build(&screen);
+    lv_image_set_src(ui_freshSettingsButton, &ui_img_314706763);
+    lv_bar_set_value(ui_freshLevelBar,75,LV_ANIM_OFF);
+    lv_bar_set_start_value(ui_freshLevelBar, 0, LV_ANIM_OFF);
+    lv_obj_set_scrollbar_mode(ui_freshLevelBar, LV_SCROLLBAR_MODE_OFF);
+    lv_obj_set_scroll_dir(ui_freshLevelBar, LV_DIR_TOP);
+    //Compensating for LVGL9.1 draw crash with bar/slider max value when top-padding is nonzero and right-padding is 0
+    if (lv_obj_get_style_pad_top(ui_freshLevelBar,LV_PART_MAIN) > 0) lv_obj_set_style_pad_right( ui_freshLevelBar, lv_obj_get_style_pad_right(ui_freshLevelBar,LV_PART_MAIN) + 1, LV_PART_MAIN );
+    uic_fresh = ui_fresh;
+}
+
+void ui_fresh_screen_destroy(void)
+{
+   if (ui_fresh) lv_obj_del(ui_fresh);
+
+// NULL screen variables
+uic_fresh= NULL;
+ui_fresh= NULL;
+ui_freshroot= NULL;
+ui_freshheader= NULL;
+ui_Label36= NULL;
+ui_freshSettingsButton= NULL;
+ui_freshBackButton= NULL;
+ui_Label41= NULL;
+ui_freshMainCard= NULL;
+ui_freshLevelBar= NULL;
+ui_freshLevelLabel= NULL;
+ui_Container10= NULL;
+ui_freshTempLabel= NULL;
+ui_FreshStatusLabel= NULL;
+ui_freshLeakLabel= NULL;
+ui_freshFreezeLabel= NULL;
+ui_freshlabels= NULL;
+ui_Label25= NULL;
+ui_Label26= NULL;
+ui_Label1= NULL;
+ui_Label2= NULL;
+ui_freshFaultCont= NULL;
+ui_Label27= NULL;
+ui_freshFaultButton= NULL;
+ui_freshFaultButtonLabel= NULL;
+ui_freshControlPanel= NULL;
+ui_freshFillButton= NULL;
+ui_freshFillLabel= NULL;
+ui_freshDrainButton= NULL;
+ui_freshDrainLabel= NULL;
+
+}
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Screen: ui/ui_freshfaults.c
+ * 98 statements -> 13 widgets, 13 style references, 2 themed properties; 1 statements kept as code
+ * Generated by tools/build_ui_tables.py. Do not edit.
+ ******************************************************************************/
+
+#include "ui.h"
+#include "cyd_uitable.h"
+#include "scr_styles.h"
+
+lv_obj_t *uic_Fresh_Faults;
+lv_obj_t *ui_freshfaults = NULL;
+lv_obj_t *ui_freshFaultPopupOverlay2 = NULL;
+lv_obj_t *ui_Label20 = NULL;
+lv_obj_t *ui_freshfaultscard = NULL;
+lv_obj_t *ui_freshfaultsCodeLabel = NULL;
+lv_obj_t *ui_Label16 = NULL;
+lv_obj_t *ui_freshfaultsdescription = NULL;
+lv_obj_t *ui_freshfaultsCodeDescription = NULL;
+lv_obj_t *ui_FreshPopupButtons2 = NULL;
+lv_obj_t *ui_freshfaultsBackButton = NULL;
+lv_obj_t *ui_Label17 = NULL;
+lv_obj_t *ui_freshfaultsClearButton = NULL;
+lv_obj_t *ui_Label18 = NULL;
+// event functions
+
+// build functions
+
+static const cyd_uitable_node_t nodes[] = {
+    {&ui_freshfaults, NULL, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 0, 2, 0},
+    {&ui_freshFaultPopupOverlay2, &ui_freshfaults, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_Label20, &ui_freshFaultPopupOverlay2, lv_label_create, "Fault Details", 0, 0, 1, 0, 0},
+    {&ui_freshfaultscard, &ui_freshFaultPopupOverlay2, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_freshfaultsCodeLabel, &ui_freshfaultscard, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_Label16, &ui_freshfaultscard, lv_label_create, "Description:", 0, 0, 1, 0, 0},
+    {&ui_freshfaultsdescription, &ui_freshfaultscard, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_freshfaultsCodeDescription, &ui_freshfaultsdescription, lv_label_create, "\nNo Active Fault", 0, 0, 1, 0, 0},
+    {&ui_FreshPopupButtons2, &ui_freshFaultPopupOverlay2, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 2, 0, 1},
+    {&ui_freshfaultsBackButton, &ui_FreshPopupButtons2, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label17, &ui_freshfaultsBackButton, lv_label_create, "Back", 0, 0, 1, 0, 0},
+    {&ui_freshfaultsClearButton, &ui_FreshPopupButtons2, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label18, &ui_freshfaultsClearButton, lv_label_create, "Clear", 0, 0, 1, 0, 0},
+};
+
+static const cyd_uitable_style_t styles[] = {
+    {&scr_style_65, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshFaultPopupOverlay2
+    {&scr_style_66, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label20
+    {&scr_style_67, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshfaultscard
+    {&scr_style_68, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshfaultsCodeLabel
+    {&scr_style_69, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label16
+    {&scr_style_70, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshfaultsdescription
+    {&scr_style_71, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshfaultsCodeDescription
+    {&scr_style_72, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_FreshPopupButtons2
+    {&scr_style_73, LV_PART_SCROLLBAR | LV_STATE_DEFAULT},  // ui_FreshPopupButtons2
+    {&scr_style_74, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshfaultsBackButton
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label17
+    {&scr_style_75, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshfaultsClearButton
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label18
+};
+
+static const cyd_uitable_themed_t themed[] = {
+    {_ui_theme_color_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_COLOR},  // ui_freshfaults
+    {_ui_theme_alpha_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_OPA},  // ui_freshfaults
+};
+
+static const cyd_uitable_screen_t screen = {
+    nodes,
+    styles,
+    themed,
+    sizeof(nodes) / sizeof(nodes[0]),
+};
+
+void ui_freshfaults_screen_init(void)
+{
+    cyd_uitable_build(&screen);
+    uic_Fresh_Faults = ui_freshfaults;
+}
+
+void ui_freshfaults_screen_destroy(void)
+{
+   if (ui_freshfaults) lv_obj_del(ui_freshfaults);
+
+// NULL screen variables
+uic_Fresh_Faults= NULL;
+ui_freshfaults= NULL;
+ui_freshFaultPopupOverlay2= NULL;
+ui_Label20= NULL;
+ui_freshfaultscard= NULL;
+ui_freshfaultsCodeLabel= NULL;
+ui_Label16= NULL;
+ui_freshfaultsdescription= NULL;
+ui_freshfaultsCodeDescription= NULL;
+ui_FreshPopupButtons2= NULL;
+ui_freshfaultsBackButton= NULL;
+ui_Label17= NULL;
+ui_freshfaultsClearButton= NULL;
+ui_Label18= NULL;
+
+}
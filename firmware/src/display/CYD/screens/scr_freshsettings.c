@@ -0,0 +1,280 @@
+/*******************************************************************************
+ * Screen: ui/ui_freshsettings.c
+ * 405 statements -> 56 widgets, 58 style references, 4 themed properties; 7 statements kept as code
+ * Generated by tools/build_ui_tables.py. Do not edit.
+ ******************************************************************************/
+
+#include "ui.h"
+#include "cyd_uitable.h"
+#include "scr_styles.h"
+
+lv_obj_t *ui_freshsettings = NULL;
+lv_obj_t *ui_freshsettingsroot = NULL;
+lv_obj_t *ui_freshsettingsheader = NULL;
+lv_obj_t *ui_Label43 = NULL;
+lv_obj_t *ui_freshsettingsBackButton = NULL;
+lv_obj_t *ui_Label40 = NULL;
+lv_obj_t *ui_freshsettingsMainCard = NULL;
+lv_obj_t *ui_freshsettingslabels = NULL;
+lv_obj_t *ui_Label38 = NULL;
+lv_obj_t *ui_Label49 = NULL;
+lv_obj_t *ui_Label50 = NULL;
+lv_obj_t *ui_Label46 = NULL;
+lv_obj_t *ui_Label47 = NULL;
+lv_obj_t *ui_Label48 = NULL;
+lv_obj_t *ui_Label52 = NULL;
+lv_obj_t *ui_Label53 = NULL;
+lv_obj_t *ui_freshsettingsControls = NULL;
+lv_obj_t *ui_freshsettingsFillLevelButton = NULL;
+lv_obj_t *ui_freshsettingsFillStopLevelLabel = NULL;
+lv_obj_t *ui_freshsettingsSetFullButton = NULL;
+lv_obj_t *ui_freshsettingsFullVoltage = NULL;
+lv_obj_t *ui_freshsettingsSetEmptyButton = NULL;
+lv_obj_t *ui_freshsettingsEmptyVoltage = NULL;
+lv_obj_t *ui_freshsettingsFreezeProtection = NULL;
+lv_obj_t *ui_freshsettingsRestart = NULL;
+lv_obj_t *ui_freshsettingsSafetyOveride = NULL;
+lv_obj_t *ui_freshsettingsValveOveride = NULL;
+lv_obj_t *ui_freshsettingsDiagnostic = NULL;
+lv_obj_t *ui_freshsettingsFillOverlay = NULL;
+lv_obj_t *ui_freshsettingsOverlayFillSlider = NULL;
+lv_obj_t *ui_freshsettingsOverlayFillPercentage = NULL;
+lv_obj_t *ui_freshsettingsOverlayBackButton = NULL;
+lv_obj_t *ui_Label51 = NULL;
+lv_obj_t *ui_freshsettingsDiagnosticOverlay = NULL;
+lv_obj_t *ui_Container7 = NULL;
+lv_obj_t *ui_Container5 = NULL;
+lv_obj_t *ui_Label54 = NULL;
+lv_obj_t *ui_Label55 = NULL;
+lv_obj_t *ui_Label56 = NULL;
+lv_obj_t *ui_Label57 = NULL;
+lv_obj_t *ui_Label58 = NULL;
+lv_obj_t *ui_Label59 = NULL;
+lv_obj_t *ui_Label60 = NULL;
+lv_obj_t *ui_Label61 = NULL;
+lv_obj_t *ui_Label62 = NULL;
+lv_obj_t *ui_Container6 = NULL;
+lv_obj_t *ui_freshsettingsdiagoverlayIP = NULL;
+lv_obj_t *ui_freshsettingsdiagoverlayID = NULL;
+lv_obj_t *ui_freshsettingsdiagoverlayMAC = NULL;
+lv_obj_t *ui_freshsettingsdiagoverlayStatus = NULL;
+lv_obj_t *ui_freshsettingsdiagoverlayRole = NULL;
+lv_obj_t *ui_freshsettingsdiagoverlayUptime = NULL;
+lv_obj_t *ui_freshsettingsdiagoverlaySignal = NULL;
+lv_obj_t *ui_freshsettingsdiagoverlayVersion = NULL;
+lv_obj_t *ui_freshsettingDiagnosticOverlayBackButton = NULL;
+lv_obj_t *ui_Label63 = NULL;
+// event functions
+
+// build functions
+
+static const cyd_uitable_node_t nodes[] = {
+    {&ui_freshsettings, NULL, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_freshsettingsroot, &ui_freshsettings, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 2, 1},
+    {&ui_freshsettingsheader, &ui_freshsettingsroot, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label43, &ui_freshsettingsheader, lv_label_create, "Fresh Settings", 0, 0, 1, 2, 0},
+    {&ui_freshsettingsBackButton, &ui_freshsettingsheader, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label40, &ui_freshsettingsBackButton, lv_label_create, "<", 0, 0, 1, 0, 0},
+    {&ui_freshsettingsMainCard, &ui_freshsettingsroot, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLL_CHAIN, 1, 0, 0},
+    {&ui_freshsettingslabels, &ui_freshsettingsMainCard, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_Label38, &ui_freshsettingslabels, lv_label_create, "Fill Stop Level", 0, 0, 1, 0, 0},
+    {&ui_Label49, &ui_freshsettingslabels, lv_label_create, "Set Tank Full", 0, 0, 1, 0, 0},
+    {&ui_Label50, &ui_freshsettingslabels, lv_label_create, "Set Tank Empty", 0, 0, 1, 0, 0},
+    {&ui_Label46, &ui_freshsettingslabels, lv_label_create, "Freeze Protection", 0, 0, 1, 0, 0},
+    {&ui_Label47, &ui_freshsettingslabels, lv_label_create, "Restart Device", 0, 0, 1, 0, 0},
+    {&ui_Label48, &ui_freshsettingslabels, lv_label_create, "Safety Overide", 0, 0, 1, 0, 0},
+    {&ui_Label52, &ui_freshsettingslabels, lv_label_create, "Valve Overide", 0, 0, 1, 0, 0},
+    {&ui_Label53, &ui_freshsettingslabels, lv_label_create, "Diagnostic", 0, 0, 1, 0, 0},
+    {&ui_freshsettingsControls, &ui_freshsettingsMainCard, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_freshsettingsFillLevelButton, &ui_freshsettingsControls, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_freshsettingsFillStopLevelLabel, &ui_freshsettingsFillLevelButton, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_freshsettingsSetFullButton, &ui_freshsettingsControls, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_freshsettingsFullVoltage, &ui_freshsettingsSetFullButton, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_freshsettingsSetEmptyButton, &ui_freshsettingsControls, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_freshsettingsEmptyVoltage, &ui_freshsettingsSetEmptyButton, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_freshsettingsFreezeProtection, &ui_freshsettingsControls, lv_dropdown_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, 0, 2, 0, 0},
+    {&ui_freshsettingsRestart, &ui_freshsettingsControls, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_freshsettingsSafetyOveride, &ui_freshsettingsControls, lv_switch_create, NULL, 0, 0, 1, 0, 0},
+    {&ui_freshsettingsValveOveride, &ui_freshsettingsControls, lv_switch_create, NULL, 0, 0, 1, 0, 0},
+    {&ui_freshsettingsDiagnostic, &ui_freshsettingsControls, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_freshsettingsFillOverlay, &ui_freshsettings, lv_obj_create, NULL, LV_OBJ_FLAG_HIDDEN, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_freshsettingsOverlayFillSlider, &ui_freshsettingsFillOverlay, lv_slider_create, NULL, 0, 0, 2, 0, 0},
+    {&ui_freshsettingsOverlayFillPercentage, &ui_freshsettingsFillOverlay, lv_label_create, "60%", 0, 0, 1, 0, 0},
+    {&ui_freshsettingsOverlayBackButton, &ui_freshsettingsFillOverlay, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label51, &ui_freshsettingsOverlayBackButton, lv_label_create, "Set", 0, 0, 1, 0, 0},
+    {&ui_freshsettingsDiagnosticOverlay, &ui_freshsettings, lv_obj_create, NULL, LV_OBJ_FLAG_HIDDEN, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_Container7, &ui_freshsettingsDiagnosticOverlay, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE, 1, 0, 1},
+    {&ui_Container5, &ui_Container7, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_Label54, &ui_Container5, lv_label_create, "IP", 0, 0, 1, 0, 0},
+    {&ui_Label55, &ui_Container5, lv_label_create, "ID", 0, 0, 1, 0, 0},
+    {&ui_Label56, &ui_Container5, lv_label_create, "MAC", 0, 0, 1, 0, 0},
+    {&ui_Label57, &ui_Container5, lv_label_create, "Status", 0, 0, 1, 0, 0},
+    {&ui_Label58, &ui_Container5, lv_label_create, "Role", 0, 0, 1, 0, 0},
+    {&ui_Label59, &ui_Container5, lv_label_create, "Uptime", 0, 0, 1, 0, 0},
+    {&ui_Label60, &ui_Container5, lv_label_create, "Signal", 0, 0, 1, 0, 0},
+    {&ui_Label61, &ui_Container5, lv_label_create, "Version", 0, 0, 1, 0, 0},
+    {&ui_Label62, &ui_Container5, lv_label_create, "", 0, 0, 1, 0, 0},
+    {&ui_Container6, &ui_Container7, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_freshsettingsdiagoverlayIP, &ui_Container6, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_freshsettingsdiagoverlayID, &ui_Container6, lv_label_create, "text", 0, 0, 1, 0, 0},
+    {&ui_freshsettingsdiagoverlayMAC, &ui_Container6, lv_label_create, "text", 0, 0, 1, 0, 0},
+    {&ui_freshsettingsdiagoverlayStatus, &ui_Container6, lv_label_create, "text", 0, 0, 1, 0, 0},
+    {&ui_freshsettingsdiagoverlayRole, &ui_Container6, lv_label_create, "text", 0, 0, 1, 0, 0},
+    {&ui_freshsettingsdiagoverlayUptime, &ui_Container6, lv_label_create, "text", 0, 0, 1, 0, 0},
+    {&ui_freshsettingsdiagoverlaySignal, &ui_Container6, lv_label_create, "text", 0, 0, 1, 0, 0},
+    {&ui_freshsettingsdiagoverlayVersion, &ui_Container6, lv_label_create, "text", 0, 0, 1, 0, 0},
+    {&ui_freshsettingDiagnosticOverlayBackButton, &ui_freshsettingsDiagnosticOverlay, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label63, &ui_freshsettingDiagnosticOverlayBackButton, lv_label_create, "Back", 0, 0, 1, 0, 0},
+};
+
+static const cyd_uitable_style_t styles[] = {
+    {&scr_style_76, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettings
+    {&scr_style_46, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsroot
+    {&scr_style_47, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsheader
+    {&scr_style_77, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label43
+    {&scr_style_34, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsBackButton
+    {&scr_style_35, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label40
+    {&scr_style_78, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsMainCard
+    {&scr_style_79, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingslabels
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label38
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label49
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label50
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label46
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label47
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label48
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label52
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label53
+    {&scr_style_80, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsControls
+    {&scr_style_81, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsFillLevelButton
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsFillStopLevelLabel
+    {&scr_style_82, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsSetFullButton
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsFullVoltage
+    {&scr_style_82, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsSetEmptyButton
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsEmptyVoltage
+    {&scr_style_83, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsFreezeProtection
+    {&scr_style_84, LV_PART_INDICATOR | LV_STATE_DEFAULT},  // ui_freshsettingsFreezeProtection
+    {&scr_style_82, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsRestart
+    {&scr_style_82, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsSafetyOveride
+    {&scr_style_82, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsValveOveride
+    {&scr_style_82, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsDiagnostic
+    {&scr_style_85, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsFillOverlay
+    {&scr_style_86, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsOverlayFillSlider
+    {&scr_style_87, LV_PART_KNOB | LV_STATE_DEFAULT},  // ui_freshsettingsOverlayFillSlider
+    {&scr_style_88, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsOverlayFillPercentage
+    {&scr_style_89, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsOverlayBackButton
+    {&scr_style_90, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label51
+    {&scr_style_91, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsDiagnosticOverlay
+    {&scr_style_92, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Container7
+    {&scr_style_93, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Container5
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label54
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label55
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label56
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label57
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label58
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label59
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label60
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label61
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label62
+    {&scr_style_94, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Container6
+    {&scr_style_95, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsdiagoverlayIP
+    {&scr_style_95, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsdiagoverlayID
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsdiagoverlayMAC
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsdiagoverlayStatus
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsdiagoverlayRole
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsdiagoverlayUptime
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsdiagoverlaySignal
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingsdiagoverlayVersion
+    {&scr_style_96, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshsettingDiagnosticOverlayBackButton
+    {&scr_style_90, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label63
+};
+
+static const cyd_uitable_themed_t themed[] = {
+    {_ui_theme_color_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_COLOR},  // ui_freshsettingsroot
+    {_ui_theme_alpha_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_OPA},  // ui_freshsettingsroot
+    {_ui_theme_color_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_Label43
+    {_ui_theme_alpha_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_Label43
+};
+
+static const cyd_uitable_screen_t screen = {
+    nodes,
+    styles,
+    themed,
+    sizeof(nodes) / sizeof(nodes[0]),
+};
+
+void ui_freshsettings_screen_init(void)
+{
+    cyd_uitable_build(&screen);
+    lv_obj_set_scrollbar_mode(ui_freshsettingsMainCard, LV_SCROLLBAR_MODE_ACTIVE);
+    lv_obj_set_scroll_dir(ui_freshsettingsMainCard, LV_DIR_VER);
+    lv_dropdown_set_options( ui_freshsettingsFreezeProtection, "Off\n1\n2\n3\n4\n5" );
+    lv_obj_set_style_text_align(lv_dropdown_get_list(ui_freshsettingsFreezeProtection), LV_TEXT_ALIGN_CENTER,  LV_PART_MAIN| LV_STATE_DEFAULT);
+    lv_slider_set_value( ui_freshsettingsOverlayFillSlider, 60, LV_ANIM_OFF);
+    if (lv_slider_get_mode(ui_freshsettingsOverlayFillSlider)==LV_SLIDER_MODE_RANGE ) lv_slider_set_left_value( ui_freshsettingsOverlayFillSlider, 0, LV_ANIM_OFF);
+    //Compensating for LVGL9.1 draw crash with bar/slider max value when top-padding is nonzero and right-padding is 0
+    if (lv_obj_get_style_pad_top(ui_freshsettingsOverlayFillSlider,LV_PART_MAIN) > 0) lv_obj_set_style_pad_right( ui_freshsettingsOverlayFillSlider, lv_obj_get_style_pad_right(ui_freshsettingsOverlayFillSlider,LV_PART_MAIN) + 1, LV_PART_MAIN );
+}
+
+void ui_freshsettings_screen_destroy(void)
+{
+   if (ui_freshsettings) lv_obj_del(ui_freshsettings);
+
+// NULL screen variables
+ui_freshsettings= NULL;
+ui_freshsettingsroot= NULL;
+ui_freshsettingsheader= NULL;
+ui_Label43= NULL;
+ui_freshsettingsBackButton= NULL;
+ui_Label40= NULL;
+ui_freshsettingsMainCard= NULL;
+ui_freshsettingslabels= NULL;
+ui_Label38= NULL;
+ui_Label49= NULL;
+ui_Label50= NULL;
+ui_Label46= NULL;
+ui_Label47= NULL;
+ui_Label48= NULL;
+ui_Label52= NULL;
+ui_Label53= NULL;
+ui_freshsettingsControls= NULL;
+ui_freshsettingsFillLevelButton= NULL;
+ui_freshsettingsFillStopLevelLabel= NULL;
+ui_freshsettingsSetFullButton= NULL;
+ui_freshsettingsFullVoltage= NULL;
+ui_freshsettingsSetEmptyButton= NULL;
+ui_freshsettingsEmptyVoltage= NULL;
+ui_freshsettingsFreezeProtection= NULL;
+ui_freshsettingsRestart= NULL;
+ui_freshsettingsSafetyOveride= NULL;
+ui_freshsettingsValveOveride= NULL;
+ui_freshsettingsDiagnostic= NULL;
+ui_freshsettingsFillOverlay= NULL;
+ui_freshsettingsOverlayFillSlider= NULL;
+ui_freshsettingsOverlayFillPercentage= NULL;
+ui_freshsettingsOverlayBackButton= NULL;
+ui_Label51= NULL;
+ui_freshsettingsDiagnosticOverlay= NULL;
+ui_Container7= NULL;
+ui_Container5= NULL;
+ui_Label54= NULL;
+ui_Label55= NULL;
+ui_Label56= NULL;
+ui_Label57= NULL;
+ui_Label58= NULL;
+ui_Label59= NULL;
+ui_Label60= NULL;
+ui_Label61= NULL;
+ui_Label62= NULL;
+ui_Container6= NULL;
+ui_freshsettingsdiagoverlayIP= NULL;
+ui_freshsettingsdiagoverlayID= NULL;
+ui_freshsettingsdiagoverlayMAC= NULL;
+ui_freshsettingsdiagoverlayStatus= NULL;
+ui_freshsettingsdiagoverlayRole= NULL;
+ui_freshsettingsdiagoverlayUptime= NULL;
+ui_freshsettingsdiagoverlaySignal= NULL;
+ui_freshsettingsdiagoverlayVersion= NULL;
+ui_freshsettingDiagnosticOverlayBackButton= NULL;
+ui_Label63= NULL;
+
+}
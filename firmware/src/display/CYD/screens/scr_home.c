@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * Screen: ui/ui_home.c
+ * 187 statements -> 21 widgets, 25 style references, 4 themed properties; 5 statements kept as code
+ * Generated by tools/build_ui_tables.py. Do not edit.
+ ******************************************************************************/
+
+#include "ui.h"
+#include "cyd_uitable.h"
+#include "scr_styles.h"
+
+lv_obj_t *uic_homeGreyTitleLabel;
+lv_obj_t *uic_home;
+lv_obj_t *ui_home = NULL;
+lv_obj_t *ui_homeroot = NULL;
+lv_obj_t *ui_homeheader = NULL;
+lv_obj_t *ui_Label42 = NULL;
+lv_obj_t *ui_homeCydsettingsButton = NULL;
+lv_obj_t *ui_homeFreshCard = NULL;
+lv_obj_t *ui_homeFreshLevelArc = NULL;
+lv_obj_t *ui_homeFreshLevelLabel = NULL;
+lv_obj_t *ui_homefreshcont = NULL;
+lv_obj_t *ui_homeFreshTitleLabel = NULL;
+lv_obj_t *ui_homeFreshStatusLabel = NULL;
+lv_obj_t *ui_homeFreshTempLabel = NULL;
+lv_obj_t *ui_homeWasteCard = NULL;
+lv_obj_t *ui_homegreycont = NULL;
+lv_obj_t *ui_homeGreyTitleLabel = NULL;
+lv_obj_t *ui_homeGreyStatusLabel = NULL;
+lv_obj_t *ui_homeGreyTempLabel = NULL;
+lv_obj_t *ui_homeGreyLevelArc = NULL;
+lv_obj_t *ui_homeGreyLevelLabel = NULL;
+lv_obj_t *ui_homeFreshButton = NULL;
+lv_obj_t *ui_homeWasteButton = NULL;
+// event functions
+
+// build functions
+
+static const cyd_uitable_node_t nodes[] = {
+    {&ui_home, NULL, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 1, 2, 0},
+    {&ui_homeroot, &ui_home, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_homeheader, &ui_homeroot, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label42, &ui_homeheader, lv_label_create, "Home\n", 0, 0, 1, 2, 0},
+    {&ui_homeCydsettingsButton, &ui_homeheader, lv_image_create, NULL, LV_OBJ_FLAG_CLICKABLE, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_homeFreshCard, &ui_homeroot, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_homeFreshLevelArc, &ui_homeFreshCard, lv_arc_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE, 3, 0, 0},
+    {&ui_homeFreshLevelLabel, &ui_homeFreshLevelArc, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_homefreshcont, &ui_homeFreshCard, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_homeFreshTitleLabel, &ui_homefreshcont, lv_label_create, "Fresh", 0, 0, 1, 0, 0},
+    {&ui_homeFreshStatusLabel, &ui_homefreshcont, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_homeFreshTempLabel, &ui_homefreshcont, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_homeWasteCard, &ui_homeroot, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_homegreycont, &ui_homeWasteCard, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_homeGreyTitleLabel, &ui_homegreycont, lv_label_create, "Waste", 0, 0, 1, 0, 0},
+    {&ui_homeGreyStatusLabel, &ui_homegreycont, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_homeGreyTempLabel, &ui_homegreycont, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_homeGreyLevelArc, &ui_homeWasteCard, lv_arc_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE, 3, 0, 0},
+    {&ui_homeGreyLevelLabel, &ui_homeGreyLevelArc, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_homeFreshButton, &ui_home, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_homeWasteButton, &ui_home, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+};
+
+static const cyd_uitable_style_t styles[] = {
+    {&scr_style_97, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_home
+    {&scr_style_98, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homeroot
+    {&scr_style_99, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homeheader
+    {&scr_style_48, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label42
+    {&scr_style_100, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homeCydsettingsButton
+    {&scr_style_101, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homeFreshCard
+    {&scr_style_102, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homeFreshLevelArc
+    {&scr_style_103, LV_PART_INDICATOR | LV_STATE_DEFAULT},  // ui_homeFreshLevelArc
+    {&scr_style_104, LV_PART_KNOB | LV_STATE_DEFAULT},  // ui_homeFreshLevelArc
+    {&scr_style_105, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homeFreshLevelLabel
+    {&scr_style_106, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homefreshcont
+    {&scr_style_107, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homeFreshTitleLabel
+    {&scr_style_108, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homeFreshStatusLabel
+    {&scr_style_109, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homeFreshTempLabel
+    {&scr_style_101, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homeWasteCard
+    {&scr_style_106, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homegreycont
+    {&scr_style_107, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homeGreyTitleLabel
+    {&scr_style_108, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homeGreyStatusLabel
+    {&scr_style_110, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homeGreyTempLabel
+    {&scr_style_102, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homeGreyLevelArc
+    {&scr_style_103, LV_PART_INDICATOR | LV_STATE_DEFAULT},  // ui_homeGreyLevelArc
+    {&scr_style_87, LV_PART_KNOB | LV_STATE_DEFAULT},  // ui_homeGreyLevelArc
+    {&scr_style_105, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homeGreyLevelLabel
+    {&scr_style_111, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homeFreshButton
+    {&scr_style_112, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_homeWasteButton
+};
+
+static const cyd_uitable_themed_t themed[] = {
+    {_ui_theme_color_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_COLOR},  // ui_home
+    {_ui_theme_alpha_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_OPA},  // ui_home
+    {_ui_theme_color_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_Label42
+    {_ui_theme_alpha_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_Label42
+};
+
+static const cyd_uitable_screen_t screen = {
+    nodes,
+    styles,
+    themed,
+    sizeof(nodes) / sizeof(nodes[0]),
+};
+
+void ui_home_screen_init(void)
+{
+    cyd_uitable_build(&screen);
+    lv_image_set_src(ui_homeCydsettingsButton, &ui_img_314706763);
+    lv_arc_set_value(ui_homeFreshLevelArc, 75);
+    lv_arc_set_value(ui_homeGreyLevelArc, 22);
+    uic_home = ui_home;
+    uic_homeGreyTitleLabel = ui_homeGreyTitleLabel;
+}
+
+void ui_home_screen_destroy(void)
+{
+   if (ui_home) lv_obj_del(ui_home);
+
+// NULL screen variables
+uic_home= NULL;
+ui_home= NULL;
+ui_homeroot= NULL;
+ui_homeheader= NULL;
+ui_Label42= NULL;
+ui_homeCydsettingsButton= NULL;
+ui_homeFreshCard= NULL;
+ui_homeFreshLevelArc= NULL;
+ui_homeFreshLevelLabel= NULL;
+ui_homefreshcont= NULL;
+ui_homeFreshTitleLabel= NULL;
+ui_homeFreshStatusLabel= NULL;
+ui_homeFreshTempLabel= NULL;
+ui_homeWasteCard= NULL;
+ui_homegreycont= NULL;
+uic_homeGreyTitleLabel= NULL;
+ui_homeGreyTitleLabel= NULL;
+ui_homeGreyStatusLabel= NULL;
+ui_homeGreyTempLabel= NULL;
+ui_homeGreyLevelArc= NULL;
+ui_homeGreyLevelLabel= NULL;
+ui_homeFreshButton= NULL;
+ui_homeWasteButton= NULL;
+
+}
@@ -0,0 +1,1496 @@
+/*******************************************************************************
+ * 122 styles replacing 1694 local style properties.
+ * Generated by tools/build_ui_tables.py. Do not edit.
+ ******************************************************************************/
+
+#include "scr_styles.h"
+
+static const lv_style_const_prop_t scr_style_0_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_SPACE_EVENLY),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_SPACE_EVENLY),
+    LV_STYLE_CONST_HEIGHT(300),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_ROW(2),
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_X(-1),
+    LV_STYLE_CONST_Y(1),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_0, (void *)scr_style_0_props);
+
+static const lv_style_const_prop_t scr_style_1_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_TOP_MID),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xF8, 0xF2, 0xF2)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_20),
+    LV_STYLE_CONST_TEXT_OPA(255),
+    LV_STYLE_CONST_WIDTH(197),
+    LV_STYLE_CONST_X(12),
+    LV_STYLE_CONST_Y(-316),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_1, (void *)scr_style_1_props);
+
+static const lv_style_const_prop_t scr_style_2_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_TOP_MID),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xF8, 0xF2, 0xF2)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_12),
+    LV_STYLE_CONST_TEXT_OPA(255),
+    LV_STYLE_CONST_WIDTH(200),
+    LV_STYLE_CONST_X(12),
+    LV_STYLE_CONST_Y(-316),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_2, (void *)scr_style_2_props);
+
+static const lv_style_const_prop_t scr_style_3_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xCC, 0xC5, 0xC5)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(90),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_RADIUS(20),
+    LV_STYLE_CONST_WIDTH(200),
+    LV_STYLE_CONST_X(-50),
+    LV_STYLE_CONST_Y(-36),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_3, (void *)scr_style_3_props);
+
+static const lv_style_const_prop_t scr_style_4_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(50),
+    LV_STYLE_CONST_WIDTH(180),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-12),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_4, (void *)scr_style_4_props);
+
+static const lv_style_const_prop_t scr_style_5_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_18),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_5, (void *)scr_style_5_props);
+
+static const lv_style_const_prop_t scr_style_6_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_12),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-21),
+    LV_STYLE_CONST_Y(102),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_6, (void *)scr_style_6_props);
+
+static const lv_style_const_prop_t scr_style_7_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_10),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(59),
+    LV_STYLE_CONST_Y(3),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_7, (void *)scr_style_7_props);
+
+static const lv_style_const_prop_t scr_style_8_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BLEND_MODE(LV_BLEND_MODE_NORMAL),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(295),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_OPA(240),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_ROW(3),
+    LV_STYLE_CONST_WIDTH(240),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_8, (void *)scr_style_8_props);
+
+static const lv_style_const_prop_t scr_style_9_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(86),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(8),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_RADIUS(12),
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_X(1),
+    LV_STYLE_CONST_Y(-53),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_9, (void *)scr_style_9_props);
+
+static const lv_style_const_prop_t scr_style_10_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_30),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_10, (void *)scr_style_10_props);
+
+static const lv_style_const_prop_t scr_style_11_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_PCT(49)),
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_16),
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_11, (void *)scr_style_11_props);
+
+static const lv_style_const_prop_t scr_style_12_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(50),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_ROW(10),
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_12, (void *)scr_style_12_props);
+
+static const lv_style_const_prop_t scr_style_13_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_TEXT_DECOR(LV_TEXT_DECOR_UNDERLINE),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_13, (void *)scr_style_13_props);
+
+static const lv_style_const_prop_t scr_style_14_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_14, (void *)scr_style_14_props);
+
+static const lv_style_const_prop_t scr_style_15_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(45),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_ROW(10),
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_15, (void *)scr_style_15_props);
+
+static const lv_style_const_prop_t scr_style_16_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(2),
+    LV_STYLE_CONST_Y(-24),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_16, (void *)scr_style_16_props);
+
+static const lv_style_const_prop_t scr_style_17_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_ROW),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(50),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(15),
+    LV_STYLE_CONST_PAD_ROW(1),
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_17, (void *)scr_style_17_props);
+
+static const lv_style_const_prop_t scr_style_18_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(40),
+    LV_STYLE_CONST_WIDTH(80),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_18, (void *)scr_style_18_props);
+
+static const lv_style_const_prop_t scr_style_19_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(40),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(8),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_RADIUS(12),
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_X(1),
+    LV_STYLE_CONST_Y(-53),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_19, (void *)scr_style_19_props);
+
+static const lv_style_const_prop_t scr_style_20_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(108),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_ROW(10),
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_20, (void *)scr_style_20_props);
+
+static const lv_style_const_prop_t scr_style_21_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_PCT(99)),
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)),
+    LV_STYLE_CONST_X(1),
+    LV_STYLE_CONST_Y(-93),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_21, (void *)scr_style_21_props);
+
+static const lv_style_const_prop_t scr_style_22_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x90, 0x86, 0x86)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x22, 0x8F, 0xE5)),
+    LV_STYLE_CONST_BORDER_OPA(255),
+    LV_STYLE_CONST_BORDER_WIDTH(1),
+    LV_STYLE_CONST_HEIGHT(89),
+    LV_STYLE_CONST_RADIUS(12),
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_22, (void *)scr_style_22_props);
+
+static const lv_style_const_prop_t scr_style_23_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xF4, 0xEF, 0xEF)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_ROW),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(40),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(7),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_RADIUS(10),
+    LV_STYLE_CONST_WIDTH(200),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-1),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_23, (void *)scr_style_23_props);
+
+static const lv_style_const_prop_t scr_style_24_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_12),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(51),
+    LV_STYLE_CONST_Y(14),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_24, (void *)scr_style_24_props);
+
+static const lv_style_const_prop_t scr_style_25_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_12),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_25, (void *)scr_style_25_props);
+
+static const lv_style_const_prop_t scr_style_26_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_ROW),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(47),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(15),
+    LV_STYLE_CONST_PAD_ROW(1),
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_26, (void *)scr_style_26_props);
+
+static const lv_style_const_prop_t scr_style_27_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(43),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(8),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_RADIUS(12),
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_X(1),
+    LV_STYLE_CONST_Y(-53),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_27, (void *)scr_style_27_props);
+
+static const lv_style_const_prop_t scr_style_28_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(100),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_ROW(35),
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_28, (void *)scr_style_28_props);
+
+static const lv_style_const_prop_t scr_style_29_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_PCT(10)),
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)),
+    LV_STYLE_CONST_X(-4),
+    LV_STYLE_CONST_Y(-51),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_29, (void *)scr_style_29_props);
+
+static const lv_style_const_prop_t scr_style_30_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_ROW),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_HEIGHT(97),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(15),
+    LV_STYLE_CONST_PAD_ROW(1),
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_30, (void *)scr_style_30_props);
+
+static const lv_style_const_prop_t scr_style_31_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(320),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_ROW(10),
+    LV_STYLE_CONST_WIDTH(240),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_31, (void *)scr_style_31_props);
+
+static const lv_style_const_prop_t scr_style_32_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xCC, 0xC5, 0xC5)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_HEIGHT(50),
+    LV_STYLE_CONST_RADIUS(0),
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-134),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_32, (void *)scr_style_32_props);
+
+static const lv_style_const_prop_t scr_style_33_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_20),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(19),
+    LV_STYLE_CONST_Y(0),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_33, (void *)scr_style_33_props);
+
+static const lv_style_const_prop_t scr_style_34_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x99, 0xA5)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_HEIGHT(40),
+    LV_STYLE_CONST_OUTLINE_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_OUTLINE_OPA(255),
+    LV_STYLE_CONST_OUTLINE_PAD(0),
+    LV_STYLE_CONST_OUTLINE_WIDTH(3),
+    LV_STYLE_CONST_RADIUS(50),
+    LV_STYLE_CONST_WIDTH(40),
+    LV_STYLE_CONST_X(-93),
+    LV_STYLE_CONST_Y(0),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_34, (void *)scr_style_34_props);
+
+static const lv_style_const_prop_t scr_style_35_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_26),
+    LV_STYLE_CONST_TEXT_OPA(255),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-2),
+    LV_STYLE_CONST_Y(1),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_35, (void *)scr_style_35_props);
+
+static const lv_style_const_prop_t scr_style_36_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xCC, 0xC5, 0xC5)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_HEIGHT(250),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_ROW(10),
+    LV_STYLE_CONST_WIDTH(224),
+    LV_STYLE_CONST_X(-15),
+    LV_STYLE_CONST_Y(-38),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_36, (void *)scr_style_36_props);
+
+static const lv_style_const_prop_t scr_style_37_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_SPACE_EVENLY),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(179),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_WIDTH(111),
+    LV_STYLE_CONST_X(47),
+    LV_STYLE_CONST_Y(-32),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_37, (void *)scr_style_37_props);
+
+static const lv_style_const_prop_t scr_style_38_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(10),
+    LV_STYLE_CONST_WIDTH(90),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_38, (void *)scr_style_38_props);
+
+static const lv_style_const_prop_t scr_style_39_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(110),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_39, (void *)scr_style_39_props);
+
+static const lv_style_const_prop_t scr_style_40_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(189),
+    LV_STYLE_CONST_WIDTH(100),
+    LV_STYLE_CONST_X(-58),
+    LV_STYLE_CONST_Y(-24),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_40, (void *)scr_style_40_props);
+
+static const lv_style_const_prop_t scr_style_41_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-4),
+    LV_STYLE_CONST_Y(-81),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_41, (void *)scr_style_41_props);
+
+static const lv_style_const_prop_t scr_style_42_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-6),
+    LV_STYLE_CONST_Y(-43),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_42, (void *)scr_style_42_props);
+
+static const lv_style_const_prop_t scr_style_43_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-6),
+    LV_STYLE_CONST_Y(1),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_43, (void *)scr_style_43_props);
+
+static const lv_style_const_prop_t scr_style_44_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-2),
+    LV_STYLE_CONST_Y(50),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_44, (void *)scr_style_44_props);
+
+static const lv_style_const_prop_t scr_style_45_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(103),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_45, (void *)scr_style_45_props);
+
+static const lv_style_const_prop_t scr_style_46_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_HEIGHT(320),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_ROW(10),
+    LV_STYLE_CONST_WIDTH(240),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_46, (void *)scr_style_46_props);
+
+static const lv_style_const_prop_t scr_style_47_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xCC, 0xC5, 0xC5)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_HEIGHT(50),
+    LV_STYLE_CONST_RADIUS(0),
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)),
+    LV_STYLE_CONST_X(-16),
+    LV_STYLE_CONST_Y(4),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_47, (void *)scr_style_47_props);
+
+static const lv_style_const_prop_t scr_style_48_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_TOP_MID),
+    LV_STYLE_CONST_HEIGHT(LV_PCT(100)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_26),
+    LV_STYLE_CONST_WIDTH(LV_PCT(50)),
+    LV_STYLE_CONST_X(11),
+    LV_STYLE_CONST_Y(-3),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_48, (void *)scr_style_48_props);
+
+static const lv_style_const_prop_t scr_style_49_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(84),
+    LV_STYLE_CONST_Y(0),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_49, (void *)scr_style_49_props);
+
+static const lv_style_const_prop_t scr_style_50_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xCC, 0xC5, 0xC5)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_HEIGHT(180),
+    LV_STYLE_CONST_RADIUS(15),
+    LV_STYLE_CONST_WIDTH(224),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_50, (void *)scr_style_50_props);
+
+static const lv_style_const_prop_t scr_style_51_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(50),
+    LV_STYLE_CONST_RADIUS(5),
+    LV_STYLE_CONST_TRANSFORM_ROTATION(2700),
+    LV_STYLE_CONST_WIDTH(120),
+    LV_STYLE_CONST_X(106),
+    LV_STYLE_CONST_Y(69),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_51, (void *)scr_style_51_props);
+
+static const lv_style_const_prop_t scr_style_52_props[] = {
+    LV_STYLE_CONST_RADIUS(5),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_52, (void *)scr_style_52_props);
+
+static const lv_style_const_prop_t scr_style_53_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(71),
+    LV_STYLE_CONST_Y(63),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_53, (void *)scr_style_53_props);
+
+static const lv_style_const_prop_t scr_style_54_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN_WRAP),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_SPACE_EVENLY),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(120),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_WIDTH(60),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-15),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_54, (void *)scr_style_54_props);
+
+static const lv_style_const_prop_t scr_style_55_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(4),
+    LV_STYLE_CONST_Y(-61),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_55, (void *)scr_style_55_props);
+
+static const lv_style_const_prop_t scr_style_56_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(4),
+    LV_STYLE_CONST_Y(-24),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_56, (void *)scr_style_56_props);
+
+static const lv_style_const_prop_t scr_style_57_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_SPACE_EVENLY),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(120),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_WIDTH(60),
+    LV_STYLE_CONST_X(-70),
+    LV_STYLE_CONST_Y(-15),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_57, (void *)scr_style_57_props);
+
+static const lv_style_const_prop_t scr_style_58_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-65),
+    LV_STYLE_CONST_Y(-61),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_58, (void *)scr_style_58_props);
+
+static const lv_style_const_prop_t scr_style_59_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-63),
+    LV_STYLE_CONST_Y(-25),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_59, (void *)scr_style_59_props);
+
+static const lv_style_const_prop_t scr_style_60_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_ROW),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_SPACE_EVENLY),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(36),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_WIDTH(168),
+    LV_STYLE_CONST_X(-33),
+    LV_STYLE_CONST_Y(57),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_60, (void *)scr_style_60_props);
+
+static const lv_style_const_prop_t scr_style_61_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(30),
+    LV_STYLE_CONST_WIDTH(50),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(11),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_61, (void *)scr_style_61_props);
+
+static const lv_style_const_prop_t scr_style_62_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xCC, 0xC5, 0xC5)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_ROW),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(60),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_RADIUS(15),
+    LV_STYLE_CONST_WIDTH(224),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_62, (void *)scr_style_62_props);
+
+static const lv_style_const_prop_t scr_style_63_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(50),
+    LV_STYLE_CONST_RADIUS(20),
+    LV_STYLE_CONST_WIDTH(100),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_63, (void *)scr_style_63_props);
+
+static const lv_style_const_prop_t scr_style_64_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_24),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_64, (void *)scr_style_64_props);
+
+static const lv_style_const_prop_t scr_style_65_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xD4, 0x6B, 0x6B)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_HEIGHT(308),
+    LV_STYLE_CONST_RADIUS(15),
+    LV_STYLE_CONST_WIDTH(227),
+    LV_STYLE_CONST_X(1),
+    LV_STYLE_CONST_Y(-3),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_65, (void *)scr_style_65_props);
+
+static const lv_style_const_prop_t scr_style_66_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-102),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_66, (void *)scr_style_66_props);
+
+static const lv_style_const_prop_t scr_style_67_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(192),
+    LV_STYLE_CONST_RADIUS(15),
+    LV_STYLE_CONST_WIDTH(200),
+    LV_STYLE_CONST_X(-1),
+    LV_STYLE_CONST_Y(10),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_67, (void *)scr_style_67_props);
+
+static const lv_style_const_prop_t scr_style_68_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-86),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_68, (void *)scr_style_68_props);
+
+static const lv_style_const_prop_t scr_style_69_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-60),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_69, (void *)scr_style_69_props);
+
+static const lv_style_const_prop_t scr_style_70_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(122),
+    LV_STYLE_CONST_WIDTH(170),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(14),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_70, (void *)scr_style_70_props);
+
+static const lv_style_const_prop_t scr_style_71_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_PCT(100)),
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_71, (void *)scr_style_71_props);
+
+static const lv_style_const_prop_t scr_style_72_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_ROW),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_SPACE_EVENLY),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(50),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_WIDTH(222),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(125),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_72, (void *)scr_style_72_props);
+
+static const lv_style_const_prop_t scr_style_73_props[] = {
+    LV_STYLE_CONST_PAD_COLUMN(10),
+    LV_STYLE_CONST_PAD_ROW(10),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_73, (void *)scr_style_73_props);
+
+static const lv_style_const_prop_t scr_style_74_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(40),
+    LV_STYLE_CONST_WIDTH(100),
+    LV_STYLE_CONST_X(-51),
+    LV_STYLE_CONST_Y(116),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_74, (void *)scr_style_74_props);
+
+static const lv_style_const_prop_t scr_style_75_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(40),
+    LV_STYLE_CONST_WIDTH(100),
+    LV_STYLE_CONST_X(37),
+    LV_STYLE_CONST_Y(67),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_75, (void *)scr_style_75_props);
+
+static const lv_style_const_prop_t scr_style_76_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_76, (void *)scr_style_76_props);
+
+static const lv_style_const_prop_t scr_style_77_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_TOP_MID),
+    LV_STYLE_CONST_HEIGHT(LV_PCT(160)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_20),
+    LV_STYLE_CONST_WIDTH(LV_PCT(94)),
+    LV_STYLE_CONST_X(35),
+    LV_STYLE_CONST_Y(-1),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_77, (void *)scr_style_77_props);
+
+static const lv_style_const_prop_t scr_style_78_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xCC, 0xC5, 0xC5)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_ROW),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_HEIGHT(254),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_RADIUS(15),
+    LV_STYLE_CONST_WIDTH(224),
+    LV_STYLE_CONST_X(-1),
+    LV_STYLE_CONST_Y(-96),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_78, (void *)scr_style_78_props);
+
+static const lv_style_const_prop_t scr_style_79_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_HEIGHT(368),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_ROW(24),
+    LV_STYLE_CONST_WIDTH(129),
+    LV_STYLE_CONST_X(-31),
+    LV_STYLE_CONST_Y(77),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_79, (void *)scr_style_79_props);
+
+static const lv_style_const_prop_t scr_style_80_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_END),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_END),
+    LV_STYLE_CONST_HEIGHT(380),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_ROW(12),
+    LV_STYLE_CONST_WIDTH(61),
+    LV_STYLE_CONST_X(61),
+    LV_STYLE_CONST_Y(27),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_80, (void *)scr_style_80_props);
+
+static const lv_style_const_prop_t scr_style_81_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(30),
+    LV_STYLE_CONST_WIDTH(60),
+    LV_STYLE_CONST_X(-35),
+    LV_STYLE_CONST_Y(-15),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_81, (void *)scr_style_81_props);
+
+static const lv_style_const_prop_t scr_style_82_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(30),
+    LV_STYLE_CONST_WIDTH(60),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_82, (void *)scr_style_82_props);
+
+static const lv_style_const_prop_t scr_style_83_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(30),
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_WIDTH(60),
+    LV_STYLE_CONST_X(13),
+    LV_STYLE_CONST_Y(-3),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_83, (void *)scr_style_83_props);
+
+static const lv_style_const_prop_t scr_style_84_props[] = {
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_84, (void *)scr_style_84_props);
+
+static const lv_style_const_prop_t scr_style_85_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x63, 0xC0, 0x7C)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(137),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_ROW(10),
+    LV_STYLE_CONST_RADIUS(15),
+    LV_STYLE_CONST_WIDTH(207),
+    LV_STYLE_CONST_X(-1),
+    LV_STYLE_CONST_Y(-24),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_85, (void *)scr_style_85_props);
+
+static const lv_style_const_prop_t scr_style_86_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(40),
+    LV_STYLE_CONST_WIDTH(180),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_86, (void *)scr_style_86_props);
+
+static const lv_style_const_prop_t scr_style_87_props[] = {
+    LV_STYLE_CONST_OPA(0),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_87, (void *)scr_style_87_props);
+
+static const lv_style_const_prop_t scr_style_88_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_20),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_88, (void *)scr_style_88_props);
+
+static const lv_style_const_prop_t scr_style_89_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_ROW),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(30),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_WIDTH(160),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_89, (void *)scr_style_89_props);
+
+static const lv_style_const_prop_t scr_style_90_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_20),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_90, (void *)scr_style_90_props);
+
+static const lv_style_const_prop_t scr_style_91_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xAA, 0x62, 0x1D)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_HEIGHT(311),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_ROW(10),
+    LV_STYLE_CONST_PAD_TOP(20),
+    LV_STYLE_CONST_RADIUS(15),
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_X(-1),
+    LV_STYLE_CONST_Y(-1),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_91, (void *)scr_style_91_props);
+
+static const lv_style_const_prop_t scr_style_92_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_ROW),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_HEIGHT(207),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_WIDTH(196),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-46),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_92, (void *)scr_style_92_props);
+
+static const lv_style_const_prop_t scr_style_93_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_HEIGHT(233),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_ROW(10),
+    LV_STYLE_CONST_WIDTH(70),
+    LV_STYLE_CONST_X(-1),
+    LV_STYLE_CONST_Y(-11),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_93, (void *)scr_style_93_props);
+
+static const lv_style_const_prop_t scr_style_94_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_END),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_END),
+    LV_STYLE_CONST_HEIGHT(230),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_LEFT(1),
+    LV_STYLE_CONST_PAD_RIGHT(10),
+    LV_STYLE_CONST_PAD_ROW(10),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_WIDTH(130),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_94, (void *)scr_style_94_props);
+
+static const lv_style_const_prop_t scr_style_95_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_RIGHT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_95, (void *)scr_style_95_props);
+
+static const lv_style_const_prop_t scr_style_96_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(41),
+    LV_STYLE_CONST_WIDTH(115),
+    LV_STYLE_CONST_X(1),
+    LV_STYLE_CONST_Y(109),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_96, (void *)scr_style_96_props);
+
+static const lv_style_const_prop_t scr_style_97_props[] = {
+    LV_STYLE_CONST_BG_GRAD_COLOR(LV_COLOR_MAKE(0xCC, 0xC5, 0xC5)),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_97, (void *)scr_style_97_props);
+
+static const lv_style_const_prop_t scr_style_98_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(320),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(8),
+    LV_STYLE_CONST_PAD_ROW(8),
+    LV_STYLE_CONST_WIDTH(240),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_98, (void *)scr_style_98_props);
+
+static const lv_style_const_prop_t scr_style_99_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xCC, 0xC5, 0xC5)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_HEIGHT(50),
+    LV_STYLE_CONST_RADIUS(0),
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)),
+    LV_STYLE_CONST_X(-14),
+    LV_STYLE_CONST_Y(5),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_99, (void *)scr_style_99_props);
+
+static const lv_style_const_prop_t scr_style_100_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(50),
+    LV_STYLE_CONST_WIDTH(50),
+    LV_STYLE_CONST_X(100),
+    LV_STYLE_CONST_Y(1),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_100, (void *)scr_style_100_props);
+
+static const lv_style_const_prop_t scr_style_101_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xCC, 0xC5, 0xC5)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_HEIGHT(120),
+    LV_STYLE_CONST_RADIUS(12),
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_X(-14),
+    LV_STYLE_CONST_Y(-37),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_101, (void *)scr_style_101_props);
+
+static const lv_style_const_prop_t scr_style_102_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_ARC_WIDTH(20),
+    LV_STYLE_CONST_HEIGHT(95),
+    LV_STYLE_CONST_WIDTH(109),
+    LV_STYLE_CONST_X(58),
+    LV_STYLE_CONST_Y(1),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_102, (void *)scr_style_102_props);
+
+static const lv_style_const_prop_t scr_style_103_props[] = {
+    LV_STYLE_CONST_ARC_WIDTH(20),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_103, (void *)scr_style_103_props);
+
+static const lv_style_const_prop_t scr_style_104_props[] = {
+    LV_STYLE_CONST_BLEND_MODE(LV_BLEND_MODE_NORMAL),
+    LV_STYLE_CONST_OPA(0),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_104, (void *)scr_style_104_props);
+
+static const lv_style_const_prop_t scr_style_105_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_16),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-7),
+    LV_STYLE_CONST_Y(0),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_105, (void *)scr_style_105_props);
+
+static const lv_style_const_prop_t scr_style_106_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_SPACE_EVENLY),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(128),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_WIDTH(94),
+    LV_STYLE_CONST_X(-50),
+    LV_STYLE_CONST_Y(0),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_106, (void *)scr_style_106_props);
+
+static const lv_style_const_prop_t scr_style_107_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_18),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-51),
+    LV_STYLE_CONST_Y(-33),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_107, (void *)scr_style_107_props);
+
+static const lv_style_const_prop_t scr_style_108_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-52),
+    LV_STYLE_CONST_Y(-4),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_108, (void *)scr_style_108_props);
+
+static const lv_style_const_prop_t scr_style_109_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-52),
+    LV_STYLE_CONST_Y(24),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_109, (void *)scr_style_109_props);
+
+static const lv_style_const_prop_t scr_style_110_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-30),
+    LV_STYLE_CONST_Y(27),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_110, (void *)scr_style_110_props);
+
+static const lv_style_const_prop_t scr_style_111_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(120),
+    LV_STYLE_CONST_OPA(0),
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-42),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_111, (void *)scr_style_111_props);
+
+static const lv_style_const_prop_t scr_style_112_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(120),
+    LV_STYLE_CONST_OPA(0),
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(86),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_112, (void *)scr_style_112_props);
+
+static const lv_style_const_prop_t scr_style_113_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(50),
+    LV_STYLE_CONST_RADIUS(20),
+    LV_STYLE_CONST_WIDTH(207),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_113, (void *)scr_style_113_props);
+
+static const lv_style_const_prop_t scr_style_114_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(40),
+    LV_STYLE_CONST_WIDTH(100),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(116),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_114, (void *)scr_style_114_props);
+
+static const lv_style_const_prop_t scr_style_115_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_TOP_MID),
+    LV_STYLE_CONST_HEIGHT(LV_PCT(160)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_20),
+    LV_STYLE_CONST_WIDTH(LV_PCT(74)),
+    LV_STYLE_CONST_X(13),
+    LV_STYLE_CONST_Y(-1),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_115, (void *)scr_style_115_props);
+
+static const lv_style_const_prop_t scr_style_116_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xCC, 0xC5, 0xC5)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_ROW),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_HEIGHT(255),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(10),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_RADIUS(15),
+    LV_STYLE_CONST_WIDTH(224),
+    LV_STYLE_CONST_X(-2),
+    LV_STYLE_CONST_Y(-152),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_116, (void *)scr_style_116_props);
+
+static const lv_style_const_prop_t scr_style_117_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_END),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_END),
+    LV_STYLE_CONST_HEIGHT(380),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_ROW(12),
+    LV_STYLE_CONST_WIDTH(61),
+    LV_STYLE_CONST_X(67),
+    LV_STYLE_CONST_Y(26),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_117, (void *)scr_style_117_props);
+
+static const lv_style_const_prop_t scr_style_118_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xD7, 0xA8, 0x1C)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_HEIGHT(137),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_ROW(10),
+    LV_STYLE_CONST_RADIUS(15),
+    LV_STYLE_CONST_WIDTH(207),
+    LV_STYLE_CONST_X(-1),
+    LV_STYLE_CONST_Y(-24),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_118, (void *)scr_style_118_props);
+
+static const lv_style_const_prop_t scr_style_119_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xAA, 0x62, 0x1D)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_HEIGHT(311),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_ROW(10),
+    LV_STYLE_CONST_PAD_TOP(20),
+    LV_STYLE_CONST_RADIUS(15),
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_X(-1),
+    LV_STYLE_CONST_Y(-2),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_119, (void *)scr_style_119_props);
+
+static const lv_style_const_prop_t scr_style_120_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_HEIGHT(277),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_ROW(10),
+    LV_STYLE_CONST_WIDTH(70),
+    LV_STYLE_CONST_X(-1),
+    LV_STYLE_CONST_Y(-11),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_120, (void *)scr_style_120_props);
+
+static const lv_style_const_prop_t scr_style_121_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_END),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_END),
+    LV_STYLE_CONST_HEIGHT(284),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PAD_LEFT(1),
+    LV_STYLE_CONST_PAD_RIGHT(10),
+    LV_STYLE_CONST_PAD_ROW(10),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_WIDTH(130),
+    LV_STYLE_CONST_PROPS_END,
+};
+LV_STYLE_CONST_INIT(scr_style_121, (void *)scr_style_121_props);
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Shared const styles of the table-built screens.
+ * Generated by tools/build_ui_tables.py. Do not edit.
+ ******************************************************************************/
+
+#ifndef SCR_STYLES_H
+#define SCR_STYLES_H
+
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const lv_style_t scr_style_0;
+extern const lv_style_t scr_style_1;
+extern const lv_style_t scr_style_2;
+extern const lv_style_t scr_style_3;
+extern const lv_style_t scr_style_4;
+extern const lv_style_t scr_style_5;
+extern const lv_style_t scr_style_6;
+extern const lv_style_t scr_style_7;
+extern const lv_style_t scr_style_8;
+extern const lv_style_t scr_style_9;
+extern const lv_style_t scr_style_10;
+extern const lv_style_t scr_style_11;
+extern const lv_style_t scr_style_12;
+extern const lv_style_t scr_style_13;
+extern const lv_style_t scr_style_14;
+extern const lv_style_t scr_style_15;
+extern const lv_style_t scr_style_16;
+extern const lv_style_t scr_style_17;
+extern const lv_style_t scr_style_18;
+extern const lv_style_t scr_style_19;
+extern const lv_style_t scr_style_20;
+extern const lv_style_t scr_style_21;
+extern const lv_style_t scr_style_22;
+extern const lv_style_t scr_style_23;
+extern const lv_style_t scr_style_24;
+extern const lv_style_t scr_style_25;
+extern const lv_style_t scr_style_26;
+extern const lv_style_t scr_style_27;
+extern const lv_style_t scr_style_28;
+extern const lv_style_t scr_style_29;
+extern const lv_style_t scr_style_30;
+extern const lv_style_t scr_style_31;
+extern const lv_style_t scr_style_32;
+extern const lv_style_t scr_style_33;
+extern const lv_style_t scr_style_34;
+extern const lv_style_t scr_style_35;
+extern const lv_style_t scr_style_36;
+extern const lv_style_t scr_style_37;
+extern const lv_style_t scr_style_38;
+extern const lv_style_t scr_style_39;
+extern const lv_style_t scr_style_40;
+extern const lv_style_t scr_style_41;
+extern const lv_style_t scr_style_42;
+extern const lv_style_t scr_style_43;
+extern const lv_style_t scr_style_44;
+extern const lv_style_t scr_style_45;
+extern const lv_style_t scr_style_46;
+extern const lv_style_t scr_style_47;
+extern const lv_style_t scr_style_48;
+extern const lv_style_t scr_style_49;
+extern const lv_style_t scr_style_50;
+extern const lv_style_t scr_style_51;
+extern const lv_style_t scr_style_52;
+extern const lv_style_t scr_style_53;
+extern const lv_style_t scr_style_54;
+extern const lv_style_t scr_style_55;
+extern const lv_style_t scr_style_56;
+extern const lv_style_t scr_style_57;
+extern const lv_style_t scr_style_58;
+extern const lv_style_t scr_style_59;
+extern const lv_style_t scr_style_60;
+extern const lv_style_t scr_style_61;
+extern const lv_style_t scr_style_62;
+extern const lv_style_t scr_style_63;
+extern const lv_style_t scr_style_64;
+extern const lv_style_t scr_style_65;
+extern const lv_style_t scr_style_66;
+extern const lv_style_t scr_style_67;
+extern const lv_style_t scr_style_68;
+extern const lv_style_t scr_style_69;
+extern const lv_style_t scr_style_70;
+extern const lv_style_t scr_style_71;
+extern const lv_style_t scr_style_72;
+extern const lv_style_t scr_style_73;
+extern const lv_style_t scr_style_74;
+extern const lv_style_t scr_style_75;
+extern const lv_style_t scr_style_76;
+extern const lv_style_t scr_style_77;
+extern const lv_style_t scr_style_78;
+extern const lv_style_t scr_style_79;
+extern const lv_style_t scr_style_80;
+extern const lv_style_t scr_style_81;
+extern const lv_style_t scr_style_82;
+extern const lv_style_t scr_style_83;
+extern const lv_style_t scr_style_84;
+extern const lv_style_t scr_style_85;
+extern const lv_style_t scr_style_86;
+extern const lv_style_t scr_style_87;
+extern const lv_style_t scr_style_88;
+extern const lv_style_t scr_style_89;
+extern const lv_style_t scr_style_90;
+extern const lv_style_t scr_style_91;
+extern const lv_style_t scr_style_92;
+extern const lv_style_t scr_style_93;
+extern const lv_style_t scr_style_94;
+extern const lv_style_t scr_style_95;
+extern const lv_style_t scr_style_96;
+extern const lv_style_t scr_style_97;
+extern const lv_style_t scr_style_98;
+extern const lv_style_t scr_style_99;
+extern const lv_style_t scr_style_100;
+extern const lv_style_t scr_style_101;
+extern const lv_style_t scr_style_102;
+extern const lv_style_t scr_style_103;
+extern const lv_style_t scr_style_104;
+extern const lv_style_t scr_style_105;
+extern const lv_style_t scr_style_106;
+extern const lv_style_t scr_style_107;
+extern const lv_style_t scr_style_108;
+extern const lv_style_t scr_style_109;
+extern const lv_style_t scr_style_110;
+extern const lv_style_t scr_style_111;
+extern const lv_style_t scr_style_112;
+extern const lv_style_t scr_style_113;
+extern const lv_style_t scr_style_114;
+extern const lv_style_t scr_style_115;
+extern const lv_style_t scr_style_116;
+extern const lv_style_t scr_style_117;
+extern const lv_style_t scr_style_118;
+extern const lv_style_t scr_style_119;
+extern const lv_style_t scr_style_120;
+extern const lv_style_t scr_style_121;
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // SCR_STYLES_H
@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Screen: ui/ui_waste.c
+ * 222 statements -> 27 widgets, 27 style references, 4 themed properties; 4 statements kept as code
+ * Generated by tools/build_ui_tables.py. Do not edit.
+ ******************************************************************************/
+
+#include "ui.h"
+#include "cyd_uitable.h"
+#include "scr_styles.h"
+
+lv_obj_t *ui_waste = NULL;
+lv_obj_t *ui_freshroot1 = NULL;
+lv_obj_t *ui_wasteheader = NULL;
+lv_obj_t *ui_wasteheaderlabel = NULL;
+lv_obj_t *ui_wasteSettingsButton = NULL;
+lv_obj_t *ui_wasteBackButton = NULL;
+lv_obj_t *ui_Label44 = NULL;
+lv_obj_t *ui_wastemaincard = NULL;
+lv_obj_t *ui_wasteLevelBar = NULL;
+lv_obj_t *ui_wasteLevelLabel = NULL;
+lv_obj_t *ui_wastecont2 = NULL;
+lv_obj_t *ui_wasteTempLabel = NULL;
+lv_obj_t *ui_wasteStatusLabel = NULL;
+lv_obj_t *ui_wasteLeakLabel = NULL;
+lv_obj_t *ui_wasteFreezeLabel = NULL;
+lv_obj_t *ui_wastelabels = NULL;
+lv_obj_t *ui_Label3 = NULL;
+lv_obj_t *ui_Label5 = NULL;
+lv_obj_t *ui_Label6 = NULL;
+lv_obj_t *ui_Label7 = NULL;
+lv_obj_t *ui_wastefaultcont = NULL;
+lv_obj_t *ui_Label8 = NULL;
+lv_obj_t *ui_wasteFaultButton = NULL;
+lv_obj_t *ui_wasteFaultButtonLabel = NULL;
+lv_obj_t *ui_wastecontrolpanel = NULL;
+lv_obj_t *ui_WasteDrainButton = NULL;
+lv_obj_t *ui_wastedrainlabel = NULL;
+// event functions
+
+// build functions
+
+static const cyd_uitable_node_t nodes[] = {
+    {&ui_waste, NULL, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 0, 2, 0},
+    {&ui_freshroot1, &ui_waste, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_wasteheader, &ui_freshroot1, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_wasteheaderlabel, &ui_wasteheader, lv_label_create, "Waste\n", 0, 0, 1, 2, 0},
+    {&ui_wasteSettingsButton, &ui_wasteheader, lv_image_create, NULL, LV_OBJ_FLAG_CLICKABLE, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_wasteBackButton, &ui_wasteheader, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label44, &ui_wasteBackButton, lv_label_create, "<", 0, 0, 1, 0, 0},
+    {&ui_wastemaincard, &ui_freshroot1, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_wasteLevelBar, &ui_wastemaincard, lv_bar_create, NULL, 0, 0, 2, 0, 0},
+    {&ui_wasteLevelLabel, &ui_wastemaincard, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_wastecont2, &ui_wastemaincard, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_wasteTempLabel, &ui_wastecont2, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_wasteStatusLabel, &ui_wastecont2, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_wasteLeakLabel, &ui_wastecont2, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_wasteFreezeLabel, &ui_wastecont2, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_wastelabels, &ui_wastemaincard, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_Label3, &ui_wastelabels, lv_label_create, "Temp", 0, 0, 1, 0, 0},
+    {&ui_Label5, &ui_wastelabels, lv_label_create, "Status", 0, 0, 1, 0, 0},
+    {&ui_Label6, &ui_wastelabels, lv_label_create, "Leak", 0, 0, 1, 0, 0},
+    {&ui_Label7, &ui_wastelabels, lv_label_create, "Freeze", 0, 0, 1, 0, 0},
+    {&ui_wastefaultcont, &ui_wastemaincard, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_Label8, &ui_wastefaultcont, lv_label_create, "Fault", 0, 0, 1, 0, 0},
+    {&ui_wasteFaultButton, &ui_wastefaultcont, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_wasteFaultButtonLabel, &ui_wasteFaultButton, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_wastecontrolpanel, &ui_freshroot1, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_WasteDrainButton, &ui_wastecontrolpanel, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_wastedrainlabel, &ui_WasteDrainButton, lv_label_create, "DRAIN", 0, 0, 1, 0, 0},
+};
+
+static const cyd_uitable_style_t styles[] = {
+    {&scr_style_46, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_freshroot1
+    {&scr_style_47, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wasteheader
+    {&scr_style_48, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wasteheaderlabel
+    {&scr_style_49, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wasteSettingsButton
+    {&scr_style_34, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wasteBackButton
+    {&scr_style_35, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label44
+    {&scr_style_50, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastemaincard
+    {&scr_style_51, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wasteLevelBar
+    {&scr_style_52, LV_PART_INDICATOR | LV_STATE_DEFAULT},  // ui_wasteLevelBar
+    {&scr_style_53, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wasteLevelLabel
+    {&scr_style_54, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastecont2
+    {&scr_style_55, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wasteTempLabel
+    {&scr_style_56, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wasteStatusLabel
+    {&scr_style_55, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wasteLeakLabel
+    {&scr_style_55, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wasteFreezeLabel
+    {&scr_style_57, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastelabels
+    {&scr_style_58, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label3
+    {&scr_style_59, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label5
+    {&scr_style_58, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label6
+    {&scr_style_58, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label7
+    {&scr_style_60, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastefaultcont
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label8
+    {&scr_style_61, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wasteFaultButton
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wasteFaultButtonLabel
+    {&scr_style_62, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastecontrolpanel
+    {&scr_style_113, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_WasteDrainButton
+    {&scr_style_64, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastedrainlabel
+};
+
+static const cyd_uitable_themed_t themed[] = {
+    {_ui_theme_color_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_COLOR},  // ui_waste
+    {_ui_theme_alpha_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_OPA},  // ui_waste
+    {_ui_theme_color_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_wasteheaderlabel
+    {_ui_theme_alpha_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_wasteheaderlabel
+};
+
+static const cyd_uitable_screen_t screen = {
+    nodes,
+    styles,
+    themed,
+    sizeof(nodes) / sizeof(nodes[0]),
+};
+
+void ui_waste_screen_init(void)
+{
+    cyd_uitable_build(&screen);
+    lv_image_set_src(ui_wasteSettingsButton, &ui_img_314706763);
+    lv_bar_set_value(ui_wasteLevelBar,75,LV_ANIM_OFF);
+    lv_bar_set_start_value(ui_wasteLevelBar, 0, LV_ANIM_OFF);
+    //Compensating for LVGL9.1 draw crash with bar/slider max value when top-padding is nonzero and right-padding is 0
+    if (lv_obj_get_style_pad_top(ui_wasteLevelBar,LV_PART_MAIN) > 0) lv_obj_set_style_pad_right( ui_wasteLevelBar, lv_obj_get_style_pad_right(ui_wasteLevelBar,LV_PART_MAIN) + 1, LV_PART_MAIN );
+}
+
+void ui_waste_screen_destroy(void)
+{
+   if (ui_waste) lv_obj_del(ui_waste);
+
+// NULL screen variables
+ui_waste= NULL;
+ui_freshroot1= NULL;
+ui_wasteheader= NULL;
+ui_wasteheaderlabel= NULL;
+ui_wasteSettingsButton= NULL;
+ui_wasteBackButton= NULL;
+ui_Label44= NULL;
+ui_wastemaincard= NULL;
+ui_wasteLevelBar= NULL;
+ui_wasteLevelLabel= NULL;
+ui_wastecont2= NULL;
+ui_wasteTempLabel= NULL;
+ui_wasteStatusLabel= NULL;
+ui_wasteLeakLabel= NULL;
+ui_wasteFreezeLabel= NULL;
+ui_wastelabels= NULL;
+ui_Label3= NULL;
+ui_Label5= NULL;
+ui_Label6= NULL;
+ui_Label7= NULL;
+ui_wastefaultcont= NULL;
+ui_Label8= NULL;
+ui_wasteFaultButton= NULL;
+ui_wasteFaultButtonLabel= NULL;
+ui_wastecontrolpanel= NULL;
+ui_WasteDrainButton= NULL;
+ui_wastedrainlabel= NULL;
+
+}
@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * Screen: ui/ui_wastefaults.c
+ * 95 statements -> 13 widgets, 12 style references, 2 themed properties; 0 statements kept as code
+ * Generated by tools/build_ui_tables.py. Do not edit.
+ ******************************************************************************/
+
+#include "ui.h"
+#include "cyd_uitable.h"
+#include "scr_styles.h"
+
+lv_obj_t *ui_wastefaults = NULL;
+lv_obj_t *ui_greyFaultPopupOverlay2 = NULL;
+lv_obj_t *ui_Label24 = NULL;
+lv_obj_t *ui_wastefaultscard = NULL;
+lv_obj_t *ui_wastefaultsCodeLabel = NULL;
+lv_obj_t *ui_Label19 = NULL;
+lv_obj_t *ui_wastefaultsdescription = NULL;
+lv_obj_t *ui_wastefaultsCodeDescription = NULL;
+lv_obj_t *ui_greyPopuputtons2 = NULL;
+lv_obj_t *ui_wastefaultsBackButton = NULL;
+lv_obj_t *ui_Label21 = NULL;
+lv_obj_t *ui_wastefaultsClearButton = NULL;
+lv_obj_t *ui_Label22 = NULL;
+// event functions
+
+// build functions
+
+static const cyd_uitable_node_t nodes[] = {
+    {&ui_wastefaults, NULL, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 0, 2, 0},
+    {&ui_greyFaultPopupOverlay2, &ui_wastefaults, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_Label24, &ui_greyFaultPopupOverlay2, lv_label_create, "Fault Details", 0, 0, 1, 0, 0},
+    {&ui_wastefaultscard, &ui_greyFaultPopupOverlay2, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_wastefaultsCodeLabel, &ui_wastefaultscard, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_Label19, &ui_wastefaultscard, lv_label_create, "Description:", 0, 0, 1, 0, 0},
+    {&ui_wastefaultsdescription, &ui_wastefaultscard, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_wastefaultsCodeDescription, &ui_wastefaultsdescription, lv_label_create, "\nNo Active Fault", 0, 0, 1, 0, 0},
+    {&ui_greyPopuputtons2, &ui_greyFaultPopupOverlay2, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_wastefaultsBackButton, &ui_greyPopuputtons2, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label21, &ui_wastefaultsBackButton, lv_label_create, "Back", 0, 0, 1, 0, 0},
+    {&ui_wastefaultsClearButton, &ui_greyPopuputtons2, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label22, &ui_wastefaultsClearButton, lv_label_create, "Clear", 0, 0, 1, 0, 0},
+};
+
+static const cyd_uitable_style_t styles[] = {
+    {&scr_style_65, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_greyFaultPopupOverlay2
+    {&scr_style_66, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label24
+    {&scr_style_67, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastefaultscard
+    {&scr_style_68, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastefaultsCodeLabel
+    {&scr_style_69, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label19
+    {&scr_style_70, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastefaultsdescription
+    {&scr_style_71, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastefaultsCodeDescription
+    {&scr_style_72, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_greyPopuputtons2
+    {&scr_style_114, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastefaultsBackButton
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label21
+    {&scr_style_114, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastefaultsClearButton
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label22
+};
+
+static const cyd_uitable_themed_t themed[] = {
+    {_ui_theme_color_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_COLOR},  // ui_wastefaults
+    {_ui_theme_alpha_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_OPA},  // ui_wastefaults
+};
+
+static const cyd_uitable_screen_t screen = {
+    nodes,
+    styles,
+    themed,
+    sizeof(nodes) / sizeof(nodes[0]),
+};
+
+void ui_wastefaults_screen_init(void)
+{
+    cyd_uitable_build(&screen);
+}
+
+void ui_wastefaults_screen_destroy(void)
+{
+   if (ui_wastefaults) lv_obj_del(ui_wastefaults);
+
+// NULL screen variables
+ui_wastefaults= NULL;
+ui_greyFaultPopupOverlay2= NULL;
+ui_Label24= NULL;
+ui_wastefaultscard= NULL;
+ui_wastefaultsCodeLabel= NULL;
+ui_Label19= NULL;
+ui_wastefaultsdescription= NULL;
+ui_wastefaultsCodeDescription= NULL;
+ui_greyPopuputtons2= NULL;
+ui_wastefaultsBackButton= NULL;
+ui_Label21= NULL;
+ui_wastefaultsClearButton= NULL;
+ui_Label22= NULL;
+
+}
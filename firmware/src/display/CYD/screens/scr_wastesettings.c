@@ -0,0 +1,283 @@
+/*******************************************************************************
+ * Screen: ui/ui_wastesettings.c
+ * 406 statements -> 56 widgets, 58 style references, 4 themed properties; 8 statements kept as code
+ * Generated by tools/build_ui_tables.py. Do not edit.
+ ******************************************************************************/
+
+#include "ui.h"
+#include "cyd_uitable.h"
+#include "scr_styles.h"
+
+lv_obj_t *uic_wastesettingsFreezeProtection;
+lv_obj_t *ui_wastesettings = NULL;
+lv_obj_t *ui_wastesettingsroot = NULL;
+lv_obj_t *ui_wastesettingsheader = NULL;
+lv_obj_t *ui_Label34 = NULL;
+lv_obj_t *ui_wastesettingsBackButton = NULL;
+lv_obj_t *ui_Label45 = NULL;
+lv_obj_t *ui_wastesettingsMainCard = NULL;
+lv_obj_t *ui_wastesettingslabels = NULL;
+lv_obj_t *ui_Label73 = NULL;
+lv_obj_t *ui_Label64 = NULL;
+lv_obj_t *ui_Label66 = NULL;
+lv_obj_t *ui_Label67 = NULL;
+lv_obj_t *ui_Label68 = NULL;
+lv_obj_t *ui_Label69 = NULL;
+lv_obj_t *ui_Label70 = NULL;
+lv_obj_t *ui_Label71 = NULL;
+lv_obj_t *ui_wastesettingsControls = NULL;
+lv_obj_t *ui_wastesettingsDrainLevelButton = NULL;
+lv_obj_t *ui_wastesettingsDrainStopLevelLabel = NULL;
+lv_obj_t *ui_wastesettingsSetFullButton = NULL;
+lv_obj_t *ui_wastesettingsFullVoltage = NULL;
+lv_obj_t *ui_wastesettingsSetEmptyButton = NULL;
+lv_obj_t *ui_wastesettingsEmptyVoltage = NULL;
+lv_obj_t *ui_wastesettingsFreezeProtection = NULL;
+lv_obj_t *ui_wastesettingsRestart = NULL;
+lv_obj_t *ui_wastesettingsSafetyOveride = NULL;
+lv_obj_t *ui_wastesettingsValveOveride = NULL;
+lv_obj_t *ui_wastesettingsDiagnostic = NULL;
+lv_obj_t *ui_wastesettingsDrainOverlay = NULL;
+lv_obj_t *ui_wastesettingsOverlayDrainSlider = NULL;
+lv_obj_t *ui_wastesettingsOverlayDrainPercentage = NULL;
+lv_obj_t *ui_wastesettingsOverlayBackButton = NULL;
+lv_obj_t *ui_Label65 = NULL;
+lv_obj_t *ui_wastesettingsDiagnosticOverlay = NULL;
+lv_obj_t *ui_Container8 = NULL;
+lv_obj_t *ui_Container1 = NULL;
+lv_obj_t *ui_Label83 = NULL;
+lv_obj_t *ui_Label72 = NULL;
+lv_obj_t *ui_Label74 = NULL;
+lv_obj_t *ui_Label75 = NULL;
+lv_obj_t *ui_Label76 = NULL;
+lv_obj_t *ui_Label77 = NULL;
+lv_obj_t *ui_Label78 = NULL;
+lv_obj_t *ui_Label79 = NULL;
+lv_obj_t *ui_Label80 = NULL;
+lv_obj_t *ui_Container2 = NULL;
+lv_obj_t *ui_wastesettingsdiagoverlayIP = NULL;
+lv_obj_t *ui_wastesettingsdiagoverlayID = NULL;
+lv_obj_t *ui_wastesettingsdiagoverlayMAC = NULL;
+lv_obj_t *ui_wastesettingsdiagoverlayStatus = NULL;
+lv_obj_t *ui_wastesettingsdiagoverlayRole = NULL;
+lv_obj_t *ui_wastesettingsdiagoverlayUptime = NULL;
+lv_obj_t *ui_wastesettingsdiagoverlaySignal = NULL;
+lv_obj_t *ui_wastesettingsdiagoverlayVersion = NULL;
+lv_obj_t *ui_wastesettingDiagnosticOverlayBackButton = NULL;
+lv_obj_t *ui_Label81 = NULL;
+// event functions
+
+// build functions
+
+static const cyd_uitable_node_t nodes[] = {
+    {&ui_wastesettings, NULL, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_wastesettingsroot, &ui_wastesettings, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 2, 1},
+    {&ui_wastesettingsheader, &ui_wastesettingsroot, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label34, &ui_wastesettingsheader, lv_label_create, "Waste Settings", 0, 0, 1, 2, 0},
+    {&ui_wastesettingsBackButton, &ui_wastesettingsheader, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label45, &ui_wastesettingsBackButton, lv_label_create, "<", 0, 0, 1, 0, 0},
+    {&ui_wastesettingsMainCard, &ui_wastesettingsroot, lv_obj_create, NULL, 0, LV_OBJ_FLAG_SCROLL_CHAIN, 1, 0, 0},
+    {&ui_wastesettingslabels, &ui_wastesettingsMainCard, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_Label73, &ui_wastesettingslabels, lv_label_create, "Drain Stop Level", 0, 0, 1, 0, 0},
+    {&ui_Label64, &ui_wastesettingslabels, lv_label_create, "Set Tank Full", 0, 0, 1, 0, 0},
+    {&ui_Label66, &ui_wastesettingslabels, lv_label_create, "Set Tank Empty", 0, 0, 1, 0, 0},
+    {&ui_Label67, &ui_wastesettingslabels, lv_label_create, "Freeze Protect", 0, 0, 1, 0, 0},
+    {&ui_Label68, &ui_wastesettingslabels, lv_label_create, "Restart Device", 0, 0, 1, 0, 0},
+    {&ui_Label69, &ui_wastesettingslabels, lv_label_create, "Safety Overide", 0, 0, 1, 0, 0},
+    {&ui_Label70, &ui_wastesettingslabels, lv_label_create, "Valve Overide", 0, 0, 1, 0, 0},
+    {&ui_Label71, &ui_wastesettingslabels, lv_label_create, "Diagnostic", 0, 0, 1, 0, 0},
+    {&ui_wastesettingsControls, &ui_wastesettingsMainCard, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_wastesettingsDrainLevelButton, &ui_wastesettingsControls, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_wastesettingsDrainStopLevelLabel, &ui_wastesettingsDrainLevelButton, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_wastesettingsSetFullButton, &ui_wastesettingsControls, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_wastesettingsFullVoltage, &ui_wastesettingsSetFullButton, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_wastesettingsSetEmptyButton, &ui_wastesettingsControls, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_wastesettingsEmptyVoltage, &ui_wastesettingsSetEmptyButton, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_wastesettingsFreezeProtection, &ui_wastesettingsControls, lv_dropdown_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, 0, 2, 0, 0},
+    {&ui_wastesettingsRestart, &ui_wastesettingsControls, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_wastesettingsSafetyOveride, &ui_wastesettingsControls, lv_switch_create, NULL, 0, 0, 1, 0, 0},
+    {&ui_wastesettingsValveOveride, &ui_wastesettingsControls, lv_switch_create, NULL, 0, 0, 1, 0, 0},
+    {&ui_wastesettingsDiagnostic, &ui_wastesettingsControls, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_wastesettingsDrainOverlay, &ui_wastesettings, lv_obj_create, NULL, LV_OBJ_FLAG_HIDDEN, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_wastesettingsOverlayDrainSlider, &ui_wastesettingsDrainOverlay, lv_slider_create, NULL, 0, 0, 2, 0, 0},
+    {&ui_wastesettingsOverlayDrainPercentage, &ui_wastesettingsDrainOverlay, lv_label_create, "60%", 0, 0, 1, 0, 0},
+    {&ui_wastesettingsOverlayBackButton, &ui_wastesettingsDrainOverlay, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label65, &ui_wastesettingsOverlayBackButton, lv_label_create, "Set", 0, 0, 1, 0, 0},
+    {&ui_wastesettingsDiagnosticOverlay, &ui_wastesettings, lv_obj_create, NULL, LV_OBJ_FLAG_HIDDEN, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_Container8, &ui_wastesettingsDiagnosticOverlay, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE, 1, 0, 1},
+    {&ui_Container1, &ui_Container8, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_Label83, &ui_Container1, lv_label_create, "IP", 0, 0, 1, 0, 0},
+    {&ui_Label72, &ui_Container1, lv_label_create, "ID", 0, 0, 1, 0, 0},
+    {&ui_Label74, &ui_Container1, lv_label_create, "MAC", 0, 0, 1, 0, 0},
+    {&ui_Label75, &ui_Container1, lv_label_create, "Status", 0, 0, 1, 0, 0},
+    {&ui_Label76, &ui_Container1, lv_label_create, "Role", 0, 0, 1, 0, 0},
+    {&ui_Label77, &ui_Container1, lv_label_create, "Uptime", 0, 0, 1, 0, 0},
+    {&ui_Label78, &ui_Container1, lv_label_create, "Signal", 0, 0, 1, 0, 0},
+    {&ui_Label79, &ui_Container1, lv_label_create, "Version", 0, 0, 1, 0, 0},
+    {&ui_Label80, &ui_Container1, lv_label_create, "", 0, 0, 1, 0, 0},
+    {&ui_Container2, &ui_Container8, lv_obj_create, NULL, 0, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE, 1, 0, 1},
+    {&ui_wastesettingsdiagoverlayIP, &ui_Container2, lv_label_create, "test", 0, 0, 1, 0, 0},
+    {&ui_wastesettingsdiagoverlayID, &ui_Container2, lv_label_create, "text", 0, 0, 1, 0, 0},
+    {&ui_wastesettingsdiagoverlayMAC, &ui_Container2, lv_label_create, "text", 0, 0, 1, 0, 0},
+    {&ui_wastesettingsdiagoverlayStatus, &ui_Container2, lv_label_create, "text", 0, 0, 1, 0, 0},
+    {&ui_wastesettingsdiagoverlayRole, &ui_Container2, lv_label_create, "text", 0, 0, 1, 0, 0},
+    {&ui_wastesettingsdiagoverlayUptime, &ui_Container2, lv_label_create, "text", 0, 0, 1, 0, 0},
+    {&ui_wastesettingsdiagoverlaySignal, &ui_Container2, lv_label_create, "text", 0, 0, 1, 0, 0},
+    {&ui_wastesettingsdiagoverlayVersion, &ui_Container2, lv_label_create, "text", 0, 0, 1, 0, 0},
+    {&ui_wastesettingDiagnosticOverlayBackButton, &ui_wastesettingsDiagnosticOverlay, lv_button_create, NULL, LV_OBJ_FLAG_SCROLL_ON_FOCUS, LV_OBJ_FLAG_SCROLLABLE, 1, 0, 0},
+    {&ui_Label81, &ui_wastesettingDiagnosticOverlayBackButton, lv_label_create, "Back", 0, 0, 1, 0, 0},
+};
+
+static const cyd_uitable_style_t styles[] = {
+    {&scr_style_76, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettings
+    {&scr_style_46, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsroot
+    {&scr_style_47, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsheader
+    {&scr_style_115, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label34
+    {&scr_style_34, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsBackButton
+    {&scr_style_35, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label45
+    {&scr_style_116, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsMainCard
+    {&scr_style_79, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingslabels
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label73
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label64
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label66
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label67
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label68
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label69
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label70
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label71
+    {&scr_style_117, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsControls
+    {&scr_style_81, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsDrainLevelButton
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsDrainStopLevelLabel
+    {&scr_style_82, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsSetFullButton
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsFullVoltage
+    {&scr_style_82, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsSetEmptyButton
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsEmptyVoltage
+    {&scr_style_83, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsFreezeProtection
+    {&scr_style_84, LV_PART_INDICATOR | LV_STATE_DEFAULT},  // ui_wastesettingsFreezeProtection
+    {&scr_style_82, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsRestart
+    {&scr_style_82, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsSafetyOveride
+    {&scr_style_82, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsValveOveride
+    {&scr_style_82, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsDiagnostic
+    {&scr_style_118, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsDrainOverlay
+    {&scr_style_86, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsOverlayDrainSlider
+    {&scr_style_87, LV_PART_KNOB | LV_STATE_DEFAULT},  // ui_wastesettingsOverlayDrainSlider
+    {&scr_style_88, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsOverlayDrainPercentage
+    {&scr_style_89, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsOverlayBackButton
+    {&scr_style_90, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label65
+    {&scr_style_119, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsDiagnosticOverlay
+    {&scr_style_92, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Container8
+    {&scr_style_120, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Container1
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label83
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label72
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label74
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label75
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label76
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label77
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label78
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label79
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label80
+    {&scr_style_121, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Container2
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsdiagoverlayIP
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsdiagoverlayID
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsdiagoverlayMAC
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsdiagoverlayStatus
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsdiagoverlayRole
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsdiagoverlayUptime
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsdiagoverlaySignal
+    {&scr_style_14, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingsdiagoverlayVersion
+    {&scr_style_96, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_wastesettingDiagnosticOverlayBackButton
+    {&scr_style_90, LV_PART_MAIN | LV_STATE_DEFAULT},  // ui_Label81
+};
+
+static const cyd_uitable_themed_t themed[] = {
+    {_ui_theme_color_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_COLOR},  // ui_wastesettingsroot
+    {_ui_theme_alpha_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_BG_OPA},  // ui_wastesettingsroot
+    {_ui_theme_color_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_COLOR},  // ui_Label34
+    {_ui_theme_alpha_black, LV_PART_MAIN | LV_STATE_DEFAULT, LV_STYLE_TEXT_OPA},  // ui_Label34
+};
+
+static const cyd_uitable_screen_t screen = {
+    nodes,
+    styles,
+    themed,
+    sizeof(nodes) / sizeof(nodes[0]),
+};
+
+void ui_wastesettings_screen_init(void)
+{
+    cyd_uitable_build(&screen);
+    lv_obj_set_scrollbar_mode(ui_wastesettingsMainCard, LV_SCROLLBAR_MODE_ACTIVE);
+    lv_obj_set_scroll_dir(ui_wastesettingsMainCard, LV_DIR_VER);
+    lv_dropdown_set_options( ui_wastesettingsFreezeProtection, "Off\n1\n2\n3\n4\n5" );
+    lv_obj_set_style_text_align(lv_dropdown_get_list(ui_wastesettingsFreezeProtection), LV_TEXT_ALIGN_CENTER,  LV_PART_MAIN| LV_STATE_DEFAULT);
+    lv_slider_set_value( ui_wastesettingsOverlayDrainSlider, 60, LV_ANIM_OFF);
+    if (lv_slider_get_mode(ui_wastesettingsOverlayDrainSlider)==LV_SLIDER_MODE_RANGE ) lv_slider_set_left_value( ui_wastesettingsOverlayDrainSlider, 0, LV_ANIM_OFF);
+    //Compensating for LVGL9.1 draw crash with bar/slider max value when top-padding is nonzero and right-padding is 0
+    if (lv_obj_get_style_pad_top(ui_wastesettingsOverlayDrainSlider,LV_PART_MAIN) > 0) lv_obj_set_style_pad_right( ui_wastesettingsOverlayDrainSlider, lv_obj_get_style_pad_right(ui_wastesettingsOverlayDrainSlider,LV_PART_MAIN) + 1, LV_PART_MAIN );
+    uic_wastesettingsFreezeProtection = ui_wastesettingsFreezeProtection;
+}
+
+void ui_wastesettings_screen_destroy(void)
+{
+   if (ui_wastesettings) lv_obj_del(ui_wastesettings);
+
+// NULL screen variables
+ui_wastesettings= NULL;
+ui_wastesettingsroot= NULL;
+ui_wastesettingsheader= NULL;
+ui_Label34= NULL;
+ui_wastesettingsBackButton= NULL;
+ui_Label45= NULL;
+ui_wastesettingsMainCard= NULL;
+ui_wastesettingslabels= NULL;
+ui_Label73= NULL;
+ui_Label64= NULL;
+ui_Label66= NULL;
+ui_Label67= NULL;
+ui_Label68= NULL;
+ui_Label69= NULL;
+ui_Label70= NULL;
+ui_Label71= NULL;
+ui_wastesettingsControls= NULL;
+ui_wastesettingsDrainLevelButton= NULL;
+ui_wastesettingsDrainStopLevelLabel= NULL;
+ui_wastesettingsSetFullButton= NULL;
+ui_wastesettingsFullVoltage= NULL;
+ui_wastesettingsSetEmptyButton= NULL;
+ui_wastesettingsEmptyVoltage= NULL;
+uic_wastesettingsFreezeProtection= NULL;
+ui_wastesettingsFreezeProtection= NULL;
+ui_wastesettingsRestart= NULL;
+ui_wastesettingsSafetyOveride= NULL;
+ui_wastesettingsValveOveride= NULL;
+ui_wastesettingsDiagnostic= NULL;
+ui_wastesettingsDrainOverlay= NULL;
+ui_wastesettingsOverlayDrainSlider= NULL;
+ui_wastesettingsOverlayDrainPercentage= NULL;
+ui_wastesettingsOverlayBackButton= NULL;
+ui_Label65= NULL;
+ui_wastesettingsDiagnosticOverlay= NULL;
+ui_Container8= NULL;
+ui_Container1= NULL;
+ui_Label83= NULL;
+ui_Label72= NULL;
+ui_Label74= NULL;
+ui_Label75= NULL;
+ui_Label76= NULL;
+ui_Label77= NULL;
+ui_Label78= NULL;
+ui_Label79= NULL;
+ui_Label80= NULL;
+ui_Container2= NULL;
+ui_wastesettingsdiagoverlayIP= NULL;
+ui_wastesettingsdiagoverlayID= NULL;
+ui_wastesettingsdiagoverlayMAC= NULL;
+ui_wastesettingsdiagoverlayStatus= NULL;
+ui_wastesettingsdiagoverlayRole= NULL;
+ui_wastesettingsdiagoverlayUptime= NULL;
+ui_wastesettingsdiagoverlaySignal= NULL;
+ui_wastesettingsdiagoverlayVersion= NULL;
+ui_wastesettingDiagnosticOverlayBackButton= NULL;
+ui_Label81= NULL;
+
+}
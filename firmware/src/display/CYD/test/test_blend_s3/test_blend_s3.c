@@ -0,0 +1,131 @@
+// Host check of cyd_blend_s3 against LVGL's own RGB565 loops: `pio test -e native`. Off the
+// device the PIE kernels are replaced by their lane arithmetic in C (see cyd_blend_s3.c), so
+// this covers the unaligned heads and tails, the phase checks and the opacity mix; the PIE
+// instructions themselves are covered by the boot self-test.
+
+#include <string.h>
+#include <unity.h>
+
+#include "cyd_blend_s3.h"
+
+#define STRIDE_PX 64
+#define ROWS 3
+#define BUF_PX (STRIDE_PX * ROWS + 16)
+
+static uint16_t s_bg[BUF_PX] __attribute__((aligned(16)));
+static uint16_t s_src[BUF_PX] __attribute__((aligned(16)));
+static uint16_t s_ref[BUF_PX] __attribute__((aligned(16)));
+static uint16_t s_out[BUF_PX] __attribute__((aligned(16)));
+static uint32_t s_rng = 0x2468ACEu;
+
+static uint16_t next_pixel(void) {
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return (uint16_t)s_rng;
+}
+
+static void fill_random(void) {
+    for (uint32_t i = 0; i < BUF_PX; i++) {
+        s_bg[i] = next_pixel();
+        s_src[i] = next_pixel();
+    }
+}
+
+// One fill into both buffers, LVGL's loop first and the backend second.
+static void blend_fill(int32_t dest_off, int32_t w, lv_color_t color, lv_opa_t opa) {
+    for (int variant = 0; variant < 2; variant++) {
+        uint16_t *dest = variant == 0 ? s_ref : s_out;
+        memcpy(dest, s_bg, sizeof(s_bg));
+        cyd_blend_s3_set_enabled(variant == 1);
+        _lv_draw_sw_blend_fill_dsc_t dsc;
+        memset(&dsc, 0, sizeof(dsc));
+        dsc.dest_buf = dest + dest_off;
+        dsc.dest_w = w;
+        dsc.dest_h = ROWS;
+        dsc.dest_stride = STRIDE_PX * sizeof(uint16_t);
+        dsc.color = color;
+        dsc.opa = opa;
+        lv_draw_sw_blend_color_to_rgb565(&dsc);
+    }
+}
+
+static void blend_image(int32_t dest_off, int32_t src_off, int32_t w, lv_opa_t opa) {
+    for (int variant = 0; variant < 2; variant++) {
+        uint16_t *dest = variant == 0 ? s_ref : s_out;
+        memcpy(dest, s_bg, sizeof(s_bg));
+        cyd_blend_s3_set_enabled(variant == 1);
+        _lv_draw_sw_blend_image_dsc_t dsc;
+        memset(&dsc, 0, sizeof(dsc));
+        dsc.dest_buf = dest + dest_off;
+        dsc.dest_w = w;
+        dsc.dest_h = ROWS;
+        dsc.dest_stride = STRIDE_PX * sizeof(uint16_t);
+        dsc.src_buf = s_src + src_off;
+        dsc.src_stride = STRIDE_PX * sizeof(uint16_t);
+        dsc.src_color_format = LV_COLOR_FORMAT_RGB565;
+        dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+        dsc.opa = opa;
+        lv_draw_sw_blend_image_to_rgb565(&dsc);
+    }
+}
+
+void setUp(void) {
+    fill_random();
+}
+
+void tearDown(void) {
+    cyd_blend_s3_set_enabled(true);
+}
+
+// Every opacity, so each 5-bit weight and its rounding is compared with lv_color_16_16_mix().
+static void test_fill_matches_lvgl_at_every_opacity(void) {
+    for (uint32_t opa = 0; opa <= LV_OPA_COVER; opa++) {
+        const lv_color_t color = lv_color_hex(s_rng & 0xFFFFFF);
+        blend_fill(3, 45, color, (lv_opa_t)opa);
+        TEST_ASSERT_EQUAL_HEX16_ARRAY_MESSAGE(s_ref, s_out, BUF_PX, "fill");
+        next_pixel();
+    }
+}
+
+static void test_image_matches_lvgl_at_every_opacity(void) {
+    for (uint32_t opa = 0; opa <= LV_OPA_COVER; opa++) {
+        blend_image(5, 0, 45, (lv_opa_t)opa);
+        TEST_ASSERT_EQUAL_HEX16_ARRAY_MESSAGE(s_ref, s_out, BUF_PX, "image, matching phase");
+        blend_image(5, 1, 45, (lv_opa_t)opa);
+        TEST_ASSERT_EQUAL_HEX16_ARRAY_MESSAGE(s_ref, s_out, BUF_PX, "image, other phase");
+    }
+}
+
+// Each destination phase with widths from the narrowest vector span up, so the scalar head, the
+// whole chunks and the tail take every split; nothing outside the area may change.
+static void test_head_and_tail_splits_match_lvgl(void) {
+    static const lv_opa_t opas[] = {LV_OPA_COVER, LV_OPA_50, 3};
+    for (int32_t dest_off = 0; dest_off < 8; dest_off++) {
+        for (int32_t w = 15; w <= STRIDE_PX - 8; w++) {
+            for (uint32_t o = 0; o < sizeof(opas) / sizeof(opas[0]); o++) {
+                blend_fill(dest_off, w, lv_color_hex(0x3C7A91), opas[o]);
+                TEST_ASSERT_EQUAL_HEX16_ARRAY_MESSAGE(s_ref, s_out, BUF_PX, "fill");
+                for (int32_t src_off = 0; src_off < 2; src_off++) {
+                    blend_image(dest_off, dest_off + src_off, w, opas[o]);
+                    TEST_ASSERT_EQUAL_HEX16_ARRAY_MESSAGE(s_ref, s_out, BUF_PX, "image");
+                }
+            }
+        }
+    }
+}
+
+static void test_selftest_passes(void) {
+    TEST_ASSERT_EQUAL_UINT32(0, cyd_blend_s3_selftest());
+    TEST_ASSERT_TRUE(cyd_blend_s3_enabled());
+}
+
+int main(void) {
+    lv_init();
+    UNITY_BEGIN();
+    RUN_TEST(test_fill_matches_lvgl_at_every_opacity);
+    RUN_TEST(test_image_matches_lvgl_at_every_opacity);
+    RUN_TEST(test_head_and_tail_splits_match_lvgl);
+    RUN_TEST(test_selftest_passes);
+    return UNITY_END();
+}
@@ -0,0 +1,207 @@
+// Replay of slider drags through cyd_touchfilter: `pio test -e native`. Strokes between stops,
+// with a reversal, a slow drag and a fast flick, are sampled like cyd_touch and carry the
+// controller's kind of noise. The finger's path is known, so every frame's point can be compared
+// with where the finger is when that frame reaches the panel (lag) and with the stop the stroke
+// was heading for (overshoot). On every noise seed, each preset's prediction must cut the lag of
+// the points it starts from and add at most a pixel of overshoot to what the unpredicted filter
+// shows, and a resting finger must move less than raw points do. The capacitive preset must beat
+// raw points; the resistive one only the median it predicts from (see cyd_touchfilter.h).
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unity.h>
+
+#include "cyd_touchfilter.h"
+
+typedef struct {
+    float from;
+    float to;
+    uint32_t start_ms;
+    uint32_t dur_ms;
+} stroke_t;
+
+static const stroke_t STROKES[] = {
+    {40, 200, 0, 400}, {200, 120, 600, 250}, {120, 180, 1000, 600}, {180, 60, 1800, 180},
+};
+#define STROKE_CNT (sizeof(STROKES) / sizeof(STROKES[0]))
+#define LENGTH_MS 2600
+#define SAMPLE_PERIOD_MS 16.0f  // cyd_touch while touched
+#define FRAME_MS (1000.0f / 60.0f)
+#define PANEL_DELAY_MS 24.0f    // read to pixels on the panel
+#define SEEDS 20
+#define OVERSHOOT_SLACK_PX 1.0f
+
+enum { RAW, SMOOTHED, PREDICTED, KINDS };
+
+typedef struct {
+    float lag[KINDS];        // mean distance from the finger, px
+    float overshoot[KINDS];  // furthest past a stroke's stop, px
+    float jitter[KINDS];     // mean frame-to-frame movement while the finger rests, px
+} replay_t;
+
+typedef struct {
+    float noise_px;
+    uint32_t spike_per_mille;  // 15 px outliers
+} noise_t;
+
+static const noise_t FT5X06_NOISE = {1.0f, 0};
+static const noise_t XPT2046_NOISE = {3.4f, 20};
+
+static uint32_t s_seed;
+
+static float rnd(void) {
+    s_seed = s_seed * 1664525u + 1013904223u;
+    return (s_seed >> 8) / 16777216.0f;
+}
+
+// Minimum-jerk strokes, the usual model of a deliberate finger movement.
+static float finger(float t_ms) {
+    float x = STROKES[0].from;
+    for (uint32_t i = 0; i < STROKE_CNT; i++) {
+        const stroke_t *s = &STROKES[i];
+        if (t_ms < s->start_ms) break;
+        float u = (t_ms - s->start_ms) / s->dur_ms;
+        if (u > 1.0f) u = 1.0f;
+        x = s->from + (s->to - s->from) * u * u * u * (10.0f - 15.0f * u + 6.0f * u * u);
+    }
+    return x;
+}
+
+static replay_t replay(const cyd_touchfilter_cfg_t *cfg, const noise_t *noise, uint32_t seed) {
+    cyd_touchfilter_cfg_t smoothed_cfg = *cfg;
+    smoothed_cfg.min_speed = UINT16_MAX;
+    cyd_touchfilter_t filters[2];
+    cyd_touchfilter_init(&filters[0], &smoothed_cfg);
+    cyd_touchfilter_init(&filters[1], cfg);
+    s_seed = seed;
+
+    replay_t r = {{0}, {0}, {0}};
+    int16_t out[KINDS] = {0};
+    int16_t prev[KINDS] = {0};
+    uint32_t frames = 0;
+    uint32_t rest_frames = 0;
+    float next_sample_ms = 0.0f;
+    for (float t = 3.0f; t < LENGTH_MS; t += FRAME_MS) {
+        for (; next_sample_ms <= t; next_sample_ms += SAMPLE_PERIOD_MS) {
+            float x = finger(next_sample_ms) + (rnd() - 0.5f) * 2.0f * noise->noise_px;
+            if (rnd() * 1000.0f < noise->spike_per_mille) x += rnd() < 0.5f ? -15.0f : 15.0f;
+            out[RAW] = (int16_t)lroundf(x);
+            for (int k = 0; k < 2; k++) {
+                cyd_touchfilter_add(&filters[k], out[RAW], 100, (uint32_t)(next_sample_ms * 1000.0f));
+            }
+        }
+        int16_t y = 0;
+        cyd_touchfilter_predict(&filters[0], (uint32_t)(t * 1000.0f), &out[SMOOTHED], &y);
+        cyd_touchfilter_predict(&filters[1], (uint32_t)(t * 1000.0f), &out[PREDICTED], &y);
+        for (uint32_t i = 0; i < STROKE_CNT; i++) {
+            const stroke_t *s = &STROKES[i];
+            const uint32_t end_ms = s->start_ms + s->dur_ms;
+            const uint32_t next_ms = i + 1 < STROKE_CNT ? STROKES[i + 1].start_ms : LENGTH_MS;
+            if (t + PANEL_DELAY_MS < end_ms || t >= next_ms) continue;
+            const float dir = s->to > s->from ? 1.0f : -1.0f;
+            for (int k = 0; k < KINDS; k++) r.overshoot[k] = fmaxf(r.overshoot[k], (out[k] - s->to) * dir);
+            if (t >= end_ms + 100) {
+                for (int k = 0; k < KINDS; k++) r.jitter[k] += abs(out[k] - prev[k]);
+                rest_frames++;
+            }
+        }
+        const float at_panel = finger(t + PANEL_DELAY_MS);
+        for (int k = 0; k < KINDS; k++) {
+            r.lag[k] += fabsf(out[k] - at_panel);
+            prev[k] = out[k];
+        }
+        frames++;
+    }
+    for (int k = 0; k < KINDS; k++) {
+        r.lag[k] /= frames;
+        r.jitter[k] /= rest_frames ? rest_frames : 1;
+    }
+    return r;
+}
+
+// lag_bar: the points the prediction must beat, RAW or SMOOTHED.
+static void check_preset(const cyd_touchfilter_cfg_t *cfg, const noise_t *noise, int lag_bar) {
+    float worst_overshoot = 0.0f;
+    for (uint32_t seed = 1; seed <= SEEDS; seed++) {
+        const replay_t r = replay(cfg, noise, seed);
+        char msg[96];
+        snprintf(msg, sizeof(msg), "seed %lu: lag %.2f vs %s %.2f", (unsigned long)seed, r.lag[PREDICTED],
+                 lag_bar == RAW ? "raw" : "unpredicted", r.lag[lag_bar]);
+        TEST_ASSERT_LESS_THAN_FLOAT_MESSAGE(r.lag[lag_bar], r.lag[PREDICTED], msg);
+        snprintf(msg, sizeof(msg), "seed %lu: overshoot %.0f vs unpredicted %.0f", (unsigned long)seed,
+                 r.overshoot[PREDICTED], r.overshoot[SMOOTHED]);
+        TEST_ASSERT_LESS_OR_EQUAL_FLOAT_MESSAGE(r.overshoot[SMOOTHED] + OVERSHOOT_SLACK_PX, r.overshoot[PREDICTED],
+                                                msg);
+        snprintf(msg, sizeof(msg), "seed %lu: rest jitter %.2f vs raw %.2f", (unsigned long)seed,
+                 r.jitter[PREDICTED], r.jitter[RAW]);
+        TEST_ASSERT_LESS_OR_EQUAL_FLOAT_MESSAGE(r.jitter[RAW], r.jitter[PREDICTED], msg);
+        worst_overshoot = fmaxf(worst_overshoot, r.overshoot[PREDICTED]);
+    }
+    const replay_t r = replay(cfg, noise, 1);
+    char line[224];
+    snprintf(line, sizeof(line), "seed 1 lag/overshoot/jitter px: raw %.2f/%.0f/%.2f unpredicted %.2f/%.0f/%.2f "
+             "filtered %.2f/%.0f/%.2f; worst overshoot %.0f", r.lag[RAW], r.overshoot[RAW], r.jitter[RAW],
+             r.lag[SMOOTHED], r.overshoot[SMOOTHED], r.jitter[SMOOTHED], r.lag[PREDICTED], r.overshoot[PREDICTED],
+             r.jitter[PREDICTED], worst_overshoot);
+    TEST_MESSAGE(line);
+}
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+static void test_ft5x06_preset(void) {
+    const cyd_touchfilter_cfg_t cfg = CYD_TOUCHFILTER_FT5X06;
+    check_preset(&cfg, &FT5X06_NOISE, RAW);
+}
+
+static void test_xpt2046_preset(void) {
+    const cyd_touchfilter_cfg_t cfg = CYD_TOUCHFILTER_XPT2046;
+    check_preset(&cfg, &XPT2046_NOISE, SMOOTHED);
+}
+
+// Raw points pass straight through.
+static void test_off_preset_is_raw(void) {
+    const cyd_touchfilter_cfg_t cfg = CYD_TOUCHFILTER_OFF;
+    cyd_touchfilter_t f;
+    cyd_touchfilter_init(&f, &cfg);
+    const int16_t xs[] = {10, 14, 90, 20, 21};
+    for (uint32_t i = 0; i < sizeof(xs) / sizeof(xs[0]); i++) {
+        cyd_touchfilter_add(&f, xs[i], 50, i * 16000u);
+        int16_t x = 0;
+        int16_t y = 0;
+        cyd_touchfilter_predict(&f, i * 16000u + 8000u, &x, &y);
+        TEST_ASSERT_EQUAL_INT(xs[i], x);
+        TEST_ASSERT_EQUAL_INT(50, y);
+    }
+}
+
+// A single outlier never reaches LVGL, and a new touch starts from its own first point.
+static void test_median_drops_spike_and_reset_starts_over(void) {
+    const cyd_touchfilter_cfg_t cfg = CYD_TOUCHFILTER_XPT2046;
+    cyd_touchfilter_t f;
+    cyd_touchfilter_init(&f, &cfg);
+    const int16_t xs[] = {100, 100, 130, 100, 100};
+    int16_t x = 0;
+    int16_t y = 0;
+    for (uint32_t i = 0; i < sizeof(xs) / sizeof(xs[0]); i++) {
+        cyd_touchfilter_add(&f, xs[i], 60, i * 16000u);
+        cyd_touchfilter_settled(&f, &x, &y);
+        TEST_ASSERT_EQUAL_INT(100, x);
+    }
+    cyd_touchfilter_reset(&f);
+    cyd_touchfilter_add(&f, 200, 70, 200000u);
+    cyd_touchfilter_predict(&f, 208000u, &x, &y);
+    TEST_ASSERT_EQUAL_INT(200, x);
+    TEST_ASSERT_EQUAL_INT(70, y);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_ft5x06_preset);
+    RUN_TEST(test_xpt2046_preset);
+    RUN_TEST(test_off_preset_is_raw);
+    RUN_TEST(test_median_drops_spike_and_reset_starts_over);
+    return UNITY_END();
+}
@@ -0,0 +1,517 @@
+"""Turn SquareLine's screen code into const widget tables with shared styles.
+
+SquareLine builds every screen with one call per widget property (ui/ui_<screen>.c): geometry,
+flex layout and each style property go through lv_obj_set_* / lv_obj_set_style_*, which gives
+every widget its own heap-allocated local style per part and state. This script reads those files
+and writes screens/scr_<screen>.c, where each widget is a cyd_uitable_node_t (create function,
+parent, flags, label text) and its properties are references to const styles in flash,
+deduplicated across all screens (screens/scr_styles.c). cyd_uitable_build() instantiates a table.
+
+What becomes table data:
+  - ui_X = lv_<type>_create(parent)
+  - lv_obj_remove_style_all() right after the create
+  - lv_obj_set_width/height/x/y/align, lv_obj_set_flex_flow/flex_align
+  - lv_obj_set_style_<prop>(widget, value, selector) with a constant value (numbers, LV_*
+    constants, lv_color_hex(), lv_pct(), &font)
+  - ui_object_set_themeable_style_property() (listed per widget; cyd_theme.c backs it with one
+    shared style per theme variable, so theme switches still apply)
+  - lv_obj_add_flag/lv_obj_remove_flag, lv_label_set_text() with a string literal
+
+Everything else in the init function (widget values, dropdown options, image sources, event
+callbacks, uic_ aliases, ...) is kept as code and runs after the table, in its original order.
+The rest of the file (globals, event functions, the destroy function) is copied unchanged.
+
+A property set again later wins, as it does in SquareLine's code. A plain set that follows a
+themeable set of the same property stays a local call after the table, so it keeps overriding
+the themed value.
+
+Runs as a PlatformIO pre: script (see platformio.ini), takes the SquareLine files it replaces out
+of the build and only rewrites a file when its content changes; the generated files are committed.
+custom_ui_tables = no builds SquareLine's code instead. Either way ui/ui_theme_manager.c is left
+out, since cyd_theme.c implements its API. Standalone: python tools/build_ui_tables.py
+"""
+
+import re
+from pathlib import Path
+
+OUT_DIR_NAME = "screens"
+STYLE_PREFIX = "scr_style_"
+THEME_MANAGER = "ui/ui_theme_manager.c"  # replaced by cyd_theme.c
+
+SCREEN_INIT = re.compile(r"void\s+ui_(\w+)_screen_init\s*\(\s*void\s*\)\s*\{")
+CREATE = re.compile(r"^(\w+)\s*=\s*(lv_\w+_create)\s*\(\s*(\w+)\s*\)$")
+CALL = re.compile(r"^(\w+)\s*\((.*)\)$", re.S)
+STRING_LITERALS = re.compile(r'^(?:"(?:[^"\\\n]|\\.)*"\s*)+$')
+
+# lv_obj_set_* helpers that only set style properties with selector 0.
+GEOMETRY_SETTERS = {
+    "lv_obj_set_width": ["WIDTH"],
+    "lv_obj_set_height": ["HEIGHT"],
+    "lv_obj_set_x": ["X"],
+    "lv_obj_set_y": ["Y"],
+    "lv_obj_set_align": ["ALIGN"],
+    "lv_obj_set_flex_flow": ["FLEX_FLOW", ("LAYOUT", "LV_LAYOUT_FLEX")],
+    "lv_obj_set_flex_align": ["FLEX_MAIN_PLACE", "FLEX_CROSS_PLACE", "FLEX_TRACK_PLACE",
+                              ("LAYOUT", "LV_LAYOUT_FLEX")],
+}
+DEFAULT_SELECTOR = "LV_PART_MAIN | LV_STATE_DEFAULT"
+
+
+# --------------------------------------------------------------------------------------------
+# C scanning
+# --------------------------------------------------------------------------------------------
+
+def skip_literal(src, i):
+    """Index just past the string or character literal starting at src[i]."""
+    quote = src[i]
+    i += 1
+    while src[i] != quote:
+        i += 2 if src[i] == "\\" else 1
+    return i + 1
+
+
+def function_body(src, open_brace):
+    """(body, end) for the block whose "{" is at src[open_brace]; end is just past its "}"."""
+    depth = 0
+    i = open_brace
+    while i < len(src):
+        c = src[i]
+        if c in "\"'":
+            i = skip_literal(src, i)
+            continue
+        if src.startswith("//", i):
+            i = src.find("\n", i)
+            continue
+        if src.startswith("/*", i):
+            i = src.find("*/", i) + 2
+            continue
+        if c == "{":
+            depth += 1
+        elif c == "}":
+            depth -= 1
+            if depth == 0:
+                return src[open_brace + 1:i], i + 1
+        i += 1
+    raise ValueError("unbalanced braces")
+
+
+class Statement:
+    def __init__(self, text, comments):
+        self.text = text              # without the trailing ";" and without comments
+        self.comments = comments      # whole-line comments just above it
+
+    def code(self):
+        return self.text + ";"
+
+
+def statements(body):
+    """Split a function body into top-level statements, dropping comments that trail code."""
+    out, cur, pending = [], [], []
+    depth = 0
+    i = 0
+    while i < len(body):
+        c = body[i]
+        if c in "\"'":
+            end = skip_literal(body, i)
+            cur.append(body[i:end])
+            i = end
+            continue
+        if body.startswith("//", i) or body.startswith("/*", i):
+            end = body.find("\n", i) if body[i + 1] == "/" else body.find("*/", i) + 2
+            end = len(body) if end < 0 else end
+            line_start = body.rfind("\n", 0, i) + 1
+            if not body[line_start:i].strip() and not "".join(cur).strip():
+                pending.append(body[i:end].strip())
+            i = end
+            continue
+        cur.append(c)
+        if c in "([{":
+            depth += 1
+        elif c in ")]}":
+            depth -= 1
+        if depth == 0 and c in ";}":
+            text = "".join(cur).strip()
+            if text.endswith(";"):
+                text = text[:-1].rstrip()
+            if text:
+                out.append(Statement(text, pending))
+            cur, pending = [], []
+        i += 1
+    if "".join(cur).strip():
+        out.append(Statement("".join(cur).strip(), pending))
+    return out
+
+
+def split_args(args):
+    out, cur, depth = [], [], 0
+    i = 0
+    while i < len(args):
+        c = args[i]
+        if c in "\"'":
+            end = skip_literal(args, i)
+            cur.append(args[i:end])
+            i = end
+            continue
+        if c in "([{":
+            depth += 1
+        elif c in ")]}":
+            depth -= 1
+        if c == "," and depth == 0:
+            out.append("".join(cur).strip())
+            cur = []
+        else:
+            cur.append(c)
+        i += 1
+    out.append("".join(cur).strip())
+    return out
+
+
+def call(text):
+    m = CALL.match(text)
+    return (m.group(1), split_args(m.group(2))) if m else (None, None)
+
+
+# --------------------------------------------------------------------------------------------
+# Values and selectors
+# --------------------------------------------------------------------------------------------
+
+def const_value(expr):
+    """The expression as a static initializer for an LV_STYLE_CONST_* value, or None."""
+    expr = " ".join(expr.split())
+    if re.fullmatch(r"-?\s*(?:0[xX][0-9a-fA-F]+|\d+)", expr):
+        return expr.replace(" ", "")
+    if re.fullmatch(r"LV_[A-Z0-9_]+", expr) or re.fullmatch(r"&\s*\w+", expr):
+        return expr.replace(" ", "")
+    m = re.fullmatch(r"lv_color_hex\(\s*0[xX]([0-9a-fA-F]{6})\s*\)", expr)
+    if m:
+        rgb = m.group(1).upper()
+        return f"LV_COLOR_MAKE(0x{rgb[0:2]}, 0x{rgb[2:4]}, 0x{rgb[4:6]})"
+    m = re.fullmatch(r"lv_pct\(\s*(-?\d+)\s*\)", expr)
+    if m:
+        return f"LV_PCT({m.group(1)})"
+    return None
+
+
+def selector(expr):
+    """Canonical form of a selector expression; None if it is not a plain OR of LV_ constants."""
+    if expr.strip() == "0":
+        return DEFAULT_SELECTOR
+    parts = [p.strip() for p in expr.split("|")]
+    if not all(re.fullmatch(r"LV_(?:PART|STATE)_[A-Z_]+", p) for p in parts):
+        return None
+    part = [p for p in parts if p.startswith("LV_PART_")] or ["LV_PART_MAIN"]
+    state = [p for p in parts if p.startswith("LV_STATE_")] or ["LV_STATE_DEFAULT"]
+    return " | ".join(sorted(set(part)) + sorted(set(state)))
+
+
+def flag_list(expr):
+    flags = [f.strip() for f in expr.split("|")]
+    return flags if all(re.fullmatch(r"LV_OBJ_FLAG_\w+", f) for f in flags) else None
+
+
+# --------------------------------------------------------------------------------------------
+# Screens
+# --------------------------------------------------------------------------------------------
+
+class Node:
+    def __init__(self, var, parent, create):
+        self.var = var
+        self.parent = parent
+        self.create = create
+        self.bare = False
+        self.text = None  # string literal; "" once the text is set in code
+        self.flags = {}   # flag -> "add" / "remove", last call wins
+        self.props = {}   # (selector, prop) -> ("value", expr) | ("code", statement)
+        self.themed = {}  # (selector, prop) -> theme variable, last call wins
+        self.styles = []  # (style name, selector), filled in by Styles.assign()
+
+
+class Screen:
+    def __init__(self, path, src):
+        m = SCREEN_INIT.search(src)
+        body, end = function_body(src, m.end() - 1)
+        self.path = path
+        self.name = m.group(1)
+        self.prefix = src[:m.start()]
+        self.suffix = src[end:]
+        self.nodes = []
+        self.code = []  # statements kept as code, in order; filled by resolve()
+        stmts = statements(body)
+        self.statement_count = len(stmts)
+        self.parse(stmts)
+
+    def parse(self, stmts):
+        nodes = {}
+        pending_code = []  # (statement, node whose property it sets, or None)
+        last_created = None
+        for st in stmts:
+            m = CREATE.match(st.text)
+            if m and m.group(1) not in nodes:
+                parent = None if m.group(3) == "NULL" else m.group(3)
+                node = Node(m.group(1), parent, m.group(2))
+                nodes[node.var] = node
+                self.nodes.append(node)
+                last_created = node
+                continue
+            name, args = call(st.text)
+            node = nodes.get(args[0]) if args else None
+            if node is None or not self.table(st, name, args, node, last_created, pending_code):
+                pending_code.append((st, None))
+            last_created = None
+        self.resolve(pending_code)
+
+    def table(self, st, name, args, node, last_created, pending_code):
+        """Record st in node's table entry; False if it has to stay code."""
+        if name == "lv_obj_remove_style_all" and len(args) == 1:
+            if node is not last_created:
+                return False  # would also drop properties set before it
+            node.bare = True
+            return True
+        if name in GEOMETRY_SETTERS and len(args) >= 2:
+            props = GEOMETRY_SETTERS[name]
+            given = [p for p in props if isinstance(p, str)]
+            if len(args) != len(given) + 1:
+                return False
+            values = [const_value(a) for a in args[1:]]
+            fixed = [p for p in props if not isinstance(p, str)]
+            entries = list(zip(given, values)) + [(p, v) for p, v in fixed]
+            self.set_props(node, DEFAULT_SELECTOR, entries, st, pending_code)
+            return True
+        if name and name.startswith("lv_obj_set_style_") and len(args) == 3:
+            sel = selector(args[2])
+            if sel is None:
+                return False
+            prop = name[len("lv_obj_set_style_"):].upper()
+            self.set_props(node, sel, [(prop, const_value(args[1]))], st, pending_code)
+            return True
+        if name == "ui_object_set_themeable_style_property" and len(args) == 4:
+            sel = selector(args[1])
+            if sel is None or not re.fullmatch(r"LV_STYLE_\w+", args[2]) or not re.fullmatch(r"\w+", args[3]):
+                return False
+            key = (sel, args[2][len("LV_STYLE_"):])
+            node.props.pop(key, None)  # the themed value replaces earlier plain ones
+            node.themed[key] = args[3]
+            return True
+        if name in ("lv_obj_add_flag", "lv_obj_remove_flag") and len(args) == 2:
+            flags = flag_list(args[1])
+            if flags is None:
+                return False
+            for f in flags:
+                node.flags[f] = "add" if name == "lv_obj_add_flag" else "remove"
+            return True
+        if name == "lv_label_set_text" and len(args) == 2:
+            if not STRING_LITERALS.match(args[1]) or node.text == "":
+                node.text = ""  # computed text: this and later texts stay code
+                return False
+            node.text = args[1]
+            return True
+        return False
+
+    def set_props(self, node, sel, entries, st, pending_code):
+        keys = [(sel, p) for p, _ in entries]
+        if (any(v is None for _, v in entries) or any(k in node.themed for k in keys)
+                or any(node.props.get(k, ("",))[0] == "code" for k in keys)):
+            # Not constant, overriding a themed value, or following a set that stays code (which
+            # runs after the table): stays a local property set in code.
+            for prop, _ in entries:
+                node.props[(sel, prop)] = ("code", st)
+            pending_code.append((st, node))
+            return
+        for prop, value in entries:
+            node.props[(sel, prop)] = ("value", value)
+
+    def resolve(self, pending_code):
+        """Keep the code statements that still set a property last (or were never tabled)."""
+        for st, node in pending_code:
+            if node is None or any(v == ("code", st) for v in node.props.values()):
+                self.code.append(st)
+
+
+class Styles:
+    def __init__(self):
+        self.by_props = {}
+        self.order = []
+        self.prop_count = 0  # local style properties the shared styles replace
+
+    def assign(self, node):
+        for sel, props in node_groups(node):
+            key = tuple(sorted(props))
+            if key not in self.by_props:
+                self.by_props[key] = f"{STYLE_PREFIX}{len(self.order)}"
+                self.order.append(key)
+            node.styles.append((self.by_props[key], sel))
+            self.prop_count += len(props)
+
+
+def node_groups(node):
+    """Constant properties of node as (selector, [(prop, value)]), one style per selector."""
+    groups = {}
+    for (sel, prop), (kind, value) in node.props.items():
+        if kind == "value":
+            groups.setdefault(sel, []).append((prop, value))
+    return list(groups.items())
+
+
+# --------------------------------------------------------------------------------------------
+# Output
+# --------------------------------------------------------------------------------------------
+
+HEADER_RULE = "/*******************************************************************************"
+
+
+def banner(lines):
+    return [HEADER_RULE] + [f" * {line}" for line in lines] + [
+        " * Generated by tools/build_ui_tables.py. Do not edit.",
+        " ******************************************************************************/",
+    ]
+
+
+def render_styles(styles):
+    header = banner(["Shared const styles of the table-built screens."]) + [
+        "",
+        "#ifndef SCR_STYLES_H",
+        "#define SCR_STYLES_H",
+        "",
+        "#include <lvgl.h>",
+        "",
+        "#ifdef __cplusplus",
+        'extern "C" {',
+        "#endif",
+        "",
+    ]
+    header += [f"extern const lv_style_t {STYLE_PREFIX}{i};" for i in range(len(styles.order))]
+    header += ["", "#ifdef __cplusplus", '}  // extern "C"', "#endif", "", "#endif  // SCR_STYLES_H", ""]
+
+    source = banner([f"{len(styles.order)} styles replacing {styles.prop_count} local style properties."]) + [
+        "",
+        '#include "scr_styles.h"',
+    ]
+    for i, props in enumerate(styles.order):
+        name = f"{STYLE_PREFIX}{i}"
+        source += ["", f"static const lv_style_const_prop_t {name}_props[] = {{"]
+        source += [f"    LV_STYLE_CONST_{prop}({value})," for prop, value in props]
+        source += ["    LV_STYLE_CONST_PROPS_END,", "};", f"LV_STYLE_CONST_INIT({name}, (void *){name}_props);"]
+    source.append("")
+    return "\n".join(header), "\n".join(source)
+
+
+def flag_expr(node, op):
+    flags = [f for f, o in node.flags.items() if o == op]
+    return " | ".join(flags) if flags else "0"
+
+
+def render_screen(screen):
+    prefix = screen.prefix
+    # Drop SquareLine's banner; the rest (includes, globals, event functions) is kept as is.
+    while prefix.startswith("//"):
+        prefix = prefix[prefix.find("\n") + 1:]
+    prefix = prefix.lstrip("\n")
+    # SquareLine packs a screen's widget globals onto one line and misspells its section comments;
+    # one declaration per line keeps diffs of the generated files readable.
+    prefix = re.sub(r";[ \t]*(?=lv_obj_t \*)", ";\n", prefix).replace(" funtions\n", " functions\n")
+    include = '#include "ui.h"\n'
+    extra = '#include "cyd_uitable.h"\n#include "scr_styles.h"\n'
+    prefix = prefix.replace(include, include + extra, 1) if include in prefix else extra + prefix
+
+    style_refs = sum(len(n.styles) for n in screen.nodes)
+    themed_refs = sum(len(n.themed) for n in screen.nodes)
+    lines = banner([
+        f"Screen: {screen.path.as_posix()}",
+        f"{screen.statement_count} statements -> {len(screen.nodes)} widgets, {style_refs} style references, "
+        f"{themed_refs} themed properties; {len(screen.code)} statements kept as code",
+    ]) + ["", prefix.rstrip("\n"), ""]
+
+    lines.append("static const cyd_uitable_node_t nodes[] = {")
+    for n in screen.nodes:
+        parent = f"&{n.parent}" if n.parent else "NULL"
+        text = n.text or "NULL"
+        lines.append(f"    {{&{n.var}, {parent}, {n.create}, {text}, {flag_expr(n, 'add')}, "
+                     f"{flag_expr(n, 'remove')}, {len(n.styles)}, {len(n.themed)}, {int(n.bare)}}},")
+    lines.append("};")
+    if style_refs:
+        lines += ["", "static const cyd_uitable_style_t styles[] = {"]
+        for n in screen.nodes:
+            for style, sel in n.styles:
+                lines.append(f"    {{&{style}, {sel}}},  // {n.var}")
+        lines.append("};")
+    if themed_refs:
+        lines += ["", "static const cyd_uitable_themed_t themed[] = {"]
+        for n in screen.nodes:
+            for (sel, prop), var in n.themed.items():
+                lines.append(f"    {{{var}, {sel}, LV_STYLE_{prop}}},  // {n.var}")
+        lines.append("};")
+    lines += [
+        "",
+        "static const cyd_uitable_screen_t screen = {",
+        "    nodes,",
+        f"    {'styles' if style_refs else 'NULL'},",
+        f"    {'themed' if themed_refs else 'NULL'},",
+        "    sizeof(nodes) / sizeof(nodes[0]),",
+        "};",
+        "",
+        f"void ui_{screen.name}_screen_init(void)",
+        "{",
+        "    cyd_uitable_build(&screen);",
+    ]
+    for st in screen.code:
+        lines += [f"    {c}" for c in st.comments]
+        lines += [f"    {line.strip()}" for line in st.code().splitlines()]
+    lines.append("}")
+    return "\n".join(lines) + screen.suffix
+
+
+def write_if_changed(project, path, text):
+    if not path.exists() or path.read_text() != text:
+        path.write_text(text)
+        print(f"build_ui_tables: wrote {path.relative_to(project)}")
+
+
+def generate(project):
+    """Write screens/; return the SquareLine sources the tables replace."""
+    out_dir = project / OUT_DIR_NAME
+    screens = []
+    for path in sorted((project / "ui").glob("ui_*.c")):
+        src = path.read_text()
+        if SCREEN_INIT.search(src):
+            screens.append(Screen(path.relative_to(project), src))
+    styles = Styles()
+    for screen in screens:
+        for node in screen.nodes:
+            styles.assign(node)
+
+    out_dir.mkdir(exist_ok=True)
+    written = set()
+    header, source = render_styles(styles)
+    for name, text in (("scr_styles.h", header), ("scr_styles.c", source)):
+        write_if_changed(project, out_dir / name, text)
+        written.add(out_dir / name)
+    for screen in screens:
+        path = out_dir / f"scr_{screen.path.stem[len('ui_'):]}.c"
+        write_if_changed(project, path, render_screen(screen))
+        written.add(path)
+        print(f"build_ui_tables: {screen.path.name}: {screen.statement_count} statements -> "
+              f"{len(screen.nodes)} widgets, {len(screen.code)} kept as code")
+    for stale in out_dir.glob("scr_*"):
+        if stale not in written:
+            stale.unlink()
+            print(f"build_ui_tables: removed {stale.relative_to(project)}")
+    print(f"build_ui_tables: {styles.prop_count} local style properties -> {len(styles.order)} shared styles")
+    return [project / s.path for s in screens]
+
+
+if __name__ == "__main__":
+    generate(Path(__file__).resolve().parent.parent)  # not defined when PlatformIO runs the script
+else:
+    from SCons.Script import DefaultEnvironment  # pylint: disable=import-error
+
+    env = DefaultEnvironment()
+    project_dir = Path(env.subst("$PROJECT_DIR"))
+    src_filter = env.get("SRC_FILTER") or ["+<*>"]
+    if isinstance(src_filter, str):
+        src_filter = [src_filter]
+    if env.GetProjectOption("custom_ui_tables", "yes").lower() in ("1", "yes", "true"):
+        drop = [p.relative_to(project_dir).as_posix() for p in generate(project_dir)]
+    else:
+        drop = [f"{OUT_DIR_NAME}/"]
+    drop.append(THEME_MANAGER)
+    env.Replace(SRC_FILTER=list(src_filter) + [f"-<{d}>" for d in drop])
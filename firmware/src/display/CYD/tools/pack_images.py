@@ -0,0 +1,337 @@
+"""Pack the UI's PNG assets into compressed LVGL image descriptors.
+
+SquareLine exports every image as a raw RGB565 array (ui/ui_img_*.c), so a 50x50 icon costs 5000
+bytes of flash even when most of it is background. This script reads the source PNGs from
+assets/, tries the encodings LVGL understands and writes the smallest one to images/img_<name>.c:
+
+  - raw: RGB565, or ARGB8888 when the PNG has transparency
+  - RLE: the raw pixels run-length compressed (LVGL's RLE, one pixel per block)
+  - indexed: I1/I2/I4/I8 with a palette, when the image has at most 256 colours
+  - RLE indexed: palette and indices run-length compressed
+
+Colours are compared after conversion to RGB565, so opaque images decode to exactly the pixels
+SquareLine would have produced. cyd_imgcache.c decodes a packed image once and keeps the result,
+so the compression costs one decode per image rather than one per draw.
+
+A packed image keeps the symbol of the SquareLine array it replaces (matched through the
+"IMAGE DATA: assets/<file>" comment in ui/ui_img_*.c), and that array is taken out of the build,
+so the generated UI links against it unchanged. Assets without a SquareLine array are exported as
+ui_img_<name>. custom_image_pack = no builds the SquareLine arrays instead.
+
+Runs as a PlatformIO pre: script (see platformio.ini) and only rewrites a file when its content
+changes; the generated files are committed. Standalone: python tools/pack_images.py
+"""
+
+import re
+import struct
+import zlib
+from pathlib import Path
+
+ASSET_DIR_NAME = "assets"
+OUT_DIR_NAME = "images"
+
+CF_RGB565 = "LV_COLOR_FORMAT_RGB565"
+CF_ARGB8888 = "LV_COLOR_FORMAT_ARGB8888"
+CF_INDEXED = {1: "LV_COLOR_FORMAT_I1", 2: "LV_COLOR_FORMAT_I2", 4: "LV_COLOR_FORMAT_I4", 8: "LV_COLOR_FORMAT_I8"}
+RLE_METHOD = 1  # LV_IMAGE_COMPRESS_RLE
+RLE_MAX_RUN = 0x7F
+
+SQUARELINE_SOURCE = re.compile(r"//\s*IMAGE DATA:\s*(\S+)")
+SQUARELINE_SYMBOL = re.compile(r"const\s+lv_image_dsc_t\s+(\w+)\s*=")
+
+
+# --------------------------------------------------------------------------------------------
+# PNG reading
+# --------------------------------------------------------------------------------------------
+
+def read_png(path):
+    """Return (width, height, [(r, g, b, a), ...]) for an 8-bit, non-interlaced PNG."""
+    data = path.read_bytes()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(f"{path}: not a PNG file")
+    pos = 8
+    idat = b""
+    palette, trns = [], b""
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            trns = body
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+    if depth != 8 or interlace:
+        raise ValueError(f"{path}: only 8-bit non-interlaced PNGs are supported")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    rows = unfilter(zlib.decompress(idat), width, height, channels)
+
+    pixels = []
+    for row in rows:
+        for x in range(width):
+            px = row[x * channels:(x + 1) * channels]
+            if color_type == 0:
+                pixels.append((px[0], px[0], px[0], 255))
+            elif color_type == 2:
+                pixels.append((px[0], px[1], px[2], 255))
+            elif color_type == 3:
+                r, g, b = palette[px[0]]
+                pixels.append((r, g, b, trns[px[0]] if px[0] < len(trns) else 255))
+            elif color_type == 4:
+                pixels.append((px[0], px[0], px[0], px[1]))
+            else:
+                pixels.append(tuple(px))
+    return width, height, pixels
+
+
+def unfilter(raw, width, height, channels):
+    stride = width * channels
+    rows, prev = [], bytearray(stride)
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        rows.append(line)
+        prev = line
+    return rows
+
+
+# --------------------------------------------------------------------------------------------
+# Encodings
+# --------------------------------------------------------------------------------------------
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def rle_compress(data, blk):
+    """LVGL RLE (lv_rle_decompress): a control byte with bit 7 set is followed by that many
+    literal blocks, otherwise it is the repeat count of the one block that follows."""
+    blocks = [bytes(data[i:i + blk]) for i in range(0, len(data), blk)]
+    min_run = 3 if blk == 1 else 2  # shorter runs are cheaper inside a literal
+    out, literal = bytearray(), []
+
+    def flush():
+        while literal:
+            chunk = literal[:RLE_MAX_RUN]
+            del literal[:RLE_MAX_RUN]
+            out.append(0x80 | len(chunk))
+            out.extend(b"".join(chunk))
+
+    i = 0
+    while i < len(blocks):
+        run = 1
+        while i + run < len(blocks) and run < RLE_MAX_RUN and blocks[i + run] == blocks[i]:
+            run += 1
+        if run >= min_run:
+            flush()
+            out.append(run)
+            out.extend(blocks[i])
+        else:
+            literal.extend(blocks[i:i + run])
+        i += run
+    flush()
+    return bytes(out)
+
+
+def rle_decompress(data, blk):
+    out, i = bytearray(), 0
+    while i < len(data):
+        ctrl = data[i]
+        i += 1
+        if ctrl & 0x80:
+            n = (ctrl & 0x7F) * blk
+            out += data[i:i + n]
+            i += n
+        else:
+            out += data[i:i + blk] * ctrl
+            i += blk
+    return bytes(out)
+
+
+def encode_true_color(width, pixels, opaque):
+    if opaque:
+        return CF_RGB565, width * 2, b"".join(struct.pack("<H", rgb565(r, g, b)) for r, g, b, _ in pixels)
+    return CF_ARGB8888, width * 4, b"".join(bytes((b, g, r, a)) for r, g, b, a in pixels)
+
+
+def encode_indexed(width, height, pixels, opaque):
+    """Palette (lv_color32_t, padded to the format's size) followed by MSB-first index rows."""
+    key = (lambda p: rgb565(*p[:3])) if opaque else (lambda p: p)
+    colors = {}
+    for p in pixels:
+        colors.setdefault(key(p), p)
+    if len(colors) > 256:
+        return None
+    bpp = next(b for b in (1, 2, 4, 8) if len(colors) <= 1 << b)
+    index = {k: i for i, k in enumerate(colors)}
+    palette = bytearray()
+    for r, g, b, a in colors.values():
+        palette += bytes((b, g, r, 255 if opaque else a))
+    palette += bytes(4 * ((1 << bpp) - len(colors)))
+    stride = (width * bpp + 7) // 8
+    body = bytearray()
+    for y in range(height):
+        row = bytearray(stride)
+        for x in range(width):
+            bit = x * bpp
+            row[bit >> 3] |= index[key(pixels[y * width + x])] << (8 - bpp - (bit & 7))
+        body += row
+    return CF_INDEXED[bpp], stride, bytes(palette + body)
+
+
+def candidates(width, height, pixels):
+    """(label, cf, stride, flags, data) for every encoding that applies."""
+    opaque = all(p[3] == 255 for p in pixels)
+    cf, stride, raw = encode_true_color(width, pixels, opaque)
+    blk = 2 if opaque else 4
+    out = [("raw", cf, stride, [], raw),
+           ("RLE", cf, stride, ["LV_IMAGE_FLAGS_COMPRESSED"], compressed(raw, blk))]
+    indexed = encode_indexed(width, height, pixels, opaque)
+    if indexed:
+        icf, istride, idata = indexed
+        flags = ["CYD_IMAGE_FLAGS_OPAQUE"] if opaque else []
+        out.append(("indexed", icf, istride, flags, idata))
+        out.append(("RLE indexed", icf, istride, flags + ["LV_IMAGE_FLAGS_COMPRESSED"], compressed(idata, 1)))
+    return out, len(raw)
+
+
+def compressed(data, blk):
+    payload = rle_compress(data, blk)
+    assert rle_decompress(payload, blk) == data, "RLE round trip failed"
+    return struct.pack("<III", RLE_METHOD, len(payload), len(data)) + payload
+
+
+# --------------------------------------------------------------------------------------------
+# Output
+# --------------------------------------------------------------------------------------------
+
+def c_list(values, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(f"0x{v:02x}" for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def squareline_images(project):
+    """Map asset paths ("assets/x.png") to (symbol, ui/ui_img_*.c) of SquareLine's arrays."""
+    found = {}
+    for path in sorted((project / "ui").glob("ui_img_*.c")):
+        text = path.read_text(errors="ignore")
+        source, symbol = SQUARELINE_SOURCE.search(text), SQUARELINE_SYMBOL.search(text)
+        if source and symbol:
+            found[source.group(1)] = (symbol.group(1), path)
+    return found
+
+
+def stem_name(path):
+    return re.sub(r"\W", "_", path.stem)
+
+
+def render(asset, symbol, width, height, choice, raw_size):
+    label, cf, stride, flags, data = choice
+    flag_expr = " | ".join(flags) if flags else "0"
+    lines = [
+        "/*******************************************************************************",
+        f" * Image: {asset} ({width}x{height})",
+        f" * Encoding: {label}, {cf[len('LV_COLOR_FORMAT_'):]}; {len(data)} bytes ({raw_size} unpacked)",
+        " * Generated by tools/pack_images.py. Do not edit.",
+        " ******************************************************************************/",
+        "",
+        "#include <lvgl.h>",
+    ]
+    if "CYD_IMAGE_FLAGS_OPAQUE" in flags:
+        lines.append('#include "cyd_imgcache.h"')
+    if "LV_IMAGE_FLAGS_COMPRESSED" in flags:
+        lines += ["", "#if !LV_USE_RLE", '#error "packed images need LV_USE_RLE"', "#endif"]
+    lines += [
+        "",
+        "#ifndef LV_ATTRIBUTE_MEM_ALIGN",
+        "#define LV_ATTRIBUTE_MEM_ALIGN",
+        "#endif",
+        "",
+        f"static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t {symbol}_data[] = {{",
+        c_list(list(data)),
+        "};",
+        "",
+        f"const lv_image_dsc_t {symbol} = {{",
+        "    .header.magic = LV_IMAGE_HEADER_MAGIC,",
+        f"    .header.cf = {cf},",
+        f"    .header.flags = {flag_expr},",
+        f"    .header.w = {width},",
+        f"    .header.h = {height},",
+        f"    .header.stride = {stride},",
+        f"    .data_size = sizeof({symbol}_data),",
+        f"    .data = {symbol}_data,",
+        "};",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def generate(project):
+    """Write images/; return the SquareLine sources the packed images replace."""
+    asset_dir, out_dir = project / ASSET_DIR_NAME, project / OUT_DIR_NAME
+    squareline = squareline_images(project)
+    replaced, written = [], set()
+    total_before = total_after = 0
+    out_dir.mkdir(exist_ok=True)
+    for png in sorted(asset_dir.glob("*.png")):
+        asset = f"{ASSET_DIR_NAME}/{png.name}"
+        symbol, ui_src = squareline.get(asset, (f"ui_img_{stem_name(png)}", None))
+        width, height, pixels = read_png(png)
+        options, raw_size = candidates(width, height, pixels)
+        choice = min(options, key=lambda c: len(c[4]))
+        path = out_dir / f"img_{stem_name(png)}.c"
+        src = render(asset, symbol, width, height, choice, raw_size)
+        if not path.exists() or path.read_text() != src:
+            path.write_text(src)
+            print(f"pack_images: wrote {path.relative_to(project)}")
+        written.add(path)
+        if ui_src:
+            replaced.append(ui_src)
+        total_before += raw_size
+        total_after += len(choice[4])
+        print(f"pack_images: {png.name} -> {symbol}: {choice[0]} {choice[1][len('LV_COLOR_FORMAT_'):]}, "
+              f"{raw_size} -> {len(choice[4])} bytes")
+    for stale in out_dir.glob("img_*.c"):
+        if stale not in written:
+            stale.unlink()
+            print(f"pack_images: removed {stale.relative_to(project)}")
+    print(f"pack_images: image data {total_before} -> {total_after} bytes")
+    return replaced
+
+
+if __name__ == "__main__":
+    generate(Path(__file__).resolve().parent.parent)  # not defined when PlatformIO runs the script
+else:
+    from SCons.Script import DefaultEnvironment  # pylint: disable=import-error
+
+    env = DefaultEnvironment()
+    project_dir = Path(env.subst("$PROJECT_DIR"))
+    src_filter = env.get("SRC_FILTER") or ["+<*>"]
+    if isinstance(src_filter, str):
+        src_filter = [src_filter]
+    if env.GetProjectOption("custom_image_pack", "yes").lower() in ("1", "yes", "true"):
+        drop = [p.relative_to(project_dir).as_posix() for p in generate(project_dir)]
+    else:
+        drop = [f"{OUT_DIR_NAME}/"]
+    env.Replace(SRC_FILTER=list(src_filter) + [f"-<{d}>" for d in drop])
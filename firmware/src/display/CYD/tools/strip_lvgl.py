@@ -5,6 +5,10 @@ from SCons.Script import DefaultEnvironment
 
 env = DefaultEnvironment()
 
+# The PIE blend backend (cyd_blend_s3.*, wired up in lv_conf.h) only exists on the ESP32-S3.
+if env.BoardConfig().get("build.mcu", "") == "esp32s3":
+    env.Append(CPPDEFINES=[("CYD_BLEND_S3", 1)])
+
 
 def prune_lvgl(target, source, env):  # pylint: disable=unused-argument
     lvgl_dir = Path(env.subst("$PROJECT_LIBDEPS_DIR")) / env.subst("$PIOENV") / "lvgl"
@@ -0,0 +1,609 @@
+"""Glyph-subset Montserrat fonts for the CYD UI.
+
+LVGL's built-in lv_font_montserrat_NN.c files carry all of printable ASCII plus ~60 FontAwesome
+symbols at 4 bpp, while the UI only ever shows a few dozen distinct characters. This script scans
+the text the firmware can display, cuts LVGL's fonts down to those glyphs (same bitmaps, metrics
+and kerning; no font rasteriser needed) and writes them to fonts/cyd_montserrat_NN.c under the
+same lv_font_montserrat_NN symbols, so the SquareLine output links against them unchanged.
+lv_conf.h switches between these and LVGL's full fonts with CYD_FONT_SUBSET.
+
+Glyph sources:
+  - every string literal in ui/*.c (SquareLine text and dropdown options)
+  - string and character literals in cyd_state.c and ui_custom.cpp, with printf conversions
+    expanded to the characters they can produce (%u -> digits, %.1f -> digits . -, ...)
+  - text passed to lv_label_set_text* / lv_dropdown_set_options* in main.cpp (the rest of that
+    file is the setup web page)
+  - LV_SYMBOL_* used in the sources, plus the ones widgets draw on their own (dropdown arrow,
+    checkbox tick)
+
+Sizes listed in custom_font_full_ascii keep all of printable ASCII: they show text that only
+exists at runtime (the SSID and password on the boot screen, diagnostics, fault descriptions,
+device names). Every other size falls back to LV_FONT_DEFAULT's font for a character it lacks, so
+an unexpected character renders at the wrong size rather than not at all.
+
+The byte counts it prints are the fonts' const data (bitmaps, glyph descriptors, cmaps, kerning)
+as estimated from the tables, i.e. roughly what the font objects hold; they are not a firmware
+image or flash usage delta, which also depends on the linker and what else is built in. Compare
+the image sizes of a CYD_FONT_SUBSET=0 and =1 build for that.
+
+Runs as a PlatformIO pre: script (see platformio.ini) and only rewrites a file when its content
+changes; the generated files are committed so a build without the LVGL sources still works.
+Standalone: python tools/subset_fonts.py [--lvgl DIR] [--compress] [--full-ascii "10 12 16"]
+"""
+
+import argparse
+import re
+from pathlib import Path
+
+OUT_DIR_NAME = "fonts"
+
+# Symbols LVGL widgets draw without the UI asking for them.
+WIDGET_SYMBOLS = ["LV_SYMBOL_DOWN", "LV_SYMBOL_UP", "LV_SYMBOL_OK"]
+# Always available so runtime numbers, temperatures and voltages render in every size.
+BASE_CHARS = " 0123456789-.%°CFV"
+
+C_STRING = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+C_CHAR = re.compile(r"'((?:[^'\\\n]|\\.))'")
+PRINTF_CONV = re.compile(r"%[-+ #0]*(?:\d+|\*)?(?:\.(?:\d+|\*))?(?:hh|h|ll|l|z|j|t|L)?([diouxXfFeEgGcsp%])")
+PRINTF_CHARS = {
+    "d": "0123456789-", "i": "0123456789-", "u": "0123456789", "o": "01234567",
+    "x": "0123456789abcdef", "X": "0123456789ABCDEF", "p": "0123456789abcdefx",
+    "f": "0123456789.-", "F": "0123456789.-", "g": "0123456789.-e+", "G": "0123456789.-E+",
+    "e": "0123456789.-e+", "E": "0123456789.-E+", "%": "%", "c": "", "s": "",
+}
+LV_TEXT_CALL = re.compile(r"lv_(?:label_set_text\w*|dropdown_set_options\w*)\s*\(")
+
+
+# --------------------------------------------------------------------------------------------
+# Text scanning
+# --------------------------------------------------------------------------------------------
+
+def c_unescape(body):
+    out = bytearray()
+    i = 0
+    while i < len(body):
+        ch = body[i]
+        if ch != "\\":
+            out += ch.encode("utf-8")
+            i += 1
+            continue
+        nxt = body[i + 1]
+        if nxt == "x":
+            m = re.match(r"[0-9a-fA-F]+", body[i + 2:])
+            out.append(int(m.group(0), 16) & 0xFF)
+            i += 2 + len(m.group(0))
+        elif nxt in "01234567":
+            m = re.match(r"[0-7]{1,3}", body[i + 1:])
+            out.append(int(m.group(0), 8) & 0xFF)
+            i += 1 + len(m.group(0))
+        else:
+            out += {"n": b"\n", "t": b"\t", "r": b"\r", "0": b"\0"}.get(nxt, nxt.encode("utf-8"))
+            i += 2
+    return out.decode("utf-8", errors="ignore")
+
+
+def strip_comments(src):
+    # Keeps string literals intact: a '//' inside "http://..." is not a comment.
+    pattern = re.compile(r'"(?:[^"\\\n]|\\.)*"|\'(?:[^\'\\\n]|\\.)*\'|//[^\n]*|/\*.*?\*/', re.S)
+    return pattern.sub(lambda m: m.group(0) if m.group(0)[0] in "\"'" else " ", src)
+
+
+def literal_text(src, printf):
+    text = []
+    for line in src.splitlines():
+        if line.lstrip().startswith("#include"):
+            continue
+        for m in C_STRING.finditer(line):
+            s = c_unescape(m.group(1))
+            if printf:
+                s = PRINTF_CONV.sub(lambda c: PRINTF_CHARS[c.group(1)], s)
+            text.append(s)
+        if printf:
+            text.extend(c_unescape(m.group(1)) for m in C_CHAR.finditer(line))
+    return "".join(text)
+
+
+def call_arguments(src, call):
+    # Source text of each call's argument list (balanced parentheses).
+    for m in call.finditer(src):
+        depth, i = 1, m.end()
+        while i < len(src) and depth:
+            if src[i] == '"':
+                i = C_STRING.match(src, i).end()
+                continue
+            depth += {"(": 1, ")": -1}.get(src[i], 0)
+            i += 1
+        yield src[m.end():i - 1]
+
+
+def collect_text(project):
+    text = [BASE_CHARS]
+    for path in sorted((project / "ui").glob("*.c")):
+        text.append(literal_text(strip_comments(path.read_text(errors="ignore")), printf=False))
+    for name in ("cyd_state.c", "ui_custom.cpp"):
+        path = project / name
+        if path.exists():
+            text.append(literal_text(strip_comments(path.read_text(errors="ignore")), printf=True))
+    main = project / "main.cpp"
+    if main.exists():
+        for args in call_arguments(strip_comments(main.read_text(errors="ignore")), LV_TEXT_CALL):
+            text.append(literal_text(args, printf=True))
+    return "".join(text)
+
+
+def symbol_codepoints(project, lvgl_font_dir):
+    defs = {}
+    for m in re.finditer(r'#define\s+(LV_SYMBOL_\w+)\s+"((?:\\x[0-9A-Fa-f]{2})+)"',
+                         (lvgl_font_dir / "lv_symbol_def.h").read_text()):
+        defs[m.group(1)] = c_unescape(m.group(2))
+    used = set(WIDGET_SYMBOLS)
+    for path in list((project / "ui").glob("*.[ch]")) + list(project.glob("*.[ch]")) + list(project.glob("*.cpp")):
+        used.update(re.findall(r"\bLV_SYMBOL_[A-Z0-9_]+\b", path.read_text(errors="ignore")))
+    return "".join(defs[name] for name in sorted(used) if name in defs)
+
+
+def used_sizes(project):
+    sizes = set()
+    for path in list((project / "ui").glob("*.c")) + list(project.glob("*.c")) + list(project.glob("*.cpp")):
+        sizes.update(int(n) for n in re.findall(r"lv_font_montserrat_(\d+)", path.read_text(errors="ignore")))
+    return sizes | {default_size(project)}
+
+
+def default_size(project):
+    conf = (project / "lv_conf.h").read_text()
+    return int(re.search(r"#define\s+LV_FONT_DEFAULT\s+&lv_font_montserrat_(\d+)", conf).group(1))
+
+
+# --------------------------------------------------------------------------------------------
+# LVGL font parsing
+# --------------------------------------------------------------------------------------------
+
+def c_array(src, name):
+    m = re.search(r"\b" + name + r"\[\]\s*=\s*\{(.*?)\};", src, re.S)
+    if not m:
+        return None
+    body = re.sub(r"/\*.*?\*/", "", m.group(1), flags=re.S)
+    return [int(tok, 0) for tok in re.findall(r"-?(?:0x[0-9a-fA-F]+|\d+)", body)]
+
+
+def c_field(src, name, default=None):
+    m = re.search(r"\." + name + r"\s*=\s*(-?\d+)", src)
+    return int(m.group(1)) if m else default
+
+
+class Font:
+    def __init__(self, path):
+        src = path.read_text()
+        self.path = path
+        self.bpp = c_field(src, "bpp")
+        if c_field(src, "bitmap_format") != 0:
+            raise ValueError(f"{path.name}: only uncompressed LVGL fonts can be subset")
+        bitmap = c_array(src, "glyph_bitmap")
+        glyphs = [tuple(int(v) for v in g) for g in re.findall(
+            r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), "
+            r"\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}", src)]
+        # glyph id -> (adv_w, box_w, box_h, ofs_x, ofs_y, bitmap bytes); id 0 is reserved
+        self.glyphs = []
+        for gid, (index, adv, box_w, box_h, ofs_x, ofs_y) in enumerate(glyphs):
+            size = (box_w * box_h * self.bpp + 7) // 8 if gid else 0
+            self.glyphs.append((adv, box_w, box_h, ofs_x, ofs_y, bytes(bitmap[index:index + size])))
+        self.bitmap_bytes = len(bitmap)
+
+        self.cmap = {}  # code point -> glyph id
+        for i, m in enumerate(re.finditer(
+                r"\.range_start = (\d+), \.range_length = (\d+), \.glyph_id_start = (\d+),\s*"
+                r"\.unicode_list = (\w+), \.glyph_id_ofs_list = (\w+), \.list_length = (\d+), \.type = (\w+)", src)):
+            start, length, gid_start = int(m.group(1)), int(m.group(2)), int(m.group(3))
+            kind = m.group(7)
+            if kind.endswith("FORMAT0_TINY"):
+                for ofs in range(length):
+                    self.cmap[start + ofs] = gid_start + ofs
+            elif kind.endswith("SPARSE_TINY"):
+                for ofs, rel in enumerate(c_array(src, m.group(4))):
+                    self.cmap[start + rel] = gid_start + ofs
+            else:
+                raise ValueError(f"{path.name}: cmap {i} type {kind} not handled")
+
+        self.kern_left = c_array(src, "kern_left_class_mapping")
+        self.kern_right = c_array(src, "kern_right_class_mapping")
+        self.kern_values = c_array(src, "kern_class_values")
+        self.kern_left_cnt = c_field(src, "left_class_cnt", 0)
+        self.kern_right_cnt = c_field(src, "right_class_cnt", 0)
+        self.kern_scale = c_field(src, "kern_scale", 16)
+        if self.kern_left is None and c_field(src, "kern_classes", 0):
+            raise ValueError(f"{path.name}: pair kerning not handled")
+
+        self.line_height = c_field(src, "line_height")
+        self.base_line = c_field(src, "base_line")
+        self.underline_position = c_field(src, "underline_position", -1)
+        self.underline_thickness = c_field(src, "underline_thickness", 1)
+
+    def data_bytes(self):
+        # Rough const data of the font object: bitmaps, 8-byte glyph descriptors, cmap lists and
+        # kerning tables.
+        cmap_lists = 2 * sum(1 for cp in self.cmap if cp > 0x7F)
+        kern = 0
+        if self.kern_left:
+            kern = len(self.kern_left) + len(self.kern_right) + len(self.kern_values)
+        return self.bitmap_bytes + 8 * len(self.glyphs) + cmap_lists + kern
+
+
+# --------------------------------------------------------------------------------------------
+# Compression (LV_FONT_FMT_TXT_COMPRESSED: XOR prefilter against the previous row, then LVGL's
+# RLE: literals of bpp bits, a repeated literal starts a run of 1-bits, the 11th 1-bit is
+# followed by a 6-bit counter)
+# --------------------------------------------------------------------------------------------
+
+class BitWriter:
+    def __init__(self):
+        self.bits = []
+
+    def put(self, value, width):
+        self.bits.extend((value >> (width - 1 - i)) & 1 for i in range(width))
+
+    def bytes(self):
+        out = bytearray()
+        for i in range(0, len(self.bits), 8):
+            chunk = self.bits[i:i + 8] + [0] * (8 - len(self.bits[i:i + 8]))
+            out.append(int("".join(map(str, chunk)), 2))
+        return bytes(out)
+
+
+def glyph_pixels(glyph, bpp):
+    _, box_w, box_h, _, _, data = glyph
+    mask = (1 << bpp) - 1
+    px = []
+    for i in range(box_w * box_h):
+        bit = i * bpp
+        px.append((data[bit // 8] >> (8 - bpp - bit % 8)) & mask)
+    return [px[r * box_w:(r + 1) * box_w] for r in range(box_h)]
+
+
+def rle_encode(values, bpp):
+    out = BitWriter()
+    n, i, prev = len(values), 0, None
+    while i < n:
+        # Literal state: a value equal to the previous literal switches the decoder to repeats.
+        value = values[i]
+        out.put(value, bpp)
+        i += 1
+        repeat = value == prev
+        prev = value
+        if not repeat:
+            continue
+        # Repeat state: each 1-bit repeats prev, a 0-bit is followed by the next literal.
+        count = 0
+        while i < n:
+            if values[i] != prev:
+                out.put(0, 1)
+                out.put(values[i], bpp)
+                prev = values[i]
+                i += 1
+                break
+            out.put(1, 1)
+            i += 1
+            count += 1
+            if count == 11:
+                # Counter c: c - 1 more repeats, then a literal.
+                run = 0
+                while i + run < n and values[i + run] == prev and run < 62:
+                    run += 1
+                out.put(run + 1, 6)
+                i += run
+                if i < n:
+                    out.put(values[i], bpp)
+                    prev = values[i]
+                    i += 1
+                break
+    return out.bytes()
+
+
+def rle_decode(data, bpp, count):
+    # Mirror of lv_font_fmt_txt.c rle_next(), used to check every compressed glyph.
+    def bits(pos, width):
+        v = 0
+        for k in range(width):
+            byte = data[(pos + k) // 8] if (pos + k) // 8 < len(data) else 0
+            v = (v << 1) | ((byte >> (7 - (pos + k) % 8)) & 1)
+        return v
+
+    out, pos, state, prev, cnt = [], 0, "single", 0, 0
+    for _ in range(count):
+        if state == "single":
+            ret = bits(pos, bpp)
+            if pos != 0 and prev == ret:
+                cnt, state = 0, "repeat"
+            prev = ret
+            pos += bpp
+        elif state == "repeat":
+            v = bits(pos, 1)
+            cnt += 1
+            pos += 1
+            if v:
+                ret = prev
+                if cnt == 11:
+                    cnt = bits(pos, 6)
+                    pos += 6
+                    if cnt:
+                        state = "counter"
+                    else:
+                        ret = prev = bits(pos, bpp)
+                        pos += bpp
+                        state = "single"
+            else:
+                ret = prev = bits(pos, bpp)
+                pos += bpp
+                state = "single"
+        else:
+            ret = prev
+            cnt -= 1
+            if cnt == 0:
+                ret = prev = bits(pos, bpp)
+                pos += bpp
+                state = "single"
+        out.append(ret)
+    return out
+
+
+def compress_glyph(glyph, bpp):
+    rows = glyph_pixels(glyph, bpp)
+    values = []
+    for r, row in enumerate(rows):
+        values.extend(row if r == 0 else [a ^ b for a, b in zip(row, rows[r - 1])])
+    data = rle_encode(values, bpp)
+    if rle_decode(data, bpp, len(values)) != values:
+        raise RuntimeError("RLE round trip failed")
+    return data
+
+
+# --------------------------------------------------------------------------------------------
+# Subsetting and C output
+# --------------------------------------------------------------------------------------------
+
+def describe(cp):
+    if 0x20 <= cp < 0x7F:
+        ch = chr(cp)
+        return '"' + ("\\" + ch if ch in '"\\' else ch) + '"'
+    return '"' + chr(cp) + '"' if cp < 0xF000 else '"<symbol>"'
+
+
+def c_list(values, fmt, per_line=8, indent="    "):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ", ".join(fmt(v) for v in values[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def subset(font, size, codepoints, compress, fallback):
+    cps = sorted(cp for cp in codepoints if cp in font.cmap)
+    old_ids = [0] + [font.cmap[cp] for cp in cps]
+
+    bitmap = bytearray()
+    dscs = ["    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */"]
+    blocks = []
+    for cp, gid in zip(cps, old_ids[1:]):
+        glyph = font.glyphs[gid]
+        adv, box_w, box_h, ofs_x, ofs_y, data = glyph
+        if compress and box_w * box_h:
+            data = compress_glyph(glyph, font.bpp)
+        dscs.append(f"    {{.bitmap_index = {len(bitmap)}, .adv_w = {adv}, .box_w = {box_w}, .box_h = {box_h}, "
+                    f".ofs_x = {ofs_x}, .ofs_y = {ofs_y}}}")
+        blocks.append(f"    /* U+{cp:04X} {describe(cp)} */\n" + (c_list(list(data), hex) + ",\n" if data else ""))
+        bitmap += data
+    if compress:
+        blocks.append("    /* rle_next() may read one byte past the last glyph */\n    0x0\n")
+        bitmap.append(0)
+
+    # ASCII through a direct-index table (absolute glyph ids, 0 = missing, so the fallback
+    # font is asked), everything else through a sorted code point list.
+    ascii_cps = [cp for cp in cps if cp < 0x80]
+    other_cps = [cp for cp in cps if cp >= 0x80]
+    cmap_src, cmaps = [], []
+    if ascii_cps:
+        first, last = ascii_cps[0], ascii_cps[-1]
+        table = [cps.index(cp) + 1 if cp in ascii_cps else 0 for cp in range(first, last + 1)]
+        cmap_src.append("static const uint8_t glyph_id_ofs_list_0[] = {\n" + c_list(table, str) + "\n};\n")
+        cmaps.append(f"    {{\n        .range_start = {first}, .range_length = {last - first + 1}, .glyph_id_start = 0,\n"
+                     f"        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_0, "
+                     f".list_length = {len(table)}, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL\n    }}")
+    if other_cps:
+        first = other_cps[0]
+        rel = [cp - first for cp in other_cps]
+        name = f"unicode_list_{len(cmaps)}"
+        cmap_src.append(f"static const uint16_t {name}[] = {{\n" + c_list(rel, hex) + "\n};\n")
+        cmaps.append(f"    {{\n        .range_start = {first}, .range_length = {rel[-1] + 1}, "
+                     f".glyph_id_start = {len(ascii_cps) + 1},\n"
+                     f"        .unicode_list = {name}, .glyph_id_ofs_list = NULL, .list_length = {len(rel)}, "
+                     f".type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY\n    }}")
+
+    # Kerning: keep only the classes the remaining glyphs use and renumber them densely.
+    kern_src = ""
+    if font.kern_left:
+        left = [font.kern_left[g] for g in old_ids]
+        right = [font.kern_right[g] for g in old_ids]
+        lmap = {c: i + 1 for i, c in enumerate(sorted(set(left) - {0}))}
+        rmap = {c: i + 1 for i, c in enumerate(sorted(set(right) - {0}))}
+        values = [0] * (len(lmap) * len(rmap))
+        for lc, ln in lmap.items():
+            for rc, rn in rmap.items():
+                values[(ln - 1) * len(rmap) + rn - 1] = font.kern_values[(lc - 1) * font.kern_right_cnt + rc - 1]
+        if any(values):
+            kern_src = (
+                "/*Map glyph_ids to kern left classes*/\n"
+                "static const uint8_t kern_left_class_mapping[] = {\n"
+                + c_list([lmap.get(c, 0) for c in left], str) + "\n};\n\n"
+                "/*Map glyph_ids to kern right classes*/\n"
+                "static const uint8_t kern_right_class_mapping[] = {\n"
+                + c_list([rmap.get(c, 0) for c in right], str) + "\n};\n\n"
+                "/*Kern values between classes*/\n"
+                "static const int8_t kern_class_values[] = {\n" + c_list(values, str) + "\n};\n\n"
+                "/*Collect the kern class' data in one place*/\n"
+                "static const lv_font_fmt_txt_kern_classes_t kern_classes = {\n"
+                "    .class_pair_values   = kern_class_values,\n"
+                "    .left_class_mapping  = kern_left_class_mapping,\n"
+                "    .right_class_mapping = kern_right_class_mapping,\n"
+                f"    .left_class_cnt      = {len(lmap)},\n"
+                f"    .right_class_cnt     = {len(rmap)},\n"
+                "};\n")
+
+    text = "".join(chr(cp) if cp < 0xF000 else "" for cp in cps)
+    symbols = sum(1 for cp in cps if cp >= 0xF000)
+    data = len(bitmap) + 8 * len(dscs) + 2 * len(other_cps)
+    if ascii_cps:
+        data += len(table)
+    if kern_src:
+        data += 2 * len(old_ids) + len(values)
+    name = f"lv_font_montserrat_{size}"
+    lines = [
+        "/*******************************************************************************",
+        f" * Size: {size} px",
+        f" * Bpp: {font.bpp}",
+        f" * Subset of LVGL's {font.path.name}, generated by tools/subset_fonts.py. Do not edit.",
+        f" * Glyphs ({len(cps)}): {comment_safe(text)}" + (f" + {symbols} symbols" if symbols else ""),
+        " ******************************************************************************/",
+        "",
+        '#include <lvgl.h>',
+        "",
+        "#if CYD_FONT_SUBSET",
+        "",
+    ]
+    if compress:
+        lines += ["#if !LV_USE_FONT_COMPRESSED",
+                  '#error "compressed font subset: build with CYD_FONT_COMPRESSED=1"',
+                  "#endif", ""]
+    lines += [
+        "/*-----------------",
+        " *    BITMAPS",
+        " *----------------*/",
+        "",
+        "/*Store the image of the glyphs*/",
+        "static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {",
+        "\n".join(blocks).rstrip(",\n") + "\n};",
+        "",
+        "/*---------------------",
+        " *  GLYPH DESCRIPTION",
+        " *--------------------*/",
+        "",
+        "static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {",
+        ",\n".join(dscs),
+        "};",
+        "",
+        "/*---------------------",
+        " *  CHARACTER MAPPING",
+        " *--------------------*/",
+        "",
+        "\n".join(cmap_src),
+        "/*Collect the unicode lists and glyph_id offsets*/",
+        "static const lv_font_fmt_txt_cmap_t cmaps[] = {",
+        ",\n".join(cmaps),
+        "};",
+        "",
+    ]
+    if kern_src:
+        lines += ["/*-----------------", " *    KERNING", " *----------------*/", "", kern_src]
+    lines += [
+        "/*--------------------",
+        " *  ALL CUSTOM DATA",
+        " *--------------------*/",
+        "",
+        "static const lv_font_fmt_txt_dsc_t font_dsc = {",
+        "    .glyph_bitmap = glyph_bitmap,",
+        "    .glyph_dsc = glyph_dsc,",
+        "    .cmaps = cmaps,",
+        "    .kern_dsc = " + ("&kern_classes," if kern_src else "NULL,"),
+        f"    .kern_scale = {font.kern_scale if kern_src else 0},",
+        f"    .cmap_num = {len(cmaps)},",
+        f"    .bpp = {font.bpp},",
+        f"    .kern_classes = {1 if kern_src else 0},",
+        f"    .bitmap_format = {1 if compress else 0},",
+        "};",
+        "",
+        "/*-----------------",
+        " *  PUBLIC FONT",
+        " *----------------*/",
+        "",
+        f"const lv_font_t {name} = {{",
+        "    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,",
+        "    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,",
+        f"    .line_height = {font.line_height},",
+        f"    .base_line = {font.base_line},",
+        "    .subpx = LV_FONT_SUBPX_NONE,",
+        f"    .underline_position = {font.underline_position},",
+        f"    .underline_thickness = {font.underline_thickness},",
+        "    .dsc = &font_dsc,",
+        f"    .fallback = &lv_font_montserrat_{fallback}," if fallback else "    .fallback = NULL,",
+        "};",
+        "",
+        "#endif /*CYD_FONT_SUBSET*/",
+        "",
+    ]
+    return "\n".join(lines), len(cps), data
+
+
+def comment_safe(text):
+    return text.replace("*/", "*\\/").replace("\n", "")
+
+
+def generate(project, lvgl_dir, compress, full_ascii):
+    font_dir = lvgl_dir / "src" / "font"
+    if not (font_dir / "lv_symbol_def.h").exists():
+        print(f"subset_fonts: LVGL sources not found in {lvgl_dir}; keeping {OUT_DIR_NAME}/ as committed")
+        return
+
+    text = collect_text(project)
+    ui_cps = {ord(ch) for ch in text if ch >= " "} | {ord(ch) for ch in symbol_codepoints(project, font_dir)}
+    default = default_size(project)
+    out_dir = project / OUT_DIR_NAME
+    out_dir.mkdir(exist_ok=True)
+
+    total_before = total_after = 0
+    for size in sorted(used_sizes(project)):
+        font = Font(font_dir / f"lv_font_montserrat_{size}.c")
+        cps = set(ui_cps)
+        if size in full_ascii:
+            cps |= set(range(0x20, 0x7F))
+        fallback = default if size not in full_ascii and size != default else None
+        src, count, data = subset(font, size, cps, compress, fallback)
+        path = out_dir / f"cyd_montserrat_{size}.c"
+        if not path.exists() or path.read_text() != src:
+            path.write_text(src)
+            print(f"subset_fonts: wrote {path.relative_to(project)}")
+        before = font.data_bytes()
+        total_before += before
+        total_after += data
+        print(f"subset_fonts: montserrat_{size}: {len(font.glyphs) - 1} -> {count} glyphs, "
+              f"~{before} -> ~{data} bytes{' (full ASCII)' if size in full_ascii else ''}")
+    for stale in out_dir.glob("cyd_montserrat_*.c"):
+        if int(re.search(r"_(\d+)\.c$", stale.name).group(1)) not in used_sizes(project):
+            stale.unlink()
+            print(f"subset_fonts: removed {stale.relative_to(project)}")
+    print(f"subset_fonts: font object data ~{total_before} -> ~{total_after} bytes"
+          f"{' (RLE compressed)' if compress else ''}, estimated; not the firmware image size")
+
+
+def parse_sizes(value):
+    return {int(v) for v in re.split(r"[\s,]+", value.strip()) if v}
+
+
+def main():
+    project = Path(__file__).resolve().parent.parent  # not defined when PlatformIO runs the script
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--lvgl", type=Path, default=project / ".pio/libdeps/cyd_s3/lvgl")
+    parser.add_argument("--compress", action="store_true", help="RLE-compress the glyph bitmaps")
+    parser.add_argument("--full-ascii", default="10 12 16", help="sizes that keep all of printable ASCII")
+    args = parser.parse_args()
+    generate(project, args.lvgl, args.compress, parse_sizes(args.full_ascii))
+
+
+if __name__ == "__main__":
+    main()
+else:
+    from SCons.Script import DefaultEnvironment  # pylint: disable=import-error
+
+    env = DefaultEnvironment()
+    compress = env.GetProjectOption("custom_font_compress", "no").lower() in ("1", "yes", "true")
+    full_ascii = parse_sizes(env.GetProjectOption("custom_font_full_ascii", "10 12 16"))
+    lvgl_dir = Path(env.subst("$PROJECT_LIBDEPS_DIR")) / env.subst("$PIOENV") / "lvgl"
+    generate(Path(env.subst("$PROJECT_DIR")), lvgl_dir, compress, full_ascii)
+    if compress:
+        env.Append(CPPDEFINES=[("CYD_FONT_COMPRESSED", 1)])
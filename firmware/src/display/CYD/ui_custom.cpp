@@ -3,6 +3,7 @@
 #include <cstdio>
 #include "ui.h"
 #include "cyd_state.h"
+#include "ui_custom.h"
 
 // Onboarding control (defined in main.cpp)
 void start_wifi_onboarding();
@@ -10,8 +11,9 @@ void stop_wifi_onboarding();
 
 // Keep navigation/overlay logic here so regenerating SquareLine files won't wipe it.
 // To add a new navigation:
-// 1) Write a small handler that calls _ui_screen_change(target_screen, animation, time_ms, delay_ms, target_init_fn).
-// 2) Register it on the source widget(s) in ui_register_custom_actions().
+// 1) Write a small handler that calls cyd_screens_show(target_screen).
+// 2) Register it with add_navigation() in the source screen's register_*_actions(), which also
+//    starts building the target on press.
 
 // Navigation targets
 
@@ -61,57 +63,52 @@ static void hide_boot_direct(lv_event_t *e) {
 static void home_to_settings(lv_event_t *e) {
     LV_UNUSED(e);
     printf("[nav] home_to_settings\n");
-    _ui_screen_change(&ui_cydsettings, LV_SCR_LOAD_ANIM_NONE, 0, 0, NULL);
-    cyd_state_apply_to_cydsettings_screen();
+    cyd_screens_show(CYD_SCREEN_CYDSETTINGS);
 }
 
 static void home_to_fresh(lv_event_t *e) {
     LV_UNUSED(e);
-    _ui_screen_change(&ui_fresh, LV_SCR_LOAD_ANIM_NONE, 0, 0, NULL);
-    cyd_state_apply_to_fresh_screen();
+    cyd_screens_show(CYD_SCREEN_FRESH);
 }
 
 static void home_to_waste(lv_event_t *e) {
     LV_UNUSED(e);
-    _ui_screen_change(&ui_waste, LV_SCR_LOAD_ANIM_NONE, 0, 0, NULL);
-    cyd_state_apply_to_waste_screen();
+    cyd_screens_show(CYD_SCREEN_WASTE);
 }
 // --- Cyd Settings ---
 
 static void cydsettings_to_home(lv_event_t *e) {
     LV_UNUSED(e);
-    _ui_screen_change(&ui_home, LV_SCR_LOAD_ANIM_NONE, 0, 0, NULL);
+    cyd_screens_show(CYD_SCREEN_HOME);
 }
 
 // --- Boot -> Home ---
 static void boot_to_home(lv_event_t *e) {
     LV_UNUSED(e);
-    _ui_screen_change(&ui_home, LV_SCR_LOAD_ANIM_NONE, 0, 0, NULL);
+    cyd_screens_show(CYD_SCREEN_HOME);
 }
 
 // --- Fresh ---
 
 static void fresh_to_home(lv_event_t *e) {
     LV_UNUSED(e);
-    _ui_screen_change(&ui_home, LV_SCR_LOAD_ANIM_NONE, 0, 0, NULL);
+    cyd_screens_show(CYD_SCREEN_HOME);
 }
 
 static void fresh_to_freshfaults(lv_event_t *e) {
     LV_UNUSED(e);
-    _ui_screen_change(&ui_freshfaults, LV_SCR_LOAD_ANIM_NONE, 0, 0, NULL);
-    cyd_state_apply_to_freshfaults_screen();
+    cyd_screens_show(CYD_SCREEN_FRESHFAULTS);
 }
 
 static void fresh_to_freshsettings(lv_event_t *e) {
     LV_UNUSED(e);
-    _ui_screen_change(&ui_freshsettings, LV_SCR_LOAD_ANIM_NONE, 0, 0, NULL);
-    cyd_state_apply_to_freshsettings_screen();
+    cyd_screens_show(CYD_SCREEN_FRESHSETTINGS);
 }
 
 // --- Fresh Settings ---
 static void freshsettings_to_fresh(lv_event_t *e) {
     LV_UNUSED(e);
-    _ui_screen_change(&ui_fresh, LV_SCR_LOAD_ANIM_NONE, 0, 0, NULL);
+    cyd_screens_show(CYD_SCREEN_FRESH);
 }
 
 // Fresh Settings overlays
@@ -136,7 +133,6 @@ static void freshsettings_show_diag_overlay(lv_event_t *e) {
     lv_obj_clear_flag(ui_freshsettingsDiagnosticOverlay, LV_OBJ_FLAG_HIDDEN);
     _ui_opacity_set(ui_freshsettingsDiagnosticOverlay, 255);
     lv_obj_move_foreground(ui_freshsettingsDiagnosticOverlay);
-    cyd_state_apply_to_freshsettings_diag_overlay();
 }
 
 static void freshsettings_hide_diag_overlay(lv_event_t *e) {
@@ -149,13 +145,8 @@ static void freshsettings_hide_diag_overlay(lv_event_t *e) {
 static void freshsettings_slider_changed(lv_event_t *e) {
     if (!ui_freshsettingsOverlayFillSlider) return;
     const int32_t v = lv_slider_get_value(ui_freshsettingsOverlayFillSlider);
-    cyd_state.fresh.stop_level_percent = v < 0 ? 0 : (v > 100 ? 100 : static_cast<uint8_t>(v));
-    if (ui_freshsettingsOverlayFillPercentage) {
-        lv_label_set_text_fmt(ui_freshsettingsOverlayFillPercentage, "%u%%", cyd_state.fresh.stop_level_percent);
-    }
-    if (ui_freshsettingsFillStopLevelLabel) {
-        lv_label_set_text_fmt(ui_freshsettingsFillStopLevelLabel, "%u%%", cyd_state.fresh.stop_level_percent);
-    }
+    cyd_state_set_stop_level(&cyd_state.fresh, v < 0 ? 0 : (v > 100 ? 100 : static_cast<uint8_t>(v)));
+    cyd_state_bind_active();
 }
 
 static void freshsettings_freeze_changed(lv_event_t *e) {
@@ -163,65 +154,64 @@ static void freshsettings_freeze_changed(lv_event_t *e) {
     if (!ui_freshsettingsFreezeProtection) return;
     uint16_t sel = lv_dropdown_get_selected(ui_freshsettingsFreezeProtection);
     if (sel > 5) sel = 0;
-    cyd_state.fresh.freeze_setting = static_cast<uint8_t>(sel);
-    cyd_state.fresh.freeze_enabled = (sel > 0);
+    cyd_state_set_freeze(&cyd_state.fresh, static_cast<uint8_t>(sel));
 }
 
 static void freshsettings_safety_changed(lv_event_t *e) {
     LV_UNUSED(e);
     if (!ui_freshsettingsSafetyOveride) return;
-    cyd_state.fresh.safety_override_enabled = lv_obj_has_state(ui_freshsettingsSafetyOveride, LV_STATE_CHECKED);
+    cyd_state_set_safety_override(&cyd_state.fresh, lv_obj_has_state(ui_freshsettingsSafetyOveride, LV_STATE_CHECKED));
 }
 
 static void freshsettings_valve_changed(lv_event_t *e) {
     LV_UNUSED(e);
     if (!ui_freshsettingsValveOveride) return;
-    cyd_state.fresh.valve_override_enabled = lv_obj_has_state(ui_freshsettingsValveOveride, LV_STATE_CHECKED);
+    cyd_state_set_valve_override(&cyd_state.fresh, lv_obj_has_state(ui_freshsettingsValveOveride, LV_STATE_CHECKED));
 }
 
 static void freshsettings_set_full(lv_event_t *e) {
     LV_UNUSED(e);
-    cyd_state.fresh.full_voltage_mv = static_cast<uint16_t>((cyd_state.fresh.full_voltage_mv + 50) % 5000);
-    if (cyd_state.fresh.full_voltage_mv < 1000) cyd_state.fresh.full_voltage_mv = 3300;
-    cyd_state_apply_to_freshsettings_screen();
+    uint16_t mv = static_cast<uint16_t>((cyd_state.fresh.full_voltage_mv + 50) % 5000);
+    if (mv < 1000) mv = 3300;
+    cyd_state_set_full_voltage(&cyd_state.fresh, mv);
+    cyd_state_bind_active();
 }
 
 static void freshsettings_set_empty(lv_event_t *e) {
     LV_UNUSED(e);
-    cyd_state.fresh.empty_voltage_mv = static_cast<uint16_t>((cyd_state.fresh.empty_voltage_mv + 25) % 2000);
-    if (cyd_state.fresh.empty_voltage_mv < 200) cyd_state.fresh.empty_voltage_mv = 800;
-    cyd_state_apply_to_freshsettings_screen();
+    uint16_t mv = static_cast<uint16_t>((cyd_state.fresh.empty_voltage_mv + 25) % 2000);
+    if (mv < 200) mv = 800;
+    cyd_state_set_empty_voltage(&cyd_state.fresh, mv);
+    cyd_state_bind_active();
 }
 
 // --- Fresh Faults ---
 static void freshfaults_to_fresh(lv_event_t *e) {
     LV_UNUSED(e);
-    _ui_screen_change(&ui_fresh, LV_SCR_LOAD_ANIM_NONE, 0, 0, NULL);
+    cyd_screens_show(CYD_SCREEN_FRESH);
 }
 
 
 // --- Waste  ---
 static void waste_to_home(lv_event_t *e) {
     LV_UNUSED(e);
-    _ui_screen_change(&ui_home, LV_SCR_LOAD_ANIM_NONE, 0, 0, NULL);
+    cyd_screens_show(CYD_SCREEN_HOME);
 }
 
 static void waste_to_wastefaults(lv_event_t *e) {
     LV_UNUSED(e);
-    _ui_screen_change(&ui_wastefaults, LV_SCR_LOAD_ANIM_NONE, 0, 0, NULL);
-    cyd_state_apply_to_wastefaults_screen();
+    cyd_screens_show(CYD_SCREEN_WASTEFAULTS);
 }
 
 static void waste_to_wastesettings(lv_event_t *e) {
     LV_UNUSED(e);
-    _ui_screen_change(&ui_wastesettings, LV_SCR_LOAD_ANIM_NONE, 0, 0, NULL);
-    cyd_state_apply_to_wastesettings_screen();
+    cyd_screens_show(CYD_SCREEN_WASTESETTINGS);
 }
 
 // --- Waste Settings ---
 static void wastesettings_to_waste(lv_event_t *e) {
     LV_UNUSED(e);
-    _ui_screen_change(&ui_waste, LV_SCR_LOAD_ANIM_NONE, 0, 0, NULL);
+    cyd_screens_show(CYD_SCREEN_WASTE);
 }
 
 // Waste Settings overlays
@@ -246,7 +236,6 @@ static void wastesettings_show_diag_overlay(lv_event_t *e) {
     lv_obj_clear_flag(ui_wastesettingsDiagnosticOverlay, LV_OBJ_FLAG_HIDDEN);
     _ui_opacity_set(ui_wastesettingsDiagnosticOverlay, 255);
     lv_obj_move_foreground(ui_wastesettingsDiagnosticOverlay);
-    cyd_state_apply_to_wastesettings_diag_overlay();
 }
 
 static void wastesettings_hide_diag_overlay(lv_event_t *e) {
@@ -259,13 +248,8 @@ static void wastesettings_hide_diag_overlay(lv_event_t *e) {
 static void wastesettings_slider_changed(lv_event_t *e) {
     if (!ui_wastesettingsOverlayDrainSlider) return;
     const int32_t v = lv_slider_get_value(ui_wastesettingsOverlayDrainSlider);
-    cyd_state.waste.stop_level_percent = v < 0 ? 0 : (v > 100 ? 100 : static_cast<uint8_t>(v));
-    if (ui_wastesettingsOverlayDrainPercentage) {
-        lv_label_set_text_fmt(ui_wastesettingsOverlayDrainPercentage, "%u%%", cyd_state.waste.stop_level_percent);
-    }
-    if (ui_wastesettingsDrainStopLevelLabel) {
-        lv_label_set_text_fmt(ui_wastesettingsDrainStopLevelLabel, "%u%%", cyd_state.waste.stop_level_percent);
-    }
+    cyd_state_set_stop_level(&cyd_state.waste, v < 0 ? 0 : (v > 100 ? 100 : static_cast<uint8_t>(v)));
+    cyd_state_bind_active();
 }
 
 static void wastesettings_freeze_changed(lv_event_t *e) {
@@ -273,40 +257,41 @@ static void wastesettings_freeze_changed(lv_event_t *e) {
     if (!ui_wastesettingsFreezeProtection) return;
     uint16_t sel = lv_dropdown_get_selected(ui_wastesettingsFreezeProtection);
     if (sel > 5) sel = 0;
-    cyd_state.waste.freeze_setting = static_cast<uint8_t>(sel);
-    cyd_state.waste.freeze_enabled = (sel > 0);
+    cyd_state_set_freeze(&cyd_state.waste, static_cast<uint8_t>(sel));
 }
 
 static void wastesettings_safety_changed(lv_event_t *e) {
     LV_UNUSED(e);
     if (!ui_wastesettingsSafetyOveride) return;
-    cyd_state.waste.safety_override_enabled = lv_obj_has_state(ui_wastesettingsSafetyOveride, LV_STATE_CHECKED);
+    cyd_state_set_safety_override(&cyd_state.waste, lv_obj_has_state(ui_wastesettingsSafetyOveride, LV_STATE_CHECKED));
 }
 
 static void wastesettings_valve_changed(lv_event_t *e) {
     LV_UNUSED(e);
     if (!ui_wastesettingsValveOveride) return;
-    cyd_state.waste.valve_override_enabled = lv_obj_has_state(ui_wastesettingsValveOveride, LV_STATE_CHECKED);
+    cyd_state_set_valve_override(&cyd_state.waste, lv_obj_has_state(ui_wastesettingsValveOveride, LV_STATE_CHECKED));
 }
 
 static void wastesettings_set_full(lv_event_t *e) {
     LV_UNUSED(e);
-    cyd_state.waste.full_voltage_mv = static_cast<uint16_t>((cyd_state.waste.full_voltage_mv + 50) % 5000);
-    if (cyd_state.waste.full_voltage_mv < 1000) cyd_state.waste.full_voltage_mv = 3100;
-    cyd_state_apply_to_wastesettings_screen();
+    uint16_t mv = static_cast<uint16_t>((cyd_state.waste.full_voltage_mv + 50) % 5000);
+    if (mv < 1000) mv = 3100;
+    cyd_state_set_full_voltage(&cyd_state.waste, mv);
+    cyd_state_bind_active();
 }
 
 static void wastesettings_set_empty(lv_event_t *e) {
     LV_UNUSED(e);
-    cyd_state.waste.empty_voltage_mv = static_cast<uint16_t>((cyd_state.waste.empty_voltage_mv + 25) % 2000);
-    if (cyd_state.waste.empty_voltage_mv < 200) cyd_state.waste.empty_voltage_mv = 700;
-    cyd_state_apply_to_wastesettings_screen();
+    uint16_t mv = static_cast<uint16_t>((cyd_state.waste.empty_voltage_mv + 25) % 2000);
+    if (mv < 200) mv = 700;
+    cyd_state_set_empty_voltage(&cyd_state.waste, mv);
+    cyd_state_bind_active();
 }
 
 // --- Waste Faults ---
 static void wastefaults_to_waste(lv_event_t *e) {
     LV_UNUSED(e);
-    _ui_screen_change(&ui_waste, LV_SCR_LOAD_ANIM_NONE, 0, 0, NULL);
+    cyd_screens_show(CYD_SCREEN_WASTE);
 }
 
 // --- Debug: simple level adjustor ---
@@ -315,11 +300,22 @@ static void home_debug_adjust(lv_event_t *e) {
     // Debug disabled in production
 }
 
+
 // Overlay helpers
 
 
-void ui_register_custom_actions() {
-    // --- Boot overlays ---
+// Start building a navigation target while its button is held, so CLICKED only has to load it.
+static void prefetch_screen(lv_event_t *e) {
+    cyd_screens_prefetch(static_cast<cyd_screen_t>(reinterpret_cast<uintptr_t>(lv_event_get_user_data(e))));
+}
+
+static void add_navigation(lv_obj_t *button, lv_event_cb_t handler, cyd_screen_t target) {
+    lv_obj_add_flag(button, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(button, prefetch_screen, LV_EVENT_PRESSED, reinterpret_cast<void *>(static_cast<uintptr_t>(target)));
+    lv_obj_add_event_cb(button, handler, LV_EVENT_CLICKED, NULL);
+}
+
+static void register_boot_actions() {
     if (ui_bootWifiButton) {
         lv_obj_add_event_cb(ui_bootWifiButton, show_boot_wifi, LV_EVENT_CLICKED, NULL);
     }
@@ -333,57 +329,51 @@ void ui_register_custom_actions() {
         lv_obj_add_event_cb(ui_buttonbootdirectback, hide_boot_direct, LV_EVENT_CLICKED, NULL);
     }
     if (ui_buttonBootWifiNext) {
-        lv_obj_add_flag(ui_buttonBootWifiNext, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(ui_buttonBootWifiNext, boot_to_home, LV_EVENT_CLICKED, NULL);
+        add_navigation(ui_buttonBootWifiNext, boot_to_home, CYD_SCREEN_HOME);
     }
     if (ui_buttonbootdirectscan) {
-        lv_obj_add_flag(ui_buttonbootdirectscan, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(ui_buttonbootdirectscan, boot_to_home, LV_EVENT_CLICKED, NULL);
+        add_navigation(ui_buttonbootdirectscan, boot_to_home, CYD_SCREEN_HOME);
     }
+}
 
-    // --- Home  ---
+static void register_home_actions() {
     if (ui_homeCydsettingsButton) {
-        lv_obj_add_flag(ui_homeCydsettingsButton, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(ui_homeCydsettingsButton, home_to_settings, LV_EVENT_CLICKED, NULL);
+        add_navigation(ui_homeCydsettingsButton, home_to_settings, CYD_SCREEN_CYDSETTINGS);
     }
     if (ui_homeFreshButton) {
-        lv_obj_add_flag(ui_homeFreshButton, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(ui_homeFreshButton, home_to_fresh, LV_EVENT_CLICKED, NULL);
+        add_navigation(ui_homeFreshButton, home_to_fresh, CYD_SCREEN_FRESH);
     }
     if (ui_homeWasteCard) {
-        lv_obj_add_flag(ui_homeWasteButton, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(ui_homeWasteButton, home_to_waste, LV_EVENT_CLICKED, NULL);
+        add_navigation(ui_homeWasteButton, home_to_waste, CYD_SCREEN_WASTE);
     }
     // Debug button: tap to cycle levels for visual testing
     if (ui_homeWasteButton) {
         lv_obj_add_event_cb(ui_homeWasteButton, home_debug_adjust, LV_EVENT_LONG_PRESSED, NULL);
     }
+}
 
-    // --- Cyd Settings ---
+static void register_cydsettings_actions() {
     if (ui_cydsettingsBackButton) {
-        lv_obj_add_flag(ui_cydsettingsBackButton, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(ui_cydsettingsBackButton, cydsettings_to_home, LV_EVENT_CLICKED, NULL);
+        add_navigation(ui_cydsettingsBackButton, cydsettings_to_home, CYD_SCREEN_HOME);
     }
+}
 
-    // --- Fresh ---    
+static void register_fresh_actions() {
     if (ui_freshBackButton) {
-        lv_obj_add_flag(ui_freshBackButton, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(ui_freshBackButton, fresh_to_home, LV_EVENT_CLICKED, NULL);
+        add_navigation(ui_freshBackButton, fresh_to_home, CYD_SCREEN_HOME);
     }
     if (ui_freshFaultButton) {
-        lv_obj_add_flag(ui_freshFaultButton, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(ui_freshFaultButton, fresh_to_freshfaults, LV_EVENT_CLICKED, NULL);
-    }
-    if (ui_freshSettingsButton) {       
-        lv_obj_add_flag(ui_freshSettingsButton, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(ui_freshSettingsButton, fresh_to_freshsettings, LV_EVENT_CLICKED, NULL);
-    }       
-    
-    // --- Fresh Settings ---
+        add_navigation(ui_freshFaultButton, fresh_to_freshfaults, CYD_SCREEN_FRESHFAULTS);
+    }
+    if (ui_freshSettingsButton) {
+        add_navigation(ui_freshSettingsButton, fresh_to_freshsettings, CYD_SCREEN_FRESHSETTINGS);
+    }
+}
+
+static void register_freshsettings_actions() {
     if (ui_freshsettingsBackButton) {
-        lv_obj_add_flag(ui_freshsettingsBackButton, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(ui_freshsettingsBackButton, freshsettings_to_fresh, LV_EVENT_CLICKED, NULL);
-    }   
+        add_navigation(ui_freshsettingsBackButton, freshsettings_to_fresh, CYD_SCREEN_FRESH);
+    }
     if (ui_freshsettingsFillLevelButton) {
         lv_obj_add_event_cb(ui_freshsettingsFillLevelButton, freshsettings_show_fill_overlay, LV_EVENT_CLICKED, NULL);
     }
@@ -414,34 +404,30 @@ void ui_register_custom_actions() {
     if (ui_freshsettingsSetEmptyButton) {
         lv_obj_add_event_cb(ui_freshsettingsSetEmptyButton, freshsettings_set_empty, LV_EVENT_CLICKED, NULL);
     }
+}
 
-    // --- Fresh Faults ---
+static void register_freshfaults_actions() {
     if (ui_freshfaultsBackButton) {
-        lv_obj_add_flag(ui_freshfaultsBackButton, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(ui_freshfaultsBackButton, freshfaults_to_fresh, LV_EVENT_CLICKED, NULL);
+        add_navigation(ui_freshfaultsBackButton, freshfaults_to_fresh, CYD_SCREEN_FRESH);
     }
+}
 
-
-    // --- Waste  ---    
+static void register_waste_actions() {
     if (ui_wasteBackButton) {
-        lv_obj_add_flag(ui_wasteBackButton, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(ui_wasteBackButton, waste_to_home, LV_EVENT_CLICKED, NULL);
+        add_navigation(ui_wasteBackButton, waste_to_home, CYD_SCREEN_HOME);
     }
     if (ui_wasteFaultButton) {
-        lv_obj_add_flag(ui_wasteFaultButton, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(ui_wasteFaultButton, waste_to_wastefaults, LV_EVENT_CLICKED, NULL);
-    }
-    if (ui_wasteSettingsButton) {       
-        lv_obj_add_flag(ui_wasteSettingsButton, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(ui_wasteSettingsButton, waste_to_wastesettings, LV_EVENT_CLICKED, NULL);
-    }       
-    
-    
-    // --- Waste Settings ---
+        add_navigation(ui_wasteFaultButton, waste_to_wastefaults, CYD_SCREEN_WASTEFAULTS);
+    }
+    if (ui_wasteSettingsButton) {
+        add_navigation(ui_wasteSettingsButton, waste_to_wastesettings, CYD_SCREEN_WASTESETTINGS);
+    }
+}
+
+static void register_wastesettings_actions() {
     if (ui_wastesettingsBackButton) {
-        lv_obj_add_flag(ui_wastesettingsBackButton, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(ui_wastesettingsBackButton, wastesettings_to_waste, LV_EVENT_CLICKED, NULL);
-    }   
+        add_navigation(ui_wastesettingsBackButton, wastesettings_to_waste, CYD_SCREEN_WASTE);
+    }
     if (ui_wastesettingsDrainLevelButton) {
         lv_obj_add_event_cb(ui_wastesettingsDrainLevelButton, wastesettings_show_drain_overlay, LV_EVENT_CLICKED, NULL);
     }
@@ -472,15 +458,25 @@ void ui_register_custom_actions() {
     if (ui_wastesettingsSetEmptyButton) {
         lv_obj_add_event_cb(ui_wastesettingsSetEmptyButton, wastesettings_set_empty, LV_EVENT_CLICKED, NULL);
     }
+}
 
-
-    // --- Waste Faults ---
+static void register_wastefaults_actions() {
     if (ui_wastefaultsBackButton) {
-        lv_obj_add_flag(ui_wastefaultsBackButton, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(ui_wastefaultsBackButton, wastefaults_to_waste, LV_EVENT_CLICKED, NULL);
-    }   
-    
-
-
+        add_navigation(ui_wastefaultsBackButton, wastefaults_to_waste, CYD_SCREEN_WASTE);
+    }
+}
 
+void ui_register_custom_actions(cyd_screen_t screen) {
+    switch (screen) {
+        case CYD_SCREEN_BOOT: register_boot_actions(); break;
+        case CYD_SCREEN_HOME: register_home_actions(); break;
+        case CYD_SCREEN_CYDSETTINGS: register_cydsettings_actions(); break;
+        case CYD_SCREEN_FRESH: register_fresh_actions(); break;
+        case CYD_SCREEN_FRESHSETTINGS: register_freshsettings_actions(); break;
+        case CYD_SCREEN_FRESHFAULTS: register_freshfaults_actions(); break;
+        case CYD_SCREEN_WASTE: register_waste_actions(); break;
+        case CYD_SCREEN_WASTESETTINGS: register_wastesettings_actions(); break;
+        case CYD_SCREEN_WASTEFAULTS: register_wastefaults_actions(); break;
+        default: break;
+    }
 }
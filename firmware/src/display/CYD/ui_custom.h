@@ -1,6 +1,8 @@
 #pragma once
 
+#include "cyd_screens.h"
+
 // Custom UI bindings that should survive SquareLine regenerations.
-// Call ui_register_custom_actions() after ui_init().
+// Call ui_register_custom_actions() for each screen right after it is built.
 
-void ui_register_custom_actions();
+void ui_register_custom_actions(cyd_screen_t screen);